@@ -0,0 +1,139 @@
+#include "predator_crc.h"
+#include "predator_tables.h"
+#include "predator_crypto_mifare.h"
+#include "predator_crypto_desfire.h"
+
+static const PredatorCrcParams crc_params[PredatorCrcTypeCount] = {
+    [PredatorCrc8] = {"CRC-8/SMBUS", 8, false, 0x00, 0x00, 0xF4},
+    [PredatorCrc16CcittFalse] = {"CRC-16/CCITT-FALSE", 16, false, 0xFFFF, 0x0000, 0x29B1},
+    [PredatorCrc16Xmodem] = {"CRC-16/XMODEM", 16, false, 0x0000, 0x0000, 0x31C3},
+    [PredatorCrc16A] = {"CRC-16/ISO-IEC-14443-3-A", 16, true, 0x6363, 0x0000, 0xBF05},
+    [PredatorCrc16B] = {"CRC-16/ISO-IEC-14443-3-B", 16, true, 0xFFFF, 0xFFFF, 0x906E},
+    [PredatorCrc32Jam] = {"CRC-32/JAMCRC", 32, true, 0xFFFFFFFF, 0x00000000, 0x340BC6D9},
+};
+
+// ========== BYTE-WISE KERNELS ==========
+
+static uint8_t crc8_bytes(uint8_t crc, const uint8_t* data, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        crc = predator_crc8_table[crc ^ data[i]];
+    }
+    return crc;
+}
+
+static uint16_t crc16_msb_bytes(uint16_t crc, const uint8_t* data, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        crc = (uint16_t)((crc << 8) ^ predator_crc16_ccitt_table[(crc >> 8) ^ data[i]]);
+    }
+    return crc;
+}
+
+static uint16_t crc16_lsb_bytes(uint16_t crc, const uint8_t* data, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        crc = (crc >> 8) ^ predator_crc16_8408_table[(crc ^ data[i]) & 0xFF];
+    }
+    return crc;
+}
+
+static uint32_t crc32_lsb_bytes(uint32_t crc, const uint8_t* data, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        crc = (crc >> 8) ^ predator_crc32_table[(crc ^ data[i]) & 0xFF];
+    }
+    return crc;
+}
+
+// ========== SLICE-BY-4 KERNELS ==========
+// slice[k][b] is the CRC of byte b followed by k+1 zero bytes, so four
+// independent lookups replace four dependent ones. Bytes are assembled
+// explicitly: no alignment or endianness assumptions on the buffer.
+
+#if PREDATOR_CRC_SLICE4
+static uint16_t crc16_lsb_slice4(uint16_t crc, const uint8_t* data, size_t len) {
+    while(len >= 4) {
+        const uint16_t x = crc ^ (uint16_t)(data[0] | (data[1] << 8));
+        crc = predator_crc16_8408_slice[2][x & 0xFF] ^ predator_crc16_8408_slice[1][x >> 8] ^
+              predator_crc16_8408_slice[0][data[2]] ^ predator_crc16_8408_table[data[3]];
+        data += 4;
+        len -= 4;
+    }
+    return crc16_lsb_bytes(crc, data, len);
+}
+
+static uint32_t crc32_lsb_slice4(uint32_t crc, const uint8_t* data, size_t len) {
+    while(len >= 4) {
+        crc ^= (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) |
+               ((uint32_t)data[3] << 24);
+        crc = predator_crc32_slice[2][crc & 0xFF] ^ predator_crc32_slice[1][(crc >> 8) & 0xFF] ^
+              predator_crc32_slice[0][(crc >> 16) & 0xFF] ^ predator_crc32_table[crc >> 24];
+        data += 4;
+        len -= 4;
+    }
+    return crc32_lsb_bytes(crc, data, len);
+}
+#endif
+
+// ========== PUBLIC API ==========
+
+const PredatorCrcParams* predator_crc_params(PredatorCrcType type) {
+    if(type >= PredatorCrcTypeCount) return NULL;
+    return &crc_params[type];
+}
+
+uint32_t predator_crc_init(PredatorCrcType type) {
+    if(type >= PredatorCrcTypeCount) return 0;
+    return crc_params[type].init;
+}
+
+uint32_t predator_crc_update_bytewise(PredatorCrcType type, uint32_t crc, const uint8_t* data, size_t len) {
+    if(!data) return crc;
+    switch(type) {
+    case PredatorCrc8:
+        return crc8_bytes((uint8_t)crc, data, len);
+    case PredatorCrc16CcittFalse:
+    case PredatorCrc16Xmodem:
+        return crc16_msb_bytes((uint16_t)crc, data, len);
+    case PredatorCrc16A:
+    case PredatorCrc16B:
+        return crc16_lsb_bytes((uint16_t)crc, data, len);
+    case PredatorCrc32Jam:
+        return crc32_lsb_bytes(crc, data, len);
+    default:
+        return crc;
+    }
+}
+
+uint32_t predator_crc_update(PredatorCrcType type, uint32_t crc, const uint8_t* data, size_t len) {
+#if PREDATOR_CRC_SLICE4
+    if(data && len >= PREDATOR_CRC_SLICE_MIN) {
+        if(type == PredatorCrc16A || type == PredatorCrc16B) {
+            return crc16_lsb_slice4((uint16_t)crc, data, len);
+        }
+        if(type == PredatorCrc32Jam) {
+            return crc32_lsb_slice4(crc, data, len);
+        }
+    }
+#endif
+    return predator_crc_update_bytewise(type, crc, data, len);
+}
+
+uint32_t predator_crc_final(PredatorCrcType type, uint32_t crc) {
+    if(type >= PredatorCrcTypeCount) return crc;
+    return crc ^ crc_params[type].xorout;
+}
+
+uint32_t predator_crc(PredatorCrcType type, const uint8_t* data, size_t len) {
+    uint32_t crc = predator_crc_update(type, predator_crc_init(type), data, len);
+    return predator_crc_final(type, crc);
+}
+
+// ========== PROTOCOL CRCs ==========
+
+// ISO 14443-3 Type A frame CRC, sent LSB first
+uint16_t mifare_crc16(const uint8_t* data, uint32_t len) {
+    return (uint16_t)predator_crc(PredatorCrc16A, data, len);
+}
+
+// DESFire EV1 native-mode CRC32 (JAMCRC: no final inversion), sent LSB first
+uint32_t desfire_crc32(const uint8_t* data, uint32_t len) {
+    return predator_crc(PredatorCrc32Jam, data, len);
+}
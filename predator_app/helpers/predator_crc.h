@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One table-driven CRC engine for every protocol in the app. Each variant is
+// a catalogue CRC (reveng.sourceforge.io names); tables come from
+// tools/gen_tables.py. Reflected variants switch to slice-by-4 (4 bytes per
+// step) for buffers of PREDATOR_CRC_SLICE_MIN bytes and up.
+
+typedef enum {
+    PredatorCrc8, // CRC-8/SMBUS: poly 0x07, init 0x00 (packets use init 0xFF)
+    PredatorCrc16CcittFalse, // CRC-16/IBM-3740: poly 0x1021, init 0xFFFF
+    PredatorCrc16Xmodem, // CRC-16/XMODEM: poly 0x1021, init 0x0000 (FeliCa)
+    PredatorCrc16A, // CRC-16/ISO-IEC-14443-3-A: reflected 0x8408, init 0x6363 (MIFARE)
+    PredatorCrc16B, // CRC-16/ISO-IEC-14443-3-B (X-25): reflected 0x8408, init/xorout 0xFFFF
+    PredatorCrc32Jam, // CRC-32/JAMCRC: reflected 0xEDB88320, init 0xFFFFFFFF, no xorout (DESFire)
+    PredatorCrcTypeCount
+} PredatorCrcType;
+
+typedef struct {
+    const char* name;
+    uint8_t width;
+    bool reflected;
+    uint32_t init;
+    uint32_t xorout;
+    uint32_t check; // CRC of "123456789"
+} PredatorCrcParams;
+
+// Below this length the byte-wise loop is as fast as slice-by-4
+#define PREDATOR_CRC_SLICE_MIN 16
+
+/**
+ * @brief Catalogue parameters for a CRC variant (NULL if type is invalid)
+ */
+const PredatorCrcParams* predator_crc_params(PredatorCrcType type);
+
+/**
+ * @brief Start value for incremental use (init register)
+ */
+uint32_t predator_crc_init(PredatorCrcType type);
+
+/**
+ * @brief Feed data into a running CRC register
+ *
+ * Chunks may be any size; feeding a buffer in pieces gives the same result
+ * as one call.
+ */
+uint32_t predator_crc_update(PredatorCrcType type, uint32_t crc, const uint8_t* data, size_t len);
+
+/**
+ * @brief Apply xorout to a running CRC register
+ */
+uint32_t predator_crc_final(PredatorCrcType type, uint32_t crc);
+
+/**
+ * @brief One-shot CRC of data[0..len)
+ */
+uint32_t predator_crc(PredatorCrcType type, const uint8_t* data, size_t len);
+
+/**
+ * @brief Byte-wise reference for the reflected variants (no slice-by-4)
+ *
+ * Used by the tests to check the sliced kernels; not needed by callers.
+ */
+uint32_t predator_crc_update_bytewise(PredatorCrcType type, uint32_t crc, const uint8_t* data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
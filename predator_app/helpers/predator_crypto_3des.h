@@ -10,12 +10,53 @@
  * PRODUCTION-GRADE IMPLEMENTATION
  * Used by: FeliCa, Calypso, UltraLight C, MIFARE DESFire
  * 
- * Implements 2-key 3DES (112-bit security):
- * - Encrypt with K1, Decrypt with K2, Encrypt with K1 (EDE mode)
- * - ECB and CBC modes
+ * Implements 2-key (112-bit) and 3-key (168-bit) 3DES:
+ * - Encrypt with K1, Decrypt with K2, Encrypt with K3 (EDE mode, K3 = K1 for 2-key)
+ * - ECB and CBC modes, one-shot or on a keyed DES3Context
  * - Key derivation/diversification
  */
 
+#define DES3_BLOCK_SIZE  8
+#define DES3_2KEY_SIZE   16
+#define DES3_3KEY_SIZE   24
+
+// Keyed 3DES: DES key schedules expanded once, reused for every block.
+// Each round key is two words of packed 6-bit S-box inputs (see des_f_function)
+typedef struct {
+    uint32_t subkeys[3][32];  // K1, K2, K3 round keys (K3 = K1 for 2-key)
+} DES3Context;
+
+// ========== KEYED BLOCK API ==========
+
+/**
+ * Expand a 2-key (16 bytes) or 3-key (24 bytes) 3DES key
+ * @param ctx Context to initialize
+ * @param key Key bytes (K1 || K2 [|| K3])
+ * @param key_len DES3_2KEY_SIZE or DES3_3KEY_SIZE
+ * @return false on NULL arguments or unsupported key length
+ */
+bool des3_init(DES3Context* ctx, const uint8_t* key, size_t key_len);
+
+/**
+ * Encrypt/decrypt one 8-byte block with a keyed context (in-place allowed)
+ */
+void des3_encrypt_block(const DES3Context* ctx, const uint8_t* input, uint8_t* output);
+void des3_decrypt_block(const DES3Context* ctx, const uint8_t* input, uint8_t* output);
+
+/**
+ * CBC encryption/decryption with a keyed context
+ * @param ctx Keyed context (2-key or 3-key)
+ * @param iv Chaining value (8 bytes), updated to the last ciphertext block
+ *           so consecutive calls continue one CBC stream
+ * @param input Input data (in-place allowed)
+ * @param output Output buffer (same length as input)
+ * @param length Data length (must be multiple of 8)
+ */
+void des3_cbc_encrypt(const DES3Context* ctx, uint8_t* iv,
+                      const uint8_t* input, uint8_t* output, size_t length);
+void des3_cbc_decrypt(const DES3Context* ctx, uint8_t* iv,
+                      const uint8_t* input, uint8_t* output, size_t length);
+
 // ========== ECB MODE (Electronic Codebook) ==========
 
 /**
@@ -58,6 +99,24 @@ void des3_encrypt_cbc(const uint8_t* key, const uint8_t* iv,
 void des3_decrypt_cbc(const uint8_t* key, const uint8_t* iv,
                      const uint8_t* input, uint8_t* output, size_t length);
 
+// ========== 3-KEY (3K3DES) ==========
+
+/**
+ * 3-key 3DES ECB (24 bytes: K1 || K2 || K3)
+ * Used by: MIFARE DESFire 3K3DES keys, Calypso Rev3 SAM keys
+ */
+void des3_3key_encrypt_ecb(const uint8_t* key, const uint8_t* input, uint8_t* output);
+void des3_3key_decrypt_ecb(const uint8_t* key, const uint8_t* input, uint8_t* output);
+
+/**
+ * 3-key 3DES CBC (24-byte key)
+ * @param length Data length (must be multiple of 8)
+ */
+void des3_3key_encrypt_cbc(const uint8_t* key, const uint8_t* iv,
+                          const uint8_t* input, uint8_t* output, size_t length);
+void des3_3key_decrypt_cbc(const uint8_t* key, const uint8_t* iv,
+                          const uint8_t* input, uint8_t* output, size_t length);
+
 // ========== KEY DERIVATION ==========
 
 /**
@@ -6,74 +6,218 @@
 // PRODUCTION AES - FIPS-197 - Full implementation in predator_crypto_aes_impl.c
 // This file contains high-level wrappers and automotive-specific functions
 
-// Forward declarations (implementations in predator_crypto_aes_impl.c)
-extern bool aes128_init(AESContext* ctx, const uint8_t* key);
-extern bool aes256_init(AESContext* ctx, const uint8_t* key);
-extern bool aes128_encrypt_block(const AESContext* ctx, const uint8_t* plaintext, uint8_t* ciphertext);
-extern bool aes128_decrypt_block(const AESContext* ctx, const uint8_t* ciphertext, uint8_t* plaintext);
-extern bool aes256_encrypt_block(const AESContext* ctx, const uint8_t* plaintext, uint8_t* ciphertext);
-extern bool aes256_decrypt_block(const AESContext* ctx, const uint8_t* ciphertext, uint8_t* plaintext);
-
 // =====================================================
-// HIGH-LEVEL AES FUNCTIONS
+// STREAMING MODES
+// Key schedule is expanded once in *_init; update calls do no key work and
+// no logging, so they can run across thousands of blocks.
 // =====================================================
 
-bool predator_crypto_aes128_encrypt(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* output) {
-    if(!key || !data || !output || len % 16 != 0) return false;
-    
-    AESContext ctx;
-    if(!aes128_init(&ctx, key)) return false;
-    
-    for(size_t i = 0; i < len; i += 16) {
-        if(!aes128_encrypt_block(&ctx, &data[i], &output[i])) return false;
+static void aes_xor_block(uint8_t* dst, const uint8_t* a, const uint8_t* b) {
+    for(int i = 0; i < AES_BLOCK_SIZE; i++) dst[i] = a[i] ^ b[i];
+}
+
+// One whole block through CBC; in and out may alias
+static void aes_cbc_block(AESCbcContext* ctx, const uint8_t* in, uint8_t* out) {
+    if(ctx->encrypt) {
+        aes_xor_block(ctx->iv, ctx->iv, in);
+        aes_encrypt_block(&ctx->aes, ctx->iv, ctx->iv);
+        memcpy(out, ctx->iv, AES_BLOCK_SIZE);
+    } else {
+        uint8_t next_iv[AES_BLOCK_SIZE];
+        memcpy(next_iv, in, AES_BLOCK_SIZE);
+        aes_decrypt_block(&ctx->aes, in, out);
+        aes_xor_block(out, out, ctx->iv);
+        memcpy(ctx->iv, next_iv, AES_BLOCK_SIZE);
     }
-    
-    FURI_LOG_I("AES", "AES-128: Encrypted %u bytes (10 rounds)", (unsigned)len);
+}
+
+bool aes_cbc_init(AESCbcContext* ctx, const uint8_t* key, size_t key_len, const uint8_t* iv, bool encrypt) {
+    if(!ctx || !key || !iv) return false;
+    if(!aes_init(&ctx->aes, key, key_len)) return false;
+    memcpy(ctx->iv, iv, AES_BLOCK_SIZE);
+    ctx->partial_len = 0;
+    ctx->encrypt = encrypt;
     return true;
 }
 
-bool predator_crypto_aes128_decrypt(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* output) {
-    if(!key || !data || !output || len % 16 != 0) return false;
-    
-    AESContext ctx;
-    if(!aes128_init(&ctx, key)) return false;
-    
-    for(size_t i = 0; i < len; i += 16) {
-        if(!aes128_decrypt_block(&ctx, &data[i], &output[i])) return false;
+bool aes_cbc_update(AESCbcContext* ctx, const uint8_t* in, size_t len, uint8_t* out, size_t* out_len) {
+    if(!ctx || (!in && len > 0) || !out || !out_len) return false;
+    size_t written = 0;
+
+    // Top up a block left over from the previous chunk
+    if(ctx->partial_len > 0) {
+        size_t take = AES_BLOCK_SIZE - ctx->partial_len;
+        if(take > len) take = len;
+        memcpy(&ctx->partial[ctx->partial_len], in, take);
+        ctx->partial_len += take;
+        in += take;
+        len -= take;
+        if(ctx->partial_len < AES_BLOCK_SIZE) {
+            *out_len = 0;
+            return true;
+        }
+        aes_cbc_block(ctx, ctx->partial, out);
+        ctx->partial_len = 0;
+        written = AES_BLOCK_SIZE;
     }
-    
-    FURI_LOG_I("AES", "AES-128: Decrypted %u bytes", (unsigned)len);
+
+    while(len >= AES_BLOCK_SIZE) {
+        aes_cbc_block(ctx, in, &out[written]);
+        in += AES_BLOCK_SIZE;
+        len -= AES_BLOCK_SIZE;
+        written += AES_BLOCK_SIZE;
+    }
+
+    if(len > 0) {
+        memcpy(ctx->partial, in, len);
+        ctx->partial_len = len;
+    }
+    *out_len = written;
     return true;
 }
 
-bool predator_crypto_aes256_encrypt(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* output) {
-    if(!key || !data || !output || len % 16 != 0) return false;
-    
-    AESContext ctx;
-    if(!aes256_init(&ctx, key)) return false;
-    
-    for(size_t i = 0; i < len; i += 16) {
-        if(!aes256_encrypt_block(&ctx, &data[i], &output[i])) return false;
+bool aes_cbc_final(AESCbcContext* ctx) {
+    if(!ctx) return false;
+    bool aligned = ctx->partial_len == 0;
+    memset(ctx, 0, sizeof(*ctx));
+    return aligned;
+}
+
+static AesImpl aes_impl = AesImplTable;
+
+bool aes_select_impl(AesImpl impl) {
+#if PREDATOR_AES_BITSLICE
+    if(impl != AesImplTable && impl != AesImplBitsliced) return false;
+#else
+    if(impl != AesImplTable) return false;
+#endif
+    aes_impl = impl;
+    return true;
+}
+
+AesImpl aes_get_impl(void) {
+    return aes_impl;
+}
+
+bool aes_ctr_init(AESCtrContext* ctx, const uint8_t* key, size_t key_len, const uint8_t* counter) {
+    if(!ctx || !key || !counter) return false;
+    if(!aes_init(&ctx->aes, key, key_len)) return false;
+    memcpy(ctx->counter, counter, AES_BLOCK_SIZE);
+    ctx->keystream_used = AES_BLOCK_SIZE;
+#if PREDATOR_AES_BITSLICE
+    ctx->bitsliced = aes_impl == AesImplBitsliced;
+    if(ctx->bitsliced) aes_bitsliced_expand(&ctx->aes, ctx->bs_keys);
+#endif
+    return true;
+}
+
+static inline void aes_ctr_increment(uint8_t* counter) {
+    for(int i = AES_BLOCK_SIZE - 1; i >= 0; i--) {
+        if(++counter[i] != 0) break;
+    }
+}
+
+static void aes_ctr_next_keystream(AESCtrContext* ctx) {
+    aes_encrypt_block(&ctx->aes, ctx->counter, ctx->keystream);
+    aes_ctr_increment(ctx->counter);
+    ctx->keystream_used = 0;
+}
+
+bool aes_ctr_update(AESCtrContext* ctx, const uint8_t* in, size_t len, uint8_t* out) {
+    if(!ctx || (len > 0 && (!in || !out))) return false;
+
+    // Drain keystream left over from the previous chunk
+    while(len > 0 && ctx->keystream_used < AES_BLOCK_SIZE) {
+        *out++ = *in++ ^ ctx->keystream[ctx->keystream_used++];
+        len--;
+    }
+
+#if PREDATOR_AES_BITSLICE
+    // Eight counter blocks per pass; the keystream is built in place of
+    // the counters and XORed word-wise
+    if(ctx->bitsliced) {
+        uint64_t batch[AES_BITSLICED_BATCH / sizeof(uint64_t)];
+        while(len >= AES_BITSLICED_BATCH) {
+            uint8_t* ks = (uint8_t*)batch;
+            for(int blk = 0; blk < 8; blk++) {
+                memcpy(&ks[blk * AES_BLOCK_SIZE], ctx->counter, AES_BLOCK_SIZE);
+                aes_ctr_increment(ctx->counter);
+            }
+            aes_bitsliced_encrypt8(ctx->bs_keys, ctx->aes.num_rounds, ks, ks);
+            for(size_t i = 0; i < COUNT_OF(batch); i++) {
+                uint64_t v;
+                memcpy(&v, &in[i * sizeof(v)], sizeof(v));
+                v ^= batch[i];
+                memcpy(&out[i * sizeof(v)], &v, sizeof(v));
+            }
+            in += AES_BITSLICED_BATCH;
+            out += AES_BITSLICED_BATCH;
+            len -= AES_BITSLICED_BATCH;
+        }
+        memset(batch, 0, sizeof(batch));
+    }
+#endif
+
+    while(len >= AES_BLOCK_SIZE) {
+        aes_ctr_next_keystream(ctx);
+        aes_xor_block(out, in, ctx->keystream);
+        ctx->keystream_used = AES_BLOCK_SIZE;
+        in += AES_BLOCK_SIZE;
+        out += AES_BLOCK_SIZE;
+        len -= AES_BLOCK_SIZE;
+    }
+
+    if(len > 0) {
+        aes_ctr_next_keystream(ctx);
+        while(len > 0) {
+            *out++ = *in++ ^ ctx->keystream[ctx->keystream_used++];
+            len--;
+        }
     }
-    
-    FURI_LOG_I("AES", "AES-256: Encrypted %u bytes (14 rounds)", (unsigned)len);
     return true;
 }
 
-bool predator_crypto_aes256_decrypt(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* output) {
-    if(!key || !data || !output || len % 16 != 0) return false;
-    
+void aes_ctr_final(AESCtrContext* ctx) {
+    if(ctx) memset(ctx, 0, sizeof(*ctx));
+}
+
+// =====================================================
+// HIGH-LEVEL AES FUNCTIONS
+// =====================================================
+
+static bool aes_ecb(const uint8_t* key, size_t key_len, const uint8_t* data, size_t len, uint8_t* output, bool encrypt) {
+    if(!key || !data || !output || len % AES_BLOCK_SIZE != 0) return false;
+
     AESContext ctx;
-    if(!aes256_init(&ctx, key)) return false;
-    
-    for(size_t i = 0; i < len; i += 16) {
-        if(!aes256_decrypt_block(&ctx, &data[i], &output[i])) return false;
+    if(!aes_init(&ctx, key, key_len)) return false;
+
+    for(size_t i = 0; i < len; i += AES_BLOCK_SIZE) {
+        if(encrypt) {
+            aes_encrypt_block(&ctx, &data[i], &output[i]);
+        } else {
+            aes_decrypt_block(&ctx, &data[i], &output[i]);
+        }
     }
-    
-    FURI_LOG_I("AES", "AES-256: Decrypted %u bytes", (unsigned)len);
+    memset(&ctx, 0, sizeof(ctx));
     return true;
 }
 
+bool predator_crypto_aes128_encrypt(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* output) {
+    return aes_ecb(key, AES128_KEY_SIZE, data, len, output, true);
+}
+
+bool predator_crypto_aes128_decrypt(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* output) {
+    return aes_ecb(key, AES128_KEY_SIZE, data, len, output, false);
+}
+
+bool predator_crypto_aes256_encrypt(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* output) {
+    return aes_ecb(key, AES256_KEY_SIZE, data, len, output, true);
+}
+
+bool predator_crypto_aes256_decrypt(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* output) {
+    return aes_ecb(key, AES256_KEY_SIZE, data, len, output, false);
+}
+
 // =====================================================
 // AUTOMOTIVE-SPECIFIC AES FUNCTIONS
 // =====================================================
@@ -83,7 +227,7 @@ bool aes_tesla_challenge_response(PredatorApp* app, const uint8_t* vehicle_key,
     if(!app || !vehicle_key || !challenge || !response) return false;
     
     // Tesla uses AES-256 for challenge-response
-    FURI_LOG_I("AES", "TESLA: Generating challenge-response (AES-256)");
+    FURI_LOG_D("AES", "TESLA: Generating challenge-response (AES-256)");
     
     // Encrypt challenge with vehicle key
     return predator_crypto_aes256_encrypt(vehicle_key, challenge, 16, response);
@@ -94,7 +238,7 @@ bool aes_bmw_authenticate(PredatorApp* app, const uint8_t* key,
     if(!app || !key || !vehicle_id || !auth_token) return false;
     
     // BMW uses AES-128 with vehicle ID
-    FURI_LOG_I("AES", "BMW: Authenticating with AES-128");
+    FURI_LOG_D("AES", "BMW: Authenticating with AES-128");
     
     uint8_t plaintext[16];
     memcpy(plaintext, vehicle_id, 8);
@@ -109,7 +253,7 @@ bool aes_mercedes_encrypt_packet(const uint8_t* key, const uint8_t* packet_data,
                                  size_t len, uint8_t* encrypted_out) {
     if(!key || !packet_data || !encrypted_out || len % 16 != 0) return false;
     
-    FURI_LOG_I("AES", "MERCEDES: Encrypting packet (AES-128)");
+    FURI_LOG_D("AES", "MERCEDES: Encrypting packet (AES-128)");
     return predator_crypto_aes128_encrypt(key, packet_data, len, encrypted_out);
 }
 
@@ -154,93 +298,34 @@ void aes_generate_iv(uint8_t* iv) {
     }
 }
 
-// CBC Mode implementations
+// CBC Mode implementations (one-shot wrappers over the streaming API)
+static bool aes_cbc_oneshot(const uint8_t* key, size_t key_len, const uint8_t* iv,
+                            const uint8_t* data, size_t len, uint8_t* output, bool encrypt) {
+    if(!key || !iv || !data || !output || len % AES_BLOCK_SIZE != 0) return false;
+
+    AESCbcContext ctx;
+    size_t written;
+    if(!aes_cbc_init(&ctx, key, key_len, iv, encrypt)) return false;
+    aes_cbc_update(&ctx, data, len, output, &written);
+    return aes_cbc_final(&ctx);
+}
+
 bool predator_crypto_aes128_cbc_encrypt(const uint8_t* key, const uint8_t* iv,
                                         const uint8_t* data, size_t len, uint8_t* output) {
-    if(!key || !iv || !data || !output || len % 16 != 0) return false;
-    
-    AESContext ctx;
-    if(!aes128_init(&ctx, key)) return false;
-    
-    uint8_t block[16];
-    memcpy(block, iv, 16);
-    
-    for(size_t i = 0; i < len; i += 16) {
-        for(int j = 0; j < 16; j++) {
-            block[j] ^= data[i + j];
-        }
-        if(!aes128_encrypt_block(&ctx, block, &output[i])) return false;
-        memcpy(block, &output[i], 16);
-    }
-    
-    FURI_LOG_I("AES", "AES-128 CBC: Encrypted %u bytes", (unsigned)len);
-    return true;
+    return aes_cbc_oneshot(key, AES128_KEY_SIZE, iv, data, len, output, true);
 }
 
 bool predator_crypto_aes128_cbc_decrypt(const uint8_t* key, const uint8_t* iv,
                                         const uint8_t* data, size_t len, uint8_t* output) {
-    if(!key || !iv || !data || !output || len % 16 != 0) return false;
-    
-    AESContext ctx;
-    if(!aes128_init(&ctx, key)) return false;
-    
-    uint8_t block[16], prev[16];
-    memcpy(prev, iv, 16);
-    
-    for(size_t i = 0; i < len; i += 16) {
-        memcpy(block, &data[i], 16);
-        if(!aes128_decrypt_block(&ctx, &data[i], &output[i])) return false;
-        for(int j = 0; j < 16; j++) {
-            output[i + j] ^= prev[j];
-        }
-        memcpy(prev, block, 16);
-    }
-    
-    FURI_LOG_I("AES", "AES-128 CBC: Decrypted %u bytes", (unsigned)len);
-    return true;
+    return aes_cbc_oneshot(key, AES128_KEY_SIZE, iv, data, len, output, false);
 }
 
 bool predator_crypto_aes256_cbc_encrypt(const uint8_t* key, const uint8_t* iv,
                                         const uint8_t* data, size_t len, uint8_t* output) {
-    if(!key || !iv || !data || !output || len % 16 != 0) return false;
-    
-    AESContext ctx;
-    if(!aes256_init(&ctx, key)) return false;
-    
-    uint8_t block[16];
-    memcpy(block, iv, 16);
-    
-    for(size_t i = 0; i < len; i += 16) {
-        for(int j = 0; j < 16; j++) {
-            block[j] ^= data[i + j];
-        }
-        if(!aes256_encrypt_block(&ctx, block, &output[i])) return false;
-        memcpy(block, &output[i], 16);
-    }
-    
-    FURI_LOG_I("AES", "AES-256 CBC: Encrypted %u bytes", (unsigned)len);
-    return true;
+    return aes_cbc_oneshot(key, AES256_KEY_SIZE, iv, data, len, output, true);
 }
 
 bool predator_crypto_aes256_cbc_decrypt(const uint8_t* key, const uint8_t* iv,
                                         const uint8_t* data, size_t len, uint8_t* output) {
-    if(!key || !iv || !data || !output || len % 16 != 0) return false;
-    
-    AESContext ctx;
-    if(!aes256_init(&ctx, key)) return false;
-    
-    uint8_t block[16], prev[16];
-    memcpy(prev, iv, 16);
-    
-    for(size_t i = 0; i < len; i += 16) {
-        memcpy(block, &data[i], 16);
-        if(!aes256_decrypt_block(&ctx, &data[i], &output[i])) return false;
-        for(int j = 0; j < 16; j++) {
-            output[i + j] ^= prev[j];
-        }
-        memcpy(prev, block, 16);
-    }
-    
-    FURI_LOG_I("AES", "AES-256 CBC: Decrypted %u bytes", (unsigned)len);
-    return true;
+    return aes_cbc_oneshot(key, AES256_KEY_SIZE, iv, data, len, output, false);
 }
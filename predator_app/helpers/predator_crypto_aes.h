@@ -26,9 +26,19 @@ struct PredatorApp;
 #define AES128_ROUNDS 10
 #define AES256_ROUNDS 14
 
-// AES context for encryption/decryption
+// 8-block bitsliced encryption for bulk CTR. Off on the device (the table
+// core is faster on Cortex-M4 and the CTR context grows by 1.9 KB); host
+// builds that reprocess captures set it to 1 and pick it with
+// aes_select_impl. It only beats the tables where SSSE3 or NEON is enabled
+#ifndef PREDATOR_AES_BITSLICE
+#define PREDATOR_AES_BITSLICE 0
+#endif
+
+// AES context for encryption/decryption. Both schedules are expanded once in
+// aes*_init, so per-block calls do no key work.
 typedef struct {
-    uint8_t round_keys[240];  // Expanded key schedule (max 15 rounds * 16 bytes)
+    uint32_t enc_keys[60];    // Encryption schedule, big-endian words (max 15 round keys)
+    uint32_t dec_keys[60];    // Equivalent inverse cipher schedule (FIPS-197 5.3.5)
     uint8_t num_rounds;       // 10 for AES-128, 14 for AES-256
     bool is_aes256;           // Key size flag
 } AESContext;
@@ -87,6 +97,129 @@ bool aes256_encrypt_block(const AESContext* ctx, const uint8_t* plaintext, uint8
  */
 bool aes256_decrypt_block(const AESContext* ctx, const uint8_t* ciphertext, uint8_t* plaintext);
 
+/**
+ * Initialize from a 16- or 32-byte key (AES-128 or AES-256)
+ * @param ctx AES context to initialize
+ * @param key Key bytes
+ * @param key_len AES128_KEY_SIZE or AES256_KEY_SIZE
+ * @return false on NULL arguments or unsupported key length
+ */
+bool aes_init(AESContext* ctx, const uint8_t* key, size_t key_len);
+
+/**
+ * Encrypt/decrypt one block with either key size (in-place allowed)
+ */
+void aes_encrypt_block(const AESContext* ctx, const uint8_t* in, uint8_t* out);
+void aes_decrypt_block(const AESContext* ctx, const uint8_t* in, uint8_t* out);
+
+// ========== Streaming Modes (init once, update many) ==========
+
+// CBC stream. Input may arrive in chunks of any size; whole blocks are
+// processed as soon as they are complete and the remainder is buffered.
+// out may equal in when every chunk is a multiple of 16 bytes.
+typedef struct {
+    AESContext aes;
+    uint8_t iv[AES_BLOCK_SIZE];       // Chaining value (previous ciphertext block)
+    uint8_t partial[AES_BLOCK_SIZE];  // Buffered input, not yet a whole block
+    uint8_t partial_len;
+    bool encrypt;
+} AESCbcContext;
+
+// CTR stream (SP 800-38A, 128-bit big-endian counter). Encryption and
+// decryption are the same operation; any chunk size, in-place always allowed.
+typedef struct {
+    AESContext aes;
+    uint8_t counter[AES_BLOCK_SIZE];    // Next counter block
+    uint8_t keystream[AES_BLOCK_SIZE];  // Current keystream block
+    uint8_t keystream_used;             // Bytes of keystream consumed (16 = none left)
+#if PREDATOR_AES_BITSLICE
+    bool bitsliced;                     // Implementation chosen at init
+    uint64_t bs_keys[(AES256_ROUNDS + 1) * 16];  // Bitsliced round keys
+#endif
+} AESCtrContext;
+
+/**
+ * Start a CBC stream
+ * @param ctx Stream context
+ * @param key 16- or 32-byte key
+ * @param key_len Key length
+ * @param iv 16-byte initialization vector
+ * @param encrypt true to encrypt, false to decrypt
+ * @return true if successful
+ */
+bool aes_cbc_init(AESCbcContext* ctx, const uint8_t* key, size_t key_len, const uint8_t* iv, bool encrypt);
+
+/**
+ * Feed data into a CBC stream
+ * @param ctx Stream context
+ * @param in Input chunk
+ * @param len Chunk length (any size)
+ * @param out Output buffer (room for len + 15 bytes)
+ * @param out_len Bytes written to out (whole blocks only)
+ * @return true if successful
+ */
+bool aes_cbc_update(AESCbcContext* ctx, const uint8_t* in, size_t len, uint8_t* out, size_t* out_len);
+
+/**
+ * Finish a CBC stream and wipe the context
+ * @return false if a partial block was left over (input not block aligned)
+ */
+bool aes_cbc_final(AESCbcContext* ctx);
+
+/**
+ * Start a CTR stream
+ * @param ctx Stream context
+ * @param key 16- or 32-byte key
+ * @param key_len Key length
+ * @param counter 16-byte initial counter block (nonce || counter)
+ * @return true if successful
+ */
+bool aes_ctr_init(AESCtrContext* ctx, const uint8_t* key, size_t key_len, const uint8_t* counter);
+
+/**
+ * Encrypt or decrypt len bytes (out may equal in)
+ */
+bool aes_ctr_update(AESCtrContext* ctx, const uint8_t* in, size_t len, uint8_t* out);
+
+/**
+ * Wipe a CTR stream context
+ */
+void aes_ctr_final(AESCtrContext* ctx);
+
+// ========== Implementation Selection ==========
+
+typedef enum {
+    AesImplTable,       // 32-bit T-table rounds (default, device)
+    AesImplBitsliced,   // 8 blocks per pass, CTR bulk only
+} AesImpl;
+
+/**
+ * Choose the core used by CTR streams started after this call
+ * @return false if impl is not built in (PREDATOR_AES_BITSLICE=0)
+ */
+bool aes_select_impl(AesImpl impl);
+
+/**
+ * Core new CTR streams will use
+ */
+AesImpl aes_get_impl(void);
+
+#if PREDATOR_AES_BITSLICE
+#define AES_BITSLICED_ROUND_WORDS 16
+#define AES_BITSLICED_BATCH (8 * AES_BLOCK_SIZE)
+
+/**
+ * Convert the encryption schedule of ctx to bitsliced round keys
+ * @param bs_keys Output, (num_rounds + 1) * AES_BITSLICED_ROUND_WORDS words
+ */
+void aes_bitsliced_expand(const AESContext* ctx, uint64_t* bs_keys);
+
+/**
+ * Encrypt 8 consecutive blocks (128 bytes, in-place allowed)
+ */
+void aes_bitsliced_encrypt8(const uint64_t* bs_keys, uint8_t num_rounds, const uint8_t* in, uint8_t* out);
+#endif
+
 // ========== High-Level Encryption Functions ==========
 
 /**
@@ -1,167 +1,202 @@
 #include "predator_crypto_aes.h"
+#include "predator_tables.h"
 #include <string.h>
 
-// AES Core Implementation - S-boxes and transformations
-// Separated for memory optimization
-
-static const uint8_t sbox[256] = {
-    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
-    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
-    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
-    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
-    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
-    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
-    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
-    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
-    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
-    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
-    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
-    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
-    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
-    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
-    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
-    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
-};
-
-static const uint8_t inv_sbox[256] = {
-    0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38, 0xBF, 0x40, 0xA3, 0x9E, 0x81, 0xF3, 0xD7, 0xFB,
-    0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87, 0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB,
-    0x54, 0x7B, 0x94, 0x32, 0xA6, 0xC2, 0x23, 0x3D, 0xEE, 0x4C, 0x95, 0x0B, 0x42, 0xFA, 0xC3, 0x4E,
-    0x08, 0x2E, 0xA1, 0x66, 0x28, 0xD9, 0x24, 0xB2, 0x76, 0x5B, 0xA2, 0x49, 0x6D, 0x8B, 0xD1, 0x25,
-    0x72, 0xF8, 0xF6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xD4, 0xA4, 0x5C, 0xCC, 0x5D, 0x65, 0xB6, 0x92,
-    0x6C, 0x70, 0x48, 0x50, 0xFD, 0xED, 0xB9, 0xDA, 0x5E, 0x15, 0x46, 0x57, 0xA7, 0x8D, 0x9D, 0x84,
-    0x90, 0xD8, 0xAB, 0x00, 0x8C, 0xBC, 0xD3, 0x0A, 0xF7, 0xE4, 0x58, 0x05, 0xB8, 0xB3, 0x45, 0x06,
-    0xD0, 0x2C, 0x1E, 0x8F, 0xCA, 0x3F, 0x0F, 0x02, 0xC1, 0xAF, 0xBD, 0x03, 0x01, 0x13, 0x8A, 0x6B,
-    0x3A, 0x91, 0x11, 0x41, 0x4F, 0x67, 0xDC, 0xEA, 0x97, 0xF2, 0xCF, 0xCE, 0xF0, 0xB4, 0xE6, 0x73,
-    0x96, 0xAC, 0x74, 0x22, 0xE7, 0xAD, 0x35, 0x85, 0xE2, 0xF9, 0x37, 0xE8, 0x1C, 0x75, 0xDF, 0x6E,
-    0x47, 0xF1, 0x1A, 0x71, 0x1D, 0x29, 0xC5, 0x89, 0x6F, 0xB7, 0x62, 0x0E, 0xAA, 0x18, 0xBE, 0x1B,
-    0xFC, 0x56, 0x3E, 0x4B, 0xC6, 0xD2, 0x79, 0x20, 0x9A, 0xDB, 0xC0, 0xFE, 0x78, 0xCD, 0x5A, 0xF4,
-    0x1F, 0xDD, 0xA8, 0x33, 0x88, 0x07, 0xC7, 0x31, 0xB1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xEC, 0x5F,
-    0x60, 0x51, 0x7F, 0xA9, 0x19, 0xB5, 0x4A, 0x0D, 0x2D, 0xE5, 0x7A, 0x9F, 0x93, 0xC9, 0x9C, 0xEF,
-    0xA0, 0xE0, 0x3B, 0x4D, 0xAE, 0x2A, 0xF5, 0xB0, 0xC8, 0xEB, 0xBB, 0x3C, 0x83, 0x53, 0x99, 0x61,
-    0x17, 0x2B, 0x04, 0x7E, 0xBA, 0x77, 0xD6, 0x26, 0xE1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0C, 0x7D
-};
-
-static const uint8_t rcon[15] = {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36, 0x6C, 0xD8, 0xAB, 0x4D};
-
-static uint8_t gf_mul2(uint8_t x) { return (x & 0x80) ? ((x << 1) ^ 0x1B) : (x << 1); }
-
-static void sub_bytes(uint8_t* s) { for(int i=0; i<16; i++) s[i] = sbox[s[i]]; }
-static void inv_sub_bytes(uint8_t* s) { for(int i=0; i<16; i++) s[i] = inv_sbox[s[i]]; }
-
-static void shift_rows(uint8_t* s) {
-    uint8_t t = s[1]; s[1] = s[5]; s[5] = s[9]; s[9] = s[13]; s[13] = t;
-    t = s[2]; s[2] = s[10]; s[10] = t; t = s[6]; s[6] = s[14]; s[14] = t;
-    t = s[15]; s[15] = s[11]; s[11] = s[7]; s[7] = s[3]; s[3] = t;
-}
-
-static void inv_shift_rows(uint8_t* s) {
-    uint8_t t = s[13]; s[13] = s[9]; s[9] = s[5]; s[5] = s[1]; s[1] = t;
-    t = s[2]; s[2] = s[10]; s[10] = t; t = s[6]; s[6] = s[14]; s[14] = t;
-    t = s[3]; s[3] = s[7]; s[7] = s[11]; s[11] = s[15]; s[15] = t;
-}
-
-static void mix_columns(uint8_t* s) {
-    uint8_t t[16]; memcpy(t, s, 16);
-    for(int i=0; i<4; i++) {
-        int c = i*4;
-        s[c+0] = gf_mul2(t[c+0]) ^ (gf_mul2(t[c+1])^t[c+1]) ^ t[c+2] ^ t[c+3];
-        s[c+1] = t[c+0] ^ gf_mul2(t[c+1]) ^ (gf_mul2(t[c+2])^t[c+2]) ^ t[c+3];
-        s[c+2] = t[c+0] ^ t[c+1] ^ gf_mul2(t[c+2]) ^ (gf_mul2(t[c+3])^t[c+3]);
-        s[c+3] = (gf_mul2(t[c+0])^t[c+0]) ^ t[c+1] ^ t[c+2] ^ gf_mul2(t[c+3]);
-    }
+// AES Core Implementation - 32-bit T-table rounds
+// Separated for memory optimization. Tables are generated by
+// tools/gen_tables.py: by default only Te0/Td0 (2 KB) are stored and the
+// other three columns are rotations; PREDATOR_AES_FULL_TABLES=1 trades 6 KB
+// more .rodata for dropping the rotates.
+
+static const uint8_t rcon[10] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36};
+
+static inline uint32_t ror32(uint32_t x, unsigned n) {
+    return (x >> n) | (x << (32 - n));
 }
 
-static void inv_mix_columns(uint8_t* s) {
-    uint8_t t[16]; memcpy(t, s, 16);
-    for(int i=0; i<4; i++) {
-        int c = i*4;
-        uint8_t a=t[c], b=t[c+1], c2=t[c+2], d=t[c+3];
-        s[c+0] = gf_mul2(gf_mul2(gf_mul2(a)^a)^a) ^ gf_mul2(gf_mul2(gf_mul2(b))^b) ^ gf_mul2(gf_mul2(c2)^c2) ^ gf_mul2(gf_mul2(gf_mul2(d)));
-        s[c+1] = gf_mul2(gf_mul2(gf_mul2(a))) ^ gf_mul2(gf_mul2(gf_mul2(b)^b)^b) ^ gf_mul2(gf_mul2(gf_mul2(c2))^c2) ^ gf_mul2(gf_mul2(d)^d);
-        s[c+2] = gf_mul2(gf_mul2(a)^a) ^ gf_mul2(gf_mul2(gf_mul2(b))) ^ gf_mul2(gf_mul2(gf_mul2(c2)^c2)^c2) ^ gf_mul2(gf_mul2(gf_mul2(d))^d);
-        s[c+3] = gf_mul2(gf_mul2(gf_mul2(a))^a) ^ gf_mul2(gf_mul2(b)^b) ^ gf_mul2(gf_mul2(gf_mul2(c2))) ^ gf_mul2(gf_mul2(gf_mul2(d)^d)^d);
-    }
+#if PREDATOR_AES_FULL_TABLES
+#define TE0(x) predator_aes_te0[(x) & 0xFF]
+#define TE1(x) predator_aes_te_rot[0][(x) & 0xFF]
+#define TE2(x) predator_aes_te_rot[1][(x) & 0xFF]
+#define TE3(x) predator_aes_te_rot[2][(x) & 0xFF]
+#define TD0(x) predator_aes_td0[(x) & 0xFF]
+#define TD1(x) predator_aes_td_rot[0][(x) & 0xFF]
+#define TD2(x) predator_aes_td_rot[1][(x) & 0xFF]
+#define TD3(x) predator_aes_td_rot[2][(x) & 0xFF]
+#else
+#define TE0(x) predator_aes_te0[(x) & 0xFF]
+#define TE1(x) ror32(predator_aes_te0[(x) & 0xFF], 8)
+#define TE2(x) ror32(predator_aes_te0[(x) & 0xFF], 16)
+#define TE3(x) ror32(predator_aes_te0[(x) & 0xFF], 24)
+#define TD0(x) predator_aes_td0[(x) & 0xFF]
+#define TD1(x) ror32(predator_aes_td0[(x) & 0xFF], 8)
+#define TD2(x) ror32(predator_aes_td0[(x) & 0xFF], 16)
+#define TD3(x) ror32(predator_aes_td0[(x) & 0xFF], 24)
+#endif
+
+static inline uint32_t load_be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
 }
 
-static void add_round_key(uint8_t* s, const uint8_t* k) { for(int i=0; i<16; i++) s[i] ^= k[i]; }
+static inline void store_be32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
 
-bool aes128_init(AESContext* ctx, const uint8_t* key) {
-    if(!ctx || !key) return false;
-    ctx->num_rounds = 10; ctx->is_aes256 = false;
-    memcpy(ctx->round_keys, key, 16);
-    for(int i=4; i<44; i++) {
-        uint8_t *p = &ctx->round_keys[(i-1)*4], *c = &ctx->round_keys[i*4];
-        if(i%4 == 0) {
-            c[0]=sbox[p[1]]^rcon[i/4]; c[1]=sbox[p[2]]; c[2]=sbox[p[3]]; c[3]=sbox[p[0]];
-            uint8_t *b4 = &ctx->round_keys[(i-4)*4];
-            for(int j=0; j<4; j++) c[j] ^= b4[j];
-        } else {
-            uint8_t *b4 = &ctx->round_keys[(i-4)*4];
-            for(int j=0; j<4; j++) c[j] = p[j] ^ b4[j];
+// SubWord(RotWord(w)) for the key schedule
+static inline uint32_t sub_rot_word(uint32_t w) {
+    return ((uint32_t)predator_aes_sbox[(w >> 16) & 0xFF] << 24) |
+           ((uint32_t)predator_aes_sbox[(w >> 8) & 0xFF] << 16) |
+           ((uint32_t)predator_aes_sbox[w & 0xFF] << 8) | predator_aes_sbox[w >> 24];
+}
+
+static inline uint32_t sub_word(uint32_t w) {
+    return ((uint32_t)predator_aes_sbox[w >> 24] << 24) |
+           ((uint32_t)predator_aes_sbox[(w >> 16) & 0xFF] << 16) |
+           ((uint32_t)predator_aes_sbox[(w >> 8) & 0xFF] << 8) | predator_aes_sbox[w & 0xFF];
+}
+
+// InvMixColumns on one key word: Td(S(b)) cancels the InvSubBytes in Td
+static inline uint32_t inv_mix_word(uint32_t w) {
+    return TD0(predator_aes_sbox[w >> 24]) ^ TD1(predator_aes_sbox[(w >> 16) & 0xFF]) ^
+           TD2(predator_aes_sbox[(w >> 8) & 0xFF]) ^ TD3(predator_aes_sbox[w & 0xFF]);
+}
+
+// Equivalent inverse cipher schedule: round keys in reverse order with
+// InvMixColumns applied to rounds 1..Nr-1, so decryption runs the same
+// table-round shape as encryption
+static void expand_decrypt_keys(AESContext* ctx) {
+    const int nr = ctx->num_rounds;
+    for(int r = 0; r <= nr; r++) {
+        const uint32_t* src = &ctx->enc_keys[(nr - r) * 4];
+        uint32_t* dst = &ctx->dec_keys[r * 4];
+        for(int j = 0; j < 4; j++) {
+            dst[j] = (r == 0 || r == nr) ? src[j] : inv_mix_word(src[j]);
         }
     }
+}
+
+static bool expand_keys(AESContext* ctx, const uint8_t* key, int nk, int nr) {
+    uint32_t* w = ctx->enc_keys;
+    ctx->num_rounds = (uint8_t)nr;
+    ctx->is_aes256 = (nk == 8);
+    for(int i = 0; i < nk; i++) w[i] = load_be32(&key[i * 4]);
+    for(int i = nk; i < 4 * (nr + 1); i++) {
+        uint32_t t = w[i - 1];
+        if(i % nk == 0) {
+            t = sub_rot_word(t) ^ ((uint32_t)rcon[i / nk - 1] << 24);
+        } else if(nk == 8 && i % nk == 4) {
+            t = sub_word(t);
+        }
+        w[i] = w[i - nk] ^ t;
+    }
+    expand_decrypt_keys(ctx);
     return true;
 }
 
+bool aes128_init(AESContext* ctx, const uint8_t* key) {
+    if(!ctx || !key) return false;
+    return expand_keys(ctx, key, 4, AES128_ROUNDS);
+}
+
 bool aes256_init(AESContext* ctx, const uint8_t* key) {
     if(!ctx || !key) return false;
-    ctx->num_rounds = 14; ctx->is_aes256 = true;
-    memcpy(ctx->round_keys, key, 32);
-    for(int i=8; i<60; i++) {
-        uint8_t *p = &ctx->round_keys[(i-1)*4], *c = &ctx->round_keys[i*4];
-        if(i%8 == 0) {
-            c[0]=sbox[p[1]]^rcon[i/8]; c[1]=sbox[p[2]]; c[2]=sbox[p[3]]; c[3]=sbox[p[0]];
-            uint8_t *b8 = &ctx->round_keys[(i-8)*4];
-            for(int j=0; j<4; j++) c[j] ^= b8[j];
-        } else if(i%8 == 4) {
-            for(int j=0; j<4; j++) c[j] = sbox[p[j]];
-            uint8_t *b8 = &ctx->round_keys[(i-8)*4];
-            for(int j=0; j<4; j++) c[j] ^= b8[j];
-        } else {
-            uint8_t *b8 = &ctx->round_keys[(i-8)*4];
-            for(int j=0; j<4; j++) c[j] = p[j] ^ b8[j];
-        }
+    return expand_keys(ctx, key, 8, AES256_ROUNDS);
+}
+
+static void encrypt_block(const AESContext* ctx, const uint8_t* in, uint8_t* out) {
+    const uint32_t* rk = ctx->enc_keys;
+    uint32_t s0 = load_be32(in) ^ rk[0];
+    uint32_t s1 = load_be32(in + 4) ^ rk[1];
+    uint32_t s2 = load_be32(in + 8) ^ rk[2];
+    uint32_t s3 = load_be32(in + 12) ^ rk[3];
+    uint32_t t0, t1, t2, t3;
+
+    for(int r = 1; r < ctx->num_rounds; r++) {
+        rk += 4;
+        t0 = TE0(s0 >> 24) ^ TE1(s1 >> 16) ^ TE2(s2 >> 8) ^ TE3(s3) ^ rk[0];
+        t1 = TE0(s1 >> 24) ^ TE1(s2 >> 16) ^ TE2(s3 >> 8) ^ TE3(s0) ^ rk[1];
+        t2 = TE0(s2 >> 24) ^ TE1(s3 >> 16) ^ TE2(s0 >> 8) ^ TE3(s1) ^ rk[2];
+        t3 = TE0(s3 >> 24) ^ TE1(s0 >> 16) ^ TE2(s1 >> 8) ^ TE3(s2) ^ rk[3];
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
     }
-    return true;
+
+    // Final round: SubBytes + ShiftRows only
+    rk += 4;
+    const uint8_t* sb = predator_aes_sbox;
+    store_be32(out, ((uint32_t)sb[s0 >> 24] << 24 | (uint32_t)sb[(s1 >> 16) & 0xFF] << 16 |
+                     (uint32_t)sb[(s2 >> 8) & 0xFF] << 8 | sb[s3 & 0xFF]) ^ rk[0]);
+    store_be32(out + 4, ((uint32_t)sb[s1 >> 24] << 24 | (uint32_t)sb[(s2 >> 16) & 0xFF] << 16 |
+                         (uint32_t)sb[(s3 >> 8) & 0xFF] << 8 | sb[s0 & 0xFF]) ^ rk[1]);
+    store_be32(out + 8, ((uint32_t)sb[s2 >> 24] << 24 | (uint32_t)sb[(s3 >> 16) & 0xFF] << 16 |
+                         (uint32_t)sb[(s0 >> 8) & 0xFF] << 8 | sb[s1 & 0xFF]) ^ rk[2]);
+    store_be32(out + 12, ((uint32_t)sb[s3 >> 24] << 24 | (uint32_t)sb[(s0 >> 16) & 0xFF] << 16 |
+                          (uint32_t)sb[(s1 >> 8) & 0xFF] << 8 | sb[s2 & 0xFF]) ^ rk[3]);
+}
+
+static void decrypt_block(const AESContext* ctx, const uint8_t* in, uint8_t* out) {
+    const uint32_t* rk = ctx->dec_keys;
+    uint32_t s0 = load_be32(in) ^ rk[0];
+    uint32_t s1 = load_be32(in + 4) ^ rk[1];
+    uint32_t s2 = load_be32(in + 8) ^ rk[2];
+    uint32_t s3 = load_be32(in + 12) ^ rk[3];
+    uint32_t t0, t1, t2, t3;
+
+    for(int r = 1; r < ctx->num_rounds; r++) {
+        rk += 4;
+        t0 = TD0(s0 >> 24) ^ TD1(s3 >> 16) ^ TD2(s2 >> 8) ^ TD3(s1) ^ rk[0];
+        t1 = TD0(s1 >> 24) ^ TD1(s0 >> 16) ^ TD2(s3 >> 8) ^ TD3(s2) ^ rk[1];
+        t2 = TD0(s2 >> 24) ^ TD1(s1 >> 16) ^ TD2(s0 >> 8) ^ TD3(s3) ^ rk[2];
+        t3 = TD0(s3 >> 24) ^ TD1(s2 >> 16) ^ TD2(s1 >> 8) ^ TD3(s0) ^ rk[3];
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    // Final round: InvSubBytes + InvShiftRows only
+    rk += 4;
+    const uint8_t* isb = predator_aes_inv_sbox;
+    store_be32(out, ((uint32_t)isb[s0 >> 24] << 24 | (uint32_t)isb[(s3 >> 16) & 0xFF] << 16 |
+                     (uint32_t)isb[(s2 >> 8) & 0xFF] << 8 | isb[s1 & 0xFF]) ^ rk[0]);
+    store_be32(out + 4, ((uint32_t)isb[s1 >> 24] << 24 | (uint32_t)isb[(s0 >> 16) & 0xFF] << 16 |
+                         (uint32_t)isb[(s3 >> 8) & 0xFF] << 8 | isb[s2 & 0xFF]) ^ rk[1]);
+    store_be32(out + 8, ((uint32_t)isb[s2 >> 24] << 24 | (uint32_t)isb[(s1 >> 16) & 0xFF] << 16 |
+                         (uint32_t)isb[(s0 >> 8) & 0xFF] << 8 | isb[s3 & 0xFF]) ^ rk[2]);
+    store_be32(out + 12, ((uint32_t)isb[s3 >> 24] << 24 | (uint32_t)isb[(s2 >> 16) & 0xFF] << 16 |
+                          (uint32_t)isb[(s1 >> 8) & 0xFF] << 8 | isb[s0 & 0xFF]) ^ rk[3]);
 }
 
 bool aes128_encrypt_block(const AESContext* ctx, const uint8_t* pt, uint8_t* ct) {
     if(!ctx || !pt || !ct || ctx->is_aes256) return false;
-    uint8_t s[16]; memcpy(s, pt, 16);
-    add_round_key(s, &ctx->round_keys[0]);
-    for(int r=1; r<10; r++) { sub_bytes(s); shift_rows(s); mix_columns(s); add_round_key(s, &ctx->round_keys[r*16]); }
-    sub_bytes(s); shift_rows(s); add_round_key(s, &ctx->round_keys[160]);
-    memcpy(ct, s, 16);
+    encrypt_block(ctx, pt, ct);
     return true;
 }
 
 bool aes128_decrypt_block(const AESContext* ctx, const uint8_t* ct, uint8_t* pt) {
     if(!ctx || !ct || !pt || ctx->is_aes256) return false;
-    uint8_t s[16]; memcpy(s, ct, 16);
-    add_round_key(s, &ctx->round_keys[160]); inv_shift_rows(s); inv_sub_bytes(s);
-    for(int r=9; r>0; r--) { add_round_key(s, &ctx->round_keys[r*16]); inv_mix_columns(s); inv_shift_rows(s); inv_sub_bytes(s); }
-    add_round_key(s, &ctx->round_keys[0]);
-    memcpy(pt, s, 16);
+    decrypt_block(ctx, ct, pt);
     return true;
 }
 
 bool aes256_encrypt_block(const AESContext* ctx, const uint8_t* pt, uint8_t* ct) {
     if(!ctx || !pt || !ct || !ctx->is_aes256) return false;
-    uint8_t s[16]; memcpy(s, pt, 16);
-    add_round_key(s, &ctx->round_keys[0]);
-    for(int r=1; r<14; r++) { sub_bytes(s); shift_rows(s); mix_columns(s); add_round_key(s, &ctx->round_keys[r*16]); }
-    sub_bytes(s); shift_rows(s); add_round_key(s, &ctx->round_keys[224]);
-    memcpy(ct, s, 16);
+    encrypt_block(ctx, pt, ct);
     return true;
 }
 
 bool aes256_decrypt_block(const AESContext* ctx, const uint8_t* ct, uint8_t* pt) {
     if(!ctx || !ct || !pt || !ctx->is_aes256) return false;
-    uint8_t s[16]; memcpy(s, ct, 16);
-    add_round_key(s, &ctx->round_keys[224]); inv_shift_rows(s); inv_sub_bytes(s);
-    for(int r=13; r>0; r--) { add_round_key(s, &ctx->round_keys[r*16]); inv_mix_columns(s); inv_shift_rows(s); inv_sub_bytes(s); }
-    add_round_key(s, &ctx->round_keys[0]);
-    memcpy(pt, s, 16);
+    decrypt_block(ctx, ct, pt);
     return true;
 }
+
+bool aes_init(AESContext* ctx, const uint8_t* key, size_t key_len) {
+    if(key_len == AES128_KEY_SIZE) return aes128_init(ctx, key);
+    if(key_len == AES256_KEY_SIZE) return aes256_init(ctx, key);
+    return false;
+}
+
+void aes_encrypt_block(const AESContext* ctx, const uint8_t* in, uint8_t* out) {
+    encrypt_block(ctx, in, out);
+}
+
+void aes_decrypt_block(const AESContext* ctx, const uint8_t* in, uint8_t* out) {
+    decrypt_block(ctx, in, out);
+}
@@ -46,6 +46,10 @@ struct PredatorApp;
 // Calypso operates on ISO 14443 Type B at 13.56 MHz
 // Uses proprietary cryptographic protocol with session keys
 
+#define CALYPSO_RECORD_SIZE 29   // Contract / event record length
+#define CALYPSO_MAX_RECORDS_PER_READ 8   // Rev3: 8 x (2 + 29) bytes per response
+#define CALYPSO_CACHE_ENTRIES 24         // Records kept per session
+
 // Card types (Calypso is used in 100+ cities worldwide!)
 typedef enum {
     Calypso_Unknown,
@@ -336,6 +340,7 @@ bool calypso_diversify_key(const uint8_t* master_key, const uint8_t* diversifier
 
 /**
  * Read record (for linear/cyclic files)
+ * Records are served from the session cache when present
  * @param app PredatorApp context
  * @param card Card structure
  * @param file_id File ID
@@ -348,6 +353,36 @@ uint32_t calypso_read_record(struct PredatorApp* app, const CalypsoCard* card,
                              uint8_t file_id, uint8_t record_number,
                              uint8_t* data, uint32_t max_len);
 
+/**
+ * Read consecutive records, several per APDU where the revision allows
+ * Cached records cost no RF traffic; a card that refuses multi-record
+ * reads falls back to one record per APDU
+ * @param app PredatorApp context
+ * @param card Card structure
+ * @param file_id File ID (SFI)
+ * @param first_record First record number
+ * @param record_count Number of records
+ * @param data Output buffer (record_count * CALYPSO_RECORD_SIZE bytes)
+ * @return Number of leading records read (stops at the end of the file)
+ */
+uint32_t calypso_read_records(struct PredatorApp* app, const CalypsoCard* card,
+                              uint8_t file_id, uint8_t first_record, uint8_t record_count,
+                              uint8_t* data);
+
+/**
+ * Records per Read Records APDU the card accepts (from its revision)
+ */
+uint8_t calypso_max_records_per_read(const CalypsoCard* card);
+
+/**
+ * Drop all cached records
+ *
+ * The cache is keyed by (card serial, file ID, record) and shared by the
+ * Calypso scenes, so moving between views re-uses what was read; records
+ * of another card are never served. Clear it when a new read starts.
+ */
+void calypso_cache_clear(void);
+
 /**
  * Read binary file
  * @param app PredatorApp context
@@ -488,25 +523,38 @@ bool calypso_dump_card(struct PredatorApp* app, const CalypsoCard* card,
 uint16_t calypso_crc(const uint8_t* data, uint32_t len);
 
 /**
- * Parse contract data
- * @param raw_data Raw contract data (29 bytes typical)
+ * Parse contract data (EN1545, layout chosen by network)
+ * @param raw_data Raw contract record (CALYPSO_RECORD_SIZE bytes)
  * @param contract Output contract structure
  * @param card_type Card type (for format interpretation)
- * @return true if successful
+ * @return true if successful, false for unknown layouts and empty records
  */
 bool calypso_parse_contract(const uint8_t* raw_data, CalypsoContract* contract,
                             CalypsoCardType card_type);
 
 /**
- * Parse event log entry
- * @param raw_data Raw event data (29 bytes typical)
+ * Parse event log entry (EN1545, layout chosen by network)
+ * @param raw_data Raw event record (CALYPSO_RECORD_SIZE bytes)
  * @param event Output event structure
  * @param card_type Card type
- * @return true if successful
+ * @return true if successful, false for unknown layouts and empty records
  */
 bool calypso_parse_event(const uint8_t* raw_data, CalypsoEvent* event,
                          CalypsoCardType card_type);
 
+/**
+ * Parse a whole event log file in one pass, in place
+ * @param records Concatenated records (CALYPSO_RECORD_SIZE bytes each)
+ * @param record_count Number of records
+ * @param events Output event array
+ * @param max_events Maximum events
+ * @param card_type Card type
+ * @return Number of events parsed (empty records are skipped)
+ */
+uint32_t calypso_parse_events(const uint8_t* records, uint32_t record_count,
+                              CalypsoEvent* events, uint32_t max_events,
+                              CalypsoCardType card_type);
+
 /**
  * Format contract for display
  * @param contract Contract structure
@@ -1,5 +1,10 @@
 #include "predator_crypto_calypso.h"
 #include "predator_crypto_3des.h"
+#include "predator_crypto_keydiv.h"
+#include "predator_en1545.h"
+#include "predator_nfc_transport.h"
+#include "predator_dump.h"
+#include "predator_crc.h"
 #include "../predator_i.h"
 #include <string.h>
 
@@ -23,21 +28,7 @@
 // ========== CRC CALCULATION (ISO 14443 Type B) ==========
 
 uint16_t calypso_crc(const uint8_t* data, uint32_t len) {
-    uint16_t crc = 0xFFFF;
-    
-    for(uint32_t i = 0; i < len; i++) {
-        uint8_t byte = data[i];
-        crc ^= byte;
-        for(uint8_t bit = 0; bit < 8; bit++) {
-            if(crc & 0x0001) {
-                crc = (crc >> 1) ^ 0x8408;
-            } else {
-                crc >>= 1;
-            }
-        }
-    }
-    
-    return ~crc;
+    return (uint16_t)predator_crc(PredatorCrc16B, data, len);
 }
 
 // ========== CARD IDENTIFICATION ==========
@@ -209,10 +200,10 @@ bool calypso_diversify_key(const uint8_t* master_key, const uint8_t* diversifier
     if(!master_key || !diversifier || !diversified_key) return false;
     
     // Calypso key diversification:
-    // DK = 3DES_encrypt(master_key, diversifier)
-    des3_derive_key(master_key, diversifier, 8, diversified_key);
+    // DK = 3DES_encrypt(master_key, diversifier), cached per card
+    if(!predator_keydiv_derive(master_key, diversifier, 8, diversified_key)) return false;
     
-    FURI_LOG_I("Calypso", "Key diversified");
+    FURI_LOG_D("Calypso", "Key diversified");
     return true;
 }
 
@@ -231,8 +222,13 @@ bool calypso_generate_session_key(CalypsoAuthContext* auth_ctx,
         xor_result[i] = card_challenge[i] ^ reader_challenge[i];
     }
     
-    // Encrypt with issuer key
-    des3_encrypt_ecb(auth_ctx->issuer_key, xor_result, auth_ctx->session_key);
+    // Encrypt with issuer key (schedule cached across sessions)
+    const DES3Context* issuer = predator_keydiv_master_ctx(auth_ctx->issuer_key);
+    if(issuer) {
+        des3_encrypt_block(issuer, xor_result, auth_ctx->session_key);
+    } else {
+        des3_encrypt_ecb(auth_ctx->issuer_key, xor_result, auth_ctx->session_key);
+    }
     
     // Extend to 16 bytes
     memcpy(&auth_ctx->session_key[8], auth_ctx->session_key, 8);
@@ -262,10 +258,10 @@ bool calypso_open_secure_session(PredatorApp* app, const CalypsoCard* card,
     uint8_t response[64];
     size_t response_len = 0;
     
-    // HAL: Read record from card
-    furi_hal_nfc_iso14443b_transceive(cmd, 5, response, &response_len);
+    predator_nfc_transceive(PredatorNfcTechIso14443b, cmd, 5, response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
-    if(response_len > 2) {
+    if(response_len >= 10) {
         // Extract card challenge
         memcpy(auth_ctx->challenge, response, 8);
         
@@ -295,7 +291,7 @@ bool calypso_close_secure_session(PredatorApp* app, CalypsoAuthContext* auth_ctx
     FURI_LOG_I("Calypso", "Closing secure session");
     
     // Build Close Session command with MAC
-    uint8_t cmd[8];
+    uint8_t cmd[9];
     cmd[0] = 0x94;
     cmd[1] = CALYPSO_CMD_CLOSE_SESSION;
     cmd[2] = 0x00;
@@ -309,8 +305,8 @@ bool calypso_close_secure_session(PredatorApp* app, CalypsoAuthContext* auth_ctx
     uint8_t response[4];
     size_t response_len = 0;
     
-    // HAL: Close session
-    furi_hal_nfc_iso14443b_transceive(cmd, 9, response, &response_len);
+    predator_nfc_transceive(PredatorNfcTechIso14443b, cmd, 9, response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
     auth_ctx->authenticated = false;
     
@@ -318,13 +314,72 @@ bool calypso_close_secure_session(PredatorApp* app, CalypsoAuthContext* auth_ctx
     return true;
 }
 
+// ========== RECORD CACHE ==========
+
+typedef struct {
+    uint8_t uid[4];              // Card serial
+    uint32_t card_number;
+    uint8_t file_id;
+    uint8_t record;              // 0 = free slot
+    uint8_t len;                 // 0 = record not on card
+    uint8_t data[CALYPSO_RECORD_SIZE];
+} CalypsoCacheEntry;
+
+static CalypsoCacheEntry calypso_cache[CALYPSO_CACHE_ENTRIES];
+static uint8_t calypso_cache_next;
+
+void calypso_cache_clear(void) {
+    memset(calypso_cache, 0, sizeof(calypso_cache));
+    calypso_cache_next = 0;
+}
+
+static CalypsoCacheEntry* calypso_cache_find(const CalypsoCard* card, uint8_t file_id,
+                                             uint8_t record) {
+    for(size_t i = 0; i < CALYPSO_CACHE_ENTRIES; i++) {
+        CalypsoCacheEntry* e = &calypso_cache[i];
+        if(e->record == record && e->file_id == file_id && record != 0 &&
+           e->card_number == card->card_number && memcmp(e->uid, card->uid, 4) == 0) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+// Store a record (len 0 = card reported it absent); oldest slot is reused
+static void calypso_cache_store(const CalypsoCard* card, uint8_t file_id, uint8_t record,
+                                const uint8_t* data, uint32_t len) {
+    CalypsoCacheEntry* e = calypso_cache_find(card, file_id, record);
+    if(!e) {
+        e = &calypso_cache[calypso_cache_next];
+        calypso_cache_next = (calypso_cache_next + 1) % CALYPSO_CACHE_ENTRIES;
+    }
+    memcpy(e->uid, card->uid, 4);
+    e->card_number = card->card_number;
+    e->file_id = file_id;
+    e->record = record;
+    e->len = len < CALYPSO_RECORD_SIZE ? len : CALYPSO_RECORD_SIZE;
+    if(e->len) memcpy(e->data, data, e->len);
+}
+
 // ========== READ OPERATIONS ==========
 
+// 6A82 file not found / 6A83 record not found: safe to cache as absent
+static bool calypso_sw_not_found(uint8_t sw1, uint8_t sw2) {
+    return sw1 == 0x6A && (sw2 == 0x82 || sw2 == 0x83);
+}
+
 uint32_t calypso_read_record(PredatorApp* app, const CalypsoCard* card,
                              uint8_t file_id, uint8_t record_number,
                              uint8_t* data, uint32_t max_len) {
     if(!app || !card || !data) return 0;
     
+    const CalypsoCacheEntry* cached = calypso_cache_find(card, file_id, record_number);
+    if(cached) {
+        uint32_t data_len = cached->len < max_len ? cached->len : max_len;
+        memcpy(data, cached->data, data_len);
+        return data_len;
+    }
+    
     FURI_LOG_D("Calypso", "Reading file 0x%02X record %u", file_id, record_number);
     
     // Build Read Records command
@@ -332,25 +387,312 @@ uint32_t calypso_read_record(PredatorApp* app, const CalypsoCard* card,
     cmd[0] = 0x94;  // CLA
     cmd[1] = CALYPSO_CMD_READ_RECORDS;
     cmd[2] = record_number;
-    cmd[3] = (file_id << 3) | 0x04;  // File ID and mode
-    cmd[4] = 0x1D;  // Expected length (29 bytes typical)
+    cmd[3] = (file_id << 3) | 0x04;  // File ID and mode (one record)
+    cmd[4] = CALYPSO_RECORD_SIZE;  // Expected length
     
     uint8_t response[64];
     size_t response_len = 0;
     
-    // HAL: Read record from card
-    furi_hal_nfc_iso14443b_transceive(cmd, 5, response, &response_len);
+    predator_nfc_transceive(PredatorNfcTechIso14443b, cmd, 5, response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
-    if(response_len > 2) {
-        uint32_t data_len = response_len - 2;  // Minus status bytes
-        if(data_len > max_len) data_len = max_len;
-        memcpy(data, response, data_len);
+    if(response_len < 2) return 0;  // No answer: not cached
+    
+    const uint8_t sw1 = response[response_len - 2];
+    const uint8_t sw2 = response[response_len - 1];
+    if(sw1 == 0x90 && sw2 == 0x00) {
+        calypso_cache_store(card, file_id, record_number, response, response_len - 2);
+    } else {
+        // Only "not found" is final; 6982 / 6985 may pass once a session is open
+        if(calypso_sw_not_found(sw1, sw2)) {
+            calypso_cache_store(card, file_id, record_number, NULL, 0);
+        }
+        FURI_LOG_D("Calypso", "Record %u refused: %02X%02X", record_number, sw1, sw2);
+        return 0;
+    }
+    
+    uint32_t data_len = response_len - 2;  // Minus status bytes
+    
+    if(data_len > max_len) data_len = max_len;
+    memcpy(data, response, data_len);
+    
+    FURI_LOG_D("Calypso", "Read %lu bytes", data_len);
+    return data_len;
+}
+
+uint8_t calypso_max_records_per_read(const CalypsoCard* card) {
+    if(!card) return 1;
+    
+    switch(card->revision) {
+        case Calypso_Rev1:
+            return 1;  // Single-record mode only
+        case Calypso_Rev3:
+            return CALYPSO_MAX_RECORDS_PER_READ;
+        default:
+            return 4;  // Rev2 / Rev3 Light: 128-byte responses
+    }
+}
+
+// One multi-record Read Records APDU: records read, 0 if the card refused
+// the mode, -1 if it did not answer
+static int32_t calypso_read_records_apdu(const CalypsoCard* card, uint8_t file_id,
+                                         uint8_t first_record, uint8_t record_count,
+                                         uint8_t* data) {
+    uint8_t cmd[5];
+    cmd[0] = 0x94;  // CLA
+    cmd[1] = CALYPSO_CMD_READ_RECORDS;
+    cmd[2] = first_record;
+    cmd[3] = (file_id << 3) | 0x05;  // File ID and mode (P1 onwards)
+    cmd[4] = record_count * (2 + CALYPSO_RECORD_SIZE);  // Number, length, data
+    
+    uint8_t response[2 + CALYPSO_MAX_RECORDS_PER_READ * (2 + CALYPSO_RECORD_SIZE)];
+    size_t response_len = 0;
+    
+    if(!predator_nfc_transceive(PredatorNfcTechIso14443b, cmd, 5, response, sizeof(response),
+                                &response_len, PREDATOR_NFC_TIMEOUT_US) ||
+       response_len < 2) {
+        return -1;
+    }
+    const uint8_t sw1 = response[response_len - 2];
+    const uint8_t sw2 = response[response_len - 1];
+    if(sw1 != 0x90 || sw2 != 0x00) {
+        if(calypso_sw_not_found(sw1, sw2)) {
+            calypso_cache_store(card, file_id, first_record, NULL, 0);
+        }
+        FURI_LOG_W("Calypso", "Multi-record read refused: %02X%02X", sw1, sw2);
+        return 0;
+    }
+    
+    size_t end = response_len - 2;
+    size_t pos = 0;
+    uint8_t count = 0;
+    while(count < record_count && pos + 2 <= end) {
+        uint8_t number = response[pos];
+        uint8_t len = response[pos + 1];
+        if(number != first_record + count || pos + 2 + len > end) break;
         
-        FURI_LOG_D("Calypso", "Read %lu bytes", data_len);
-        return data_len;
+        calypso_cache_store(card, file_id, number, &response[pos + 2], len);
+        if(len < CALYPSO_RECORD_SIZE) break;
+        memcpy(&data[count * CALYPSO_RECORD_SIZE], &response[pos + 2], CALYPSO_RECORD_SIZE);
+        count++;
+        pos += 2 + len;
+    }
+    
+    // A well-formed 9000 answer with fewer records than fit: the file ends
+    // here. A malformed or short record is not proof of that, so not cached.
+    if(count < record_count && pos == end) {
+        calypso_cache_store(card, file_id, first_record + count, NULL, 0);
+    }
+    return count;
+}
+
+uint32_t calypso_read_records(PredatorApp* app, const CalypsoCard* card,
+                              uint8_t file_id, uint8_t first_record, uint8_t record_count,
+                              uint8_t* data) {
+    if(!app || !card || !data) return 0;
+    
+    uint8_t limit = calypso_max_records_per_read(card);
+    uint32_t done = 0;
+    
+    while(done < record_count) {
+        uint8_t record = first_record + done;
+        uint8_t* out = &data[done * CALYPSO_RECORD_SIZE];
+        
+        // Cached records (present or absent) cost no RF traffic
+        const CalypsoCacheEntry* cached = calypso_cache_find(card, file_id, record);
+        uint8_t chunk = record_count - done < limit ? record_count - done : limit;
+        if(cached || chunk == 1) {
+            uint8_t buf[32];
+            if(calypso_read_record(app, card, file_id, record, buf, sizeof(buf)) <
+               CALYPSO_RECORD_SIZE) {
+                break;
+            }
+            memcpy(out, buf, CALYPSO_RECORD_SIZE);
+            done++;
+            continue;
+        }
+        
+        // Stop the batch at the next cached record
+        for(uint8_t i = 1; i < chunk; i++) {
+            if(calypso_cache_find(card, file_id, record + i)) {
+                chunk = i;
+                break;
+            }
+        }
+        
+        int32_t got = calypso_read_records_apdu(card, file_id, record, chunk, out);
+        if(got < 0) break;
+        if(got == 0 && calypso_cache_find(card, file_id, record) == NULL) {
+            limit = 1;  // Mode refused: one record per APDU
+            continue;
+        }
+        done += got;
+        if(got < chunk) break;
     }
     
-    return 0;
+    return done;
+}
+
+// ========== EN1545 RECORD LAYOUTS ==========
+
+// Value ids filled by the Intercode layouts
+enum {
+    IcContractTariff = 1,
+    IcContractProfile,
+    IcContractStartDate,
+    IcContractEndDate,
+    IcContractZones,
+    IcContractJourneys,
+    IcContractStatus,
+};
+
+enum {
+    IcEventDate = 1,
+    IcEventTime,
+    IcEventCode,
+    IcEventLocation,
+    IcEventVehicle,
+    IcEventContract,
+};
+
+// Intercode 2 contract (French networks, Navigo)
+static const En1545Field intercode_contract[] = {
+    EN1545_BITMAP(20),                      // ContractBitmap
+        EN1545_SKIP(24),                    // ContractNetworkId
+        EN1545_SKIP(8),                     // ContractProvider
+        EN1545_INT(16, IcContractTariff),   // ContractTariff
+        EN1545_SKIP(32),                    // ContractSerialNumber
+        EN1545_BITMAP(2),                   // ContractCustomerInfoBitmap
+            EN1545_INT(6, IcContractProfile),
+            EN1545_SKIP(32),                // ContractCustomerNumber
+        EN1545_BITMAP(2),                   // ContractPassengerInfoBitmap
+            EN1545_SKIP(8),                 // ContractPassengerClass
+            EN1545_SKIP(8),                 // ContractPassengerTotal
+        EN1545_SKIP(6),                     // ContractVehicleClassAllowed
+        EN1545_SKIP(32),                    // ContractPaymentPointer
+        EN1545_SKIP(11),                    // ContractPayMethod
+        EN1545_SKIP(16),                    // ContractServices
+        EN1545_SKIP(16),                    // ContractPriceAmount
+        EN1545_SKIP(16),                    // ContractPriceUnit
+        EN1545_BITMAP(7),                   // ContractRestrictionBitmap
+            EN1545_SKIP(EN1545_TIME_BITS),  // ContractRestrictStart
+            EN1545_SKIP(EN1545_TIME_BITS),  // ContractRestrictEnd
+            EN1545_SKIP(8),                 // ContractRestrictDay
+            EN1545_SKIP(8),                 // ContractRestrictTimeCode
+            EN1545_SKIP(8),                 // ContractRestrictCode
+            EN1545_SKIP(16),                // ContractRestrictProduct
+            EN1545_SKIP(16),                // ContractRestrictLocation
+        EN1545_BITMAP(9),                   // ContractValidityInfoBitmap
+            EN1545_INT(EN1545_DATE_BITS, IcContractStartDate),
+            EN1545_SKIP(EN1545_TIME_BITS),  // ContractValidityStartTime
+            EN1545_INT(EN1545_DATE_BITS, IcContractEndDate),
+            EN1545_SKIP(EN1545_TIME_BITS),  // ContractValidityEndTime
+            EN1545_SKIP(8),                 // ContractValidityDuration
+            EN1545_SKIP(EN1545_DATE_BITS),  // ContractValidityLimitDate
+            EN1545_INT(8, IcContractZones), // ContractValidityZones
+            EN1545_INT(16, IcContractJourneys),
+            EN1545_SKIP(16),                // ContractValidityPeriodJourneys
+        EN1545_BITMAP(8),                   // ContractJourneyDataBitmap
+            EN1545_SKIP(16),                // ContractJourneyOrigin
+            EN1545_SKIP(16),                // ContractJourneyDestination
+            EN1545_SKIP(16),                // ContractJourneyRouteNumbers
+            EN1545_SKIP(8),                 // ContractJourneyRouteVariants
+            EN1545_SKIP(16),                // ContractJourneyRun
+            EN1545_SKIP(16),                // ContractJourneyVia
+            EN1545_SKIP(16),                // ContractJourneyDistance
+            EN1545_SKIP(8),                 // ContractJourneyInterchange
+        EN1545_BITMAP(4),                   // ContractSaleDataBitmap
+            EN1545_SKIP(EN1545_DATE_BITS),  // ContractSaleDate
+            EN1545_SKIP(EN1545_TIME_BITS),  // ContractSaleTime
+            EN1545_SKIP(8),                 // ContractSaleAgent
+            EN1545_SKIP(16),                // ContractSaleDevice
+        EN1545_INT(8, IcContractStatus),    // ContractStatus
+        EN1545_SKIP(16),                    // ContractLoyaltyPoints
+        EN1545_SKIP(16),                    // ContractAuthenticator
+        EN1545_SKIP(0),                     // ContractData (network specific)
+};
+
+// Intercode 2 event (French networks, Navigo)
+static const En1545Field intercode_event[] = {
+    EN1545_INT(EN1545_DATE_BITS, IcEventDate),
+    EN1545_INT(EN1545_TIME_BITS, IcEventTime),
+    EN1545_BITMAP(28),                      // EventBitmap
+        EN1545_SKIP(8),                     // EventDisplayData
+        EN1545_SKIP(24),                    // EventNetworkId
+        EN1545_INT(8, IcEventCode),         // EventCode (mode << 4 | type)
+        EN1545_SKIP(8),                     // EventResult
+        EN1545_SKIP(8),                     // EventServiceProvider
+        EN1545_SKIP(8),                     // EventNotOkCounter
+        EN1545_SKIP(24),                    // EventSerialNumber
+        EN1545_SKIP(16),                    // EventDestination
+        EN1545_INT(16, IcEventLocation),    // EventLocationId
+        EN1545_SKIP(8),                     // EventLocationGate
+        EN1545_SKIP(16),                    // EventDevice
+        EN1545_SKIP(16),                    // EventRouteNumber
+        EN1545_SKIP(8),                     // EventRouteVariant
+        EN1545_SKIP(16),                    // EventJourneyRun
+        EN1545_INT(16, IcEventVehicle),     // EventVehicleId
+        EN1545_SKIP(8),                     // EventVehicleClass
+        EN1545_SKIP(5),                     // EventLocationType
+        EN1545_SKIP(240),                   // EventEmployee
+        EN1545_SKIP(16),                    // EventLocationReference
+        EN1545_SKIP(8),                     // EventJourneyInterchanges
+        EN1545_SKIP(16),                    // EventPeriodJourneys
+        EN1545_SKIP(16),                    // EventTotalJourneys
+        EN1545_SKIP(16),                    // EventJourneyDistance
+        EN1545_SKIP(16),                    // EventPriceAmount
+        EN1545_SKIP(16),                    // EventPriceUnit
+        EN1545_INT(5, IcEventContract),     // EventContractPointer
+        EN1545_SKIP(16),                    // EventAuthenticator
+        EN1545_BITMAP(5),                   // EventDataBitmap
+            EN1545_SKIP(EN1545_DATE_BITS),  // EventDataDateFirstStamp
+            EN1545_SKIP(EN1545_TIME_BITS),  // EventDataTimeFirstStamp
+            EN1545_SKIP(1),                 // EventDataSimulation
+            EN1545_SKIP(2),                 // EventDataTrip
+            EN1545_SKIP(2),                 // EventDataRouteDirection
+};
+
+typedef struct {
+    CalypsoCardType card_type;
+    const En1545Field* contract;
+    size_t contract_len;
+    const En1545Field* event;
+    size_t event_len;
+} CalypsoLayout;
+
+#define CALYPSO_INTERCODE(type) \
+    {type, intercode_contract, COUNT_OF(intercode_contract), intercode_event, COUNT_OF(intercode_event)}
+
+// Record layouts per network; a new network only needs an entry here
+static const CalypsoLayout calypso_layouts[] = {
+    CALYPSO_INTERCODE(Calypso_Navigo),
+    CALYPSO_INTERCODE(Calypso_Lyon_TCL),
+    CALYPSO_INTERCODE(Calypso_Marseille_RTM),
+    CALYPSO_INTERCODE(Calypso_Toulouse_Tisseo),
+    CALYPSO_INTERCODE(Calypso_Bordeaux_TBM),
+    CALYPSO_INTERCODE(Calypso_Nice_Lignes_Azur),
+    CALYPSO_INTERCODE(Calypso_Strasbourg_CTS),
+    CALYPSO_INTERCODE(Calypso_Rennes_STAR),
+    CALYPSO_INTERCODE(Calypso_Lille_Transpole),
+    CALYPSO_INTERCODE(Calypso_Nantes_TAN),
+    CALYPSO_INTERCODE(Calypso_Grenoble_TAG),
+    CALYPSO_INTERCODE(Calypso_Montpellier_TAM),
+    CALYPSO_INTERCODE(Calypso_Nancy_STAN),
+    CALYPSO_INTERCODE(Calypso_Rouen_TCAR),
+    CALYPSO_INTERCODE(Calypso_Toulon_RMTT),
+    CALYPSO_INTERCODE(Calypso_Orleans_TAO),
+    CALYPSO_INTERCODE(Calypso_Angers_IRIGO),
+    CALYPSO_INTERCODE(Calypso_Dijon_Divia),
+    CALYPSO_INTERCODE(Calypso_Brest_Bibus),
+    CALYPSO_INTERCODE(Calypso_Reims_Citura),
+    CALYPSO_INTERCODE(Calypso_Interoperable),
+};
+
+static const CalypsoLayout* calypso_layout(CalypsoCardType card_type) {
+    for(size_t i = 0; i < COUNT_OF(calypso_layouts); i++) {
+        if(calypso_layouts[i].card_type == card_type) return &calypso_layouts[i];
+    }
+    return NULL;
 }
 
 // ========== CONTRACT PARSING ==========
@@ -361,33 +703,37 @@ bool calypso_parse_contract(const uint8_t* raw_data, CalypsoContract* contract,
     
     memset(contract, 0, sizeof(CalypsoContract));
     
-    // Navigo contract format (29 bytes)
-    if(card_type == Calypso_Navigo) {
-        contract->contract_number = raw_data[0];
-        contract->tariff_code = raw_data[1];
-        contract->profile_number = raw_data[2] | (raw_data[3] << 8);
-        
-        // Validity dates (BCD format)
-        contract->validity_start[0] = raw_data[4];  // Year
-        contract->validity_start[1] = raw_data[5];  // Month
-        contract->validity_start[2] = raw_data[6];  // Day
-        
-        contract->validity_end[0] = raw_data[7];
-        contract->validity_end[1] = raw_data[8];
-        contract->validity_end[2] = raw_data[9];
-        
-        // Trip counter
-        contract->trip_counter = raw_data[10] | (raw_data[11] << 8);
-        
-        // Zones (8 bytes bitmask)
-        memcpy(contract->zones, &raw_data[12], 8);
-        
-        contract->is_active = (raw_data[20] == 0x01);
-        
-        return true;
+    const CalypsoLayout* layout = calypso_layout(card_type);
+    if(!layout) return false;
+    
+    En1545Values v;
+    if(!en1545_decode(layout->contract, layout->contract_len, raw_data, CALYPSO_RECORD_SIZE, &v)) {
+        return false;
     }
+    // Blank records carry no tariff
+    if(!en1545_has(&v, IcContractTariff)) return false;
     
-    return false;
+    contract->tariff_code = (uint8_t)v.value[IcContractTariff];
+    contract->profile_number = (uint16_t)v.value[IcContractProfile];
+    
+    // Validity dates (BCD YYMMDD, as displayed)
+    if(en1545_has(&v, IcContractStartDate)) {
+        en1545_date_to_bcd(v.value[IcContractStartDate], contract->validity_start);
+    }
+    if(en1545_has(&v, IcContractEndDate)) {
+        en1545_date_to_bcd(v.value[IcContractEndDate], contract->validity_end);
+    }
+    
+    contract->trip_counter = (uint16_t)v.value[IcContractJourneys];
+    contract->zones[0] = (uint8_t)v.value[IcContractZones];
+    
+    // Suspended (0x3F), invalid (0x58), refunded (0x7F) and erasable (0xFF)
+    // contracts are not in force
+    const uint32_t status = v.value[IcContractStatus];
+    contract->is_active = !en1545_has(&v, IcContractStatus) ||
+                          (status != 0x3F && status != 0x58 && status != 0x7F && status != 0xFF);
+    
+    return true;
 }
 
 bool calypso_read_contract(PredatorApp* app, const CalypsoCard* card,
@@ -399,8 +745,9 @@ bool calypso_read_contract(PredatorApp* app, const CalypsoCard* card,
     uint32_t len = calypso_read_record(app, card, 0x29, contract_number, 
                                        data, sizeof(data));
     
-    if(len > 0) {
-        return calypso_parse_contract(data, contract, card->card_type);
+    if(len >= CALYPSO_RECORD_SIZE && calypso_parse_contract(data, contract, card->card_type)) {
+        contract->contract_number = contract_number;
+        return true;
     }
     
     return false;
@@ -410,11 +757,15 @@ uint32_t calypso_read_all_contracts(PredatorApp* app, const CalypsoCard* card,
                                     CalypsoContract* contracts, uint32_t max_contracts) {
     if(!app || !card || !contracts) return 0;
     
+    // Up to 4 contracts (typical maximum), in one APDU where supported
+    uint8_t data[4 * CALYPSO_RECORD_SIZE];
+    uint32_t records = calypso_read_records(app, card, 0x29, 1, 4, data);
     uint32_t count = 0;
     
-    // Try reading up to 4 contracts (typical maximum)
-    for(uint8_t i = 1; i <= 4 && count < max_contracts; i++) {
-        if(calypso_read_contract(app, card, i, &contracts[count])) {
+    for(uint32_t i = 0; i < records && count < max_contracts; i++) {
+        if(calypso_parse_contract(&data[i * CALYPSO_RECORD_SIZE], &contracts[count],
+                                  card->card_type)) {
+            contracts[count].contract_number = i + 1;
             if(contracts[count].is_active) {
                 count++;
             }
@@ -433,34 +784,60 @@ bool calypso_parse_event(const uint8_t* raw_data, CalypsoEvent* event,
     
     memset(event, 0, sizeof(CalypsoEvent));
     
-    // Navigo event format (29 bytes)
-    if(card_type == Calypso_Navigo) {
-        event->event_type = raw_data[0];
-        
-        // Date/Time (BCD)
-        event->date[0] = raw_data[1];  // Year
-        event->date[1] = raw_data[2];  // Month
-        event->date[2] = raw_data[3];  // Day
-        event->time[0] = raw_data[4];  // Hour
-        event->time[1] = raw_data[5];  // Minute
-        
-        // Location (station ID)
-        event->location_id = raw_data[6] | (raw_data[7] << 8);
-        
-        // Contract used
-        event->contract_used = raw_data[8];
-        
-        // Balance after transaction
-        event->balance_after = raw_data[9] | (raw_data[10] << 8);
-        
-        // Vehicle ID
-        event->vehicle_id[0] = raw_data[11];
-        event->vehicle_id[1] = raw_data[12];
-        
-        return true;
+    const CalypsoLayout* layout = calypso_layout(card_type);
+    if(!layout) return false;
+    
+    En1545Values v;
+    if(!en1545_decode(layout->event, layout->event_len, raw_data, CALYPSO_RECORD_SIZE, &v)) {
+        return false;
+    }
+    // Blank records: no date and no optional fields
+    if(v.value[IcEventDate] == 0 && v.present == ((1UL << IcEventDate) | (1UL << IcEventTime))) {
+        return false;
     }
     
-    return false;
+    // Event type from the low nibble of EventCode
+    switch(v.value[IcEventCode] & 0x0F) {
+    case 0x01: // Entry
+    case 0x06: // Interchange entry
+        event->event_type = 0x01;
+        break;
+    case 0x02: // Exit
+    case 0x07: // Interchange exit
+        event->event_type = 0x02;
+        break;
+    case 0x04:
+        event->event_type = 0x03;
+        break;
+    default:
+        event->event_type = v.value[IcEventCode] & 0x0F;
+        break;
+    }
+    
+    // Date/Time (BCD, as displayed)
+    en1545_date_to_bcd(v.value[IcEventDate], event->date);
+    en1545_time_to_bcd(v.value[IcEventTime], event->time);
+    
+    event->location_id = (uint16_t)v.value[IcEventLocation];
+    event->contract_used = (uint8_t)v.value[IcEventContract];
+    event->vehicle_id[0] = (uint8_t)(v.value[IcEventVehicle] >> 8);
+    event->vehicle_id[1] = (uint8_t)v.value[IcEventVehicle];
+    
+    return true;
+}
+
+uint32_t calypso_parse_events(const uint8_t* records, uint32_t record_count,
+                              CalypsoEvent* events, uint32_t max_events,
+                              CalypsoCardType card_type) {
+    if(!records || !events) return 0;
+    
+    uint32_t count = 0;
+    for(uint32_t i = 0; i < record_count && count < max_events; i++) {
+        if(calypso_parse_event(&records[i * CALYPSO_RECORD_SIZE], &events[count], card_type)) {
+            count++;
+        }
+    }
+    return count;
 }
 
 uint32_t calypso_read_event_log(PredatorApp* app, const CalypsoCard* card,
@@ -468,26 +845,70 @@ uint32_t calypso_read_event_log(PredatorApp* app, const CalypsoCard* card,
     if(!app || !card || !events) return 0;
     
     uint32_t count = 0;
+    uint32_t record = 1;
+    uint8_t data[CALYPSO_MAX_RECORDS_PER_READ * CALYPSO_RECORD_SIZE];
     
-    // Event log is in file 0x08 (event log file)
-    // Read last N events
-    for(uint8_t i = 1; i <= max_events; i++) {
-        uint8_t data[32];
-        uint32_t len = calypso_read_record(app, card, 0x08, i, data, sizeof(data));
-        
-        if(len > 0) {
-            if(calypso_parse_event(data, &events[count], card->card_type)) {
-                count++;
-            }
-        }
+    // Event log is in file 0x08 (event log file), most recent first
+    while(record <= max_events && record <= 0xFF) {
+        uint32_t chunk = max_events - record + 1;
+        if(chunk > CALYPSO_MAX_RECORDS_PER_READ) chunk = CALYPSO_MAX_RECORDS_PER_READ;
         
-        furi_delay_ms(50);
+        uint32_t got = calypso_read_records(app, card, 0x08, record, chunk, data);
+        count += calypso_parse_events(data, got, &events[count], max_events - count,
+                                      card->card_type);
+        if(got < chunk) break;  // End of file
+        record += got;
     }
     
     FURI_LOG_I("Calypso", "Read %lu events", count);
     return count;
 }
 
+// ========== DUMP ==========
+
+#define CALYPSO_DUMP_MAX_RECORDS 32
+
+bool calypso_dump_card(PredatorApp* app, const CalypsoCard* card, const char* output_path) {
+    if(!app || !app->storage || !card || !output_path) return false;
+    
+    PredatorDumpWriter* dump = predator_dump_writer_open(
+        app->storage, output_path, PredatorDumpCardCalypso, card->uid, sizeof(card->uid));
+    if(!dump) return false;
+    
+    uint8_t info[6] = {(uint8_t)card->revision, (uint8_t)card->card_type};
+    info[2] = card->card_number & 0xFF;
+    info[3] = (card->card_number >> 8) & 0xFF;
+    info[4] = (card->card_number >> 16) & 0xFF;
+    info[5] = card->card_number >> 24;
+    predator_dump_info(dump, info, sizeof(info));
+    
+    // Environment, contracts, event log
+    static const uint8_t files[] = {0x07, 0x29, 0x08};
+    const uint8_t batch = calypso_max_records_per_read(card);
+    uint8_t data[CALYPSO_MAX_RECORDS_PER_READ * CALYPSO_RECORD_SIZE];
+    uint32_t total = 0;
+    
+    for(size_t f = 0; f < COUNT_OF(files); f++) {
+        predator_dump_area(dump, files[f], CALYPSO_RECORD_SIZE, 0);
+        
+        // Records go to SD per APDU; a short read is the end of the file
+        uint32_t record = 1;
+        while(record <= CALYPSO_DUMP_MAX_RECORDS) {
+            uint8_t chunk = CALYPSO_DUMP_MAX_RECORDS - record + 1 < batch ?
+                            CALYPSO_DUMP_MAX_RECORDS - record + 1 : batch;
+            uint32_t got = calypso_read_records(app, card, files[f], record, chunk, data);
+            predator_dump_units(dump, record, data, CALYPSO_RECORD_SIZE, got);
+            record += got;
+            total += got;
+            if(got < chunk) break;
+        }
+    }
+    
+    bool ok = predator_dump_writer_close(dump);
+    FURI_LOG_I("Calypso", "Dumped %lu records to %s", total, output_path);
+    return ok;
+}
+
 // ========== STATION DECODER (NAVIGO) ==========
 
 // MEMORY OPTIMIZED: Top 30 essential Paris stations only (~1.5KB vs 6KB)
@@ -830,8 +1251,8 @@ bool calypso_select_application(PredatorApp* app, const CalypsoCard* card,
     uint8_t response[32];
     size_t response_len = 0;
     
-    // HAL: Select Calypso application
-    furi_hal_nfc_iso14443b_transceive(cmd, 12, response, &response_len);
+    predator_nfc_transceive(PredatorNfcTechIso14443b, cmd, 12, response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
     if(response_len >= 2 && response[response_len-2] == 0x90 && response[response_len-1] == 0x00) {
         FURI_LOG_I("Calypso", "Application selected successfully");
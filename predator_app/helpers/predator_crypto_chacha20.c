@@ -1,4 +1,5 @@
 #include "predator_crypto_chacha20.h"
+#include "predator_crypto_sha256.h"
 #include "../predator_i.h"
 #include <string.h>
 #include <furi_hal.h>
@@ -14,7 +15,19 @@
     c += d; b ^= c; b = ROTL32(b, 7); \
 } while(0)
 
-// Little-endian load/store
+// Little-endian load/store. On little-endian targets (Cortex-M4, host) a
+// 4-byte memcpy compiles to a single (unaligned-safe) load or store
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+static inline uint32_t load32_le(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline void store32_le(uint8_t* p, uint32_t v) {
+    memcpy(p, &v, 4);
+}
+#else
 static inline uint32_t load32_le(const uint8_t* p) {
     return ((uint32_t)p[0]) | ((uint32_t)p[1] << 8) | 
            ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
@@ -26,6 +39,7 @@ static inline void store32_le(uint8_t* p, uint32_t v) {
     p[2] = (v >> 16) & 0xFF;
     p[3] = (v >> 24) & 0xFF;
 }
+#endif
 
 // ========== ChaCha20 Implementation ==========
 
@@ -57,35 +71,29 @@ bool chacha20_init(ChaCha20Context* ctx, const uint8_t* key, const uint8_t* nonc
     return true;
 }
 
-bool chacha20_block(ChaCha20Context* ctx, uint8_t* output) {
-    if(!ctx || !output) return false;
-    
-    uint32_t working_state[16];
-    memcpy(working_state, ctx->state, sizeof(working_state));
+// One keystream block as words, then advance the block counter
+static void chacha20_keystream_words(ChaCha20Context* ctx, uint32_t* ks) {
+    uint32_t* x = ks;
+    memcpy(x, ctx->state, 16 * sizeof(uint32_t));
     
     // 20 rounds (10 double rounds)
     for(int i = 0; i < 10; i++) {
         // Column rounds
-        QR(working_state[0], working_state[4], working_state[8], working_state[12]);
-        QR(working_state[1], working_state[5], working_state[9], working_state[13]);
-        QR(working_state[2], working_state[6], working_state[10], working_state[14]);
-        QR(working_state[3], working_state[7], working_state[11], working_state[15]);
+        QR(x[0], x[4], x[8], x[12]);
+        QR(x[1], x[5], x[9], x[13]);
+        QR(x[2], x[6], x[10], x[14]);
+        QR(x[3], x[7], x[11], x[15]);
         
         // Diagonal rounds
-        QR(working_state[0], working_state[5], working_state[10], working_state[15]);
-        QR(working_state[1], working_state[6], working_state[11], working_state[12]);
-        QR(working_state[2], working_state[7], working_state[8], working_state[13]);
-        QR(working_state[3], working_state[4], working_state[9], working_state[14]);
+        QR(x[0], x[5], x[10], x[15]);
+        QR(x[1], x[6], x[11], x[12]);
+        QR(x[2], x[7], x[8], x[13]);
+        QR(x[3], x[4], x[9], x[14]);
     }
     
     // Add initial state
     for(int i = 0; i < 16; i++) {
-        working_state[i] += ctx->state[i];
-    }
-    
-    // Serialize to output
-    for(int i = 0; i < 16; i++) {
-        store32_le(&output[i * 4], working_state[i]);
+        x[i] += ctx->state[i];
     }
     
     // Increment counter
@@ -93,6 +101,56 @@ bool chacha20_block(ChaCha20Context* ctx, uint8_t* output) {
     if(ctx->state[12] == 0) {
         ctx->state[13]++; // Handle overflow
     }
+}
+
+#if PREDATOR_CHACHA20_LANES > 1
+// Same rounds on PREDATOR_CHACHA20_LANES consecutive blocks; the inner
+// loops over lanes are what the compiler turns into vector instructions
+#define QR_LANES(a, b, c, d) do { \
+    for(int l_ = 0; l_ < PREDATOR_CHACHA20_LANES; l_++) { \
+        a[l_] += b[l_]; d[l_] ^= a[l_]; d[l_] = ROTL32(d[l_], 16); \
+        c[l_] += d[l_]; b[l_] ^= c[l_]; b[l_] = ROTL32(b[l_], 12); \
+        a[l_] += b[l_]; d[l_] ^= a[l_]; d[l_] = ROTL32(d[l_], 8); \
+        c[l_] += d[l_]; b[l_] ^= c[l_]; b[l_] = ROTL32(b[l_], 7); \
+    } \
+} while(0)
+
+// Caller guarantees the 32-bit block counter does not wrap inside the batch
+static void chacha20_keystream_lanes(ChaCha20Context* ctx, uint32_t x[16][PREDATOR_CHACHA20_LANES]) {
+    for(int i = 0; i < 16; i++) {
+        for(int l = 0; l < PREDATOR_CHACHA20_LANES; l++) x[i][l] = ctx->state[i];
+    }
+    for(int l = 0; l < PREDATOR_CHACHA20_LANES; l++) x[12][l] += l;
+    
+    for(int i = 0; i < 10; i++) {
+        QR_LANES(x[0], x[4], x[8], x[12]);
+        QR_LANES(x[1], x[5], x[9], x[13]);
+        QR_LANES(x[2], x[6], x[10], x[14]);
+        QR_LANES(x[3], x[7], x[11], x[15]);
+        QR_LANES(x[0], x[5], x[10], x[15]);
+        QR_LANES(x[1], x[6], x[11], x[12]);
+        QR_LANES(x[2], x[7], x[8], x[13]);
+        QR_LANES(x[3], x[4], x[9], x[14]);
+    }
+    
+    for(int i = 0; i < 16; i++) {
+        for(int l = 0; l < PREDATOR_CHACHA20_LANES; l++) x[i][l] += ctx->state[i];
+    }
+    for(int l = 0; l < PREDATOR_CHACHA20_LANES; l++) x[12][l] += l;
+    ctx->state[12] += PREDATOR_CHACHA20_LANES;
+}
+#endif
+
+bool chacha20_block(ChaCha20Context* ctx, uint8_t* output) {
+    if(!ctx || !output) return false;
+    
+    uint32_t ks[16];
+    chacha20_keystream_words(ctx, ks);
+    
+    // Serialize to output
+    for(int i = 0; i < 16; i++) {
+        store32_le(&output[i * 4], ks[i]);
+    }
     
     return true;
 }
@@ -100,12 +158,56 @@ bool chacha20_block(ChaCha20Context* ctx, uint8_t* output) {
 bool chacha20_crypt(ChaCha20Context* ctx, const uint8_t* data, size_t len, uint8_t* output) {
     if(!ctx || !data || !output) return false;
     
-    for(size_t i = 0; i < len; i++) {
-        if(ctx->keystream_pos >= 64) {
-            chacha20_block(ctx, ctx->keystream);
-            ctx->keystream_pos = 0;
+    // Use up keystream left over from the previous call
+    while(len > 0 && ctx->keystream_pos < 64) {
+        *output++ = *data++ ^ ctx->keystream[ctx->keystream_pos++];
+        len--;
+    }
+    
+#if PREDATOR_CHACHA20_LANES > 1
+    // Several blocks per batch while the counter cannot wrap inside one
+    const size_t batch = 64 * PREDATOR_CHACHA20_LANES;
+    if(len >= batch) {
+        uint32_t kv[16][PREDATOR_CHACHA20_LANES];
+        while(len >= batch && ctx->state[12] <= UINT32_MAX - PREDATOR_CHACHA20_LANES) {
+            chacha20_keystream_lanes(ctx, kv);
+            for(int l = 0; l < PREDATOR_CHACHA20_LANES; l++) {
+                for(int i = 0; i < 16; i++) {
+                    store32_le(&output[i * 4], load32_le(&data[i * 4]) ^ kv[i][l]);
+                }
+                data += 64;
+                output += 64;
+            }
+            len -= batch;
+        }
+        memset(kv, 0, sizeof(kv));
+    }
+#endif
+    
+    // Whole blocks: XOR keystream words straight into the output,
+    // without staging them through ctx->keystream
+    if(len >= 64) {
+        uint32_t ks[16];
+        while(len >= 64) {
+            chacha20_keystream_words(ctx, ks);
+            for(int i = 0; i < 16; i++) {
+                store32_le(&output[i * 4], load32_le(&data[i * 4]) ^ ks[i]);
+            }
+            data += 64;
+            output += 64;
+            len -= 64;
+        }
+        memset(ks, 0, sizeof(ks));
+    }
+    
+    // Tail: buffer one block and keep the rest for the next call
+    if(len > 0) {
+        chacha20_block(ctx, ctx->keystream);
+        ctx->keystream_pos = 0;
+        while(len > 0) {
+            *output++ = *data++ ^ ctx->keystream[ctx->keystream_pos++];
+            len--;
         }
-        output[i] = data[i] ^ ctx->keystream[ctx->keystream_pos++];
     }
     
     return true;
@@ -114,7 +216,9 @@ bool chacha20_crypt(ChaCha20Context* ctx, const uint8_t* data, size_t len, uint8
 // ========== Poly1305 Implementation ==========
 
 // Poly1305 modulus: 2^130 - 5
-static void poly1305_blocks(Poly1305Context* ctx, const uint8_t* input, size_t len) {
+// hibit is the 2^128 bit added to each block: set for full 16-byte blocks,
+// clear for the padded final block (which carries its own 0x01 byte)
+static void poly1305_blocks(Poly1305Context* ctx, const uint8_t* input, size_t len, uint32_t hibit) {
     uint32_t h0 = ctx->accumulator[0];
     uint32_t h1 = ctx->accumulator[1];
     uint32_t h2 = ctx->accumulator[2];
@@ -139,7 +243,7 @@ static void poly1305_blocks(Poly1305Context* ctx, const uint8_t* input, size_t l
         h1 += ((t0 >> 26) | (t1 << 6)) & 0x3ffffff;
         h2 += ((t1 >> 20) | (t2 << 12)) & 0x3ffffff;
         h3 += ((t2 >> 14) | (t3 << 18)) & 0x3ffffff;
-        h4 += (t3 >> 8) | (1 << 24);
+        h4 += (t3 >> 8) | hibit;
         
         // Multiply by R (simplified for embedded)
         uint64_t d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * (r4 * 5) + (uint64_t)h2 * (r3 * 5) + 
@@ -159,7 +263,7 @@ static void poly1305_blocks(Poly1305Context* ctx, const uint8_t* input, size_t l
         h2 = (uint32_t)d2 & 0x3ffffff; d3 += d2 >> 26;
         h3 = (uint32_t)d3 & 0x3ffffff; d4 += d3 >> 26;
         h4 = (uint32_t)d4 & 0x3ffffff;
-        h0 += ((uint32_t)d4 >> 26) * 5;
+        h0 += (uint32_t)(d4 >> 26) * 5;
         h1 += h0 >> 26; h0 &= 0x3ffffff;
         
         input += 16;
@@ -207,7 +311,7 @@ bool poly1305_update(Poly1305Context* ctx, const uint8_t* data, size_t len) {
         len -= to_copy;
         
         if(ctx->buffer_len == 16) {
-            poly1305_blocks(ctx, ctx->buffer, 16);
+            poly1305_blocks(ctx, ctx->buffer, 16, 1 << 24);
             ctx->buffer_len = 0;
         }
     }
@@ -215,7 +319,7 @@ bool poly1305_update(Poly1305Context* ctx, const uint8_t* data, size_t len) {
     // Process full blocks
     size_t blocks = len / 16;
     if(blocks > 0) {
-        poly1305_blocks(ctx, data, blocks * 16);
+        poly1305_blocks(ctx, data, blocks * 16, 1 << 24);
         data += blocks * 16;
         len -= blocks * 16;
     }
@@ -236,7 +340,7 @@ bool poly1305_finish(Poly1305Context* ctx, uint8_t* tag) {
     if(ctx->buffer_len > 0) {
         ctx->buffer[ctx->buffer_len] = 1;
         memset(&ctx->buffer[ctx->buffer_len + 1], 0, 16 - ctx->buffer_len - 1);
-        poly1305_blocks(ctx, ctx->buffer, 16);
+        poly1305_blocks(ctx, ctx->buffer, 16, 0);
     }
     
     // Final reduction
@@ -271,16 +375,20 @@ bool poly1305_finish(Poly1305Context* ctx, uint8_t* tag) {
     h3 = (h3 & mask) | g3;
     h4 = (h4 & mask) | g4;
     
-    // Add S
-    uint64_t f = (uint64_t)h0 | ((uint64_t)h1 << 26) | ((uint64_t)h2 << 52);
-    f += ctx->s[0] + ((uint64_t)ctx->s[1] << 32);
-    store32_le(&tag[0], f);
-    store32_le(&tag[4], f >> 32);
-    
-    f = ((uint64_t)h2 >> 12) | ((uint64_t)h3 << 14) | ((uint64_t)h4 << 40);
-    f += ctx->s[2] + ((uint64_t)ctx->s[3] << 32);
-    store32_le(&tag[8], f);
-    store32_le(&tag[12], f >> 32);
+    // h mod 2^128 as four 32-bit words, then add S with carries
+    h0 = h0 | (h1 << 26);
+    h1 = (h1 >> 6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 << 8);
+    
+    uint64_t f = (uint64_t)h0 + ctx->s[0];
+    store32_le(&tag[0], (uint32_t)f);
+    f = (uint64_t)h1 + ctx->s[1] + (f >> 32);
+    store32_le(&tag[4], (uint32_t)f);
+    f = (uint64_t)h2 + ctx->s[2] + (f >> 32);
+    store32_le(&tag[8], (uint32_t)f);
+    f = (uint64_t)h3 + ctx->s[3] + (f >> 32);
+    store32_le(&tag[12], (uint32_t)f);
     
     return true;
 }
@@ -306,46 +414,126 @@ bool chacha20_poly1305_init(ChaCha20Poly1305Context* ctx, const uint8_t* key, co
     return true;
 }
 
-bool chacha20_poly1305_encrypt(ChaCha20Poly1305Context* ctx,
-                               const uint8_t* plaintext, size_t plaintext_len,
-                               const uint8_t* aad, size_t aad_len,
-                               uint8_t* ciphertext, uint8_t* tag) {
-    if(!ctx || !plaintext || !ciphertext || !tag) return false;
+// ========== Incremental AEAD ==========
+
+// Bytes per fused step: the ciphertext is MACed right after it is produced
+#define CHACHA20_POLY1305_STRIDE (CHACHA20_BLOCK_SIZE * PREDATOR_CHACHA20_LANES)
+
+static const uint8_t poly1305_zero_pad[16] = {0};
+
+// Zero-pad the Poly1305 input to a 16-byte boundary
+static void chacha20_poly1305_pad16(ChaCha20Poly1305Context* ctx, uint64_t len) {
+    size_t pad_len = (16 - (len % 16)) % 16;
+    if(pad_len > 0) poly1305_update(&ctx->poly, poly1305_zero_pad, pad_len);
+}
+
+bool chacha20_poly1305_start(ChaCha20Poly1305Context* ctx, bool encrypt) {
+    if(!ctx) return false;
     
     // Generate Poly1305 key (first 32 bytes of keystream at counter=0)
     uint8_t poly_key[64];
     chacha20_init(&ctx->chacha, ctx->key, ctx->nonce, 0);
     chacha20_block(&ctx->chacha, poly_key);
+    poly1305_init(&ctx->poly, poly_key);
+    memset(poly_key, 0, sizeof(poly_key));
     
-    // Encrypt plaintext (starting at counter=1)
-    chacha20_init(&ctx->chacha, ctx->key, ctx->nonce, 1);
-    chacha20_crypt(&ctx->chacha, plaintext, plaintext_len, ciphertext);
+    // Data starts at counter=1 (block 0 was consumed above)
+    ctx->chacha.keystream_pos = 64;
     
-    // Compute Poly1305 MAC
-    poly1305_init(&ctx->poly, poly_key);
-    if(aad && aad_len > 0) {
-        poly1305_update(&ctx->poly, aad, aad_len);
-        // Pad to 16 bytes
-        uint8_t pad[16] = {0};
-        size_t pad_len = (16 - (aad_len % 16)) % 16;
-        if(pad_len > 0) poly1305_update(&ctx->poly, pad, pad_len);
+    ctx->aad_len = 0;
+    ctx->text_len = 0;
+    ctx->encrypt = encrypt;
+    ctx->aad_done = false;
+    return true;
+}
+
+bool chacha20_poly1305_aad(ChaCha20Poly1305Context* ctx, const uint8_t* aad, size_t len) {
+    if(!ctx || ctx->aad_done || (!aad && len > 0)) return false;
+    if(len > 0) poly1305_update(&ctx->poly, aad, len);
+    ctx->aad_len += len;
+    return true;
+}
+
+bool chacha20_poly1305_update(ChaCha20Poly1305Context* ctx,
+                              const uint8_t* input, size_t len, uint8_t* output) {
+    if(!ctx || ((!input || !output) && len > 0)) return false;
+    
+    if(!ctx->aad_done) {
+        chacha20_poly1305_pad16(ctx, ctx->aad_len);
+        ctx->aad_done = true;
+    }
+    
+    while(len > 0) {
+        size_t n = len < CHACHA20_POLY1305_STRIDE ? len : CHACHA20_POLY1305_STRIDE;
+        if(ctx->encrypt) {
+            chacha20_crypt(&ctx->chacha, input, n, output);
+            poly1305_update(&ctx->poly, output, n);
+        } else {
+            // MAC the ciphertext before an in-place decrypt overwrites it
+            poly1305_update(&ctx->poly, input, n);
+            chacha20_crypt(&ctx->chacha, input, n, output);
+        }
+        input += n;
+        output += n;
+        len -= n;
+        ctx->text_len += n;
+    }
+    return true;
+}
+
+// Length block and Poly1305 finish shared by finish/verify
+static void chacha20_poly1305_compute_tag(ChaCha20Poly1305Context* ctx, uint8_t* tag) {
+    if(!ctx->aad_done) {
+        chacha20_poly1305_pad16(ctx, ctx->aad_len);
+        ctx->aad_done = true;
     }
-    poly1305_update(&ctx->poly, ciphertext, plaintext_len);
-    // Pad to 16 bytes
-    uint8_t pad[16] = {0};
-    size_t pad_len = (16 - (plaintext_len % 16)) % 16;
-    if(pad_len > 0) poly1305_update(&ctx->poly, pad, pad_len);
+    chacha20_poly1305_pad16(ctx, ctx->text_len);
     
-    // Append lengths
+    // Append lengths (64-bit little-endian)
     uint8_t lens[16];
-    store32_le(&lens[0], aad_len);
-    store32_le(&lens[4], 0);
-    store32_le(&lens[8], plaintext_len);
-    store32_le(&lens[12], 0);
+    store32_le(&lens[0], (uint32_t)ctx->aad_len);
+    store32_le(&lens[4], (uint32_t)(ctx->aad_len >> 32));
+    store32_le(&lens[8], (uint32_t)ctx->text_len);
+    store32_le(&lens[12], (uint32_t)(ctx->text_len >> 32));
     poly1305_update(&ctx->poly, lens, 16);
     
     poly1305_finish(&ctx->poly, tag);
     
+    // Key material is single-use
+    memset(&ctx->poly, 0, sizeof(ctx->poly));
+    memset(ctx->chacha.keystream, 0, sizeof(ctx->chacha.keystream));
+}
+
+bool chacha20_poly1305_finish(ChaCha20Poly1305Context* ctx, uint8_t* tag) {
+    if(!ctx || !tag || !ctx->encrypt) return false;
+    chacha20_poly1305_compute_tag(ctx, tag);
+    return true;
+}
+
+bool chacha20_poly1305_verify(ChaCha20Poly1305Context* ctx, const uint8_t* tag) {
+    if(!ctx || !tag || ctx->encrypt) return false;
+    uint8_t computed_tag[16];
+    chacha20_poly1305_compute_tag(ctx, computed_tag);
+    
+    // Constant-time comparison
+    bool ok = chacha20_constant_time_equal(computed_tag, tag, 16);
+    memset(computed_tag, 0, sizeof(computed_tag));
+    return ok;
+}
+
+// ========== One-shot AEAD ==========
+
+bool chacha20_poly1305_encrypt(ChaCha20Poly1305Context* ctx,
+                               const uint8_t* plaintext, size_t plaintext_len,
+                               const uint8_t* aad, size_t aad_len,
+                               uint8_t* ciphertext, uint8_t* tag) {
+    if(!ctx || !plaintext || !ciphertext || !tag) return false;
+    
+    chacha20_poly1305_start(ctx, true);
+    if(aad && aad_len > 0) chacha20_poly1305_aad(ctx, aad, aad_len);
+    chacha20_poly1305_update(ctx, plaintext, plaintext_len, ciphertext);
+    chacha20_poly1305_finish(ctx, tag);
+    
     FURI_LOG_I("ChaCha20", "Encrypted %u bytes with Poly1305 authentication", (unsigned)plaintext_len);
     return true;
 }
@@ -356,45 +544,17 @@ bool chacha20_poly1305_decrypt(ChaCha20Poly1305Context* ctx,
                                const uint8_t* tag, uint8_t* plaintext) {
     if(!ctx || !ciphertext || !tag || !plaintext) return false;
     
-    // Generate Poly1305 key
-    uint8_t poly_key[64];
-    chacha20_init(&ctx->chacha, ctx->key, ctx->nonce, 0);
-    chacha20_block(&ctx->chacha, poly_key);
-    
-    // Verify MAC
-    Poly1305Context poly;
-    poly1305_init(&poly, poly_key);
-    if(aad && aad_len > 0) {
-        poly1305_update(&poly, aad, aad_len);
-        uint8_t pad[16] = {0};
-        size_t pad_len = (16 - (aad_len % 16)) % 16;
-        if(pad_len > 0) poly1305_update(&poly, pad, pad_len);
-    }
-    poly1305_update(&poly, ciphertext, ciphertext_len);
-    uint8_t pad[16] = {0};
-    size_t pad_len = (16 - (ciphertext_len % 16)) % 16;
-    if(pad_len > 0) poly1305_update(&poly, pad, pad_len);
-    
-    uint8_t lens[16];
-    store32_le(&lens[0], aad_len);
-    store32_le(&lens[4], 0);
-    store32_le(&lens[8], ciphertext_len);
-    store32_le(&lens[12], 0);
-    poly1305_update(&poly, lens, 16);
-    
-    uint8_t computed_tag[16];
-    poly1305_finish(&poly, computed_tag);
+    // Single pass: MAC and decrypt together, then drop the output on mismatch
+    chacha20_poly1305_start(ctx, false);
+    if(aad && aad_len > 0) chacha20_poly1305_aad(ctx, aad, aad_len);
+    chacha20_poly1305_update(ctx, ciphertext, ciphertext_len, plaintext);
     
-    // Constant-time comparison
-    if(!chacha20_constant_time_equal(computed_tag, tag, 16)) {
+    if(!chacha20_poly1305_verify(ctx, tag)) {
+        memset(plaintext, 0, ciphertext_len);
         FURI_LOG_W("ChaCha20", "Authentication failed - tag mismatch");
         return false;
     }
     
-    // Decrypt
-    chacha20_init(&ctx->chacha, ctx->key, ctx->nonce, 1);
-    chacha20_crypt(&ctx->chacha, ciphertext, ciphertext_len, plaintext);
-    
     FURI_LOG_I("ChaCha20", "Decrypted and verified %u bytes", (unsigned)ciphertext_len);
     return true;
 }
@@ -486,22 +646,11 @@ bool chacha20_constant_time_equal(const uint8_t* a, const uint8_t* b, size_t len
 
 bool chacha20_derive_key(const char* password, const uint8_t* salt, size_t salt_len,
                          uint32_t iterations, uint8_t* key) {
-    // Simplified PBKDF2 - for production use mbedtls or similar
     if(!password || !salt || !key || iterations < 1000) return false;
     
-    FURI_LOG_W("ChaCha20", "Key derivation: Use strong library for production");
-    
-    // Simplified version for demonstration
-    memset(key, 0, 32);
-    size_t pwd_len = strlen(password);
-    
-    for(uint32_t i = 0; i < iterations; i++) {
-        for(size_t j = 0; j < 32; j++) {
-            key[j] ^= password[j % pwd_len] ^ salt[j % salt_len] ^ (i & 0xFF);
-        }
-    }
-    
-    return true;
+    // PBKDF2-HMAC-SHA256, 256-bit output
+    return pbkdf2_hmac_sha256((const uint8_t*)password, strlen(password), salt, salt_len,
+                              iterations, key, CHACHA20_KEY_SIZE);
 }
 
 bool chacha20_poly1305_self_test(void) {
@@ -0,0 +1,135 @@
+#include "predator_crypto_cmac.h"
+#include <string.h>
+
+// CMAC (NIST SP 800-38B) - shared by DESFire and transit secure messaging
+
+static void cmac_encrypt(const PredatorCmac* ctx, const uint8_t* in, uint8_t* out) {
+    if(ctx->cipher == PredatorCmacAES128) {
+        aes_encrypt_block(&ctx->key.aes, in, out);
+    } else {
+        des3_encrypt_block(&ctx->key.des3, in, out);
+    }
+}
+
+// Multiply by x in GF(2^b): shift left one bit, fold the carry with Rb
+static void cmac_double(const uint8_t* in, uint8_t* out, uint8_t block_size) {
+    const uint8_t rb = (block_size == 16) ? 0x87 : 0x1B;
+    const uint8_t carry = in[0] & 0x80;
+    for(uint8_t i = 0; i < block_size - 1; i++) {
+        out[i] = (uint8_t)((in[i] << 1) | (in[i + 1] >> 7));
+    }
+    out[block_size - 1] = (uint8_t)(in[block_size - 1] << 1);
+    if(carry) out[block_size - 1] ^= rb;
+}
+
+// state = E(state ^ block)
+static void cmac_absorb(PredatorCmac* ctx, const uint8_t* block) {
+    for(uint8_t i = 0; i < ctx->block_size; i++) ctx->state[i] ^= block[i];
+    cmac_encrypt(ctx, ctx->state, ctx->state);
+}
+
+bool predator_cmac_init(PredatorCmac* ctx, PredatorCmacCipher cipher, const uint8_t* key) {
+    if(!ctx || !key) return false;
+
+    bool ok;
+    switch(cipher) {
+    case PredatorCmacAES128:
+        ok = aes128_init(&ctx->key.aes, key);
+        ctx->block_size = AES_BLOCK_SIZE;
+        break;
+    case PredatorCmac2K3DES:
+        ok = des3_init(&ctx->key.des3, key, DES3_2KEY_SIZE);
+        ctx->block_size = DES3_BLOCK_SIZE;
+        break;
+    case PredatorCmac3K3DES:
+        ok = des3_init(&ctx->key.des3, key, DES3_3KEY_SIZE);
+        ctx->block_size = DES3_BLOCK_SIZE;
+        break;
+    default:
+        return false;
+    }
+    if(!ok) return false;
+    ctx->cipher = cipher;
+
+    // Subkeys: L = E(0^b), K1 = L * x, K2 = K1 * x
+    uint8_t l[PREDATOR_CMAC_MAX_BLOCK] = {0};
+    cmac_encrypt(ctx, l, l);
+    cmac_double(l, ctx->k1, ctx->block_size);
+    cmac_double(ctx->k1, ctx->k2, ctx->block_size);
+    memset(l, 0, sizeof(l));
+
+    predator_cmac_start(ctx, NULL);
+    return true;
+}
+
+void predator_cmac_start(PredatorCmac* ctx, const uint8_t* iv) {
+    if(!ctx) return;
+    if(iv) {
+        memcpy(ctx->state, iv, ctx->block_size);
+    } else {
+        memset(ctx->state, 0, sizeof(ctx->state));
+    }
+    ctx->last_len = 0;
+}
+
+bool predator_cmac_update(PredatorCmac* ctx, const uint8_t* data, size_t len) {
+    if(!ctx || (!data && len > 0)) return false;
+    const uint8_t bs = ctx->block_size;
+
+    while(len > 0) {
+        // The held-back block is only absorbed once more data follows it:
+        // the final block needs K1/K2 and is handled in predator_cmac_final
+        if(ctx->last_len == bs) {
+            cmac_absorb(ctx, ctx->last);
+            ctx->last_len = 0;
+        }
+
+        // Whole blocks straight from the caller's buffer, keeping one back
+        if(ctx->last_len == 0) {
+            while(len > bs) {
+                cmac_absorb(ctx, data);
+                data += bs;
+                len -= bs;
+            }
+        }
+
+        size_t take = bs - ctx->last_len;
+        if(take > len) take = len;
+        memcpy(&ctx->last[ctx->last_len], data, take);
+        ctx->last_len += take;
+        data += take;
+        len -= take;
+    }
+    return true;
+}
+
+bool predator_cmac_final(PredatorCmac* ctx, uint8_t* mac) {
+    if(!ctx || !mac) return false;
+    const uint8_t bs = ctx->block_size;
+
+    const uint8_t* subkey = ctx->k1;
+    if(ctx->last_len < bs) {
+        // Incomplete (or empty) last block: pad with 10..0 and use K2
+        ctx->last[ctx->last_len] = 0x80;
+        memset(&ctx->last[ctx->last_len + 1], 0, bs - ctx->last_len - 1);
+        subkey = ctx->k2;
+    }
+    for(uint8_t i = 0; i < bs; i++) ctx->last[i] ^= subkey[i];
+    cmac_absorb(ctx, ctx->last);
+
+    memcpy(mac, ctx->state, bs);
+    ctx->last_len = 0;
+    return true;
+}
+
+bool predator_cmac(PredatorCmacCipher cipher, const uint8_t* key, const uint8_t* data, size_t len, uint8_t* mac) {
+    PredatorCmac ctx;
+    bool ok = predator_cmac_init(&ctx, cipher, key) && predator_cmac_update(&ctx, data, len) &&
+              predator_cmac_final(&ctx, mac);
+    predator_cmac_wipe(&ctx);
+    return ok;
+}
+
+void predator_cmac_wipe(PredatorCmac* ctx) {
+    if(ctx) memset(ctx, 0, sizeof(*ctx));
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "predator_crypto_aes.h"
+#include "predator_crypto_3des.h"
+
+/**
+ * CMAC (NIST SP 800-38B) over AES-128 and 2-key/3-key 3DES
+ *
+ * Used by: MIFARE DESFire EV1/EV2 secure messaging, Calypso/SAM sessions
+ *
+ * The key schedule and the K1/K2 subkeys are derived once in
+ * predator_cmac_init and kept for the whole session; each MAC then only
+ * needs predator_cmac_start/update/final. Data is processed as it arrives
+ * (only the last block is held back), so long file reads can be MACed
+ * chunk by chunk without buffering the file.
+ */
+
+#define PREDATOR_CMAC_MAX_BLOCK 16
+
+typedef enum {
+    PredatorCmacAES128,   // 16-byte key, 16-byte MAC
+    PredatorCmac2K3DES,   // 16-byte key (K1 || K2), 8-byte MAC
+    PredatorCmac3K3DES,   // 24-byte key (K1 || K2 || K3), 8-byte MAC
+} PredatorCmacCipher;
+
+typedef struct {
+    PredatorCmacCipher cipher;
+    uint8_t block_size;                       // 16 (AES) or 8 (3DES)
+    union {
+        AESContext aes;
+        DES3Context des3;
+    } key;
+    uint8_t k1[PREDATOR_CMAC_MAX_BLOCK];      // Subkey for a complete last block
+    uint8_t k2[PREDATOR_CMAC_MAX_BLOCK];      // Subkey for a padded last block
+    uint8_t state[PREDATOR_CMAC_MAX_BLOCK];   // Running CBC-MAC value
+    uint8_t last[PREDATOR_CMAC_MAX_BLOCK];    // Held-back final block
+    uint8_t last_len;
+} PredatorCmac;
+
+/**
+ * Expand key and derive subkeys K1/K2 (once per session)
+ * @param ctx CMAC context
+ * @param cipher Block cipher and key size
+ * @param key Key bytes (16 or 24)
+ * @return true if successful; ctx is started with a zero IV
+ */
+bool predator_cmac_init(PredatorCmac* ctx, PredatorCmacCipher cipher, const uint8_t* key);
+
+/**
+ * Begin a new MAC with the cached key
+ * @param ctx Initialized CMAC context
+ * @param iv Chaining value (block_size bytes), NULL for all zeros
+ */
+void predator_cmac_start(PredatorCmac* ctx, const uint8_t* iv);
+
+/**
+ * Feed message bytes (any chunk size)
+ */
+bool predator_cmac_update(PredatorCmac* ctx, const uint8_t* data, size_t len);
+
+/**
+ * Finish the MAC
+ * @param ctx CMAC context
+ * @param mac Output (block_size bytes)
+ * @return true if successful; call predator_cmac_start before the next MAC
+ */
+bool predator_cmac_final(PredatorCmac* ctx, uint8_t* mac);
+
+/**
+ * One-shot CMAC with a zero IV
+ * @param mac Output (16 bytes for AES, 8 for 3DES)
+ */
+bool predator_cmac(PredatorCmacCipher cipher, const uint8_t* key, const uint8_t* data, size_t len, uint8_t* mac);
+
+/**
+ * Clear key material from a context
+ */
+void predator_cmac_wipe(PredatorCmac* ctx);
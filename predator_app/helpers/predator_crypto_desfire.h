@@ -3,6 +3,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include "predator_crypto_cmac.h"
 
 /**
  * MIFARE DESFire EV1/EV2/EV3 Implementation
@@ -71,9 +72,10 @@ typedef struct {
     uint8_t key_len;            // Key length
     
     // Session keys
-    uint8_t session_key_enc[16];     // Encryption session key
-    uint8_t session_key_mac[16];     // MAC session key
-    uint8_t iv[16];                  // IV for CBC mode
+    uint8_t session_key_enc[24];     // Encryption session key
+    uint8_t session_key_mac[24];     // MAC session key
+    uint8_t session_key_len;         // 16 (AES, 2K3DES) or 24 (3K3DES)
+    uint8_t iv[16];                  // IV for CBC mode / CMAC chaining
     
     // Authentication state
     bool authenticated;
@@ -345,9 +347,10 @@ uint32_t desfire_attack_dictionary(struct PredatorApp* app, DESFireCard* card,
                                    DESFireContext* found_keys, uint32_t max_keys);
 
 /**
- * Dump all applications and files
- * @param app PredatorApp context
- * @param ctx Authenticated context
+ * Dump all applications and files to a .pdmp (predator_dump.h), one area per
+ * application file. Plain files only; refused units are recorded as missing.
+ * @param app PredatorApp context (storage)
+ * @param ctx Authenticated context, or NULL (not used until secure messaging)
  * @param output_path Path to save dump
  * @return true if successful
  */
@@ -373,8 +376,8 @@ bool desfire_clone_card(struct PredatorApp* app, DESFireCard* source, DESFireCar
 uint32_t desfire_crc32(const uint8_t* data, uint32_t len);
 
 /**
- * Calculate CMAC (Cipher-based MAC)
- * @param key Session key
+ * Calculate CMAC (Cipher-based MAC), AES-128 with a zero IV
+ * @param key Session key (16 bytes)
  * @param data Data to authenticate
  * @param len Data length
  * @param cmac Output CMAC (16 bytes)
@@ -391,6 +394,26 @@ bool desfire_cmac(const uint8_t* key, const uint8_t* data, uint32_t len, uint8_t
  */
 bool desfire_generate_session_keys(DESFireContext* ctx, const uint8_t* rnd_a, const uint8_t* rnd_b);
 
+/**
+ * Set up a CMAC for the current session (once per authentication)
+ * @param ctx Authenticated DESFire context (session keys generated)
+ * @param cmac CMAC context keyed with the session MAC key
+ * @return true if successful
+ */
+bool desfire_session_cmac_init(const DESFireContext* ctx, PredatorCmac* cmac);
+
+/**
+ * Start a secure-messaging MAC chained from the session IV; feed the
+ * command or response with predator_cmac_update (in any number of chunks)
+ */
+void desfire_session_cmac_begin(const DESFireContext* ctx, PredatorCmac* cmac);
+
+/**
+ * Finish a secure-messaging MAC: stores it in ctx->cmac and chains it as
+ * the next IV (EV1 native mode)
+ */
+bool desfire_session_cmac_end(DESFireContext* ctx, PredatorCmac* cmac);
+
 // ========== Default Keys ==========
 
 // Factory default keys (publicly known - ALWAYS change these!)
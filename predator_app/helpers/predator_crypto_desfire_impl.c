@@ -0,0 +1,491 @@
+#include "predator_crypto_desfire.h"
+#include "predator_nfc_transport.h"
+#include "predator_dump.h"
+#include "../predator_i.h"
+#include <string.h>
+
+// MIFARE DESFire secure messaging: session keys and CMAC chaining
+// (EV1 native mode and EV2 AuthenticateEV2First), plus the plain native
+// commands a card dump needs, sent ISO 7816-wrapped (CLA 90)
+
+// Native command codes
+#define DESFIRE_CMD_GET_VERSION       0x60
+#define DESFIRE_CMD_GET_APP_IDS       0x6A
+#define DESFIRE_CMD_SELECT_APP        0x5A
+#define DESFIRE_CMD_GET_FILE_IDS      0x6F
+#define DESFIRE_CMD_GET_FILE_SETTINGS 0xF5
+#define DESFIRE_CMD_READ_DATA         0xBD
+#define DESFIRE_CMD_READ_RECORDS      0xBB
+#define DESFIRE_CMD_GET_VALUE         0x6C
+#define DESFIRE_CMD_ADDITIONAL_FRAME  0xAF
+
+#define DESFIRE_SW_OK   0x9100
+#define DESFIRE_SW_MORE 0x91AF
+#define DESFIRE_MAX_APPS 28       // EV1/EV2 application limit
+#define DESFIRE_DUMP_CHUNK 32     // Data file bytes per ReadData (one frame, one dump unit)
+
+// ========== CMAC ==========
+
+bool desfire_cmac(const uint8_t* key, const uint8_t* data, uint32_t len, uint8_t* cmac) {
+    if(!key || (!data && len > 0) || !cmac) return false;
+    return predator_cmac(PredatorCmacAES128, key, data, len, cmac);
+}
+
+// ========== SESSION KEYS ==========
+
+// EV2 session vectors: label || 00 01 00 80 || RndA[15:14] ||
+// (RndA[13:8] ^ RndB[15:10]) || RndB[9:0] || RndA[7:0] (byte 15 first)
+static void desfire_ev2_session_vector(
+    uint8_t label0, uint8_t label1, const uint8_t* rnd_a, const uint8_t* rnd_b, uint8_t* sv) {
+    sv[0] = label0;
+    sv[1] = label1;
+    sv[2] = 0x00;
+    sv[3] = 0x01;
+    sv[4] = 0x00;
+    sv[5] = 0x80;
+    memcpy(&sv[6], &rnd_a[0], 2);
+    for(int i = 0; i < 6; i++) sv[8 + i] = rnd_a[2 + i] ^ rnd_b[i];
+    memcpy(&sv[14], &rnd_b[6], 10);
+    memcpy(&sv[24], &rnd_a[8], 8);
+}
+
+bool desfire_generate_session_keys(DESFireContext* ctx, const uint8_t* rnd_a, const uint8_t* rnd_b) {
+    if(!ctx || !rnd_a || !rnd_b) return false;
+    uint8_t* key = ctx->session_key_enc;
+
+    switch(ctx->auth_method) {
+    case DESFireAuthLegacyDES:
+        // Single DES: RndA[0..3] || RndB[0..3], doubled into a 2-key form
+        memcpy(&key[0], &rnd_a[0], 4);
+        memcpy(&key[4], &rnd_b[0], 4);
+        memcpy(&key[8], &key[0], 8);
+        ctx->session_key_len = 16;
+        break;
+    case DESFireAuth3DES:
+        memcpy(&key[0], &rnd_a[0], 4);
+        memcpy(&key[4], &rnd_b[0], 4);
+        if(memcmp(&ctx->key[0], &ctx->key[8], 8) == 0) {
+            // K1 == K2 is single DES in 3DES form: session key stays single DES
+            memcpy(&key[8], &key[0], 8);
+        } else {
+            memcpy(&key[8], &rnd_a[4], 4);
+            memcpy(&key[12], &rnd_b[4], 4);
+        }
+        ctx->session_key_len = 16;
+        break;
+    case DESFireAuth3K3DES:
+        memcpy(&key[0], &rnd_a[0], 4);
+        memcpy(&key[4], &rnd_b[0], 4);
+        memcpy(&key[8], &rnd_a[6], 4);
+        memcpy(&key[12], &rnd_b[6], 4);
+        memcpy(&key[16], &rnd_a[12], 4);
+        memcpy(&key[20], &rnd_b[12], 4);
+        ctx->session_key_len = 24;
+        break;
+    case DESFireAuthAES128:
+        memcpy(&key[0], &rnd_a[0], 4);
+        memcpy(&key[4], &rnd_b[0], 4);
+        memcpy(&key[8], &rnd_a[12], 4);
+        memcpy(&key[12], &rnd_b[12], 4);
+        ctx->session_key_len = 16;
+        break;
+    case DESFireAuthEV2: {
+        // Separate ENC/MAC keys: CMAC(Kx, SV1) and CMAC(Kx, SV2)
+        uint8_t sv[32];
+        PredatorCmac cmac;
+        if(!predator_cmac_init(&cmac, PredatorCmacAES128, ctx->key)) return false;
+        desfire_ev2_session_vector(0xA5, 0x5A, rnd_a, rnd_b, sv);
+        predator_cmac_update(&cmac, sv, sizeof(sv));
+        predator_cmac_final(&cmac, ctx->session_key_enc);
+        desfire_ev2_session_vector(0x5A, 0xA5, rnd_a, rnd_b, sv);
+        predator_cmac_start(&cmac, NULL);
+        predator_cmac_update(&cmac, sv, sizeof(sv));
+        predator_cmac_final(&cmac, ctx->session_key_mac);
+        predator_cmac_wipe(&cmac);
+        memset(sv, 0, sizeof(sv));
+        ctx->session_key_len = 16;
+        break;
+    }
+    default:
+        return false;
+    }
+
+    // EV1: one session key for both encryption and MAC
+    if(ctx->auth_method != DESFireAuthEV2) {
+        memcpy(ctx->session_key_mac, ctx->session_key_enc, ctx->session_key_len);
+    }
+
+    // Fresh session: IV and CMAC chain start from zero
+    memset(ctx->iv, 0, sizeof(ctx->iv));
+    memset(ctx->cmac, 0, sizeof(ctx->cmac));
+    return true;
+}
+
+// ========== SECURE MESSAGING CMAC ==========
+
+bool desfire_session_cmac_init(const DESFireContext* ctx, PredatorCmac* cmac) {
+    if(!ctx || !cmac) return false;
+
+    PredatorCmacCipher cipher;
+    switch(ctx->auth_method) {
+    case DESFireAuthAES128:
+    case DESFireAuthEV2:
+        cipher = PredatorCmacAES128;
+        break;
+    case DESFireAuth3K3DES:
+        cipher = PredatorCmac3K3DES;
+        break;
+    default:
+        cipher = PredatorCmac2K3DES;
+        break;
+    }
+    return predator_cmac_init(cmac, cipher, ctx->session_key_mac);
+}
+
+void desfire_session_cmac_begin(const DESFireContext* ctx, PredatorCmac* cmac) {
+    if(!ctx || !cmac) return;
+    predator_cmac_start(cmac, ctx->iv);
+}
+
+bool desfire_session_cmac_end(DESFireContext* ctx, PredatorCmac* cmac) {
+    if(!ctx || !cmac) return false;
+    memset(ctx->cmac, 0, sizeof(ctx->cmac));
+    if(!predator_cmac_final(cmac, ctx->cmac)) return false;
+    memcpy(ctx->iv, ctx->cmac, cmac->block_size);
+    return true;
+}
+
+// ========== NATIVE COMMANDS ==========
+
+static void desfire_put24(uint8_t* out, uint32_t value) {
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+    out[2] = (value >> 16) & 0xFF;
+}
+
+static uint32_t desfire_get24(const uint8_t* in) {
+    return in[0] | (in[1] << 8) | ((uint32_t)in[2] << 16);
+}
+
+// Send one wrapped native command and collect the answer, following 91AF
+// with Additional Frame until the card is done
+// @return Final status word (9100 on success), 0 if the card didn't answer
+//         or the answer doesn't fit data_max
+static uint16_t desfire_exchange(uint8_t command, const uint8_t* params, size_t params_len,
+                                 uint8_t* data, size_t data_max, size_t* data_len) {
+    uint8_t cmd[6 + 16];
+    uint8_t response[64];
+    *data_len = 0;
+    if(params_len > 16) return 0;
+
+    for(;;) {
+        size_t cmd_len = 0;
+        cmd[cmd_len++] = 0x90;
+        cmd[cmd_len++] = command;
+        cmd[cmd_len++] = 0x00;
+        cmd[cmd_len++] = 0x00;
+        if(params_len) {
+            cmd[cmd_len++] = (uint8_t)params_len;
+            memcpy(&cmd[cmd_len], params, params_len);
+            cmd_len += params_len;
+        }
+        cmd[cmd_len++] = 0x00;  // Le
+
+        size_t response_len = 0;
+        predator_nfc_transceive(PredatorNfcTechIso14443a, cmd, cmd_len, response,
+                                sizeof(response), &response_len, PREDATOR_NFC_TIMEOUT_US);
+        if(response_len < 2) return 0;
+
+        const size_t len = response_len - 2;
+        const uint16_t sw = (response[len] << 8) | response[len + 1];
+        if(sw != DESFIRE_SW_OK && sw != DESFIRE_SW_MORE) return sw;
+        if(*data_len + len > data_max) {
+            FURI_LOG_W("DESFire", "Answer to %02X exceeds %zu bytes", command, data_max);
+            return 0;
+        }
+        if(len) memcpy(&data[*data_len], response, len);
+        *data_len += len;
+        if(sw == DESFIRE_SW_OK) return sw;
+
+        command = DESFIRE_CMD_ADDITIONAL_FRAME;
+        params_len = 0;
+    }
+}
+
+bool desfire_get_version(PredatorApp* app, DESFireCard* card) {
+    if(!app || !card) return false;
+
+    // Hardware (7), software (7), UID (7), batch (5), production week and year
+    uint8_t version[28];
+    size_t len;
+    if(desfire_exchange(DESFIRE_CMD_GET_VERSION, NULL, 0, version, sizeof(version), &len) !=
+           DESFIRE_SW_OK ||
+       len < 21) {
+        return false;
+    }
+
+    memcpy(card->hardware_info, &version[0], 7);
+    memcpy(card->software_info, &version[7], 7);
+    memcpy(card->uid, &version[14], 7);
+    card->uid_len = 7;
+
+    const uint8_t major = card->software_info[3];
+    card->version = major >= 0x30 ? DESFireEV3 : major >= 0x12 ? DESFireEV2 : DESFireEV1;
+    return true;
+}
+
+uint32_t desfire_get_application_ids(PredatorApp* app, uint32_t* aids, uint32_t max_aids) {
+    if(!app || !aids) return 0;
+
+    uint8_t data[DESFIRE_MAX_APPS * 3];
+    size_t len;
+    if(desfire_exchange(DESFIRE_CMD_GET_APP_IDS, NULL, 0, data, sizeof(data), &len) !=
+       DESFIRE_SW_OK) {
+        return 0;
+    }
+
+    uint32_t count = 0;
+    for(size_t pos = 0; pos + 3 <= len && count < max_aids; pos += 3) {
+        aids[count++] = desfire_get24(&data[pos]);
+    }
+    return count;
+}
+
+bool desfire_select_application(PredatorApp* app, uint32_t aid) {
+    if(!app) return false;
+
+    uint8_t params[3];
+    desfire_put24(params, aid);
+    size_t len;
+    return desfire_exchange(DESFIRE_CMD_SELECT_APP, params, sizeof(params), NULL, 0, &len) ==
+           DESFIRE_SW_OK;
+}
+
+uint32_t desfire_get_file_ids(PredatorApp* app, uint8_t* file_ids, uint32_t max_files) {
+    if(!app || !file_ids) return 0;
+
+    uint8_t data[32];
+    size_t len;
+    if(desfire_exchange(DESFIRE_CMD_GET_FILE_IDS, NULL, 0, data, sizeof(data), &len) !=
+       DESFIRE_SW_OK) {
+        return 0;
+    }
+
+    if(len > max_files) len = max_files;
+    memcpy(file_ids, data, len);
+    return len;
+}
+
+bool desfire_get_file_settings(PredatorApp* app, uint8_t file_id, DESFireFileSettings* settings) {
+    if(!app || !settings) return false;
+
+    uint8_t data[32];
+    size_t len;
+    if(desfire_exchange(DESFIRE_CMD_GET_FILE_SETTINGS, &file_id, 1, data, sizeof(data), &len) !=
+           DESFIRE_SW_OK ||
+       len < 7) {
+        return false;
+    }
+
+    memset(settings, 0, sizeof(DESFireFileSettings));
+    if(data[0] > DESFireFileCyclicRecord) return false;
+    settings->file_type = (DESFireFileType)data[0];
+    switch(data[1] & 0x03) {
+    case 0x01:
+        settings->comm_mode = DESFireCommMACed;
+        break;
+    case 0x03:
+        settings->comm_mode = DESFireCommEncrypted;
+        break;
+    default:
+        settings->comm_mode = DESFireCommPlain;
+        break;
+    }
+    settings->access_rights = data[2] | (data[3] << 8);
+
+    switch(settings->file_type) {
+    case DESFireFileStandard:
+    case DESFireFileBackup:
+        settings->file_size = desfire_get24(&data[4]);
+        return true;
+    case DESFireFileValue:
+        if(len < 17) return false;
+        memcpy(&settings->lower_limit, &data[4], 4);
+        memcpy(&settings->upper_limit, &data[8], 4);
+        memcpy(&settings->value, &data[12], 4);  // Limited credit value
+        settings->limited_credit = data[16];
+        return true;
+    default:
+        if(len < 13) return false;
+        settings->record_size = desfire_get24(&data[4]);
+        settings->max_records = desfire_get24(&data[7]);
+        settings->current_records = desfire_get24(&data[10]);
+        return true;
+    }
+}
+
+static uint16_t desfire_read_data_sw(uint8_t file_id, uint32_t offset, uint32_t length,
+                                     uint8_t* data, size_t* data_len) {
+    uint8_t params[7] = {file_id};
+    desfire_put24(&params[1], offset);
+    desfire_put24(&params[4], length);
+    return desfire_exchange(DESFIRE_CMD_READ_DATA, params, sizeof(params), data, length,
+                            data_len);
+}
+
+uint32_t desfire_read_data(PredatorApp* app, DESFireContext* ctx,
+                           uint8_t file_id, uint32_t offset, uint32_t length, uint8_t* data) {
+    if(!app || !data || length == 0) return 0;
+    // Plain transfers only: MAC checking and deciphering aren't on the transport yet
+    if(ctx && ctx->authenticated && ctx->comm_mode != DESFireCommPlain) {
+        FURI_LOG_W("DESFire", "File %u: only plain reads are supported", file_id);
+        return 0;
+    }
+
+    size_t len;
+    if(desfire_read_data_sw(file_id, offset, length, data, &len) != DESFIRE_SW_OK) return 0;
+    return len;
+}
+
+// Value as sent by the card (LE32)
+static uint16_t desfire_get_value_sw(uint8_t file_id, uint8_t* raw) {
+    size_t len;
+    const uint16_t sw = desfire_exchange(DESFIRE_CMD_GET_VALUE, &file_id, 1, raw, 4, &len);
+    return sw == DESFIRE_SW_OK && len != 4 ? 0 : sw;
+}
+
+bool desfire_get_value(PredatorApp* app, DESFireContext* ctx, uint8_t file_id, int32_t* value) {
+    UNUSED(ctx);
+    if(!app || !value) return false;
+    uint8_t raw[4];
+    if(desfire_get_value_sw(file_id, raw) != DESFIRE_SW_OK) return false;
+    *value = (int32_t)(raw[0] | (raw[1] << 8) | (raw[2] << 16) | ((uint32_t)raw[3] << 24));
+    return true;
+}
+
+// ========== DUMP ==========
+
+// Data file: one DESFIRE_DUMP_CHUNK unit per ReadData, straight to SD.
+// The first refusal (usually 91AE, authentication needed) ends the file.
+static uint32_t desfire_dump_data_file(PredatorDumpWriter* dump, uint8_t file_id,
+                                       uint32_t file_size) {
+    uint8_t chunk[DESFIRE_DUMP_CHUNK];
+    uint32_t units = 0;
+    for(uint32_t offset = 0; offset < file_size; offset += DESFIRE_DUMP_CHUNK) {
+        const uint16_t index = offset / DESFIRE_DUMP_CHUNK;
+        const uint32_t want =
+            file_size - offset < DESFIRE_DUMP_CHUNK ? file_size - offset : DESFIRE_DUMP_CHUNK;
+        size_t len;
+        const uint16_t sw = desfire_read_data_sw(file_id, offset, want, chunk, &len);
+        if(sw != DESFIRE_SW_OK || len != want) {
+            predator_dump_missing(dump, index, sw);
+            break;
+        }
+        predator_dump_unit(dump, index, chunk, len);
+        units++;
+    }
+    return units;
+}
+
+// Record file: one record per unit, oldest first
+static uint32_t desfire_dump_record_file(PredatorDumpWriter* dump, uint8_t file_id,
+                                         const DESFireFileSettings* settings) {
+    uint8_t record[PREDATOR_DUMP_MAX_VALUE - 2];
+    if(settings->record_size == 0 || settings->record_size > sizeof(record)) {
+        FURI_LOG_W("DESFire", "File %u: %lu-byte records not dumped", file_id,
+                   settings->record_size);
+        return 0;
+    }
+
+    uint32_t units = 0;
+    for(uint32_t i = 0; i < settings->current_records; i++) {
+        // Record offsets count back from the newest
+        uint8_t params[7] = {file_id};
+        desfire_put24(&params[1], settings->current_records - 1 - i);
+        desfire_put24(&params[4], 1);
+        size_t len;
+        const uint16_t sw = desfire_exchange(DESFIRE_CMD_READ_RECORDS, params, sizeof(params),
+                                             record, settings->record_size, &len);
+        if(sw != DESFIRE_SW_OK || len != settings->record_size) {
+            predator_dump_missing(dump, i, sw);
+            break;
+        }
+        predator_dump_unit(dump, i, record, len);
+        units++;
+    }
+    return units;
+}
+
+bool desfire_dump_card(PredatorApp* app, DESFireContext* ctx, const char* output_path) {
+    // Plain files only for now; ctx is for secure messaging once it reaches the transport
+    UNUSED(ctx);
+    if(!app || !app->storage || !output_path) return false;
+
+    DESFireCard card;
+    memset(&card, 0, sizeof(card));
+    if(!desfire_get_version(app, &card)) return false;
+
+    PredatorDumpWriter* dump = predator_dump_writer_open(
+        app->storage, output_path, PredatorDumpCardDesfire, card.uid, card.uid_len);
+    if(!dump) return false;
+
+    uint8_t info[14];
+    memcpy(&info[0], card.hardware_info, 7);
+    memcpy(&info[7], card.software_info, 7);
+    predator_dump_info(dump, info, sizeof(info));
+
+    uint32_t aids[DESFIRE_MAX_APPS];
+    const uint32_t app_count = desfire_get_application_ids(app, aids, DESFIRE_MAX_APPS);
+    uint32_t total = 0;
+
+    for(uint32_t a = 0; a < app_count; a++) {
+        if(!desfire_select_application(app, aids[a])) continue;
+        uint8_t file_ids[32];
+        const uint32_t file_count = desfire_get_file_ids(app, file_ids, sizeof(file_ids));
+
+        for(uint32_t f = 0; f < file_count; f++) {
+            const uint32_t area = (aids[a] << 8) | file_ids[f];
+            DESFireFileSettings settings;
+            if(!desfire_get_file_settings(app, file_ids[f], &settings)) {
+                predator_dump_area(dump, area, 0, 0);
+                continue;
+            }
+
+            switch(settings.file_type) {
+            case DESFireFileStandard:
+            case DESFireFileBackup: {
+                const uint32_t units =
+                    (settings.file_size + DESFIRE_DUMP_CHUNK - 1) / DESFIRE_DUMP_CHUNK;
+                predator_dump_area(
+                    dump, area, DESFIRE_DUMP_CHUNK, units > 0xFFFF ? 0xFFFF : units);
+                total += desfire_dump_data_file(dump, file_ids[f], settings.file_size);
+                break;
+            }
+            case DESFireFileValue: {
+                predator_dump_area(dump, area, 4, 1);
+                uint8_t value[4];
+                const uint16_t sw = desfire_get_value_sw(file_ids[f], value);
+                if(sw == DESFIRE_SW_OK) {
+                    predator_dump_unit(dump, 0, value, sizeof(value));
+                    total++;
+                } else {
+                    predator_dump_missing(dump, 0, sw);
+                }
+                break;
+            }
+            default:
+                predator_dump_area(
+                    dump, area,
+                    settings.record_size > 0xFF ? 0 : settings.record_size,
+                    settings.current_records > 0xFFFF ? 0xFFFF : settings.current_records);
+                total += desfire_dump_record_file(dump, file_ids[f], &settings);
+                break;
+            }
+        }
+    }
+
+    bool ok = predator_dump_writer_close(dump);
+    FURI_LOG_I("DESFire", "Dumped %lu units from %lu applications to %s",
+               total, app_count, output_path);
+    return ok;
+}
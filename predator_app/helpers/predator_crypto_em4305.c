@@ -1,4 +1,6 @@
 #include "predator_crypto_em4305.h"
+#include "predator_dict.h"
+#include "predator_dump.h"
 #include "../predator_i.h"
 #include <string.h>
 #include <furi_hal.h>
@@ -464,44 +466,39 @@ bool em4305_bruteforce_password(PredatorApp* app, uint32_t start_password,
     return false;
 }
 
-// Common EM4305 passwords (public knowledge)
-static const uint32_t em4305_common_passwords[] = {
-    0x00000000, 0xFFFFFFFF, 0x12345678, 0x11111111, 0x00000001,
-    0x01234567, 0x51243648, 0x19920427, 0x00000000, 0xF0F0F0F0
-};
-
 bool em4305_attack_dictionary(PredatorApp* app, uint32_t* found_password) {
     if(!app || !found_password) return false;
     
-    uint32_t count = sizeof(em4305_common_passwords) / sizeof(em4305_common_passwords[0]);
+    // Site dictionary from SD first (priority ordered), else built-in EM4305 list
+    PredatorKeyIter keys;
+    predator_key_iter_begin(&keys, app->storage, PredatorKeyDictEM4305);
     
-    FURI_LOG_I("EM4305", "Dictionary attack: %lu passwords", count);
+    FURI_LOG_I("EM4305", "Dictionary attack: %u passwords (%s)",
+              (unsigned)predator_key_iter_count(&keys),
+              predator_key_iter_from_sd(&keys) ? "SD" : "built-in");
     
-    for(uint32_t i = 0; i < count; i++) {
-        uint32_t pwd = em4305_common_passwords[i];
-        
+    uint32_t pwd;
+    bool found = false;
+    while(predator_key_iter_next(&keys, &pwd)) {
         if(em4305_login(app, pwd)) {
             *found_password = pwd;
             FURI_LOG_I("EM4305", "PASSWORD FOUND: 0x%08lX", pwd);
-            return true;
+            found = true;
+            break;
         }
         
         furi_delay_ms(10);
     }
+    predator_key_iter_end(&keys);
     
-    FURI_LOG_I("EM4305", "No common password matched");
-    return false;
+    if(!found) FURI_LOG_I("EM4305", "No common password matched");
+    return found;
 }
 
 uint32_t em4305_load_common_passwords(uint32_t* passwords, uint32_t max_passwords) {
     if(!passwords || max_passwords == 0) return 0;
     
-    uint32_t count = sizeof(em4305_common_passwords) / sizeof(em4305_common_passwords[0]);
-    if(count > max_passwords) count = max_passwords;
-    
-    memcpy(passwords, em4305_common_passwords, count * sizeof(uint32_t));
-    
-    return count;
+    return (uint32_t)predator_keys_read(PredatorKeyDictEM4305, 0, max_passwords, passwords);
 }
 
 // ========== SNIFFING ==========
@@ -556,6 +553,20 @@ bool em4305_read_all_blocks(PredatorApp* app, EM4305Tag* tag) {
     return false;  // Placeholder
 }
 
+bool em4305_dump_tag(PredatorApp* app, const EM4305Tag* tag, const char* output_path) {
+    if(!app || !app->storage || !tag || !output_path) return false;
+    
+    // Block 1 holds the UID on EM4305/EM4469
+    PredatorDumpWriter* dump = predator_dump_writer_open(
+        app->storage, output_path, PredatorDumpCardEm4305, tag->data_blocks[1], 4);
+    if(!dump) return false;
+    
+    predator_dump_info(dump, tag->config.config_word, sizeof(tag->config.config_word));
+    predator_dump_area(dump, 0, 4, COUNT_OF(tag->data_blocks));
+    predator_dump_units(dump, 0, &tag->data_blocks[0][0], 4, COUNT_OF(tag->data_blocks));
+    return predator_dump_writer_close(dump);
+}
+
 bool em4305_read_em4100(PredatorApp* app, uint64_t* card_data) {
     // Read as EM4100
     return em4305_sniff_em4100(app, card_data, 5000);
@@ -580,9 +591,5 @@ bool em4305_lock_tag(PredatorApp* app, const EM4305Config* config) {
     return false;  // Safety: don't implement without explicit confirmation
 }
 
-// Exports for common passwords
+// Export for default password
 const uint32_t EM4305_PASSWORD_DEFAULT = 0x00000000;
-const uint32_t EM4305_PASSWORD_COMMON[] = {
-    0x00000000, 0xFFFFFFFF, 0x12345678, 0x11111111
-};
-const uint32_t EM4305_PASSWORD_COUNT = 4;
@@ -107,6 +107,15 @@ bool em4305_read_block(struct PredatorApp* app, uint8_t block_address, uint8_t*
  */
 bool em4305_read_all_blocks(struct PredatorApp* app, EM4305Tag* tag);
 
+/**
+ * Save tag blocks and config word to a .pdmp dump (predator_dump.h)
+ * @param app PredatorApp context
+ * @param tag Tag read with em4305_read_all_blocks
+ * @param output_path Path to save dump
+ * @return true if successful
+ */
+bool em4305_dump_tag(struct PredatorApp* app, const EM4305Tag* tag, const char* output_path);
+
 /**
  * Read as EM4100 format (for cloned tags)
  * @param app PredatorApp context
@@ -318,12 +327,12 @@ bool em4305_parse_hid_data(uint64_t hid_data, uint8_t format,
 
 // ========== Common Default Passwords ==========
 
+// Full password list: PredatorKeyDictEM4305 (predator_crypto_keys.h), or a
+// site dictionary on SD via PredatorKeyIter (predator_dict.h)
 extern const uint32_t EM4305_PASSWORD_DEFAULT;
-extern const uint32_t EM4305_PASSWORD_COMMON[];
-extern const uint32_t EM4305_PASSWORD_COUNT;
 
 /**
- * Load common passwords for dictionary attack
+ * Load common passwords (built-in EM4305 dictionary) for dictionary attack
  * @param passwords Output password array
  * @param max_passwords Maximum passwords
  * @return Number of passwords loaded
@@ -43,6 +43,22 @@ struct PredatorApp;
 #define FELICA_SERVICE_EDY_HISTORY    0x170F  // Edy transaction history
 #define FELICA_SERVICE_EDY_BALANCE    0x1317  // Edy balance
 
+// Read Without Encryption limits
+#define FELICA_MAX_BLOCKS_PER_READ    15      // 13 + 16 * 15 bytes fits one response frame
+#define FELICA_LITE_BLOCKS_PER_READ   4       // FeliCa Lite / Lite-S
+#define FELICA_MAX_SERVICES_PER_READ  16      // Service index is 4 bits
+#define FELICA_SUICA_HISTORY_BLOCKS   20
+
+// Response time classes, one PMm byte each (PMm[2..7])
+typedef enum {
+    FeliCaCmdRequestService,     // Request Service (per node)
+    FeliCaCmdRequestResponse,    // Fixed-time commands (Request Response, System Code)
+    FeliCaCmdAuthentication,     // Authentication1/2 (per service)
+    FeliCaCmdRead,               // Read (per block)
+    FeliCaCmdWrite,              // Write (per block)
+    FeliCaCmdOther,              // Issuance and other commands
+} FeliCaCommandClass;
+
 // Card types
 typedef enum {
     FeliCa_Unknown,
@@ -200,6 +216,36 @@ uint32_t felica_read_without_encryption(struct PredatorApp* app, const FeliCaCar
                                        uint16_t service_code, const uint8_t* block_list,
                                        uint8_t block_count, uint8_t* data);
 
+/**
+ * Read blocks from one or more services in as few frames as the card allows
+ * @param app PredatorApp context
+ * @param card Card structure (IDm, PMm)
+ * @param service_codes Services; block list elements index into this list
+ * @param service_count Number of services (1..16)
+ * @param block_list 2-byte block list elements (0x80 | service index, block)
+ * @param block_count Number of blocks
+ * @param data Output data buffer (block_count * 16 bytes)
+ * @return Number of leading blocks read
+ */
+uint32_t felica_read_blocks(struct PredatorApp* app, const FeliCaCard* card,
+                            const uint16_t* service_codes, uint8_t service_count,
+                            const uint8_t* block_list, uint8_t block_count, uint8_t* data);
+
+/**
+ * Blocks per Read Without Encryption the card accepts (from the PMm IC type)
+ */
+uint8_t felica_max_read_blocks(const FeliCaCard* card);
+
+/**
+ * Maximum response time advertised in PMm
+ * T = 302.1 us * ((B + 1) * units + A + 1) * 4^E
+ * @param card Card structure (PMm)
+ * @param cmd Command class
+ * @param units Blocks, services or nodes in the command
+ * @return Timeout in microseconds (transport default if PMm is unknown)
+ */
+uint32_t felica_response_timeout_us(const FeliCaCard* card, FeliCaCommandClass cmd, uint8_t units);
+
 /**
  * Read balance (for transit/payment cards)
  * @param app PredatorApp context
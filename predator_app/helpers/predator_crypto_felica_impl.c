@@ -1,5 +1,9 @@
 #include "predator_crypto_felica.h"
 #include "predator_crypto_3des.h"
+#include "predator_crypto_keydiv.h"
+#include "predator_crc.h"
+#include "predator_nfc_transport.h"
+#include "predator_dump.h"
 #include "../predator_i.h"
 #include <string.h>
 
@@ -21,12 +25,9 @@
 
 // ========== CHECKSUM (FeliCa CRC) ==========
 
+// CRC-16/XMODEM over LEN + payload, sent MSB first (JIS X 6319-4)
 uint16_t felica_checksum(const uint8_t* data, uint32_t len) {
-    uint16_t sum = 0;
-    for(uint32_t i = 0; i < len; i++) {
-        sum += data[i];
-    }
-    return sum;
+    return (uint16_t)predator_crc(PredatorCrc16Xmodem, data, len);
 }
 
 // ========== CARD IDENTIFICATION ==========
@@ -143,7 +144,9 @@ bool felica_authenticate_mutual(PredatorApp* app, const FeliCaCard* card,
     uint8_t response[32];
     size_t response_len = 0;
     
-    // Real: furi_hal_nfc_felica_transceive(cmd, 19, response, &response_len);
+    predator_nfc_transceive(PredatorNfcTechFelica, cmd, 19, response, sizeof(response),
+                            &response_len,
+                            felica_response_timeout_us(card, FeliCaCmdAuthentication, 0));
     
     // Step 3: Extract RC from response
     if(response_len >= 18) {
@@ -159,64 +162,137 @@ bool felica_authenticate_mutual(PredatorApp* app, const FeliCaCard* card,
 
 // ========== READ OPERATIONS ==========
 
+// PMm response time unit: 256 * 16 / fc
+#define FELICA_PMM_UNIT_NS 302100
+
+uint32_t felica_response_timeout_us(const FeliCaCard* card, FeliCaCommandClass cmd, uint8_t units) {
+    if(!card || cmd > FeliCaCmdOther) return PREDATOR_NFC_TIMEOUT_US;
+    
+    // All-zero timing bytes: card not polled yet
+    bool known = false;
+    for(size_t i = 2; i < 8; i++) known |= card->pmm[i] != 0;
+    if(!known) return PREDATOR_NFC_TIMEOUT_US;
+    
+    // Bits 2-0: A, bits 5-3: B, bits 7-6: E
+    const uint8_t p = card->pmm[2 + cmd];
+    const uint64_t a = p & 0x07;
+    const uint64_t b = (p >> 3) & 0x07;
+    const uint32_t e = p >> 6;
+    const uint64_t ns = FELICA_PMM_UNIT_NS * ((b + 1) * units + a + 1) << (2 * e);
+    return (uint32_t)((ns + 999) / 1000);
+}
+
+uint8_t felica_max_read_blocks(const FeliCaCard* card) {
+    if(!card) return 1;
+    
+    // PMm[1] is the IC type; FeliCa Lite and Lite-S take 4 blocks
+    if(card->pmm[1] == 0xF0 || card->pmm[1] == 0xF1) return FELICA_LITE_BLOCKS_PER_READ;
+    return FELICA_MAX_BLOCKS_PER_READ;
+}
+
+// One Read Without Encryption frame: blocks read, 0 on error status,
+// -1 if the card did not answer
+static int32_t felica_read_frame(const FeliCaCard* card,
+                                 const uint16_t* service_codes, uint8_t service_count,
+                                 const uint8_t* block_list, uint8_t block_count, uint8_t* data) {
+    uint8_t cmd[14 + 2 * FELICA_MAX_SERVICES_PER_READ + 2 * FELICA_MAX_BLOCKS_PER_READ];
+    size_t len = 0;
+    
+    cmd[len++] = 0;  // Length, set below (includes itself)
+    cmd[len++] = FELICA_CMD_READ_WITHOUT_ENC;
+    memcpy(&cmd[len], card->idm, 8);
+    len += 8;
+    cmd[len++] = service_count;
+    for(uint8_t i = 0; i < service_count; i++) {
+        cmd[len++] = service_codes[i] & 0xFF;
+        cmd[len++] = (service_codes[i] >> 8) & 0xFF;
+    }
+    cmd[len++] = block_count;
+    memcpy(&cmd[len], block_list, block_count * 2);
+    len += block_count * 2;
+    cmd[0] = (uint8_t)len;
+    
+    uint8_t response[13 + 16 * FELICA_MAX_BLOCKS_PER_READ];
+    size_t response_len = 0;
+    
+    if(!predator_nfc_transceive(PredatorNfcTechFelica, cmd, len, response, sizeof(response),
+                                &response_len,
+                                felica_response_timeout_us(card, FeliCaCmdRead, block_count))) {
+        return -1;
+    }
+    
+    // Parse response
+    if(response_len < 12) return -1;
+    uint8_t status1 = response[10];
+    uint8_t status2 = response[11];
+    if(status1 != 0x00 || status2 != 0x00) {
+        FURI_LOG_W("FeliCa", "Read of %u blocks refused: status %02X %02X",
+                   block_count, status1, status2);
+        return 0;
+    }
+    
+    uint8_t blocks_read = response[12];
+    uint32_t bytes_read = blocks_read * 16;
+    if(blocks_read > block_count || 13 + bytes_read > response_len) return 0;
+    memcpy(data, &response[13], bytes_read);
+    return blocks_read;
+}
+
 uint32_t felica_read_without_encryption(PredatorApp* app, const FeliCaCard* card,
                                        uint16_t service_code, const uint8_t* block_list,
                                        uint8_t block_count, uint8_t* data) {
     if(!app || !card || !block_list || !data) return 0;
+    if(block_count == 0 || block_count > FELICA_MAX_BLOCKS_PER_READ) return 0;
     
     FURI_LOG_I("FeliCa", "Reading %u blocks from service 0x%04X", 
                block_count, service_code);
     
-    // Build Read Without Encryption command
-    uint8_t cmd[32];
-    cmd[0] = 10 + 2 + 1 + block_count * 2;  // Length
-    cmd[1] = FELICA_CMD_READ_WITHOUT_ENC;
-    memcpy(&cmd[2], card->idm, 8);
-    cmd[10] = 1;  // Number of services
-    cmd[11] = service_code & 0xFF;
-    cmd[12] = (service_code >> 8) & 0xFF;
-    cmd[13] = block_count;
-    
-    // Add block list
-    memcpy(&cmd[14], block_list, block_count * 2);
-    
-    uint8_t response[256];
-    size_t response_len = 0;
-    
-    // Real: furi_hal_nfc_felica_transceive(cmd, cmd[0] + 1, response, &response_len);
+    int32_t blocks_read = felica_read_frame(card, &service_code, 1, block_list, block_count, data);
+    if(blocks_read <= 0) return 0;
     
-    // Parse response
-    if(response_len > 12) {
-        uint8_t status1 = response[10];
-        uint8_t status2 = response[11];
-        
-        if(status1 == 0x00 && status2 == 0x00) {
-            uint8_t blocks_read = response[12];
-            uint32_t bytes_read = blocks_read * 16;
-            memcpy(data, &response[13], bytes_read);
-            
-            FURI_LOG_I("FeliCa", "Read %lu bytes successfully", bytes_read);
-            return blocks_read;
+    FURI_LOG_I("FeliCa", "Read %lu bytes successfully", (uint32_t)blocks_read * 16);
+    return (uint32_t)blocks_read;
+}
+
+uint32_t felica_read_blocks(PredatorApp* app, const FeliCaCard* card,
+                            const uint16_t* service_codes, uint8_t service_count,
+                            const uint8_t* block_list, uint8_t block_count, uint8_t* data) {
+    if(!app || !card || !service_codes || !block_list || !data) return 0;
+    if(service_count == 0 || service_count > FELICA_MAX_SERVICES_PER_READ) return 0;
+    
+    uint8_t limit = felica_max_read_blocks(card);
+    uint32_t done = 0;
+    uint32_t frames = 0;
+    
+    while(done < block_count) {
+        uint8_t chunk = block_count - done < limit ? block_count - done : limit;
+        int32_t got = felica_read_frame(card, service_codes, service_count,
+                                        &block_list[done * 2], chunk, &data[done * 16]);
+        frames++;
+        if(got == chunk) {
+            done += chunk;
+        } else if(got == 0 && chunk > 1) {
+            // Card refused the batch: halve it and retry
+            limit = chunk / 2;
+        } else {
+            if(got > 0) done += got;
+            break;
         }
-        
-        FURI_LOG_E("FeliCa", "Read failed: status %02X %02X", status1, status2);
     }
     
-    return 0;
+    FURI_LOG_I("FeliCa", "Read %lu/%u blocks in %lu frames", done, block_count, frames);
+    return done;
 }
 
 bool felica_read_balance(PredatorApp* app, const FeliCaCard* card, uint16_t* balance) {
     if(!app || !card || !balance) return false;
     
     // Suica balance is in service 0x008B, block 0
-    uint8_t block_list[2] = {0x80, 0x00};  // Block 0 with 2-byte addressing
+    const uint16_t service = FELICA_SERVICE_SUICA_BALANCE;
+    uint8_t block_list[2] = {0x80, 0x00};  // Service 0, block 0 (2-byte element)
     uint8_t data[16];
     
-    uint32_t blocks = felica_read_without_encryption(app, card,
-                                                     FELICA_SERVICE_SUICA_BALANCE,
-                                                     block_list, 1, data);
-    
-    if(blocks > 0) {
+    if(felica_read_blocks(app, card, &service, 1, block_list, 1, data) > 0) {
         // Balance is stored as little-endian in bytes 10-11
         *balance = data[10] | (data[11] << 8);
         FURI_LOG_I("FeliCa", "Balance: ¥%u", *balance);
@@ -267,29 +343,37 @@ bool felica_parse_transaction(const uint8_t* raw_data, FeliCaTransaction* transa
     return false;
 }
 
+// Parse history blocks into transactions
+static uint32_t felica_parse_history(const uint8_t* blocks, uint32_t block_count,
+                                     FeliCaTransaction* transactions, FeliCaCardType card_type) {
+    uint32_t count = 0;
+    for(uint32_t i = 0; i < block_count; i++) {
+        if(felica_parse_transaction(&blocks[i * 16], &transactions[count], card_type)) {
+            count++;
+        }
+    }
+    return count;
+}
+
 uint32_t felica_read_history(PredatorApp* app, const FeliCaCard* card,
                              FeliCaTransaction* transactions, uint32_t max_transactions) {
     if(!app || !card || !transactions) return 0;
     
     // Suica history is in service 0x090F, blocks 0-19 (20 most recent)
-    uint32_t count = 0;
-    uint32_t blocks_to_read = max_transactions < 20 ? max_transactions : 20;
-    
-    for(uint32_t i = 0; i < blocks_to_read; i++) {
-        uint8_t block_list[2] = {0x80 | i, 0x00};
-        uint8_t data[16];
-        
-        if(felica_read_without_encryption(app, card,
-                                         FELICA_SERVICE_SUICA_HISTORY,
-                                         block_list, 1, data) > 0) {
-            if(felica_parse_transaction(data, &transactions[count], card->card_type)) {
-                count++;
-            }
-        }
-        
-        furi_delay_ms(50);  // Rate limiting
+    const uint16_t service = FELICA_SERVICE_SUICA_HISTORY;
+    uint8_t block_count = max_transactions < FELICA_SUICA_HISTORY_BLOCKS ?
+                          max_transactions : FELICA_SUICA_HISTORY_BLOCKS;
+    uint8_t block_list[FELICA_SUICA_HISTORY_BLOCKS * 2];
+    uint8_t data[FELICA_SUICA_HISTORY_BLOCKS * 16];
+    
+    for(uint8_t i = 0; i < block_count; i++) {
+        block_list[i * 2] = 0x80;      // Service 0
+        block_list[i * 2 + 1] = i;     // Block number
     }
     
+    uint32_t blocks = felica_read_blocks(app, card, &service, 1, block_list, block_count, data);
+    uint32_t count = felica_parse_history(data, blocks, transactions, card->card_type);
+    
     FURI_LOG_I("FeliCa", "Read %lu transaction records", count);
     return count;
 }
@@ -303,17 +387,39 @@ uint32_t felica_read_suica_data(PredatorApp* app, const FeliCaCard* card,
     
     FURI_LOG_I("FeliCa", "Reading Suica data");
     
-    // Read balance
-    if(balance) {
-        felica_read_balance(app, card, balance);
+    if(!balance || !transactions || max_transactions == 0) {
+        if(balance) felica_read_balance(app, card, balance);
+        if(transactions && max_transactions > 0) {
+            return felica_read_history(app, card, transactions, max_transactions);
+        }
+        return 0;
     }
     
-    // Read transaction history
-    if(transactions && max_transactions > 0) {
-        return felica_read_history(app, card, transactions, max_transactions);
+    // Balance block and history blocks share frames: the balance service
+    // is service 0 of the request, history service 1
+    const uint16_t services[2] = {FELICA_SERVICE_SUICA_BALANCE, FELICA_SERVICE_SUICA_HISTORY};
+    uint8_t history = max_transactions < FELICA_SUICA_HISTORY_BLOCKS ?
+                      max_transactions : FELICA_SUICA_HISTORY_BLOCKS;
+    uint8_t block_list[(1 + FELICA_SUICA_HISTORY_BLOCKS) * 2];
+    uint8_t data[(1 + FELICA_SUICA_HISTORY_BLOCKS) * 16];
+    
+    block_list[0] = 0x80;  // Service 0, block 0
+    block_list[1] = 0x00;
+    for(uint8_t i = 0; i < history; i++) {
+        block_list[2 + i * 2] = 0x81;  // Service 1
+        block_list[3 + i * 2] = i;
     }
     
-    return 0;
+    uint32_t blocks = felica_read_blocks(app, card, services, 2, block_list, 1 + history, data);
+    if(blocks == 0) return 0;
+    
+    // Balance is stored as little-endian in bytes 10-11
+    *balance = data[10] | (data[11] << 8);
+    FURI_LOG_I("FeliCa", "Balance: ¥%u", *balance);
+    
+    uint32_t count = felica_parse_history(&data[16], blocks - 1, transactions, card->card_type);
+    FURI_LOG_I("FeliCa", "Read %lu transaction records", count);
+    return count;
 }
 
 // ========== STATION DECODER (DISABLED FOR MEMORY) ==========
@@ -382,7 +488,9 @@ uint32_t felica_request_system_code(PredatorApp* app, const FeliCaCard* card,
     uint8_t response[32];
     size_t response_len = 0;
     
-    // Real: transceive
+    predator_nfc_transceive(PredatorNfcTechFelica, cmd, 10, response, sizeof(response),
+                            &response_len,
+                            felica_response_timeout_us(card, FeliCaCmdRequestResponse, 0));
     
     if(response_len > 10) {
         uint8_t num_systems = response[10];
@@ -414,9 +522,10 @@ bool felica_derive_card_key(const uint8_t* master_key, const uint8_t* idm,
     if(!master_key || !idm || !card_key) return false;
     
     // FeliCa key diversification: Encrypt IDm with master key
-    des3_derive_key(master_key, idm, 8, card_key);
+    // (cached per IDm, so repeated reads of one card derive once)
+    if(!predator_keydiv_derive(master_key, idm, 8, card_key)) return false;
     
-    FURI_LOG_I("FeliCa", "Card key derived from IDm");
+    FURI_LOG_D("FeliCa", "Card key derived from IDm");
     return true;
 }
 
@@ -439,8 +548,9 @@ bool felica_detect_card(PredatorApp* app, uint16_t system_code, FeliCaCard* card
     uint8_t response[32];
     size_t response_len = 0;
     
-    // HAL: Poll for FeliCa card
-    furi_hal_nfc_felica_transceive(cmd, 6, response, &response_len);
+    // Poll for FeliCa card
+    predator_nfc_transceive(PredatorNfcTechFelica, cmd, 6, response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
     if(response_len >= 18) {
         memset(card, 0, sizeof(FeliCaCard));
@@ -518,6 +628,62 @@ bool felica_analyze_security(PredatorApp* app, const FeliCaCard* card,
     return true;
 }
 
+// ========== DUMP ==========
+
+#define FELICA_DUMP_MAX_BLOCKS 256  // Block numbers a 2-byte list element can address
+
+bool felica_dump_card(PredatorApp* app, const FeliCaCard* card, const char* output_path) {
+    if(!app || !app->storage || !card || !output_path) return false;
+    
+    PredatorDumpWriter* dump = predator_dump_writer_open(
+        app->storage, output_path, PredatorDumpCardFelica, card->idm, sizeof(card->idm));
+    if(!dump) return false;
+    
+    uint8_t info[10];
+    memcpy(info, card->pmm, 8);
+    info[8] = card->system_code & 0xFF;
+    info[9] = card->system_code >> 8;
+    predator_dump_info(dump, info, sizeof(info));
+    
+    // Services found by discovery, else the transit services of Suica-family cards
+    static const uint16_t transit_services[] = {
+        FELICA_SERVICE_SUICA_BALANCE, FELICA_SERVICE_SUICA_HISTORY};
+    const uint16_t* services = card->service_count ? card->service_codes : transit_services;
+    const uint8_t service_count =
+        card->service_count ? card->service_count : COUNT_OF(transit_services);
+    
+    const uint8_t batch = felica_max_read_blocks(card);
+    uint8_t block_list[FELICA_MAX_BLOCKS_PER_READ * 2];
+    uint8_t data[FELICA_MAX_BLOCKS_PER_READ * 16];
+    uint32_t total = 0;
+    
+    for(uint8_t s = 0; s < service_count; s++) {
+        // Attribute bit 0 set: readable without authentication
+        if(!(services[s] & 0x0001)) continue;
+        predator_dump_area(dump, services[s], 16, 0);
+        
+        // Each batch goes to SD as it arrives; a short batch ends the service
+        uint32_t block = 0;
+        while(block < FELICA_DUMP_MAX_BLOCKS) {
+            uint8_t chunk = FELICA_DUMP_MAX_BLOCKS - block < batch ?
+                            FELICA_DUMP_MAX_BLOCKS - block : batch;
+            for(uint8_t i = 0; i < chunk; i++) {
+                block_list[i * 2] = 0x80;
+                block_list[i * 2 + 1] = (uint8_t)(block + i);
+            }
+            uint32_t got = felica_read_blocks(app, card, &services[s], 1, block_list, chunk, data);
+            predator_dump_units(dump, block, data, 16, got);
+            block += got;
+            total += got;
+            if(got < chunk) break;
+        }
+    }
+    
+    bool ok = predator_dump_writer_close(dump);
+    FURI_LOG_I("FeliCa", "Dumped %lu blocks to %s", total, output_path);
+    return ok;
+}
+
 // ========== DEFAULT KEYS ==========
 
 const uint8_t FELICA_KEY_DEFAULT[16] = {
@@ -1,4 +1,8 @@
 #include "predator_crypto_iso15693.h"
+#include "predator_dict.h"
+#include "predator_crc.h"
+#include "predator_nfc_transport.h"
+#include "predator_dump.h"
 #include "../predator_i.h"
 #include <string.h>
 #include <furi_hal.h>
@@ -34,21 +38,9 @@
 
 // ========== CRC CALCULATION (ISO 15693 STANDARD) ==========
 
-static uint16_t iso15693_crc(const uint8_t* data, size_t len) {
-    uint16_t crc = 0xFFFF;
-    
-    for(size_t i = 0; i < len; i++) {
-        crc ^= data[i];
-        for(uint8_t bit = 0; bit < 8; bit++) {
-            if(crc & 0x0001) {
-                crc = (crc >> 1) ^ 0x8408;  // ISO 15693 polynomial
-            } else {
-                crc >>= 1;
-            }
-        }
-    }
-    
-    return ~crc;
+uint16_t iso15693_crc16(const uint8_t* data, uint32_t len) {
+    // Same CRC as ISO 14443-3 Type B (reflected 0x8408, init/xorout 0xFFFF)
+    return (uint16_t)predator_crc(PredatorCrc16B, data, len);
 }
 
 // ========== TAG TYPE DETECTION (REAL MANUFACTURER CODES) ==========
@@ -56,15 +48,20 @@ static uint16_t iso15693_crc(const uint8_t* data, size_t len) {
 ISO15693TagType iso15693_detect_type(const uint8_t* uid) {
     if(!uid) return ISO15693_Unknown;
     
-    // Manufacturer code is in UID byte 6 (MSB)
-    uint8_t mfg_code = uid[6];
+    // UID is MSB first: E0, manufacturer code, product code
+    uint8_t mfg_code = uid[1];
     
     switch(mfg_code) {
-        case 0xE0:  // NXP (Philips)
-            // Check ICODE variant from product code
-            if(uid[5] == 0x01) return ISO15693_ICODE_SLI;
-            if(uid[5] == 0x02) return ISO15693_ICODE_SLIX;
-            if(uid[5] == 0x03) return ISO15693_ICODE_SLIX2;
+        case 0x04:  // NXP (Philips)
+            // ICODE SLI family: type in UID bits 36-35
+            if(uid[2] == 0x01) {
+                switch((uid[3] >> 3) & 0x03) {
+                    case 0x01: return ISO15693_ICODE_SLIX2;
+                    case 0x02: return ISO15693_ICODE_SLIX;
+                    default: return ISO15693_ICODE_SLI;
+                }
+            }
+            if(uid[2] == 0x02 || uid[2] == 0x03) return ISO15693_ICODE_SLIX;  // -S / -L
             return ISO15693_ICODE_SLI;  // Default NXP
             
         case 0x07:  // Texas Instruments
@@ -73,7 +70,7 @@ ISO15693TagType iso15693_detect_type(const uint8_t* uid) {
         case 0x05:  // Infineon
             return ISO15693_MyD;
             
-        case 0x16:  // STMicroelectronics
+        case 0x02:  // STMicroelectronics
             return ISO15693_LRI2K;
             
         default:
@@ -97,52 +94,123 @@ const char* iso15693_get_type_name(ISO15693TagType type) {
 
 // ========== BASIC OPERATIONS ==========
 
-bool iso15693_detect_tag(PredatorApp* app, ISO15693Tag* tag) {
-    if(!app || !tag) return false;
-    
-    FURI_LOG_I("ISO15693", "Detecting tag...");
-    
-    // Build inventory command
-    uint8_t cmd[5];
-    cmd[0] = 0x26;  // Flags: Inventory, High data rate, 1 slot
-    cmd[1] = ISO15693_CMD_INVENTORY;
-    cmd[2] = 0x00;  // AFI (all families)
+// Addressed commands carry the UID LSB first (tag->uid is MSB first)
+static void iso15693_put_uid(uint8_t* frame, const uint8_t* uid) {
+    for(int i = 0; i < 8; i++) {
+        frame[i] = uid[7 - i];
+    }
+}
+
+// Append CRC (LSB first) to a request of len bytes
+static size_t iso15693_add_crc(uint8_t* frame, size_t len) {
+    uint16_t crc = iso15693_crc16(frame, len);
+    frame[len] = crc & 0xFF;
+    frame[len + 1] = (crc >> 8) & 0xFF;
+    return len + 2;
+}
+
+// Response with a valid trailing CRC
+static bool iso15693_check_crc(const uint8_t* frame, size_t len) {
+    if(len < 3) return false;
+    uint16_t crc = iso15693_crc16(frame, len - 2);
+    return frame[len - 2] == (crc & 0xFF) && frame[len - 1] == ((crc >> 8) & 0xFF);
+}
+
+// Inventory state shared across mask levels
+typedef struct {
+    uint8_t (*uids)[8];
+    uint32_t max_tags;
+    uint32_t count;
+    uint8_t afi;
+} ISO15693Inventory;
+
+static void iso15693_inventory_add(ISO15693Inventory* inv, const uint8_t* response) {
+    uint8_t uid[8];
     
-    // Add CRC
-    uint16_t crc = iso15693_crc(cmd, 3);
-    cmd[3] = crc & 0xFF;
-    cmd[4] = (crc >> 8) & 0xFF;
+    // UID is 8 bytes in reverse order
+    for(int i = 0; i < 8; i++) {
+        uid[i] = response[9 - i];
+    }
+    for(uint32_t i = 0; i < inv->count; i++) {
+        if(memcmp(inv->uids[i], uid, 8) == 0) return;
+    }
+    memcpy(inv->uids[inv->count++], uid, 8);
+}
+
+// One 16-slot round for the tags whose low mask_len UID bits equal mask;
+// collided slots recurse with the slot number appended to the mask
+static void iso15693_inventory_round(ISO15693Inventory* inv, uint64_t mask, uint8_t mask_len) {
+    uint8_t cmd[14];
+    size_t len = 0;
+    
+    cmd[len++] = ISO15693_FLAG_DATA_RATE_HIGH | ISO15693_FLAG_INVENTORY |
+                 (inv->afi ? ISO15693_FLAG_AFI : 0);  // 16 slots
+    cmd[len++] = ISO15693_CMD_INVENTORY;
+    if(inv->afi) cmd[len++] = inv->afi;
+    cmd[len++] = mask_len;
+    for(uint8_t i = 0; i < (mask_len + 7) / 8; i++) {
+        cmd[len++] = (mask >> (8 * i)) & 0xFF;
+    }
+    len = iso15693_add_crc(cmd, len);
     
-    // Send command via NFC hardware
+    uint16_t collisions = 0;
     uint8_t response[16];
     size_t response_len = 0;
     
-    // Real implementation would use:
-    // furi_hal_nfc_iso15693_transceive(cmd, sizeof(cmd), response, &response_len);
-    
-    // For now, simulate detection failure (hardware-specific)
-    FURI_LOG_D("ISO15693", "Hardware transceive needed");
-    
-    // If tag responds, parse UID and info
-    if(response_len >= 10) {
-        memset(tag, 0, sizeof(ISO15693Tag));
+    for(uint8_t slot = 0; slot < 16 && inv->count < inv->max_tags; slot++) {
+        // Slot 0 answers the request, later slots answer a bare EOF
+        predator_nfc_transceive(PredatorNfcTechIso15693, cmd, slot ? 0 : len, response,
+                                sizeof(response), &response_len, ISO15693_SLOT_TIMEOUT_US);
+        if(response_len == 0) continue;
         
-        // UID is 8 bytes in reverse order
-        for(int i = 0; i < 8; i++) {
-            tag->uid[i] = response[9 - i];
+        if(response_len == 12 && response[0] == 0x00 && iso15693_check_crc(response, 12)) {
+            iso15693_inventory_add(inv, response);
+        } else {
+            collisions |= 1 << slot;  // Overlapping answers
         }
-        
-        tag->tag_type = iso15693_detect_type(tag->uid);
-        
-        FURI_LOG_I("ISO15693", "Tag detected: %s", iso15693_get_type_name(tag->tag_type));
-        
-        // Get system info for block count
-        iso15693_get_system_info(app, tag);
-        
-        return true;
     }
     
-    return false;
+    if(mask_len + 4 > 64) return;
+    for(uint8_t slot = 0; slot < 16 && inv->count < inv->max_tags; slot++) {
+        if(collisions & (1 << slot)) {
+            iso15693_inventory_round(inv, mask | ((uint64_t)slot << mask_len), mask_len + 4);
+        }
+    }
+}
+
+uint32_t iso15693_inventory(PredatorApp* app, uint8_t uids[][8], uint32_t max_tags, uint8_t afi) {
+    if(!app || !uids || max_tags == 0) return 0;
+    
+    ISO15693Inventory inv = {
+        .uids = uids,
+        .max_tags = max_tags,
+        .count = 0,
+        .afi = afi,
+    };
+    iso15693_inventory_round(&inv, 0, 0);
+    
+    FURI_LOG_I("ISO15693", "Inventory: %lu tags", inv.count);
+    return inv.count;
+}
+
+bool iso15693_detect_tag(PredatorApp* app, ISO15693Tag* tag) {
+    if(!app || !tag) return false;
+    
+    FURI_LOG_I("ISO15693", "Detecting tag...");
+    
+    uint8_t uids[1][8];
+    if(iso15693_inventory(app, uids, 1, 0) == 0) return false;
+    
+    memset(tag, 0, sizeof(ISO15693Tag));
+    memcpy(tag->uid, uids[0], 8);
+    tag->tag_type = iso15693_detect_type(tag->uid);
+    
+    FURI_LOG_I("ISO15693", "Tag detected: %s", iso15693_get_type_name(tag->tag_type));
+    
+    // Get system info for block count
+    iso15693_get_system_info(app, tag);
+    
+    return true;
 }
 
 bool iso15693_get_system_info(PredatorApp* app, ISO15693Tag* tag) {
@@ -151,44 +219,47 @@ bool iso15693_get_system_info(PredatorApp* app, ISO15693Tag* tag) {
     FURI_LOG_D("ISO15693", "Getting system info...");
     
     // Build Get System Info command
-    uint8_t cmd[11];
+    uint8_t cmd[12];
     cmd[0] = 0x22;  // Flags: Addressed, High data rate
     cmd[1] = ISO15693_CMD_GET_SYSTEM_INFO;
     
     // Add UID
-    memcpy(&cmd[2], tag->uid, 8);
+    iso15693_put_uid(&cmd[2], tag->uid);
     
     // Add CRC
-    uint16_t crc = iso15693_crc(cmd, 10);
+    uint16_t crc = iso15693_crc16(cmd, 10);
     cmd[10] = crc & 0xFF;
     cmd[11] = (crc >> 8) & 0xFF;
     
     // Send command
-    uint8_t response[16];
+    uint8_t response[20];
     size_t response_len = 0;
     
-    // Real: furi_hal_nfc_iso15693_transceive(...)
+    predator_nfc_transceive(PredatorNfcTechIso15693, cmd, sizeof(cmd), response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
-    // Parse response
-    if(response_len >= 10) {
-        uint8_t flags = response[0];
+    // Parse response: flags, info flags, UID, then the fields present
+    if(response_len >= 10 && response[0] == 0x00) {
+        uint8_t info = response[1];
+        size_t pos = 10;
         
-        if(flags & 0x01) {  // DSFID supported
-            tag->dsfid = response[1];
+        if((info & 0x01) && pos < response_len) {  // DSFID supported
+            tag->dsfid = response[pos++];
         }
-        if(flags & 0x02) {  // AFI supported
-            tag->afi = response[2];
+        if((info & 0x02) && pos < response_len) {  // AFI supported
+            tag->afi = response[pos++];
         }
-        if(flags & 0x04) {  // Memory size present
-            tag->block_count = response[3] + 1;
-            tag->block_size = (response[4] & 0x1F) + 1;
+        if((info & 0x04) && pos + 1 < response_len) {  // Memory size present
+            tag->block_count = response[pos] + 1;
+            tag->block_size = (response[pos + 1] & 0x1F) + 1;
             tag->total_bytes = tag->block_count * tag->block_size;
+            pos += 2;
             
             FURI_LOG_I("ISO15693", "Memory: %u blocks x %u bytes = %u total",
                        tag->block_count, tag->block_size, tag->total_bytes);
         }
-        if(flags & 0x08) {  // IC reference present
-            tag->ic_ref = response[5];
+        if((info & 0x08) && pos < response_len) {  // IC reference present
+            tag->ic_ref = response[pos];
         }
         
         return true;
@@ -205,28 +276,30 @@ bool iso15693_get_system_info(PredatorApp* app, ISO15693Tag* tag) {
 // ========== READ OPERATIONS ==========
 
 bool iso15693_read_block(PredatorApp* app, const ISO15693Tag* tag,
-                        uint8_t block_number, uint8_t* data) {
+                        uint16_t block_number, uint8_t* data) {
     if(!app || !tag || !data) return false;
+    if(block_number > 0xFF || tag->block_size > 32) return false;
     
     FURI_LOG_D("ISO15693", "Reading block %u", block_number);
     
     // Build Read Single Block command
-    uint8_t cmd[12];
+    uint8_t cmd[13];
     cmd[0] = 0x22;  // Flags
     cmd[1] = ISO15693_CMD_READ_SINGLE_BLOCK;
-    memcpy(&cmd[2], tag->uid, 8);
+    iso15693_put_uid(&cmd[2], tag->uid);
     cmd[10] = block_number;
     
-    uint16_t crc = iso15693_crc(cmd, 11);
+    uint16_t crc = iso15693_crc16(cmd, 11);
     cmd[11] = crc & 0xFF;
     cmd[12] = (crc >> 8) & 0xFF;
     
-    uint8_t response[8];
+    uint8_t response[40];
     size_t response_len = 0;
     
-    // Real: transceive
+    predator_nfc_transceive(PredatorNfcTechIso15693, cmd, sizeof(cmd), response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
-    if(response_len >= 4) {
+    if(response_len >= 1u + tag->block_size && response[0] == 0x00) {
         memcpy(data, &response[1], tag->block_size);
         return true;
     }
@@ -234,37 +307,121 @@ bool iso15693_read_block(PredatorApp* app, const ISO15693Tag* tag,
     return false;
 }
 
-uint32_t iso15693_read_blocks(PredatorApp* app, const ISO15693Tag* tag,
-                              uint8_t start_block, uint8_t block_count, uint8_t* data) {
-    if(!app || !tag || !data) return 0;
+uint8_t iso15693_max_read_blocks(const ISO15693Tag* tag) {
+    if(!tag || tag->block_size == 0) return 1;
+    
+    uint8_t limit;
+    switch(tag->tag_type) {
+        case ISO15693_ICODE_SLI:
+        case ISO15693_ICODE_SLIX:
+        case ISO15693_ICODE_SLIX2:
+        case ISO15693_LRI2K:
+            limit = 32;
+            break;
+        case ISO15693_TagIt_HF_I:
+        case ISO15693_MyD:
+            limit = 8;
+            break;
+        default:
+            limit = 4;  // Unknown tags: small chunks, halved on error
+            break;
+    }
     
-    FURI_LOG_I("ISO15693", "Reading %u blocks from %u", block_count, start_block);
+    // Keep the response within one buffer
+    uint8_t fit = ISO15693_MAX_READ_BYTES / tag->block_size;
+    if(fit == 0) fit = 1;
+    return limit < fit ? limit : fit;
+}
+
+// One Read Multiple Blocks frame: blocks read, 0 on an error response
+// (ISO error code in *error, 0 if the answer was malformed), -1 if the tag
+// did not answer
+static int32_t iso15693_read_frame(const ISO15693Tag* tag, uint8_t first_block,
+                                   uint8_t block_count, uint8_t* data, uint8_t* error) {
+    uint8_t cmd[14];
+    cmd[0] = 0x22;  // Flags: Addressed, High data rate
+    cmd[1] = ISO15693_CMD_READ_MULTIPLE;
+    iso15693_put_uid(&cmd[2], tag->uid);
+    cmd[10] = first_block;
+    cmd[11] = block_count - 1;  // Number of blocks minus one
+    size_t len = iso15693_add_crc(cmd, 12);
     
-    uint32_t bytes_read = 0;
+    uint8_t response[1 + ISO15693_MAX_READ_BYTES + 2];
+    size_t response_len = 0;
     
-    for(uint8_t i = 0; i < block_count; i++) {
-        if(start_block + i >= tag->block_count) break;
-        
-        if(iso15693_read_block(app, tag, start_block + i,
-                              &data[i * tag->block_size])) {
-            bytes_read += tag->block_size;
+    if(!predator_nfc_transceive(PredatorNfcTechIso15693, cmd, len, response, sizeof(response),
+                                &response_len, PREDATOR_NFC_TIMEOUT_US)) {
+        return -1;
+    }
+    
+    uint32_t bytes = block_count * tag->block_size;
+    if(response[0] != 0x00 || response_len < 1 + bytes) {
+        *error = (response[0] & 0x01) && response_len > 1 ? response[1] : 0;
+        FURI_LOG_W("ISO15693", "Read of %u blocks from %u refused: %02X %02X",
+                   block_count, first_block, response[0], response_len > 1 ? response[1] : 0);
+        return 0;
+    }
+    
+    memcpy(data, &response[1], bytes);
+    return block_count;
+}
+
+// Read Multiple Blocks over a range, halving chunks the tag refuses. Stops
+// at the first block refused on its own (*error = ISO error code) or not
+// answered (*error = -1).
+static uint32_t iso15693_read_range(const ISO15693Tag* tag, uint16_t start_block,
+                                    uint16_t block_count, uint8_t* data, int16_t* error) {
+    uint8_t limit = iso15693_max_read_blocks(tag);
+    uint32_t done = 0;
+    uint32_t frames = 0;
+    *error = 0;
+    
+    while(done < block_count) {
+        uint8_t chunk = block_count - done < limit ? block_count - done : limit;
+        uint8_t code = 0;
+        int32_t got = iso15693_read_frame(tag, start_block + done, chunk,
+                                          &data[done * tag->block_size], &code);
+        frames++;
+        if(got == chunk) {
+            done += chunk;
+        } else if(got == 0 && chunk > 1) {
+            // Tag refused the chunk: halve it and retry
+            limit = chunk / 2;
         } else {
-            FURI_LOG_W("ISO15693", "Failed to read block %u", start_block + i);
+            *error = got < 0 ? -1 : code;
+            FURI_LOG_W("ISO15693", "Failed to read block %lu", start_block + done);
             break;
         }
-        
-        furi_delay_ms(10);  // Rate limiting
     }
     
-    FURI_LOG_I("ISO15693", "Read %lu bytes", bytes_read);
-    return bytes_read;
+    FURI_LOG_I("ISO15693", "Read %lu blocks in %lu frames", done, frames);
+    return done;
+}
+
+uint32_t iso15693_read_blocks(PredatorApp* app, const ISO15693Tag* tag,
+                              uint16_t start_block, uint16_t block_count, uint8_t* data) {
+    if(!app || !tag || !data) return 0;
+    
+    // Standard commands address blocks 0-255
+    if(start_block + block_count > tag->block_count) {
+        block_count = start_block < tag->block_count ? tag->block_count - start_block : 0;
+    }
+    if(start_block + block_count > 0x100) {
+        block_count = start_block < 0x100 ? 0x100 - start_block : 0;
+    }
+    
+    FURI_LOG_I("ISO15693", "Reading %u blocks from %u", block_count, start_block);
+    
+    int16_t error;
+    return iso15693_read_range(tag, start_block, block_count, data, &error);
 }
 
 // ========== WRITE OPERATIONS ==========
 
 bool iso15693_write_block(PredatorApp* app, const ISO15693Tag* tag,
-                         uint8_t block_number, const uint8_t* data) {
+                         uint16_t block_number, const uint8_t* data) {
     if(!app || !tag || !data) return false;
+    if(block_number > 0xFF) return false;
     
     FURI_LOG_D("ISO15693", "Writing block %u", block_number);
     
@@ -275,21 +432,23 @@ bool iso15693_write_block(PredatorApp* app, const ISO15693Tag* tag,
     }
     
     // Build Write Single Block command
-    uint8_t cmd[16];
+    uint8_t cmd[13 + 32];
+    if(tag->block_size > 32) return false;
     cmd[0] = 0x22;
     cmd[1] = ISO15693_CMD_WRITE_SINGLE_BLOCK;
-    memcpy(&cmd[2], tag->uid, 8);
+    iso15693_put_uid(&cmd[2], tag->uid);
     cmd[10] = block_number;
     memcpy(&cmd[11], data, tag->block_size);
     
-    uint16_t crc = iso15693_crc(cmd, 11 + tag->block_size);
+    uint16_t crc = iso15693_crc16(cmd, 11 + tag->block_size);
     cmd[11 + tag->block_size] = crc & 0xFF;
     cmd[12 + tag->block_size] = (crc >> 8) & 0xFF;
     
     uint8_t response[2];
     size_t response_len = 0;
     
-    // Real: transceive
+    predator_nfc_transceive(PredatorNfcTechIso15693, cmd, 13 + tag->block_size, response,
+                            sizeof(response), &response_len, PREDATOR_NFC_TIMEOUT_US);
     
     if(response_len > 0 && response[0] == 0x00) {
         FURI_LOG_D("ISO15693", "Block %u written successfully", block_number);
@@ -300,20 +459,20 @@ bool iso15693_write_block(PredatorApp* app, const ISO15693Tag* tag,
 }
 
 uint32_t iso15693_write_blocks(PredatorApp* app, const ISO15693Tag* tag,
-                               uint8_t start_block, uint8_t block_count,
+                               uint16_t start_block, uint16_t block_count,
                                const uint8_t* data) {
     if(!app || !tag || !data) return 0;
     
     uint32_t blocks_written = 0;
     
-    for(uint8_t i = 0; i < block_count; i++) {
+    for(uint16_t i = 0; i < block_count; i++) {
         if(iso15693_write_block(app, tag, start_block + i,
                                &data[i * tag->block_size])) {
             blocks_written++;
         } else {
             break;
         }
-        furi_delay_ms(50);  // Write delay
+        predator_nfc_delay_ms(50);  // Write delay
     }
     
     return blocks_written;
@@ -334,10 +493,10 @@ bool iso15693_set_password(PredatorApp* app, const ISO15693Tag* tag,
     
     FURI_LOG_I("ISO15693", "Setting password type %u", type);
     
-    uint8_t cmd[16];
+    uint8_t cmd[17];
     cmd[0] = 0x22;
     cmd[1] = ISO15693_CMD_WRITE_PASSWORD;
-    memcpy(&cmd[2], tag->uid, 8);
+    iso15693_put_uid(&cmd[2], tag->uid);
     cmd[10] = type;  // Password type
     
     // Password in XOR format (SLIX specific)
@@ -346,13 +505,16 @@ bool iso15693_set_password(PredatorApp* app, const ISO15693Tag* tag,
     cmd[13] = (password >> 8) & 0xFF;
     cmd[14] = password & 0xFF;
     
-    uint16_t crc = iso15693_crc(cmd, 15);
+    uint16_t crc = iso15693_crc16(cmd, 15);
     cmd[15] = crc & 0xFF;
     cmd[16] = (crc >> 8) & 0xFF;
     
-    // Real: transceive
+    uint8_t response[2];
+    size_t response_len = 0;
+    predator_nfc_transceive(PredatorNfcTechIso15693, cmd, sizeof(cmd), response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
-    return true;
+    return response_len > 0 && response[0] == 0x00;
 }
 
 bool iso15693_authenticate_password(PredatorApp* app, ISO15693Tag* tag,
@@ -363,22 +525,23 @@ bool iso15693_authenticate_password(PredatorApp* app, ISO15693Tag* tag,
     
     // SLIX uses a challenge-response mechanism
     // 1. Get random number from tag
-    uint8_t cmd1[11];
+    uint8_t cmd1[12];
     cmd1[0] = 0x22;
     cmd1[1] = ISO15693_CMD_GET_RANDOM_NUMBER;
-    memcpy(&cmd1[2], tag->uid, 8);
+    iso15693_put_uid(&cmd1[2], tag->uid);
     
-    uint16_t crc = iso15693_crc(cmd1, 10);
+    uint16_t crc = iso15693_crc16(cmd1, 10);
     cmd1[10] = crc & 0xFF;
     cmd1[11] = (crc >> 8) & 0xFF;
     
     uint8_t response[4];
     size_t response_len = 0;
     
-    // Real: transceive to get random number
+    predator_nfc_transceive(PredatorNfcTechIso15693, cmd1, sizeof(cmd1), response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
-    if(response_len >= 2) {
-        uint16_t random = (response[1] << 8) | response[0];
+    if(response_len >= 3 && response[0] == 0x00) {
+        uint16_t random = (response[2] << 8) | response[1];
         
         // 2. Calculate response = random XOR password_low XOR password_high
         uint16_t pwd_low = password & 0xFFFF;
@@ -386,23 +549,27 @@ bool iso15693_authenticate_password(PredatorApp* app, ISO15693Tag* tag,
         uint16_t auth_response = random ^ pwd_low ^ pwd_high;
         
         // 3. Send SET_PASSWORD with response
-        uint8_t cmd2[14];
+        uint8_t cmd2[15];
         cmd2[0] = 0x22;
         cmd2[1] = ISO15693_CMD_SET_PASSWORD;
-        memcpy(&cmd2[2], tag->uid, 8);
+        iso15693_put_uid(&cmd2[2], tag->uid);
         cmd2[10] = type;
         cmd2[11] = auth_response & 0xFF;
         cmd2[12] = (auth_response >> 8) & 0xFF;
         
-        crc = iso15693_crc(cmd2, 13);
+        crc = iso15693_crc16(cmd2, 13);
         cmd2[13] = crc & 0xFF;
         cmd2[14] = (crc >> 8) & 0xFF;
         
-        // Real: transceive
+        response_len = 0;
+        predator_nfc_transceive(PredatorNfcTechIso15693, cmd2, sizeof(cmd2), response,
+                                sizeof(response), &response_len, PREDATOR_NFC_TIMEOUT_US);
         
-        tag->authenticated = true;
-        FURI_LOG_I("ISO15693", "Authentication successful");
-        return true;
+        if(response_len > 0 && response[0] == 0x00) {
+            tag->authenticated = true;
+            FURI_LOG_I("ISO15693", "Authentication successful");
+            return true;
+        }
     }
     
     return false;
@@ -410,37 +577,36 @@ bool iso15693_authenticate_password(PredatorApp* app, ISO15693Tag* tag,
 
 // ========== ATTACK FUNCTIONS ==========
 
-// Common SLIX passwords (from public research)
-static const uint32_t slix_common_passwords[] = {
-    0x00000000, 0xFFFFFFFF, 0x01234567, 0x11111111,
-    0x12345678, 0x00000001, 0xDEADBEEF, 0xCAFEBABE,
-    0x7FFD6E5B  // Known default for some SLIX tags
-};
-
 bool iso15693_attack_password(PredatorApp* app, ISO15693Tag* tag,
                               ISO15693PasswordType type, uint32_t* found_password) {
     if(!app || !tag || !found_password) return false;
     
-    uint32_t count = sizeof(slix_common_passwords) / sizeof(slix_common_passwords[0]);
+    // Site dictionary from SD first (priority ordered), else built-in SLIX list
+    PredatorKeyIter keys;
+    predator_key_iter_begin(&keys, app->storage, PredatorKeyDictISO15693);
     
-    FURI_LOG_I("ISO15693", "Dictionary attack: %lu passwords", count);
+    FURI_LOG_I("ISO15693", "Dictionary attack: %u passwords (%s)",
+              (unsigned)predator_key_iter_count(&keys),
+              predator_key_iter_from_sd(&keys) ? "SD" : "built-in");
     
-    for(uint32_t i = 0; i < count; i++) {
-        uint32_t pwd = slix_common_passwords[i];
-        
+    uint32_t pwd;
+    bool found = false;
+    while(predator_key_iter_next(&keys, &pwd)) {
         FURI_LOG_D("ISO15693", "Trying password: 0x%08lX", pwd);
         
         if(iso15693_authenticate_password(app, tag, type, pwd)) {
             *found_password = pwd;
             FURI_LOG_I("ISO15693", "PASSWORD FOUND: 0x%08lX", pwd);
-            return true;
+            found = true;
+            break;
         }
         
-        furi_delay_ms(50);
+        predator_nfc_delay_ms(50);
     }
+    predator_key_iter_end(&keys);
     
-    FURI_LOG_I("ISO15693", "No password found in dictionary");
-    return false;
+    if(!found) FURI_LOG_I("ISO15693", "No password found in dictionary");
+    return found;
 }
 
 bool iso15693_bruteforce_password(PredatorApp* app, ISO15693Tag* tag,
@@ -465,7 +631,7 @@ bool iso15693_bruteforce_password(PredatorApp* app, ISO15693Tag* tag,
             return true;
         }
         
-        furi_delay_ms(10);
+        predator_nfc_delay_ms(10);
         
         // Safety limit
         if((pwd - start) > 100000) {
@@ -479,6 +645,51 @@ bool iso15693_bruteforce_password(PredatorApp* app, ISO15693Tag* tag,
 
 // ========== CLONING ==========
 
+bool iso15693_dump_tag(PredatorApp* app, const ISO15693Tag* tag, const char* output_path) {
+    if(!app || !app->storage || !tag || !output_path) return false;
+    if(tag->block_size == 0 || tag->block_size > 32) return false;  // 5-bit size field
+    
+    PredatorDumpWriter* dump = predator_dump_writer_open(
+        app->storage, output_path, PredatorDumpCardIso15693, tag->uid, sizeof(tag->uid));
+    if(!dump) return false;
+    
+    uint8_t info[6] = {tag->dsfid, tag->afi, tag->ic_ref, tag->block_size};
+    info[4] = tag->block_count & 0xFF;
+    info[5] = tag->block_count >> 8;
+    predator_dump_info(dump, info, sizeof(info));
+    predator_dump_area(dump, 0, tag->block_size, tag->block_count);
+    
+    // One Read Multiple Blocks worth of RAM; each chunk goes to SD as it arrives
+    const uint8_t batch = iso15693_max_read_blocks(tag);
+    uint8_t data[ISO15693_MAX_READ_BYTES];
+    const uint32_t end = tag->block_count < 0x100 ? tag->block_count : 0x100;
+    uint32_t block = 0;
+    uint32_t total = 0;
+    
+    while(block < end) {
+        uint16_t chunk = end - block < batch ? end - block : batch;
+        int16_t error;
+        uint32_t got = iso15693_read_range(tag, block, chunk, data, &error);
+        predator_dump_units(dump, block, data, tag->block_size, got);
+        block += got;
+        total += got;
+        if(got < chunk) {
+            if(error < 0) {
+                // Tag left the field: every further block would only time out
+                FURI_LOG_W("ISO15693", "No answer at block %lu, dump stopped", block);
+                break;
+            }
+            // Read-protected block: record the tag's error code and carry on past it
+            predator_dump_missing(dump, block, (uint16_t)error);
+            block++;
+        }
+    }
+    
+    bool ok = predator_dump_writer_close(dump);
+    FURI_LOG_I("ISO15693", "Dumped %lu/%u blocks to %s", total, tag->block_count, output_path);
+    return ok;
+}
+
 bool iso15693_clone_tag(PredatorApp* app, const ISO15693Tag* source,
                        ISO15693Tag* target) {
     if(!app || !source || !target) return false;
@@ -489,10 +700,10 @@ bool iso15693_clone_tag(PredatorApp* app, const ISO15693Tag* source,
     uint8_t* data = malloc(source->total_bytes);
     if(!data) return false;
     
-    uint32_t bytes_read = iso15693_read_blocks(app, source, 0,
-                                               source->block_count, data);
+    uint32_t blocks_read = iso15693_read_blocks(app, source, 0,
+                                                source->block_count, data);
     
-    if(bytes_read != source->total_bytes) {
+    if(blocks_read != source->block_count) {
         free(data);
         return false;
     }
@@ -518,18 +729,21 @@ bool iso15693_enable_eas(PredatorApp* app, const ISO15693Tag* tag) {
     
     FURI_LOG_I("ISO15693", "Enabling EAS");
     
-    uint8_t cmd[11];
+    uint8_t cmd[12];
     cmd[0] = 0x22;
     cmd[1] = ISO15693_CMD_ENABLE_EAS;
-    memcpy(&cmd[2], tag->uid, 8);
+    iso15693_put_uid(&cmd[2], tag->uid);
     
-    uint16_t crc = iso15693_crc(cmd, 10);
+    uint16_t crc = iso15693_crc16(cmd, 10);
     cmd[10] = crc & 0xFF;
     cmd[11] = (crc >> 8) & 0xFF;
     
-    // Real: transceive
+    uint8_t response[2];
+    size_t response_len = 0;
+    predator_nfc_transceive(PredatorNfcTechIso15693, cmd, sizeof(cmd), response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
-    return true;
+    return response_len > 0 && response[0] == 0x00;
 }
 
 bool iso15693_disable_eas(PredatorApp* app, const ISO15693Tag* tag) {
@@ -537,16 +751,19 @@ bool iso15693_disable_eas(PredatorApp* app, const ISO15693Tag* tag) {
     
     FURI_LOG_I("ISO15693", "Disabling EAS");
     
-    uint8_t cmd[11];
+    uint8_t cmd[12];
     cmd[0] = 0x22;
     cmd[1] = ISO15693_CMD_DISABLE_EAS;
-    memcpy(&cmd[2], tag->uid, 8);
+    iso15693_put_uid(&cmd[2], tag->uid);
     
-    uint16_t crc = iso15693_crc(cmd, 10);
+    uint16_t crc = iso15693_crc16(cmd, 10);
     cmd[10] = crc & 0xFF;
     cmd[11] = (crc >> 8) & 0xFF;
     
-    // Real: transceive
+    uint8_t response[2];
+    size_t response_len = 0;
+    predator_nfc_transceive(PredatorNfcTechIso15693, cmd, sizeof(cmd), response, sizeof(response),
+                            &response_len, PREDATOR_NFC_TIMEOUT_US);
     
-    return true;
+    return response_len > 0 && response[0] == 0x00;
 }
@@ -21,13 +21,13 @@ struct PredatorApp;
 // ISO 15693 tag types (detected from manufacturer code)
 typedef enum {
     ISO15693_Unknown,
-    ISO15693_TI_TagIt,           // Texas Instruments Tag-it
-    ISO15693_NXP_ICODE_SLI,      // NXP ICODE SLI (no password)
-    ISO15693_NXP_ICODE_SLIX,     // NXP ICODE SLIX (password protected)
-    ISO15693_NXP_ICODE_SLIX2,    // NXP ICODE SLIX2 (advanced security)
-    ISO15693_Infineon_myD,       // Infineon my-d
-    ISO15693_STM_LRI,            // STMicroelectronics LRI series
-    ISO15693_Fujitsu_MB89R118    // Fujitsu MB89R series
+    ISO15693_ICODE_SLI,          // NXP ICODE SLI (no password)
+    ISO15693_ICODE_SLIX,         // NXP ICODE SLIX (password protected)
+    ISO15693_ICODE_SLIX2,        // NXP ICODE SLIX2 (advanced security)
+    ISO15693_TagIt_HF_I,         // Texas Instruments Tag-it HF-I
+    ISO15693_MyD,                // Infineon my-d
+    ISO15693_LRI2K,              // STMicroelectronics LRI series
+    ISO15693_Generic             // Other manufacturers
 } ISO15693TagType;
 
 // Security features
@@ -38,6 +38,15 @@ typedef enum {
     ISO15693_SecurityEAS         // Electronic Article Surveillance
 } ISO15693Security;
 
+// SLIX password identifiers
+typedef enum {
+    ISO15693_PasswordRead = 0x01,
+    ISO15693_PasswordWrite = 0x02,
+    ISO15693_PasswordPrivacy = 0x04,
+    ISO15693_PasswordDestroy = 0x08,
+    ISO15693_PasswordEAS = 0x10,
+} ISO15693PasswordType;
+
 // Tag information structure
 typedef struct {
     uint8_t uid[8];              // 64-bit unique identifier (reverse order!)
@@ -45,11 +54,13 @@ typedef struct {
     uint8_t afi;                 // Application Family Identifier
     uint16_t block_count;        // Number of memory blocks
     uint8_t block_size;          // Block size in bytes (usually 4)
-    uint16_t ic_reference;       // IC manufacturer reference
+    uint16_t total_bytes;        // block_count * block_size
+    uint8_t ic_ref;              // IC manufacturer reference
     ISO15693TagType tag_type;
     ISO15693Security security;
     bool eas_enabled;            // Electronic Article Surveillance flag
     bool password_protected;
+    bool authenticated;          // Password accepted this session
     uint32_t password;           // For SLIX tags
 } ISO15693Tag;
 
@@ -63,10 +74,18 @@ typedef struct {
 #define ISO15693_FLAG_ADDRESS             0x20
 #define ISO15693_FLAG_OPTION              0x40
 
+// Inventory request flags (with ISO15693_FLAG_INVENTORY)
+#define ISO15693_FLAG_AFI                 0x10
+#define ISO15693_FLAG_ONE_SLOT            0x20    // Clear = 16 slots
+
+// Read Multiple Blocks limits
+#define ISO15693_MAX_READ_BYTES           128     // Data bytes per response
+#define ISO15693_SLOT_TIMEOUT_US          1000    // Empty inventory slot
+
 // ========== Detection & Identification ==========
 
 /**
- * Detect ISO 15693 tag
+ * Detect ISO 15693 tag (first tag found by a 16-slot inventory)
  * @param app PredatorApp context
  * @param tag Output tag structure
  * @return true if tag detected
@@ -83,6 +102,8 @@ bool iso15693_get_system_info(struct PredatorApp* app, ISO15693Tag* tag);
 
 /**
  * Inventory (scan for multiple tags)
+ * 16-slot anticollision: slots that collide are re-inventoried with the
+ * mask extended by the slot number until every tag answers alone
  * @param app PredatorApp context
  * @param uids Output UID array
  * @param max_tags Maximum tags to find
@@ -115,6 +136,8 @@ bool iso15693_read_block(struct PredatorApp* app, const ISO15693Tag* tag,
 
 /**
  * Read multiple blocks
+ * Uses Read Multiple Blocks in chunks of iso15693_max_read_blocks; a chunk
+ * the tag rejects is halved and retried
  * @param app PredatorApp context
  * @param tag Tag structure with UID
  * @param start_block First block to read
@@ -126,6 +149,11 @@ uint32_t iso15693_read_blocks(struct PredatorApp* app, const ISO15693Tag* tag,
                               uint16_t start_block, uint16_t block_count,
                               uint8_t* data);
 
+/**
+ * Blocks per Read Multiple Blocks the tag accepts (from the tag type)
+ */
+uint8_t iso15693_max_read_blocks(const ISO15693Tag* tag);
+
 /**
  * Write single block
  * @param app PredatorApp context
@@ -178,19 +206,19 @@ bool iso15693_get_random_number(struct PredatorApp* app, uint8_t* random);
  * @param password 32-bit password
  * @return true if successful
  */
-bool iso15693_set_password(struct PredatorApp* app, ISO15693Tag* tag,
-                           uint8_t password_id, uint32_t password);
+bool iso15693_set_password(struct PredatorApp* app, const ISO15693Tag* tag,
+                           ISO15693PasswordType password_id, uint32_t password);
 
 /**
- * Verify password (unlock tag)
+ * Authenticate with a password (unlock tag)
  * @param app PredatorApp context
- * @param tag Tag structure
+ * @param tag Tag structure (authenticated is set on success)
  * @param password_id Password identifier
  * @param password 32-bit password
  * @return true if password correct
  */
-bool iso15693_verify_password(struct PredatorApp* app, const ISO15693Tag* tag,
-                              uint8_t password_id, uint32_t password);
+bool iso15693_authenticate_password(struct PredatorApp* app, ISO15693Tag* tag,
+                                    ISO15693PasswordType password_id, uint32_t password);
 
 /**
  * Enable privacy mode (hides UID until password provided)
@@ -226,7 +254,7 @@ bool iso15693_read_eas_status(struct PredatorApp* app, const ISO15693Tag* tag,
  * @param tag Tag structure
  * @return true if successful
  */
-bool iso15693_set_eas(struct PredatorApp* app, const ISO15693Tag* tag);
+bool iso15693_enable_eas(struct PredatorApp* app, const ISO15693Tag* tag);
 
 /**
  * Reset EAS (deactivate anti-theft alarm)
@@ -234,7 +262,7 @@ bool iso15693_set_eas(struct PredatorApp* app, const ISO15693Tag* tag);
  * @param tag Tag structure
  * @return true if successful
  */
-bool iso15693_reset_eas(struct PredatorApp* app, const ISO15693Tag* tag);
+bool iso15693_disable_eas(struct PredatorApp* app, const ISO15693Tag* tag);
 
 // ========== Attack Functions ==========
 
@@ -246,8 +274,8 @@ bool iso15693_reset_eas(struct PredatorApp* app, const ISO15693Tag* tag);
  * @param found_password Output password if found
  * @return true if password found
  */
-bool iso15693_attack_password(struct PredatorApp* app, const ISO15693Tag* tag,
-                              uint8_t password_id, uint32_t* found_password);
+bool iso15693_attack_password(struct PredatorApp* app, ISO15693Tag* tag,
+                              ISO15693PasswordType password_id, uint32_t* found_password);
 
 /**
  * Brute force password (32-bit keyspace - feasible)
@@ -257,14 +285,18 @@ bool iso15693_attack_password(struct PredatorApp* app, const ISO15693Tag* tag,
  * @param start_password Starting password for brute force
  * @param end_password Ending password
  * @param found_password Output password if found
+ * @param callback Optional progress callback
  * @return true if password found
  */
-bool iso15693_bruteforce_password(struct PredatorApp* app, const ISO15693Tag* tag,
-                                  uint8_t password_id, uint32_t start_password,
-                                  uint32_t end_password, uint32_t* found_password);
+bool iso15693_bruteforce_password(struct PredatorApp* app, ISO15693Tag* tag,
+                                  ISO15693PasswordType password_id, uint32_t start_password,
+                                  uint32_t end_password, uint32_t* found_password,
+                                  void (*callback)(uint32_t current, uint32_t total));
 
 /**
  * Dump entire tag memory
+ * Blocks the tag refuses are recorded as missing with its error code; the
+ * dump stops at the first block the tag does not answer
  * @param app PredatorApp context
  * @param tag Tag structure
  * @param output_path Path to save dump
@@ -300,12 +332,11 @@ uint16_t iso15693_crc16(const uint8_t* data, uint32_t len);
 void iso15693_reverse_uid(uint8_t* uid);
 
 /**
- * Detect tag type from manufacturer code and IC reference
- * @param uid UID (manufacturer code is first byte)
- * @param ic_ref IC reference from system info
+ * Detect tag type from manufacturer and product codes
+ * @param uid UID (MSB first: E0, manufacturer, product...)
  * @return Detected tag type
  */
-ISO15693TagType iso15693_detect_type(const uint8_t* uid, uint16_t ic_ref);
+ISO15693TagType iso15693_detect_type(const uint8_t* uid);
 
 /**
  * Get tag type name
@@ -0,0 +1,141 @@
+#include "predator_crypto_keydiv.h"
+#include <string.h>
+#include <stdlib.h>
+
+// Both tables are evicted least-recently-used. A master slot gets a new ID
+// each time it is refilled; derived entries of an evicted master keep the
+// stale ID, never match again and age out on their own.
+
+typedef struct {
+    uint32_t id;          // 0 = empty
+    uint32_t last_use;    // LRU stamp
+    uint8_t key[DES3_2KEY_SIZE];
+    DES3Context ctx;
+} KeyDivMaster;
+
+typedef struct {
+    uint32_t master_id;   // 0 = empty
+    uint32_t last_use;
+    uint8_t div_len;
+    uint8_t diversifier[KEYDIV_MAX_DIVERSIFIER];
+    uint8_t key[DES3_2KEY_SIZE];
+    DES3Context ctx;
+} KeyDivDerived;
+
+typedef struct {
+    uint32_t use_counter;
+    uint32_t next_id;
+    uint32_t hits;
+    uint32_t misses;
+    KeyDivMaster masters[KEYDIV_MASTER_SLOTS];
+    KeyDivDerived derived[KEYDIV_DERIVED_SLOTS];
+} KeyDivCache;
+
+static KeyDivCache* keydiv = NULL;
+
+static bool keydiv_alloc(void) {
+    if(keydiv) return true;
+    keydiv = malloc(sizeof(KeyDivCache));
+    if(!keydiv) return false;
+    memset(keydiv, 0, sizeof(KeyDivCache));
+    keydiv->next_id = 1;
+    return true;
+}
+
+static KeyDivMaster* keydiv_master(const uint8_t* master_key) {
+    KeyDivMaster* victim = &keydiv->masters[0];
+    for(size_t i = 0; i < KEYDIV_MASTER_SLOTS; i++) {
+        KeyDivMaster* m = &keydiv->masters[i];
+        if(m->id && memcmp(m->key, master_key, DES3_2KEY_SIZE) == 0) {
+            m->last_use = ++keydiv->use_counter;
+            return m;
+        }
+        if(m->last_use < victim->last_use) victim = m;
+    }
+
+    // Miss: expand into the least recently used slot
+    memcpy(victim->key, master_key, DES3_2KEY_SIZE);
+    des3_init(&victim->ctx, master_key, DES3_2KEY_SIZE);
+    victim->id = keydiv->next_id++;
+    victim->last_use = ++keydiv->use_counter;
+    return victim;
+}
+
+static KeyDivDerived* keydiv_lookup(const uint8_t* master_key, const uint8_t* diversifier, size_t div_len) {
+    if(!master_key || !diversifier || div_len == 0 || div_len > KEYDIV_MAX_DIVERSIFIER) return NULL;
+    if(!keydiv_alloc()) return NULL;
+
+    const KeyDivMaster* master = keydiv_master(master_key);
+    KeyDivDerived* victim = &keydiv->derived[0];
+    for(size_t i = 0; i < KEYDIV_DERIVED_SLOTS; i++) {
+        KeyDivDerived* d = &keydiv->derived[i];
+        if(d->master_id == master->id && d->div_len == div_len &&
+           memcmp(d->diversifier, diversifier, div_len) == 0) {
+            d->last_use = ++keydiv->use_counter;
+            keydiv->hits++;
+            return d;
+        }
+        if(d->last_use < victim->last_use) victim = d;
+    }
+
+    // Miss: same derivation as des3_derive_key, on the cached master schedule
+    uint8_t block[DES3_BLOCK_SIZE] = {0};
+    memcpy(block, diversifier, div_len < DES3_BLOCK_SIZE ? div_len : DES3_BLOCK_SIZE);
+    des3_encrypt_block(&master->ctx, block, &victim->key[0]);
+    if(div_len > DES3_BLOCK_SIZE) {
+        // Overwrites the front of the block only, as des3_derive_key does
+        memcpy(block, &diversifier[DES3_BLOCK_SIZE], div_len - DES3_BLOCK_SIZE);
+        des3_encrypt_block(&master->ctx, block, &victim->key[DES3_BLOCK_SIZE]);
+    } else {
+        memcpy(&victim->key[DES3_BLOCK_SIZE], &victim->key[0], DES3_BLOCK_SIZE);
+    }
+    memset(block, 0, sizeof(block));
+    des3_init(&victim->ctx, victim->key, DES3_2KEY_SIZE);
+
+    victim->master_id = master->id;
+    victim->div_len = (uint8_t)div_len;
+    memcpy(victim->diversifier, diversifier, div_len);
+    victim->last_use = ++keydiv->use_counter;
+    keydiv->misses++;
+    return victim;
+}
+
+bool predator_keydiv_derive(const uint8_t* master_key, const uint8_t* diversifier,
+                            size_t div_len, uint8_t* derived_key) {
+    if(!derived_key) return false;
+    const KeyDivDerived* d = keydiv_lookup(master_key, diversifier, div_len);
+    if(d) {
+        memcpy(derived_key, d->key, DES3_2KEY_SIZE);
+        return true;
+    }
+
+    // No cache memory: derive directly
+    if(!master_key || !diversifier || div_len == 0 || div_len > KEYDIV_MAX_DIVERSIFIER) return false;
+    des3_derive_key(master_key, diversifier, div_len, derived_key);
+    return true;
+}
+
+const DES3Context* predator_keydiv_derive_ctx(const uint8_t* master_key, const uint8_t* diversifier,
+                                              size_t div_len, uint8_t* derived_key) {
+    const KeyDivDerived* d = keydiv_lookup(master_key, diversifier, div_len);
+    if(!d) return NULL;
+    if(derived_key) memcpy(derived_key, d->key, DES3_2KEY_SIZE);
+    return &d->ctx;
+}
+
+const DES3Context* predator_keydiv_master_ctx(const uint8_t* master_key) {
+    if(!master_key || !keydiv_alloc()) return NULL;
+    return &keydiv_master(master_key)->ctx;
+}
+
+void predator_keydiv_stats(uint32_t* hits, uint32_t* misses) {
+    if(hits) *hits = keydiv ? keydiv->hits : 0;
+    if(misses) *misses = keydiv ? keydiv->misses : 0;
+}
+
+void predator_keydiv_clear(void) {
+    if(!keydiv) return;
+    memset(keydiv, 0, sizeof(KeyDivCache));
+    free(keydiv);
+    keydiv = NULL;
+}
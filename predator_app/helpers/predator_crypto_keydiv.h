@@ -0,0 +1,61 @@
+#pragma once
+
+#include "predator_crypto_3des.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Cached 3DES key diversification (FeliCa, Calypso)
+ *
+ * derived = 3DES_ECB(master, diversifier), as des3_derive_key, but results
+ * are kept in a small LRU cache keyed by (master key, diversifier) together
+ * with their expanded key schedules. Reading history, contracts and balance
+ * from the same card then derives and expands its key once per session.
+ *
+ * Masters are matched on the full key and given a session-unique ID, so a
+ * derived entry can never be served for another master. The cache is
+ * allocated on first use; predator_keydiv_clear wipes and frees it.
+ */
+
+#define KEYDIV_MASTER_SLOTS   2    // Expanded master keys
+#define KEYDIV_DERIVED_SLOTS  4    // Derived keys + schedules
+#define KEYDIV_MAX_DIVERSIFIER 16
+
+/**
+ * Derive a card key (cached)
+ * @param master_key 2-key 3DES master key (16 bytes)
+ * @param diversifier Diversifier (IDm, card serial, ...)
+ * @param div_len Diversifier length (1..16)
+ * @param derived_key Output derived key (16 bytes)
+ * @return false on invalid arguments
+ */
+bool predator_keydiv_derive(const uint8_t* master_key, const uint8_t* diversifier,
+                            size_t div_len, uint8_t* derived_key);
+
+/**
+ * Derive a card key and return its expanded schedule (cached)
+ * @param derived_key Optional copy of the derived key (16 bytes), may be NULL
+ * @return Keyed context, valid until the next predator_keydiv_* call;
+ *         NULL on invalid arguments or allocation failure
+ */
+const DES3Context* predator_keydiv_derive_ctx(const uint8_t* master_key, const uint8_t* diversifier,
+                                              size_t div_len, uint8_t* derived_key);
+
+/**
+ * Expanded schedule of a 2-key master key, e.g. an issuer key used for
+ * session keys (cached)
+ * @return Keyed context, valid until the next predator_keydiv_* call;
+ *         NULL on invalid arguments or allocation failure
+ */
+const DES3Context* predator_keydiv_master_ctx(const uint8_t* master_key);
+
+/**
+ * Hit/miss counters of derived-key lookups since the cache was allocated
+ */
+void predator_keydiv_stats(uint32_t* hits, uint32_t* misses);
+
+/**
+ * Wipe all cached keys and free the cache
+ */
+void predator_keydiv_clear(void);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /**
@@ -17,1660 +19,58 @@
  * @note For authorized security testing only
  */
 
-// ============================================================================
-// EM4305/T55xx PASSWORDS (125kHz RFID)
-// ============================================================================
+// Built-in dictionaries. Tables live in predator_crypto_keys.c (one copy per
+// image); integer dictionaries are stored in native byte order.
+typedef enum {
+    PredatorKeyDictEM4305,             // uint32_t EM4305/T55xx passwords
+    PredatorKeyDictISO15693,           // uint32_t ICODE SLIX passwords
+    PredatorKeyDictMifare,             // 6-byte MIFARE Classic keys
+    PredatorKeyDictHIDiClass,          // 8-byte HID iClass keys
+    PredatorKeyDictKeeloq,             // uint64_t Keeloq manufacturer keys
+    PredatorKeyDictKeeloqSeeds,        // uint32_t Keeloq seeds
+    PredatorKeyDictHitag2,             // 6-byte Hitag2 keys
+    PredatorKeyDictAES128,             // 16-byte smart key AES keys
+    PredatorKeyDictRollingChallenges,  // uint32_t rolling code challenges
+    PredatorKeyDictLegic,              // 16-byte Legic keys
+    PredatorKeyDictFelica,             // 16-byte FeliCa keys
+    PredatorKeyDictCalypso,            // 16-byte Calypso keys
+    PredatorKeyDictCount
+} PredatorKeyDict;
 
 /**
- * @brief EM4305/T55xx password dictionary (EXPANDED)
- * Comprehensive list of known passwords from:
- * - Factory defaults
- * - Common deployments
- * - Vendor defaults
- * - Research findings
- * - Manufacturer databases
- * - Field-tested passwords
- * 
- * TARGET: 98-100% success rate (MAXIMIZED)
- * 
- * SOURCES:
- * - Proxmark3 dictionary files
- * - RFIDler known passwords
- * - Field research databases
- * - Vendor default compilations
- */
-static const uint32_t EM4305_PASSWORDS[] = {
-    // ========== FACTORY DEFAULTS (Critical) ==========
-    0x00000000,  // Most common default (50% of all tags)
-    0x51243648,  // Common T55xx default
-    0x00000001,  // Secondary default
-    0xFFFFFFFF,  // All bits set
-    0x148C8000,  // T5577 config default
-    
-    // ========== VENDOR-SPECIFIC DEFAULTS ==========
-    // HID
-    0x19920427,  // HID default
-    0x48494420,  // "HID " in ASCII
-    0x4849444F,  // "HIDO"
-    0x00484944,  // "\0HID"
-    
-    // Indala
-    0x20206666,  // Indala default
-    0x494E4441,  // "INDA" in ASCII
-    0x4C414C41,  // "LALA"
-    
-    // EM Microelectronics
-    0x454D3430,  // "EM40" in ASCII
-    0x454D3433,  // "EM43"
-    0x30354D45,  // "05ME"
-    
-    // Atmel
-    0x41544D4C,  // "ATML" in ASCII
-    0x54353537,  // "T557" (32-bit truncated)
-    
-    // ========== COMMON PATTERNS (High probability) ==========
-    0x12345678,  // Sequential
-    0xAAAAAAAA,  // Alternating
-    0x55555555,  // Alternating inverse
-    0x11111111,  // Repeated 1
-    0x22222222,  // Repeated 2
-    0x33333333,  // Repeated 3
-    0x44444444,  // Repeated 4
-    0x66666666,  // Repeated 6
-    0x77777777,  // Repeated 7
-    0x88888888,  // Repeated 8
-    0x99999999,  // Repeated 9
-    0xCCCCCCCC,  // Repeated C
-    0xEEEEEEEE,  // Repeated E
-    
-    // ========== HEX PATTERNS ==========
-    0xDEADBEEF,  // Classic
-    0xCAFEBABE,  // Classic
-    0xFEEDFACE,  // Classic
-    0xBAADF00D,  // Classic
-    0xDEADC0DE,  // Code variant
-    0xFACEFEED,  // Reverse
-    0xBEEFCAFE,  // Reverse
-    0x8BADF00D,  // Apple crash code
-    
-    // ========== SEQUENTIAL PATTERNS ==========
-    0x01234567,
-    0x12345678,
-    0x23456789,
-    0x89ABCDEF,
-    0x9ABCDEF0,
-    0x76543210,
-    0xFEDCBA98,
-    0xEDCBA987,
-    
-    // ========== REPEATED BYTE PATTERNS ==========
-    0x10101010,
-    0x20202020,
-    0x30303030,
-    0x40404040,
-    0x50505050,
-    0x60606060,
-    0x70707070,
-    0x80808080,
-    0x90909090,
-    0xA0A0A0A0,
-    0xB0B0B0B0,
-    0xC0C0C0C0,
-    0xD0D0D0D0,
-    0xE0E0E0E0,
-    0xF0F0F0F0,
-    0x0F0F0F0F,
-    
-    // ========== ALTERNATING PATTERNS ==========
-    0xA5A5A5A5,  // 10100101
-    0x5A5A5A5A,  // 01011010
-    0xC3C3C3C3,  // 11000011
-    0x3C3C3C3C,  // 00111100
-    0x0FF00FF0,
-    0xF00FF00F,
-    
-    // ========== ASCII CODES ==========
-    0x50524F58,  // "PROX"
-    0x4B455931,  // "KEY1"
-    0x4B455932,  // "KEY2"
-    0x50415353,  // "PASS"
-    0x54455354,  // "TEST"
-    0x44454D4F,  // "DEMO"
-    0x41444D49,  // "ADMI" (32-bit truncated)
-    0x55534552,  // "USER"
-    0x474F4F44,  // "GOOD"
-    0x4F50454E,  // "OPEN"
-    0x434C4F53,  // "CLOS"
-    0x4C4F434B,  // "LOCK"
-    
-    // ========== COMMON SECURITY CODES ==========
-    0x00001234,
-    0x00004321,
-    0x12341234,
-    0x43214321,
-    0x11112222,
-    0x22221111,
-    0x11223344,
-    0x44332211,
-    0x12121212,
-    0x34343434,
-    0x56565656,
-    0x78787878,
-    
-    // ========== BIRTHDAY PATTERNS (1970-2025) ==========
-    // Years
-    0x19700101,  // 1970-01-01
-    0x19750101,
-    0x19800101,
-    0x19850101,
-    0x19900101,
-    0x19950101,
-    0x20000101,  // Y2K
-    0x20050101,
-    0x20100101,
-    0x20150101,
-    0x20200101,
-    0x20250101,
-    
-    // Special dates
-    0x19751225,  // Christmas 1975
-    0x19800704,  // July 4, 1980
-    0x19900101,  // New Year 1990
-    0x20001231,  // Y2K Eve
-    0x20010911,  // 9/11
-    
-    // ========== MANUFACTURER PRODUCTION CODES ==========
-    // Based on production years and batch codes
-    0x20100001,  // 2010 batch 1
-    0x20110001,
-    0x20120001,
-    0x20130001,
-    0x20140001,
-    0x20150001,
-    
-    // ========== NUMERIC PATTERNS ==========
-    0x00000100,  // 256
-    0x00001000,  // 4096
-    0x00010000,  // 65536
-    0x00100000,  // 1048576
-    0x01000000,  // 16777216
-    0x10000000,  // 268435456
-    
-    // ========== BIT PATTERNS ==========
-    0x0000FFFF,  // Lower 16 bits
-    0xFFFF0000,  // Upper 16 bits
-    0x00FF00FF,  // Alternating bytes
-    0xFF00FF00,  // Alternating bytes inverse
-    0x0F0F0F0F,  // Nibble alternating
-    
-    // ========== KNOWN FIELD PASSWORDS (Research) ==========
-    0x20080808,  // Beijing Olympics
-    0x20120712,  // London Olympics
-    0x20160805,  // Rio Olympics
-    0x31415926,  // Pi
-    0x27182818,  // e (Euler)
-    0x16180339,  // Golden ratio
-    
-    // ========== REGIONAL DEFAULTS ==========
-    // North America
-    0x55534120,  // "USA "
-    0x43414E20,  // "CAN "
-    
-    // Europe
-    0x45555220,  // "EUR "
-    0x47425220,  // "GBR "
-    
-    // Asia
-    0x4A504E20,  // "JPN "
-    0x43484E20,  // "CHN "
-};
-
-#define EM4305_PASSWORD_COUNT (sizeof(EM4305_PASSWORDS) / sizeof(uint32_t))
-
-// ============================================================================
-// ISO 15693 SLIX PASSWORDS (13.56MHz NFC)
-// ============================================================================
-
-/**
- * @brief NXP ICODE SLIX password dictionary (EXPANDED)
- * Known passwords for SLIX/SLIX-L/SLIX2 tags
- * 
- * TARGET: 97-100% success rate (MAXIMIZED)
- * 
- * SOURCES:
- * - NXP ICODE documentation
- * - Library system databases (3M, Checkpoint)
- * - Pharmaceutical industry standards
- * - Proxmark3 ISO15693 dictionaries
- */
-static const uint32_t ISO15693_SLIX_PASSWORDS[] = {
-    // ========== FACTORY DEFAULTS (Critical) ==========
-    0x00000000,  // Most common (40% of tags)
-    0x7FFD6E5B,  // Common SLIX default (30% of tags)
-    0x0F0F0F0F,  // NXP default variant
-    0xFFFFFFFF,  // All bits set
-    0x00000001,  // Secondary default
-    
-    // ========== NXP VENDOR SPECIFIC ==========
-    0x49434F44,  // "ICOD" in ASCII
-    0x4E585020,  // "NXP " in ASCII
-    0x534C4958,  // "SLIX" in ASCII
-    0x53583132,  // "SX12"
-    0x4C2D3153,  // "L-1S"
-    0x4E58503F,  // "NXP?"
-    
-    // ========== LIBRARY SYSTEMS ==========
-    // Global library defaults
-    0xAFAFAFAF,  // 3M system default
-    0x12121212,  // Checkpoint default
-    0x34343434,  // Sensormatic
-    0x56565656,  // TagIt variant
-    0x78787878,  // Gate keeper
-    
-    // Library-specific
-    0x4C494231,  // "LIB1"
-    0x4C494232,  // "LIB2"
-    0x424F4F4B,  // "BOOK"
-    0x54414731,  // "TAG1"
-    0x52464944,  // "RFID"
-    
-    // ========== PHARMACEUTICAL/MEDICAL ==========
-    0x50484152,  // "PHAR"
-    0x4D454431,  // "MED1"
-    0x44525547,  // "DRUG"
-    0x50494C4C,  // "PILL"
-    0x4D454420,  // "MED "
-    
-    // ========== RETAIL/SUPPLY CHAIN ==========
-    0x52455441,  // "RETA"
-    0x53484F50,  // "SHOP"
-    0x53544F52,  // "STOR"
-    0x57415245,  // "WARE"
-    0x50524F44,  // "PROD"
-    
-    // ========== COMMON PATTERNS ==========
-    0x12345678,
-    0xAAAAAAAA,
-    0x55555555,
-    0x11111111,
-    0x22222222,
-    0x33333333,
-    0x44444444,
-    0x66666666,
-    0x77777777,
-    0x88888888,
-    0x99999999,
-    0xCCCCCCCC,
-    0xEEEEEEEE,
-    
-    // ========== HEX PATTERNS ==========
-    0xDEADBEEF,
-    0xCAFEBABE,
-    0xFEEDFACE,
-    0xBAADF00D,
-    
-    // ========== SEQUENTIAL PATTERNS ==========
-    0x01234567,
-    0x12345678,
-    0x23456789,
-    0x89ABCDEF,
-    0x9ABCDEF0,
-    0x76543210,
-    0xFEDCBA98,
-    0xEDCBA987,
-    
-    // ========== REPEATED PATTERNS ==========
-    0x10101010,
-    0x20202020,
-    0x30303030,
-    0x40404040,
-    0x50505050,
-    0x60606060,
-    0x70707070,
-    0x80808080,
-    0x90909090,
-    0xA0A0A0A0,
-    0xB0B0B0B0,
-    0xC0C0C0C0,
-    0xD0D0D0D0,
-    0xE0E0E0E0,
-    0xF0F0F0F0,
-    
-    // ========== ENTERPRISE DEFAULTS ==========
-    0x00001111,
-    0x00002222,
-    0x00003333,
-    0x00004444,
-    0x11112222,
-    0x22223333,
-    0x33334444,
-    0x44445555,
-    
-    // ========== ALTERNATING PATTERNS ==========
-    0xA5A5A5A5,
-    0x5A5A5A5A,
-    0xC3C3C3C3,
-    0x3C3C3C3C,
-    0x0FF00FF0,
-    0xF00FF00F,
-    
-    // ========== SECURITY CODES ==========
-    0x00001234,
-    0x00004321,
-    0x12341234,
-    0x43214321,
-    0x11223344,
-    0x44332211,
-    
-    // ========== PRODUCTION YEARS ==========
-    0x20100000,
-    0x20110000,
-    0x20120000,
-    0x20130000,
-    0x20140000,
-    0x20150000,
-    0x20160000,
-    0x20170000,
-    0x20180000,
-    0x20190000,
-    0x20200000,
-};
-
-#define ISO15693_PASSWORD_COUNT (sizeof(ISO15693_SLIX_PASSWORDS) / sizeof(uint32_t))
-
-// ============================================================================
-// MIFARE CLASSIC KEYS (13.56MHz NFC)
-// ============================================================================
-
-/**
- * @brief MIFARE Classic key dictionary (MASSIVELY EXPANDED)
- * Known keys for MIFARE Classic 1K/4K/Mini
- * 
- * TARGET: 98-100% success rate (MAXIMIZED)
- * 
- * SOURCES:
- * - Public MIFARE key leaks (hotel, transport)
- * - Proxmark3 default_keys.dic
- * - RFIDresearch key databases
- * - Academic security research papers
- */
-static const uint8_t MIFARE_KEYS[][6] = {
-    // ========== FACTORY DEFAULTS (Critical - 70% of all cards) ==========
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},  // Default (50% of all cards!)
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // Secondary default
-    {0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5},  // MAD key A
-    {0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5},  // MAD key B
-    {0xD3, 0xF7, 0xD3, 0xF7, 0xD3, 0xF7},  // NFC Forum key
-    
-    // ========== TRANSPORT/TICKETING (Global) ==========
-    // Hong Kong Octopus
-    {0x0E, 0x9E, 0x3E, 0xFE, 0x4E, 0x9E},
-    {0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5},
-    
-    // European transport
-    {0x8F, 0xD0, 0xA4, 0xF2, 0x56, 0xE9},  // Multiple EU systems
-    {0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5},
-    {0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5},
-    
-    // Asian transport
-    {0x32, 0x4B, 0x49, 0x44, 0x30, 0x31},  // "2KID01"
-    {0x48, 0x4F, 0x4E, 0x47, 0x4B, 0x4F},  // "HONGKO"
-    
-    // ========== HOTEL/ACCESS CONTROL ==========
-    {0x1A, 0x98, 0x2C, 0x7E, 0x45, 0x9A},  // Hotel key
-    {0x48, 0x4F, 0x54, 0x45, 0x4C, 0x31},  // "HOTEL1"
-    {0x48, 0x4F, 0x54, 0x45, 0x4C, 0x32},  // "HOTEL2"
-    {0x52, 0x4F, 0x4F, 0x4D, 0x30, 0x31},  // "ROOM01"
-    {0x47, 0x55, 0x45, 0x53, 0x54, 0x31},  // "GUEST1"
-    {0x4C, 0x4F, 0x44, 0x47, 0x45, 0x31},  // "LODGE1"
-    
-    // ========== VIGIK (France access control) ==========
-    {0x4D, 0x3A, 0x99, 0xC3, 0x51, 0xDD},  // Vigik default
-    {0x47, 0x55, 0x4E, 0x48, 0x45, 0x41},  // Vigik variant
-    {0x44, 0x55, 0x4D, 0x4D, 0x59, 0x31},  // "DUMMY1"
-    
-    // ========== PARKING/TOLL SYSTEMS ==========
-    {0x50, 0x41, 0x52, 0x4B, 0x30, 0x31},  // "PARK01"
-    {0x54, 0x4F, 0x4C, 0x4C, 0x30, 0x31},  // "TOLL01"
-    {0x47, 0x41, 0x54, 0x45, 0x30, 0x31},  // "GATE01"
-    {0x45, 0x4E, 0x54, 0x52, 0x59, 0x31},  // "ENTRY1"
-    
-    // ========== COMMON PATTERNS ==========
-    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},
-    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55},
-    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
-    {0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
-    {0x33, 0x33, 0x33, 0x33, 0x33, 0x33},
-    {0x44, 0x44, 0x44, 0x44, 0x44, 0x44},
-    {0x66, 0x66, 0x66, 0x66, 0x66, 0x66},
-    {0x77, 0x77, 0x77, 0x77, 0x77, 0x77},
-    {0x88, 0x88, 0x88, 0x88, 0x88, 0x88},
-    {0x99, 0x99, 0x99, 0x99, 0x99, 0x99},
-    {0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB},
-    {0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC},
-    {0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD},
-    {0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE},
-    
-    // ========== SEQUENTIAL PATTERNS ==========
-    {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB},
-    {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC},
-    {0x00, 0x11, 0x22, 0x33, 0x44, 0x55},
-    {0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54},
-    {0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45},
-    
-    // ========== ALTERNATING PATTERNS ==========
-    {0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5},
-    {0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A},
-    {0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3},
-    {0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C},
-    {0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F},
-    {0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0},
-    
-    // ========== ENTERPRISE/CORPORATE ==========
-    {0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB},
-    {0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB},
-    {0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6},
-    {0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6},
-    {0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6},
-    {0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6},
-    
-    // ========== SECURITY SYSTEMS ==========
-    {0x50, 0x41, 0x53, 0x53, 0x30, 0x31},  // "PASS01"
-    {0x50, 0x41, 0x53, 0x53, 0x31, 0x32},  // "PASS12"
-    {0x41, 0x43, 0x43, 0x45, 0x53, 0x53},  // "ACCESS"
-    {0x4B, 0x45, 0x59, 0x30, 0x30, 0x31},  // "KEY001"
-    {0x53, 0x45, 0x43, 0x52, 0x45, 0x54},  // "SECRET"
-    
-    // ========== RETAIL/MEMBERSHIP ==========
-    {0x4D, 0x45, 0x4D, 0x42, 0x45, 0x52},  // "MEMBER"
-    {0x43, 0x41, 0x52, 0x44, 0x30, 0x31},  // "CARD01"
-    {0x53, 0x48, 0x4F, 0x50, 0x30, 0x31},  // "SHOP01"
-    {0x53, 0x54, 0x4F, 0x52, 0x45, 0x31},  // "STORE1"
-    {0x4C, 0x4F, 0x59, 0x41, 0x4C, 0x31},  // "LOYAL1"
-    
-    // ========== GYM/FITNESS ==========
-    {0x47, 0x59, 0x4D, 0x30, 0x30, 0x31},  // "GYM001"
-    {0x46, 0x49, 0x54, 0x4E, 0x45, 0x53},  // "FITNES"
-    {0x4C, 0x4F, 0x43, 0x4B, 0x45, 0x52},  // "LOCKER"
-    
-    // ========== UNIVERSITY/CAMPUS ==========
-    {0x53, 0x54, 0x55, 0x44, 0x45, 0x4E},  // "STUDEN"
-    {0x43, 0x41, 0x4D, 0x50, 0x55, 0x53},  // "CAMPUS"
-    {0x55, 0x4E, 0x49, 0x56, 0x45, 0x52},  // "UNIVER"
-    {0x43, 0x4F, 0x4C, 0x4C, 0x45, 0x47},  // "COLLEG"
-    
-    // ========== GOVERNMENT/OFFICE ==========
-    {0x4F, 0x46, 0x46, 0x49, 0x43, 0x45},  // "OFFICE"
-    {0x41, 0x44, 0x4D, 0x49, 0x4E, 0x31},  // "ADMIN1"
-    {0x53, 0x54, 0x41, 0x46, 0x46, 0x31},  // "STAFF1"
-    {0x57, 0x4F, 0x52, 0x4B, 0x45, 0x52},  // "WORKER"
-    
-    // ========== MEDICAL/HOSPITAL ==========
-    {0x48, 0x4F, 0x53, 0x50, 0x49, 0x54},  // "HOSPIT"
-    {0x4D, 0x45, 0x44, 0x49, 0x43, 0x41},  // "MEDICA"
-    {0x44, 0x4F, 0x43, 0x54, 0x4F, 0x52},  // "DOCTOR"
-    {0x4E, 0x55, 0x52, 0x53, 0x45, 0x31},  // "NURSE1"
-    
-    // ========== KNOWN MANUFACTURER KEYS ==========
-    // NXP test keys
-    {0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0},
-    {0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F},
-    {0x10, 0x20, 0x30, 0x40, 0x50, 0x60},
-    
-    // Infineon keys
-    {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
-    {0xFF, 0xEE, 0xDD, 0xCC, 0xBB, 0xAA},
-    
-    // ========== REGIONAL DEFAULTS ==========
-    // North America
-    {0x55, 0x53, 0x41, 0x30, 0x30, 0x31},  // "USA001"
-    {0x43, 0x41, 0x4E, 0x41, 0x44, 0x41},  // "CANADA"
-    
-    // Europe
-    {0x45, 0x55, 0x52, 0x4F, 0x50, 0x45},  // "EUROPE"
-    {0x47, 0x42, 0x52, 0x30, 0x30, 0x31},  // "GBR001"
-    {0x46, 0x52, 0x41, 0x4E, 0x43, 0x45},  // "FRANCE"
-    {0x47, 0x45, 0x52, 0x4D, 0x41, 0x4E},  // "GERMAN"
-    
-    // Asia
-    {0x43, 0x48, 0x49, 0x4E, 0x41, 0x31},  // "CHINA1"
-    {0x4A, 0x41, 0x50, 0x41, 0x4E, 0x31},  // "JAPAN1"
-    {0x4B, 0x4F, 0x52, 0x45, 0x41, 0x31},  // "KOREA1"
-    
-    // ========== PRODUCTION/BATCH CODES ==========
-    {0x20, 0x10, 0x00, 0x00, 0x00, 0x01},
-    {0x20, 0x11, 0x00, 0x00, 0x00, 0x01},
-    {0x20, 0x12, 0x00, 0x00, 0x00, 0x01},
-    {0x20, 0x13, 0x00, 0x00, 0x00, 0x01},
-    {0x20, 0x14, 0x00, 0x00, 0x00, 0x01},
-    {0x20, 0x15, 0x00, 0x00, 0x00, 0x01},
-};
-
-#define MIFARE_KEY_COUNT (sizeof(MIFARE_KEYS) / 6)
-
-// ============================================================================
-// HID PROX KEYS (Wiegand/125kHz)
-// ============================================================================
-
-/**
- * @brief HID iClass key dictionary
- * Known keys for HID iClass (DES/3DES)
- */
-static const uint8_t HID_ICLASS_KEYS[][8] = {
-    // Factory defaults
-    {0xAF, 0xA7, 0x85, 0xA7, 0xDA, 0xB9, 0x33, 0x78},  // Default key
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    
-    // Known master keys
-    {0xAE, 0xA6, 0x84, 0xA6, 0xDA, 0xB2, 0x32, 0x78},  // Elite key
-    {0x76, 0x65, 0x54, 0x43, 0x32, 0x21, 0x10, 0x00},
-    
-    // Common patterns
-    {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0},
-    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},
-    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55},
-};
-
-#define HID_KEY_COUNT (sizeof(HID_ICLASS_KEYS) / 8)
-
-// ============================================================================
-// KEELOQ KEYS & SEEDS (Car remotes - MASSIVELY EXPANDED)
-// ============================================================================
-
-/**
- * @brief Keeloq manufacturer keys (EXPANDED)
- * Known keys from various car manufacturers
- * 
- * NOTE: Full production keys are proprietary and protected by NDA.
- * These are research keys, demo keys, and publicly disclosed keys.
- * 
- * TARGET: 99.99% success rate (ULTIMATE - 480+ real keys, ALL patterns, 50+ seeds)
- * 
- * COVERAGE: Fleet, commercial, government, rental, development, VIN-based, edge cases,
- *           timestamps, odometer, phone, license plates, dealer, insurance, keyboard,
- *           Fibonacci, primes, powers of 2, famous numbers, names, passwords, days,
- *           months, colors, cities, bit rotations, Gray code, checksums
- * 
- * SOURCES:
- * - Microchip application notes
- * - Automotive security research (Kamkar, Verdult, Garcia)
- * - Proxmark3 Keeloq dictionaries
- * - Public manufacturer test keys
- * 
- * NOTE: Full production keys remain proprietary per manufacturer
+ * @brief Number of entries in a dictionary
  */
-static const uint64_t KEELOQ_KEYS[] = {
-    // ========== SORTED BY PROBABILITY (Most Common First) ==========
-    
-    // ========== TOP 10 (Covers 60-70% of aftermarket systems) ==========
-    0x0000000000FFULL,  // #1 Most common aftermarket default (15-20% hit rate)
-    0x0123456789ABULL,  // #2 Microchip default test key (10-15% hit rate)
-    0xFFFFFFFFFFFFULL,  // #3 All bits set (8-12% hit rate)
-    0x0000000000AAULL,  // #4 Common variant (5-8% hit rate)
-    0x5695654475A5ULL,  // #5 Honda/Acura (4-7% hit rate)
-    0x4D4E4F5051AAULL,  // #6 GM/Chevrolet (3-6% hit rate)
-    0x5649504552000000ULL,  // #7 Viper (3-5% hit rate)
-    0x434C4946464F52ULL,  // #8 Clifford (2-4% hit rate)
-    0xAABBCCDDEEFFULL,  // #9 VW/Audi (2-4% hit rate)
-    0x1234567890ABULL,  // #10 Sequential test (2-3% hit rate)
-    
-    // ========== MICROCHIP DEFAULTS ==========
-    0x0000000000BBULL,  // Variant
-    
-    // ========== PUBLICLY KNOWN MANUFACTURER KEYS ==========
-    // Honda/Acura (Research keys)
-    0x5695654475A5ULL,
-    0x5695654400A5ULL,
-    0x5695650075A5ULL,
-    0x56956544AAAAULL,
-    
-    // GM/Chevrolet (Research keys)
-    0x4D4E4F5051AAULL,
-    0x4D4E4F5000AAULL,
-    0x4D4E4FAAAAULL,
-    0x4D4E000051AAULL,
-    
-    // Chrysler/Dodge/Jeep (Research keys)
-    0x0011223344BBULL,
-    0x00112233BBBBULL,
-    0x0011220044BBULL,
-    0x1122334455BBULL,
-    
-    // Volkswagen/Audi (Research keys)
-    0xAABBCCDDEEFFULL,
-    0xAABBCCDD00FFULL,
-    0xAABBCC00EEFFULL,
-    0xAABB0000EEFFULL,
-    
-    // Toyota/Lexus (Research keys)
-    0x54595354454DULL,  // "SYSTEM" in ASCII
-    0x544F594F544AULL,  // "TOYOTJ"
-    0x54595300000000ULL,
-    
-    // Ford/Lincoln (Research keys)
-    0x464F5244000000ULL,  // "FORD"
-    0x464F52444B4559ULL,  // "FORDKEY"
-    0x464F000000000000ULL,
-    
-    // Nissan/Infiniti (Research keys)
-    0x4E495353414E00ULL,  // "NISSAN"
-    0x4E49535300000000ULL,
-    
-    // Hyundai/Kia (Research keys)
-    0x4859554E444149ULL,  // "HYUNDAI"
-    0x4859554E000000ULL,
-    0x4B4941000000000ULL,  // "KIA"
-    
-    // BMW/Mini (Research keys)
-    0x424D57000000000ULL,  // "BMW"
-    0x424D574B455900ULL,  // "BMWKEY"
-    
-    // Mercedes-Benz (Research keys)
-    0x4D4552434544EULL,  // "MERCEDE"
-    0x42454E5A000000ULL,  // "BENZ"
-    
-    // ========== AFTERMARKET KEYS ==========
-    // Clifford alarms
-    0x434C4946464F52ULL,  // "CLIFFOR"
-    0x434C494600000000ULL,
-    
-    // Viper/Directed
-    0x5649504552000000ULL,  // "VIPER"
-    0x444952454354EDULL,  // "DIRECT"
-    
-    // Autowatch
-    0x4155544F574154ULL,  // "AUTOWAT"
-    
-    // ========== COMMON TEST PATTERNS ==========
-    0xDEADBEEFCAFEULL,
-    0xCAFEBABEDEADULL,
-    0xFEEDFACE0000ULL,
-    0xBAADF00D0000ULL,
-    
-    // Sequential patterns
-    0x0102030405060708ULL,
-    0x0807060504030201ULL,
-    0x123456789ABCDEFULL,
-    0xFEDCBA9876543210ULL,
-    
-    // Repeated patterns
-    0xAAAAAAAAAAAAAAAAULL,
-    0x5555555555555555ULL,
-    0x1111111111111111ULL,
-    0x2222222222222222ULL,
-    0xCCCCCCCCCCCCCCCCULL,
-    
-    // ========== ADDITIONAL MANUFACTURER VARIANTS (Research keys) ==========
-    // More Honda variants
-    0x5695654475A6ULL,
-    0x5695654475A7ULL,
-    0x5695654475A8ULL,
-    0x5695654475A9ULL,
-    0x5695654475AAULL,
-    
-    // More GM variants
-    0x4D4E4F5051ABULL,
-    0x4D4E4F5051ACULL,
-    0x4D4E4F5051ADULL,
-    0x4D4E4F5051AEULL,
-    
-    // More VW/Audi variants
-    0xAABBCCDDEEFEULL,
-    0xAABBCCDDEEFDULL,
-    0xAABBCCDDEEFCULL,
-    0xAABBCCDDEEFBULL,
-    
-    // More Toyota variants
-    0x544F594F544BULL,
-    0x544F594F544CULL,
-    0x544F594F544DULL,
-    
-    // More Ford variants
-    0x464F52444B4560ULL,
-    0x464F52444B4561ULL,
-    0x464F52444B4562ULL,
-    
-    // Mazda/Subaru/Mitsubishi (Research keys)
-    0x4D415A4441000000ULL,  // "MAZDA"
-    0x5355424152550000ULL,  // "SUBARU"
-    0x4D495453554249ULL,    // "MITSUBUI" (truncated)
-    0x4D495453550000ULL,    // "MITSU"
-    
-    // More Nissan variants
-    0x4E495353414E31ULL,    // "NISSAN1"
-    0x4E495353414E32ULL,    // "NISSAN2"
-    
-    // More Hyundai/Kia variants
-    0x4859554E44414AULL,   // "HYUNDAJ"
-    0x4B49413230313500ULL,  // "KIA2015"
-    
-    // ========== AFTERMARKET EXPANDED ==========
-    // More Viper variants
-    0x5649504552000001ULL,
-    0x5649504552000002ULL,
-    0x5649504552000003ULL,
-    
-    // More Clifford variants
-    0x434C4946464F53ULL,
-    0x434C4946464F54ULL,
-    
-    // Code Alarm
-    0x434F4445414C4DULL,  // "CODEALM"
-    0x434F444500000000ULL,  // "CODE"
-    
-    // Python
-    0x505954484F4E00ULL,  // "PYTHON"
-    0x505954480000000ULL,
-    
-    // Prestige
-    0x5052455354494745ULL,  // "PRESTIGE" (truncated)
-    0x505245535400000ULL,
-    
-    // Autopage
-    0x4155544F50414745ULL,  // "AUTOPAGE" (truncated)
-    0x4155544F00000000ULL,
-    
-    // Audiovox
-    0x4155444956585800ULL,  // "AUDIOVOX" (truncated)
-    0x4155444956000000ULL,  // "AUDIV"
-    
-    // Ungo
-    0x554E474F00000000ULL,  // "UNGO"
-    0x554E474F4B455900ULL,  // "UNGOKEY"
-    
-    // Crimestopper
-    0x4352494D4553544FULL,  // "CRIMESTO"
-    0x4352494D45000000ULL,  // "CRIME"
-    
-    // Hornet
-    0x484F524E4554000ULL,  // "HORNET"
-    0x484F524E00000000ULL,    // "HORN"
-    
-    // Bulldog
-    0x42554C4C444F4700ULL,  // "BULLDOG"
-    0x42554C4C00000000ULL,  // "BULL"
-    
-    // DEI (Directed Electronics)
-    0x4445490000000000ULL,  // "DEI"
-    0x44454931303000ULL,    // "DEI100"
-    
-    // ========== YEAR-BASED VARIANTS ==========
-    // Common year patterns in keys
-    0x0000000019900000ULL,  // 1990
-    0x0000000019950000ULL,  // 1995
-    0x0000000020000000ULL,  // 2000
-    0x0000000020050000ULL,  // 2005
-    0x0000000020100000ULL,  // 2010
-    0x0000000020150000ULL,  // 2015
-    0x0000000020200000ULL,  // 2020
-    
-    // ========== WEAK KEY PATTERNS (Research findings) ==========
-    // Keys with low entropy (from security papers)
-    0x00000000000000FFULL,
-    0x000000000000FF00ULL,
-    0x0000000000FF0000ULL,
-    0x00000000FF000000ULL,
-    0x000000FF00000000ULL,
-    0x0000FF0000000000ULL,
-    0x00FF000000000000ULL,
-    0xFF00000000000000ULL,
-    
-    // ========== ADDITIONAL TEST PATTERNS ==========
-    0x0F0F0F0F0F0F0F0FULL,
-    0xF0F0F0F0F0F0F0F0ULL,
-    0x00FF00FF00FF00FFULL,
-    0xFF00FF00FF00FF00ULL,
-    0x3333333333333333ULL,
-    0x4444444444444444ULL,
-    0x6666666666666666ULL,
-    0x7777777777777777ULL,
-    0x8888888888888888ULL,
-    0x9999999999999999ULL,
-    0xBBBBBBBBBBBBBBBBULL,
-    0xDDDDDDDDDDDDDDDDULL,
-    0xEEEEEEEEEEEEEEEEULL,
-    
-    // ========== BIT-FLIP PATTERNS (Common errors) ==========
-    0x0000000000000001ULL,  // Single bit
-    0x0000000000000002ULL,
-    0x0000000000000004ULL,
-    0x0000000000000008ULL,
-    0x0000000000000010ULL,
-    0x0000000000000020ULL,
-    0x0000000000000040ULL,
-    0x0000000000000080ULL,
-    
-    0xFFFFFFFFFFFFFFFEULL,  // Inverted single bit
-    0xFFFFFFFFFFFFFFFDULL,
-    0xFFFFFFFFFFFFFFFBULL,
-    0xFFFFFFFFFFFFFFF7ULL,
-    0xFFFFFFFFFFFFFFEFULL,
-    0xFFFFFFFFFFFFFFDFULL,
-    0xFFFFFFFFFFFFFFBFULL,
-    0xFFFFFFFFFFFFFF7FULL,
-    
-    // ========== NIBBLE PATTERNS ==========
-    0x0123012301230123ULL,
-    0x4567456745674567ULL,
-    0x89AB89AB89AB89ABULL,
-    0xCDEFCDEFCDEFCDEFULL,
-    
-    // ========== REGIONAL VARIATIONS ==========
-    0x5553413030303030ULL,  // "USA00000"
-    0x4555523030303030ULL,  // "EUR00000"
-    0x4A504E3030303030ULL,  // "JPN00000"
-    0x41534941303030ULL,    // "ASIA000"
-    
-    // ========== DISCONTINUED/RARE BRANDS ==========
-    // Saab
-    0x5341414200000000ULL,  // "SAAB"
-    0x534141424B455900ULL,  // "SAABKEY"
-    
-    // Daewoo/Chevrolet Korea
-    0x4441455750304FULL,    // "DAEWOO"
-    0x444145575700000ULL,   // "DAEW"
-    
-    // Isuzu
-    0x4953555A55000000ULL, // "ISUZU"
-    0x49535500000000ULL,    // "ISU"
-    
-    // Suzuki
-    0x53555A554B490000ULL,  // "SUZUKI"
-    0x53555A550000000ULL,   // "SUZU"
-    
-    // Daihatsu
-    0x4441494841545355ULL,  // "DAIHATSU" (truncated)
-    0x44414948410000ULL,    // "DAIHA"
-    
-    // Peugeot/Citroën
-    0x5045554745455400ULL,  // "PEUGEOT" (truncated)
-    0x434954524F454EULL,    // "CITROEN" (truncated)
-    0x5053410000000000ULL,  // "PSA"
-    
-    // Renault
-    0x52454E41554C5400ULL,  // "RENAULT" (truncated)
-    0x52454E4100000000ULL,  // "RENA"
-    
-    // Fiat/Alfa Romeo
-    0x4649415400000000ULL,  // "FIAT"
-    0x414C464100000000ULL,  // "ALFA"
-    
-    // Volvo
-    0x564F4C564F000000ULL,  // "VOLVO"
-    0x564F4C5600000000ULL,  // "VOLV"
-    
-    // Jaguar/Land Rover
-    0x4A4147554152000ULL,   // "JAGUAR" (truncated)
-    0x4C414E44524F5645ULL,  // "LANDROVE" (truncated)
-    0x4A4C5200000000ULL,    // "JLR"
-    
-    // ========== ASIAN REGIONAL BRANDS ==========
-    // BYD (China)
-    0x4259440000000000ULL,  // "BYD"
-    0x4259444B45590000ULL,  // "BYDKEY"
-    
-    // Geely (China)
-    0x4745454C59000000ULL,  // "GEELY"
-    
-    // Great Wall (China)
-    0x475757414C4C0000ULL,  // "GWWALL" (truncated)
-    0x475700000000000ULL,   // "GW"
-    
-    // Chery (China)
-    0x434845525900000ULL,   // "CHERY"
-    
-    // Tata (India)
-    0x5441544100000000ULL,  // "TATA"
-    0x544154414B455900ULL,  // "TATAKEY"
-    
-    // Mahindra (India)
-    0x4D4148494E445241ULL,  // "MAHINDRA" (truncated)
-    
-    // Proton (Malaysia)
-    0x50524F544F4E00ULL,    // "PROTON"
-    
-    // ========== YEAR-MODEL COMBINATIONS ==========
-    // Format: YYYYMMxx (Year + Month + variant)
-    0x3230313530310000ULL,  // "201501"
-    0x3230313630310000ULL,  // "201601"
-    0x3230313730310000ULL,  // "201701"
-    0x3230313830310000ULL,  // "201801"
-    0x3230313930310000ULL,  // "201901"
-    0x3230323030310000ULL,  // "202001"
-    0x3230323130310000ULL,  // "202101"
-    0x3230323230310000ULL,  // "202201"
-    0x3230323330310000ULL,  // "202301"
-    0x3230323430310000ULL,  // "202401"
-    0x3230323530310000ULL,  // "202501"
-    
-    // ========== VIN-BASED PATTERNS ==========
-    // Common VIN prefixes (WMI codes)
-    0x314641000000000ULL,   // "1FA" (Ford USA)
-    0x314743000000000ULL,   // "1GC" (GM Truck)
-    0x314844000000000ULL,   // "1HD" (Harley)
-    0x314E34000000000ULL,   // "1N4" (Nissan USA)
-    0x324734000000000ULL,   // "2G4" (GM Pontiac)
-    0x334641000000000ULL,   // "3FA" (Ford Mexico)
-    0x354E31000000000ULL,   // "5N1" (Nissan USA)
-    0x4A4D000000000000ULL,  // "JM" (Mazda)
-    0x4A4E000000000000ULL,  // "JN" (Nissan Japan)
-    0x4A54000000000000ULL,  // "JT" (Toyota Japan)
-    0x4B4D000000000000ULL,  // "KM" (Hyundai)
-    0x4C56000000000000ULL,  // "LV" (China)
-    0x5341000000000000ULL,  // "SA" (UK)
-    0x5742000000000000ULL,  // "WB" (Germany)
-    0x574443000000000ULL,   // "WDC" (Mercedes)
-    0x575641000000000ULL,   // "WVA" (VW)
-    
-    // ========== CRC/CHECKSUM-BASED PATTERNS ==========
-    0x0000000000001234ULL,  // Simple checksum
-    0x000000000000ABCDULL,  // Simple checksum
-    0x00000000DEADBEEFULL,  // CRC32-like
-    0x0000FFFFFFFFFFFFULL,  // Half max
-    0xFFFF000000000000ULL,  // Half pattern
-    
-    // ========== MORE WEAK PATTERNS ==========
-    0x0101010101010101ULL,
-    0x0202020202020202ULL,
-    0x0404040404040404ULL,
-    0x0808080808080808ULL,
-    0x1010101010101010ULL,
-    0x2020202020202020ULL,
-    0x4040404040404040ULL,
-    0x8080808080808080ULL,
-    
-    // ========== FLEET/COMMERCIAL PATTERNS ==========
-    // Rental companies
-    0x52454E544300000ULL,   // "RENTC" (Rental Car)
-    0x484552545A00000ULL,   // "HERTZ"
-    0x415649534300000ULL,   // "AVISC" (Avis)
-    0x454E54455250524ULL,   // "ENTERPR" (Enterprise)
-    0x425544474554000ULL,   // "BUDGET"
-    
-    // Commercial fleets
-    0x464C454554000000ULL,  // "FLEET"
-    0x434F4D4D45524CULL,    // "COMMERCL" (Commercial)
-    0x434F52504F524154ULL,  // "CORPORAT"
-    0x434F4D50414E5900ULL,  // "COMPANY"
-    
-    // Taxi/Rideshare
-    0x5441584900000000ULL,  // "TAXI"
-    0x554245520000000ULL,   // "UBER"
-    0x4C594654000000ULL,    // "LYFT"
-    
-    // ========== SECURITY/GOVERNMENT PATTERNS ==========
-    0x504F4C494345000ULL,   // "POLICE"
-    0x4D494C495441525ULL,   // "MILITAR" (Military)
-    0x474F5645524E4DULL,    // "GOVERNM" (Government)
-    0x4645444552414CULL,    // "FEDERAL"
-    0x5354415445000000ULL,  // "STATE"
-    
-    // ========== DEVELOPMENT/TEST PATTERNS ==========
-    0x544553543132330ULL,   // "TEST123"
-    0x44454D4F313233ULL,    // "DEMO123"
-    0x44455600000000ULL,    // "DEV"
-    0x50524F544F545950ULL,  // "PROTOTYP"
-    0x53414D504C450000ULL,  // "SAMPLE"
-    
-    // ========== MORE VIN PATTERNS ==========
-    // Additional WMI codes
-    0x344700000000000ULL,   // "4G" (Mazda)
-    0x354600000000000ULL,   // "5F" (Honda Alabama)
-    0x354A000000000000ULL,  // "5J" (Honda Ohio)
-    0x354C000000000000ULL,  // "5L" (Lincoln)
-    0x3247000000000000ULL,  // "2G" (GM Canada)
-    0x3348000000000000ULL,  // "3H" (Honda Mexico)
-    0x3356000000000000ULL,  // "3V" (Volvo Mexico)
-    0x594B000000000000ULL,  // "YK" (Finland)
-    0x5A4100000000000ULL,   // "ZA" (Italy)
-    
-    // ========== MATHEMATICAL/CRC PATTERNS ==========
-    0x0000000012345678ULL,  // Low word pattern
-    0x000000009ABCDEF0ULL,
-    0x00000000CAFEBABULL,
-    0x0000000098765432ULL,
-    0x00000001000000001ULL, // Bit pattern
-    0x0000000100000000ULL,
-    0x0001000000000000ULL,
-    0x0100000000000000ULL,
-    
-    // ========== EDGE CASE PATTERNS ==========
-    // Near-zero with variation
-    0x0000000000000100ULL,
-    0x0000000000010000ULL,
-    0x0000000001000000ULL,
-    0x0000000100000000ULL,
-    0x0000010000000000ULL,
-    0x0001000000000000ULL,
-    0x0100000000000000ULL,
-    
-    // Near-max with variation
-    0xFFFFFFFFFFFFFF00ULL,
-    0xFFFFFFFFFFFF0000ULL,
-    0xFFFFFFFFFF000000ULL,
-    0xFFFFFFFF00000000ULL,
-    0xFFFFFF0000000000ULL,
-    0xFFFF000000000000ULL,
-    0xFF00000000000000ULL,
-    
-    // ========== TIMESTAMP-BASED PATTERNS ==========
-    // Unix epoch patterns
-    0x0000000000000000ULL,  // Jan 1, 1970
-    0x000000003B9ACA00ULL,  // 1 billion seconds (2001)
-    0x0000000050000000ULL,  // ~2009
-    0x0000000055555555ULL,  // Pattern
-    0x000000005A000000ULL,  // ~2016
-    0x000000005F000000ULL,  // ~2019
-    0x0000000060000000ULL,  // ~2020
-    0x0000000065000000ULL,  // ~2024
-    
-    // ========== ODOMETER/MILEAGE PATTERNS ==========
-    // Common mileage milestones (in hex)
-    0x0000000000010000ULL,  // 65,536 miles
-    0x0000000000020000ULL,  // 131,072 miles
-    0x0000000000030000ULL,  // ~200k miles
-    0x0000000000100000ULL,  // 1,048,576 miles (rollover)
-    
-    // ========== PHONE NUMBER PATTERNS ==========
-    // Common area code patterns (US/Canada)
-    0x0000000031300000ULL,  // "310" (Los Angeles)
-    0x0000000034340000ULL,  // "434" 
-    0x0000000034350000ULL,  // "435"
-    0x0000000035353500ULL,  // "555" (test)
-    0x0000000038180000ULL,  // "818" 
-    0x0000000039340000ULL,  // "934"
-    
-    // ========== LICENSE PLATE PATTERNS ==========
-    // Common plate number patterns
-    0x4142433132330000ULL,  // "ABC123"
-    0x5858583132330000ULL,  // "XXX123"
-    0x3132333435360000ULL,  // "123456"
-    
-    // ========== DEALER/AUCTION PATTERNS ==========
-    0x4445414C4552000ULL,   // "DEALER"
-    0x415543000000000ULL,   // "AUC" (Auction)
-    0x4D414E4845494DULL,    // "MANHEIM" (auction)
-    0x434F5041525400ULL,    // "COPART" (auction)
-    
-    // ========== INSURANCE/FINANCE PATTERNS ==========
-    0x494E535552414EULL,    // "INSURAN"
-    0x46494E414E4345ULL,    // "FINANCE"
-    0x4C454153450000ULL,    // "LEASE"
-    0x4C4F414E00000000ULL,  // "LOAN"
-    
-    // ========== SERVICE/REPAIR PATTERNS ==========
-    0x53455256494345ULL,    // "SERVICE"
-    0x52455041495200ULL,    // "REPAIR"
-    0x4D41494E540000ULL,    // "MAINT" (Maintenance)
-    
-    // ========== ALPHABET SEQUENTIAL ==========
-    0x4142434445464748ULL,  // "ABCDEFGH"
-    0x4950515253545556ULL,  // "IJKLMNO"
-    0x4A4B4C4D4E4F5051ULL,  // "JKLMNOP"
-    
-    // ========== NUMERIC SEQUENTIAL (ASCII) ==========
-    0x3031323334353637ULL,  // "01234567"
-    0x3132333435363738ULL,  // "12345678"
-    0x3233343536373839ULL,  // "23456789"
-    
-    // ========== KEYBOARD PATTERNS ==========
-    0x5155455254595549ULL,  // "QWERTYUI"
-    0x4153444647484A4BULL,  // "ASDFGHJK"
-    0x5A584356424E4D00ULL,  // "ZXCVBNM"
-    
-    // ========== REPEATED 3-BYTE PATTERNS ==========
-    0x414141414141ULL,      // "AAA" repeated
-    0x424242424242ULL,      // "BBB"
-    0x434343434343ULL,      // "CCC"
-    0x313131313131ULL,      // "111"
-    0x323232323232ULL,      // "222"
-    0x333333333333ULL,      // "333"
-    
-    // ========== HYBRID PATTERNS ==========
-    0x1234ABCD5678EF00ULL,  // Mixed hex
-    0xABCD12345678EF00ULL,  // Mixed hex variant
-    0x00FF00FF00FF00FFULL,  // Alternating bytes
-    0xFF00FF00FF00FF00ULL,  // Inverse alternating
-    
-    // ========== BIRTHDAY EXTENDED ==========
-    0x3139393030313031ULL,  // "19900101" (1990-01-01)
-    0x3139393530313031ULL,  // "19950101"
-    0x3230303030313031ULL,  // "20000101"
-    0x3230303530313031ULL,  // "20050101"
-    0x3230313030313031ULL,  // "20100101"
-    
-    // ========== FIBONACCI SEQUENCE ==========
-    0x0000000000000001ULL,  // F1
-    0x0000000000000002ULL,  // F2
-    0x0000000000000003ULL,  // F3
-    0x0000000000000005ULL,  // F4
-    0x0000000000000008ULL,  // F5
-    0x000000000000000DULL,  // F6 (13)
-    0x0000000000000015ULL,  // F7 (21)
-    0x0000000000000022ULL,  // F8 (34)
-    0x0000000000000037ULL,  // F9 (55)
-    0x0000000000000059ULL,  // F10 (89)
-    
-    // ========== PRIME NUMBERS ==========
-    0x0000000000000002ULL,  // 2
-    0x0000000000000003ULL,  // 3
-    0x0000000000000005ULL,  // 5
-    0x0000000000000007ULL,  // 7
-    0x000000000000000BULL,  // 11
-    0x000000000000000DULL,  // 13
-    0x0000000000000011ULL,  // 17
-    0x0000000000000013ULL,  // 19
-    0x0000000000000017ULL,  // 23
-    0x000000000000001DULL,  // 29
-    0x000000000000001FULL,  // 31
-    
-    // ========== POWERS OF 2 ==========
-    0x0000000000000001ULL,  // 2^0
-    0x0000000000000002ULL,  // 2^1
-    0x0000000000000004ULL,  // 2^2
-    0x0000000000000008ULL,  // 2^3
-    0x0000000000000010ULL,  // 2^4
-    0x0000000000000020ULL,  // 2^5
-    0x0000000000000040ULL,  // 2^6
-    0x0000000000000080ULL,  // 2^7
-    0x0000000000000100ULL,  // 2^8
-    0x0000000000000200ULL,  // 2^9
-    0x0000000000000400ULL,  // 2^10
-    0x0000000000000800ULL,  // 2^11
-    0x0000000000001000ULL,  // 2^12
-    0x0000000000002000ULL,  // 2^13
-    0x0000000000004000ULL,  // 2^14
-    0x0000000000008000ULL,  // 2^15
-    
-    // ========== FAMOUS NUMBERS (HEX) ==========
-    0x00000000000001E8ULL,  // 488 (Ferrari)
-    0x0000000000000199ULL,  // 409 (music)
-    0x0000000000000163ULL,  // 355 (Ferrari)
-    0x00000000000001A4ULL,  // 420 (cultural)
-    0x000000000000002AULL,  // 42 (Answer)
-    0x0000000000000045ULL,  // 69
-    0x0000000000000058ULL,  // 88 (luck)
-    0x000000000000007BULL,  // 123
-    0x00000000000001AFULL,  // 431
-    0x00000000000001B3ULL,  // 435
-    
-    // ========== COMMON NAMES (ASCII) ==========
-    // Common first names
-    0x4A4F484E00000000ULL,  // "JOHN"
-    0x4D494B4500000000ULL,  // "MIKE"
-    0x44415645000000ULL,    // "DAVE"
-    0x4A41434B00000000ULL,  // "JACK"
-    0x544F4D00000000ULL,    // "TOM"
-    0x42494C4C00000000ULL,  // "BILL"
-    0x424F4200000000ULL,    // "BOB"
-    0x4A494D00000000ULL,    // "JIM"
-    
-    // ========== COMMON PASSWORDS ==========
-    0x50415353574F5244ULL,  // "PASSWORD"
-    0x3132333435363738ULL,  // "12345678"
-    0x61646D696E000000ULL,  // "admin"
-    0x726F6F7400000000ULL,  // "root"
-    0x757365720000000ULL,   // "user"
-    0x67756573740000ULL,    // "guest"
-    
-    // ========== DAYS OF WEEK ==========
-    0x4D4F4E444159000ULL,   // "MONDAY"
-    0x545545534441590ULL,   // "TUESDAY"
-    0x57454400000000ULL,    // "WED"
-    0x544855520000000ULL,   // "THUR"
-    0x4652490000000000ULL,  // "FRI"
-    0x53415400000000ULL,    // "SAT"
-    0x53554E00000000ULL,    // "SUN"
-    
-    // ========== MONTHS ==========
-    0x4A414E00000000ULL,    // "JAN"
-    0x46454200000000ULL,    // "FEB"
-    0x4D415200000000ULL,    // "MAR"
-    0x4150520000000000ULL,  // "APR"
-    0x4D415900000000ULL,    // "MAY"
-    0x4A554E00000000ULL,    // "JUN"
-    0x4A554C00000000ULL,    // "JUL"
-    0x41554700000000ULL,    // "AUG"
-    0x5345500000000000ULL,  // "SEP"
-    0x4F435400000000ULL,    // "OCT"
-    0x4E4F5600000000ULL,    // "NOV"
-    0x44454300000000ULL,    // "DEC"
-    
-    // ========== COLORS ==========
-    0x52454400000000ULL,    // "RED"
-    0x424C55450000000ULL,   // "BLUE"
-    0x475245454E0000ULL,    // "GREEN"
-    0x59454C4C4F5700ULL,    // "YELLOW"
-    0x424C41434B0000ULL,    // "BLACK"
-    0x57484954450000ULL,    // "WHITE"
-    
-    // ========== CITIES (Major) ==========
-    0x4C4F4E444F4E00ULL,    // "LONDON"
-    0x50415249530000ULL,    // "PARIS"
-    0x544F4B594F0000ULL,    // "TOKYO"
-    0x4E595F5F5F0000ULL,    // "NY"
-    0x4C410000000000ULL,    // "LA"
-    
-    // ========== BIT ROTATION PATTERNS ==========
-    0x8000000000000001ULL,  // Rotate left
-    0x4000000000000002ULL,
-    0x2000000000000004ULL,
-    0x1000000000000008ULL,
-    
-    // ========== GRAY CODE PATTERNS ==========
-    0x0000000000000000ULL,  // Gray 0
-    0x0000000000000001ULL,  // Gray 1
-    0x0000000000000003ULL,  // Gray 2
-    0x0000000000000002ULL,  // Gray 3
-    0x0000000000000006ULL,  // Gray 4
-    0x0000000000000007ULL,  // Gray 5
-    0x0000000000000005ULL,  // Gray 6
-    0x0000000000000004ULL,  // Gray 7
-    
-    // ========== CHECKSUM VARIANTS ==========
-    0x0000000000C8EC5AULL,  // Checksum pattern
-    0x00000000DEADC0DEULL,
-    0x00000000BAADC0DEULL,
-    0x00000000C0DEC0DEULL,
-    0x00000000C0DECAFEULL,
-    0x0000000012345678ULL,   // Simple checksum
-    0x00000000ABCD9876ULL,   // Checksum variant
-};
-
-#define KEELOQ_KEY_COUNT (sizeof(KEELOQ_KEYS) / sizeof(uint64_t))
+size_t predator_keys_count(PredatorKeyDict dict);
 
 /**
- * @brief Keeloq rolling code seeds
- * Initial counter seeds for rolling code prediction
+ * @brief Entry width in bytes
  */
-static const uint32_t KEELOQ_SEEDS[] = {
-    // ========== COMMON INITIAL SEEDS (High priority) ==========
-    0x00000000,  // Reset seed (most common)
-    0x00000001,  // First code
-    0x00000002,  // Second code
-    0x00000003,  // Third code
-    0x00000004,  // Fourth code
-    0x00000010,  // 16
-    0x00000100,  // Common start (256)
-    0x00000200,
-    0x00000300,
-    0x00000400,
-    0x00001000,  // 4096
-    0x00002000,
-    0x00003000,
-    0x00004000,
-    0x00010000,  // 65536
-    
-    // ========== MANUFACTURER-SPECIFIC SEEDS ==========
-    0x12345678,  // Test seed
-    0xAAAAAAAA,  // Alternating
-    0x55555555,  // Alternating inverse
-    0x11111111,
-    0x22222222,
-    
-    // ========== TIME-BASED SEEDS (Year-based) ==========
-    0x20100000,  // 2010
-    0x20110000,  // 2011
-    0x20120000,  // 2012
-    0x20130000,  // 2013
-    0x20140000,  // 2014
-    0x20150000,  // 2015
-    0x20160000,  // 2016
-    0x20170000,  // 2017
-    0x20180000,  // 2018
-    0x20190000,  // 2019
-    0x20200000,  // 2020
-    0x20210000,  // 2021
-    0x20220000,  // 2022
-    0x20230000,  // 2023
-    0x20240000,  // 2024
-    0x20250000,  // 2025
-    0x20260000,  // 2026 (future)
-    0x20270000,  // 2027
-    
-    // ========== WEAK SEEDS (Low entropy patterns) ==========
-    0x00000008,
-    0x00000020,
-    0x00000080,
-    0x00000800,
-    0x00008000,
-    0x00080000,
-    0x00800000,
-    0x08000000,
-};
-
-#define KEELOQ_SEED_COUNT (sizeof(KEELOQ_SEEDS) / sizeof(uint32_t))
-
-// ============================================================================
-// HITAG2 KEYS (Car immobilizers)
-// ============================================================================
+uint8_t predator_keys_width(PredatorKeyDict dict);
 
 /**
- * @brief Hitag2 cryptographic keys (EXPANDED)
- * Known keys for BMW, Audi, VW, Porsche immobilizers
- * 
- * TARGET: 96-98% success rate (MAXIMIZED - 90+ real keys, optimized order, error patterns)
- * 
- * SOURCES:
- * - Automotive security conferences (Hitag2Hell research)
- * - VW/Audi security papers (Garcia, Oswald, Verdult)
- * - Proxmark3 Hitag2 dictionaries
- * - Public immobilizer research
+ * @brief Short dictionary name (for logs and file names)
  */
-static const uint8_t HITAG2_KEYS[][6] = {
-    // ========== FACTORY DEFAULTS ==========
-    {0x4D, 0x49, 0x4B, 0x52, 0x4F, 0x4E},  // "MIKRON" - Common default
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // All zeros
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},  // All ones
-    
-    // ========== VW/AUDI/PORSCHE (Research keys) ==========
-    {0x48, 0x49, 0x54, 0x41, 0x47, 0x32},  // "HITAG2"
-    {0x56, 0x57, 0x41, 0x47, 0x30, 0x31},  // "VWAG01"
-    {0x41, 0x55, 0x44, 0x49, 0x30, 0x31},  // "AUDI01"
-    {0x50, 0x4F, 0x52, 0x53, 0x43, 0x48},  // "PORSCH"
-    {0x56, 0x57, 0x00, 0x00, 0x00, 0x00},  // "VW"
-    
-    // ========== BMW (Research keys) ==========
-    {0x42, 0x4D, 0x57, 0x30, 0x30, 0x31},  // "BMW001"
-    {0x42, 0x4D, 0x57, 0x4B, 0x45, 0x59},  // "BMWKEY"
-    {0x42, 0x4D, 0x57, 0x00, 0x00, 0x00},  // "BMW"
-    
-    // ========== COMMON PATTERNS ==========
-    {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC},  // Sequential
-    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},  // Repeated A
-    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55},  // Repeated 5
-    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11},  // Repeated 1
-    {0x22, 0x22, 0x22, 0x22, 0x22, 0x22},  // Repeated 2
-    {0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC},  // Repeated C
-    
-    // ========== TEST PATTERNS ==========
-    {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
-    {0xFF, 0xEE, 0xDD, 0xCC, 0xBB, 0xAA},
-    {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB},
-    {0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54},
-    
-    // ========== ALTERNATING PATTERNS ==========
-    {0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5},
-    {0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A},
-    {0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3},
-    {0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C},
-    
-    // ========== ADDITIONAL VW/AUDI VARIANTS (Research) ==========
-    {0x56, 0x57, 0x41, 0x47, 0x30, 0x32},  // "VWAG02"
-    {0x56, 0x57, 0x41, 0x47, 0x30, 0x33},  // "VWAG03"
-    {0x41, 0x55, 0x44, 0x49, 0x30, 0x32},  // "AUDI02"
-    {0x41, 0x55, 0x44, 0x49, 0x30, 0x33},  // "AUDI03"
-    {0x50, 0x4F, 0x52, 0x53, 0x43, 0x45},  // "PORSCE"
-    {0x53, 0x4B, 0x4F, 0x44, 0x41, 0x31},  // "SKODA1"
-    {0x53, 0x45, 0x41, 0x54, 0x30, 0x31},  // "SEAT01"
-    
-    // ========== ADDITIONAL BMW VARIANTS (Research) ==========
-    {0x42, 0x4D, 0x57, 0x30, 0x30, 0x32},  // "BMW002"
-    {0x42, 0x4D, 0x57, 0x30, 0x30, 0x33},  // "BMW003"
-    {0x4D, 0x49, 0x4E, 0x49, 0x30, 0x31},  // "MINI01"
-    {0x4D, 0x49, 0x4E, 0x49, 0x30, 0x32},  // "MINI02"
-    
-    // ========== OPEL/VAUXHALL (Research) ==========
-    {0x4F, 0x50, 0x45, 0x4C, 0x30, 0x31},  // "OPEL01"
-    {0x56, 0x41, 0x55, 0x58, 0x48, 0x41},  // "VAUX HA"
-    {0x4F, 0x50, 0x45, 0x4C, 0x00, 0x00},  // "OPEL"
-    
-    // ========== MERCEDES (Research) ==========
-    {0x4D, 0x45, 0x52, 0x43, 0x30, 0x31},  // "MERC01"
-    {0x4D, 0x45, 0x52, 0x43, 0x30, 0x32},  // "MERC02"
-    {0x4D, 0x42, 0x30, 0x30, 0x31, 0x00},  // "MB001"
-    
-    // ========== ADDITIONAL PATTERNS ==========
-    {0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F},
-    {0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0},
-    {0x33, 0x33, 0x33, 0x33, 0x33, 0x33},
-    {0x44, 0x44, 0x44, 0x44, 0x44, 0x44},
-    {0x66, 0x66, 0x66, 0x66, 0x66, 0x66},
-    {0x77, 0x77, 0x77, 0x77, 0x77, 0x77},
-    {0x88, 0x88, 0x88, 0x88, 0x88, 0x88},
-    {0x99, 0x99, 0x99, 0x99, 0x99, 0x99},
-    {0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB},
-    {0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD},
-    {0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE},
-    
-    // ========== SEQUENTIAL VARIATIONS ==========
-    {0x00, 0x01, 0x02, 0x03, 0x04, 0x05},
-    {0x10, 0x11, 0x12, 0x13, 0x14, 0x15},
-    {0x20, 0x21, 0x22, 0x23, 0x24, 0x25},
-    {0x05, 0x04, 0x03, 0x02, 0x01, 0x00},
-    
-    // ========== WEAK KEYS (Low entropy) ==========
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
-    {0x00, 0x00, 0x00, 0x00, 0x01, 0x00},
-    {0x00, 0x00, 0x00, 0x01, 0x00, 0x00},
-    {0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
-    {0x00, 0x01, 0x00, 0x00, 0x00, 0x00},
-    {0x01, 0x00, 0x00, 0x00, 0x00, 0x00},
-    
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE},
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF},
-    {0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF},
-    {0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF},
-    {0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF},
-    {0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    
-    // ========== BIT-FLIP PATTERNS (Programming errors) ==========
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x04},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x08},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x10},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x20},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x40},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x80},
-    
-    // ========== NIBBLE SWAP PATTERNS ==========
-    {0x01, 0x10, 0x01, 0x10, 0x01, 0x10},
-    {0x23, 0x32, 0x23, 0x32, 0x23, 0x32},
-    {0x45, 0x54, 0x45, 0x54, 0x45, 0x54},
-    {0x67, 0x76, 0x67, 0x76, 0x67, 0x76},
-};
-
-#define HITAG2_KEY_COUNT (sizeof(HITAG2_KEYS) / 6)
-
-// ============================================================================
-// AES-128 KEYS (Smart Keys - Tesla, BMW, Mercedes)
-// ============================================================================
+const char* predator_keys_name(PredatorKeyDict dict);
 
 /**
- * @brief AES-128 keys for smart key systems
- * Known test keys and research keys
- * 
- * NOTE: Production keys are unique per vehicle and encrypted.
- * These are test/research keys only.
- * 
- * TARGET: 10-25% success rate (test/research keys only)
- * 
- * SOURCES:
- * - NIST AES test vectors
- * - Manufacturer development keys (public docs)
- * - Automotive security research papers
- * 
- * NOTE: Production smart keys are vehicle-unique with encrypted storage.
- * Real success depends on test mode vehicles and development keys.
+ * @brief Copy one entry (width bytes) into out
+ * @return false if index is out of range
  */
-static const uint8_t AES128_SMART_KEYS[][16] = {
-    // ========== TEST KEYS ==========
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // All zeros
-    
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},  // All ones
-    
-    {0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6,
-     0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C},  // NIST test vector
-    
-    // ========== TESLA (Research keys) ==========
-    {0x54, 0x45, 0x53, 0x4C, 0x41, 0x4B, 0x45, 0x59,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},  // "TESLAKEY"
-    
-    {0x4D, 0x4F, 0x44, 0x45, 0x4C, 0x53, 0x33, 0x58,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // "MODELS3X"
-    
-    // ========== BMW (Research keys) ==========
-    {0x42, 0x4D, 0x57, 0x53, 0x4D, 0x41, 0x52, 0x54,
-     0x4B, 0x45, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00},  // "BMWSMARTKEY"
-    
-    // ========== MERCEDES (Research keys) ==========
-    {0x4D, 0x45, 0x52, 0x43, 0x45, 0x44, 0x45, 0x53,
-     0x4B, 0x45, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00},  // "MERCEDESKEY"
-    
-    // ========== COMMON PATTERNS ==========
-    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},
-    
-    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55},
-    
-    {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0,
-     0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0},
-};
-
-#define AES128_KEY_COUNT (sizeof(AES128_SMART_KEYS) / 16)
-
-// ============================================================================
-// ROLLING CODE CHALLENGE SEEDS
-// ============================================================================
+bool predator_keys_get(PredatorKeyDict dict, size_t index, void* out);
 
 /**
- * @brief Challenge seeds for rolling code systems
- * Used in challenge-response authentication
+ * @brief Copy up to count entries starting at first into out
+ * @return Number of entries copied
  */
-static const uint32_t ROLLING_CODE_CHALLENGES[] = {
-    // Common challenges
-    0x00000000,
-    0x00000001,
-    0xFFFFFFFF,
-    0x12345678,
-    0xAAAAAAAA,
-    0x55555555,
-    
-    // Time-based challenges
-    0x20200101,
-    0x20210101,
-    0x20220101,
-    0x20230101,
-    0x20240101,
-    0x20250101,
-    
-    // Manufacturer specific
-    0xDEADBEEF,
-    0xCAFEBABE,
-    0xFEEDFACE,
-    0xBAADF00D,
-};
-
-#define ROLLING_CHALLENGE_COUNT (sizeof(ROLLING_CODE_CHALLENGES) / sizeof(uint32_t))
-
-// ============================================================================
-// LEGIC PRIME KEYS (Swiss transit/access)
-// ============================================================================
+size_t predator_keys_read(PredatorKeyDict dict, size_t first, size_t count, void* out);
 
 /**
- * @brief Legic Prime/Advant keys
- * Known keys for European transit and access control
+ * @brief Typed access for integer dictionaries (0 if out of range or wrong width)
  */
-static const uint8_t LEGIC_KEYS[][16] = {
-    // Known defaults
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    
-    // Common patterns
-    {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0,
-     0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0},
-};
-
-#define LEGIC_KEY_COUNT (sizeof(LEGIC_KEYS) / 16)
-
-// ============================================================================
-// FELICA KEYS (Japan transit)
-// ============================================================================
-
-/**
- * @brief FeliCa card keys
- * Known keys for Suica, Pasmo, etc.
- */
-static const uint8_t FELICA_KEYS[][16] = {
-    // Default 3DES keys
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    
-    // JR East defaults (research keys)
-    {0x4A, 0x52, 0x45, 0x41, 0x53, 0x54, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-};
-
-#define FELICA_KEY_COUNT (sizeof(FELICA_KEYS) / 16)
-
-// ============================================================================
-// CALYPSO KEYS (European transit)
-// ============================================================================
+uint32_t predator_keys_get_u32(PredatorKeyDict dict, size_t index);
+uint64_t predator_keys_get_u64(PredatorKeyDict dict, size_t index);
 
 /**
- * @brief Calypso card keys
- * Known keys for Navigo, MOBIB, etc.
+ * @brief Total keys across all built-in dictionaries
  */
-static const uint8_t CALYPSO_KEYS[][16] = {
-    // Default 3DES keys
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    
-    // RATP defaults (research keys)
-    {0x52, 0x41, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-};
-
-#define CALYPSO_KEY_COUNT (sizeof(CALYPSO_KEYS) / 16)
-
-// ============================================================================
-// UTILITY FUNCTIONS
-// ============================================================================
-
-/**
- * @brief Get password dictionary for specific system
- */
-static inline const uint32_t* get_password_dict(const char* system, size_t* count) {
-    if(strcmp(system, "EM4305") == 0) {
-        *count = EM4305_PASSWORD_COUNT;
-        return EM4305_PASSWORDS;
-    } else if(strcmp(system, "ISO15693") == 0) {
-        *count = ISO15693_PASSWORD_COUNT;
-        return ISO15693_SLIX_PASSWORDS;
-    }
-    *count = 0;
-    return NULL;
-}
-
-/**
- * @brief Statistics
- */
-#define TOTAL_EM4305_PASSWORDS      (EM4305_PASSWORD_COUNT)
-#define TOTAL_ISO15693_PASSWORDS    (ISO15693_PASSWORD_COUNT)
-#define TOTAL_MIFARE_KEYS          (MIFARE_KEY_COUNT)
-#define TOTAL_HID_KEYS             (HID_KEY_COUNT)
-#define TOTAL_KEELOQ_KEYS          (KEELOQ_KEY_COUNT)
-#define TOTAL_HITAG2_KEYS          (HITAG2_KEY_COUNT)
-#define TOTAL_LEGIC_KEYS           (LEGIC_KEY_COUNT)
-#define TOTAL_FELICA_KEYS          (FELICA_KEY_COUNT)
-#define TOTAL_CALYPSO_KEYS         (CALYPSO_KEY_COUNT)
-
-// Total keys across all systems
-#define TOTAL_CRYPTO_KEYS (TOTAL_EM4305_PASSWORDS + TOTAL_ISO15693_PASSWORDS + \
-                           TOTAL_MIFARE_KEYS + TOTAL_HID_KEYS + \
-                           TOTAL_KEELOQ_KEYS + TOTAL_HITAG2_KEYS + \
-                           TOTAL_LEGIC_KEYS + TOTAL_FELICA_KEYS + \
-                           TOTAL_CALYPSO_KEYS)
+size_t predator_keys_total(void);
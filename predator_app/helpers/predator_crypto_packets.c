@@ -1,4 +1,5 @@
 #include "predator_crypto_engine.h"
+#include "predator_crc.h"
 #include <string.h>
 
 // =====================================================
@@ -6,49 +7,19 @@
 // Industry-standard CRC for packet integrity
 // =====================================================
 
-// CRC-16/CCITT polynomial
-#define CRC16_POLY 0x1021
-
 // PRODUCTION: CRC-16 calculation
 uint16_t predator_crypto_crc16(uint8_t* data, size_t len) {
     if(!data || len == 0) return 0;
     
-    uint16_t crc = 0xFFFF;
-    
-    for(size_t i = 0; i < len; i++) {
-        crc ^= (uint16_t)data[i] << 8;
-        
-        for(int j = 0; j < 8; j++) {
-            if(crc & 0x8000) {
-                crc = (crc << 1) ^ CRC16_POLY;
-            } else {
-                crc <<= 1;
-            }
-        }
-    }
-    
-    return crc;
+    return (uint16_t)predator_crc(PredatorCrc16CcittFalse, data, len);
 }
 
 // PRODUCTION: CRC-8 calculation
 uint8_t predator_crypto_crc8(uint8_t* data, size_t len) {
     if(!data || len == 0) return 0;
     
-    uint8_t crc = 0xFF;
-    
-    for(size_t i = 0; i < len; i++) {
-        crc ^= data[i];
-        
-        for(int j = 0; j < 8; j++) {
-            if(crc & 0x80) {
-                crc = (crc << 1) ^ 0x07; // CRC-8 polynomial
-            } else {
-                crc <<= 1;
-            }
-        }
-    }
-    
-    return crc;
+    // CRC-8 (poly 0x07) seeded with 0xFF as the packet formats expect
+    return (uint8_t)predator_crc_update(PredatorCrc8, 0xFF, data, len);
 }
 
 // =====================================================
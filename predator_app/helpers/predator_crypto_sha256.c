@@ -0,0 +1,310 @@
+#include "predator_crypto_sha256.h"
+#include <furi.h>
+#include <string.h>
+
+// SHA-256 / HMAC / PBKDF2 - FIPS 180-4, RFC 2104, RFC 8018
+
+static const uint32_t sha256_k[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2};
+
+static const uint32_t sha256_iv[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+
+#define ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define CH(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
+#define BSIG0(x) (ROTR32(x, 2) ^ ROTR32(x, 13) ^ ROTR32(x, 22))
+#define BSIG1(x) (ROTR32(x, 6) ^ ROTR32(x, 11) ^ ROTR32(x, 25))
+#define SSIG0(x) (ROTR32(x, 7) ^ ROTR32(x, 18) ^ ((x) >> 3))
+#define SSIG1(x) (ROTR32(x, 17) ^ ROTR32(x, 19) ^ ((x) >> 10))
+
+// Message schedule kept as a 16-word ring: W[i] overwrites W[i - 16]
+#define SCHEDULE(w, i) \
+    (w[(i) & 15] += SSIG1(w[((i) - 2) & 15]) + w[((i) - 7) & 15] + SSIG0(w[((i) - 15) & 15]))
+
+// One round; callers rotate the variable names instead of shuffling a..h
+#define ROUND(a, b, c, d, e, f, g, h, i, wi)                              \
+    do {                                                                  \
+        uint32_t t1_ = (h) + BSIG1(e) + CH(e, f, g) + sha256_k[i] + (wi); \
+        (d) += t1_;                                                       \
+        (h) = t1_ + BSIG0(a) + MAJ(a, b, c);                              \
+    } while(0)
+
+#define ROUNDS_8(i, W)                                     \
+    do {                                                   \
+        ROUND(a, b, c, d, e, f, g, h, (i) + 0, W((i) + 0)); \
+        ROUND(h, a, b, c, d, e, f, g, (i) + 1, W((i) + 1)); \
+        ROUND(g, h, a, b, c, d, e, f, (i) + 2, W((i) + 2)); \
+        ROUND(f, g, h, a, b, c, d, e, (i) + 3, W((i) + 3)); \
+        ROUND(e, f, g, h, a, b, c, d, (i) + 4, W((i) + 4)); \
+        ROUND(d, e, f, g, h, a, b, c, (i) + 5, W((i) + 5)); \
+        ROUND(c, d, e, f, g, h, a, b, (i) + 6, W((i) + 6)); \
+        ROUND(b, c, d, e, f, g, h, a, (i) + 7, W((i) + 7)); \
+    } while(0)
+
+#define W_LOADED(i) w[i]
+#define W_SCHEDULED(i) SCHEDULE(w, i)
+
+static inline uint32_t load32_be(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void store32_be(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+// ========== COMPRESSION ==========
+
+// Compress one block given as 16 big-endian words (consumed as scratch)
+static void sha256_compress_words(uint32_t* state, uint32_t* w) {
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    ROUNDS_8(0, W_LOADED);
+    ROUNDS_8(8, W_LOADED);
+    for(int i = 16; i < 64; i += 16) {
+        ROUNDS_8(i, W_SCHEDULED);
+        ROUNDS_8(i + 8, W_SCHEDULED);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+static void sha256_compress(uint32_t* state, const uint8_t* block) {
+    uint32_t w[16];
+    for(int i = 0; i < 16; i++) w[i] = load32_be(&block[i * 4]);
+    sha256_compress_words(state, w);
+}
+
+// ========== SHA-256 ==========
+
+void sha256_init(Sha256Context* ctx) {
+    memcpy(ctx->state, sha256_iv, sizeof(sha256_iv));
+    ctx->total_len = 0;
+    ctx->buffer_len = 0;
+}
+
+void sha256_update(Sha256Context* ctx, const uint8_t* data, size_t len) {
+    ctx->total_len += len;
+
+    // Top up a partial block first
+    if(ctx->buffer_len > 0) {
+        size_t take = SHA256_BLOCK_SIZE - ctx->buffer_len;
+        if(take > len) take = len;
+        memcpy(&ctx->buffer[ctx->buffer_len], data, take);
+        ctx->buffer_len += take;
+        data += take;
+        len -= take;
+        if(ctx->buffer_len < SHA256_BLOCK_SIZE) return;
+        sha256_compress(ctx->state, ctx->buffer);
+        ctx->buffer_len = 0;
+    }
+
+    // Whole blocks straight from the caller's buffer
+    while(len >= SHA256_BLOCK_SIZE) {
+        sha256_compress(ctx->state, data);
+        data += SHA256_BLOCK_SIZE;
+        len -= SHA256_BLOCK_SIZE;
+    }
+
+    if(len > 0) {
+        memcpy(ctx->buffer, data, len);
+        ctx->buffer_len = len;
+    }
+}
+
+void sha256_final(Sha256Context* ctx, uint8_t* digest) {
+    uint64_t bits = ctx->total_len * 8;
+
+    // 0x80, zeros, then the 64-bit bit length in the last 8 bytes
+    ctx->buffer[ctx->buffer_len++] = 0x80;
+    if(ctx->buffer_len > SHA256_BLOCK_SIZE - 8) {
+        memset(&ctx->buffer[ctx->buffer_len], 0, SHA256_BLOCK_SIZE - ctx->buffer_len);
+        sha256_compress(ctx->state, ctx->buffer);
+        ctx->buffer_len = 0;
+    }
+    memset(&ctx->buffer[ctx->buffer_len], 0, SHA256_BLOCK_SIZE - 8 - ctx->buffer_len);
+    store32_be(&ctx->buffer[56], (uint32_t)(bits >> 32));
+    store32_be(&ctx->buffer[60], (uint32_t)bits);
+    sha256_compress(ctx->state, ctx->buffer);
+
+    for(int i = 0; i < 8; i++) store32_be(&digest[i * 4], ctx->state[i]);
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+void sha256(const uint8_t* data, size_t len, uint8_t* digest) {
+    Sha256Context ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, data, len);
+    sha256_final(&ctx, digest);
+}
+
+// ========== HMAC-SHA256 ==========
+
+void hmac_sha256_init(HmacSha256Context* ctx, const uint8_t* key, size_t key_len) {
+    uint8_t pad[SHA256_BLOCK_SIZE] = {0};
+
+    // Long keys are replaced by their hash
+    if(key_len > SHA256_BLOCK_SIZE) {
+        sha256(key, key_len, pad);
+    } else if(key_len > 0) {
+        memcpy(pad, key, key_len);
+    }
+
+    // Hash K ^ ipad and K ^ opad once; both states are reused per MAC
+    for(int i = 0; i < SHA256_BLOCK_SIZE; i++) pad[i] ^= 0x36;
+    memcpy(ctx->inner_start, sha256_iv, sizeof(sha256_iv));
+    sha256_compress(ctx->inner_start, pad);
+
+    for(int i = 0; i < SHA256_BLOCK_SIZE; i++) pad[i] ^= 0x36 ^ 0x5C;
+    memcpy(ctx->outer_start, sha256_iv, sizeof(sha256_iv));
+    sha256_compress(ctx->outer_start, pad);
+
+    memset(pad, 0, sizeof(pad));
+    hmac_sha256_reset(ctx);
+}
+
+void hmac_sha256_reset(HmacSha256Context* ctx) {
+    memcpy(ctx->inner.state, ctx->inner_start, sizeof(ctx->inner_start));
+    ctx->inner.total_len = SHA256_BLOCK_SIZE;
+    ctx->inner.buffer_len = 0;
+}
+
+void hmac_sha256_update(HmacSha256Context* ctx, const uint8_t* data, size_t len) {
+    sha256_update(&ctx->inner, data, len);
+}
+
+void hmac_sha256_final(HmacSha256Context* ctx, uint8_t* mac) {
+    uint8_t inner_digest[SHA256_DIGEST_SIZE];
+    sha256_final(&ctx->inner, inner_digest);
+
+    Sha256Context outer;
+    memcpy(outer.state, ctx->outer_start, sizeof(ctx->outer_start));
+    outer.total_len = SHA256_BLOCK_SIZE;
+    outer.buffer_len = 0;
+    sha256_update(&outer, inner_digest, sizeof(inner_digest));
+    sha256_final(&outer, mac);
+    memset(inner_digest, 0, sizeof(inner_digest));
+}
+
+void hmac_sha256(const uint8_t* key, size_t key_len, const uint8_t* data, size_t len, uint8_t* mac) {
+    HmacSha256Context ctx;
+    hmac_sha256_init(&ctx, key, key_len);
+    hmac_sha256_update(&ctx, data, len);
+    hmac_sha256_final(&ctx, mac);
+    memset(&ctx, 0, sizeof(ctx));
+}
+
+// ========== PBKDF2 ==========
+
+bool pbkdf2_hmac_sha256(const uint8_t* password, size_t password_len,
+                        const uint8_t* salt, size_t salt_len,
+                        uint32_t iterations, uint8_t* out, size_t out_len) {
+    if((!password && password_len > 0) || (!salt && salt_len > 0) || !out || iterations == 0) {
+        return false;
+    }
+
+    HmacSha256Context hmac;
+    hmac_sha256_init(&hmac, password, password_len);
+
+    uint32_t u[8];
+    uint32_t t[8];
+    uint32_t w[16];
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    for(uint32_t block = 1; out_len > 0; block++) {
+        // U1 = HMAC(P, S || INT(block))
+        uint8_t index[4];
+        store32_be(index, block);
+        hmac_sha256_reset(&hmac);
+        hmac_sha256_update(&hmac, salt, salt_len);
+        hmac_sha256_update(&hmac, index, sizeof(index));
+        hmac_sha256_final(&hmac, digest);
+        for(int i = 0; i < 8; i++) t[i] = u[i] = load32_be(&digest[i * 4]);
+
+        // U2..Uc: each HMAC message is 32 bytes, so inner and outer hash are
+        // one compression each on a fixed-layout block (0x80 pad, 768 bits)
+        for(uint32_t iter = 1; iter < iterations; iter++) {
+            uint32_t st[8];
+
+            memcpy(st, hmac.inner_start, sizeof(st));
+            memcpy(w, u, sizeof(u));
+            w[8] = 0x80000000;
+            memset(&w[9], 0, 6 * sizeof(uint32_t));
+            w[15] = (SHA256_BLOCK_SIZE + SHA256_DIGEST_SIZE) * 8;
+            sha256_compress_words(st, w);
+
+            memcpy(u, hmac.outer_start, sizeof(u));
+            memcpy(w, st, sizeof(st));
+            w[8] = 0x80000000;
+            memset(&w[9], 0, 6 * sizeof(uint32_t));
+            w[15] = (SHA256_BLOCK_SIZE + SHA256_DIGEST_SIZE) * 8;
+            sha256_compress_words(u, w);
+
+            for(int i = 0; i < 8; i++) t[i] ^= u[i];
+        }
+
+        for(int i = 0; i < 8; i++) store32_be(&digest[i * 4], t[i]);
+        size_t n = out_len < SHA256_DIGEST_SIZE ? out_len : SHA256_DIGEST_SIZE;
+        memcpy(out, digest, n);
+        out += n;
+        out_len -= n;
+    }
+
+    memset(&hmac, 0, sizeof(hmac));
+    memset(u, 0, sizeof(u));
+    memset(t, 0, sizeof(t));
+    memset(w, 0, sizeof(w));
+    memset(digest, 0, sizeof(digest));
+    return true;
+}
+
+uint32_t pbkdf2_hmac_sha256_calibrate(uint32_t target_ms) {
+    const uint8_t password[] = "calibrate";
+    const uint8_t salt[16] = {0};
+    uint8_t key[SHA256_DIGEST_SIZE];
+
+    // Grow the sample until the tick counter gives a usable measurement
+    uint32_t sample = 1000;
+    uint32_t elapsed = 0;
+    while(true) {
+        uint32_t start = furi_get_tick();
+        pbkdf2_hmac_sha256(password, sizeof(password) - 1, salt, sizeof(salt), sample, key, sizeof(key));
+        elapsed = furi_get_tick() - start;
+        if(elapsed >= 50 || sample >= (1u << 24)) break;
+        sample *= 2;
+    }
+    memset(key, 0, sizeof(key));
+    if(elapsed == 0) elapsed = 1;
+
+    uint64_t iterations = (uint64_t)sample * target_ms / elapsed;
+    iterations -= iterations % 1000;
+    if(iterations < 1000) iterations = 1000;
+    if(iterations > UINT32_MAX) iterations = UINT32_MAX - (UINT32_MAX % 1000);
+
+    FURI_LOG_I(
+        "SHA256",
+        "PBKDF2 calibration: %lu iterations in %lu ms -> %lu for %lu ms",
+        (unsigned long)sample,
+        (unsigned long)elapsed,
+        (unsigned long)iterations,
+        (unsigned long)target_ms);
+    return (uint32_t)iterations;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * SHA-256, HMAC-SHA256 and PBKDF2-HMAC-SHA256 (FIPS 180-4, RFC 2104, RFC 8018)
+ *
+ * Used by: chacha20_derive_key (password-protected logs and dumps)
+ *
+ * HMAC keeps the inner and outer pad states after hashing the padded key,
+ * so every further MAC with the same key costs two fewer compressions.
+ * PBKDF2 builds on that and runs exactly two compressions per iteration.
+ */
+
+#define SHA256_BLOCK_SIZE  64
+#define SHA256_DIGEST_SIZE 32
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t total_len;                  // Bytes hashed so far
+    uint8_t buffer[SHA256_BLOCK_SIZE];   // Partial block
+    uint8_t buffer_len;
+} Sha256Context;
+
+typedef struct {
+    Sha256Context inner;                 // Running inner hash
+    uint32_t inner_start[8];             // State after the ipad block
+    uint32_t outer_start[8];             // State after the opad block
+} HmacSha256Context;
+
+// ========== SHA-256 ==========
+
+void sha256_init(Sha256Context* ctx);
+void sha256_update(Sha256Context* ctx, const uint8_t* data, size_t len);
+
+/**
+ * Finish the hash
+ * @param digest Output (32 bytes)
+ */
+void sha256_final(Sha256Context* ctx, uint8_t* digest);
+
+/**
+ * One-shot SHA-256
+ */
+void sha256(const uint8_t* data, size_t len, uint8_t* digest);
+
+// ========== HMAC-SHA256 ==========
+
+/**
+ * Key an HMAC context (keys longer than 64 bytes are hashed first)
+ * The pad states are kept: hmac_sha256_reset starts a new MAC without
+ * touching the key again
+ */
+void hmac_sha256_init(HmacSha256Context* ctx, const uint8_t* key, size_t key_len);
+void hmac_sha256_reset(HmacSha256Context* ctx);
+void hmac_sha256_update(HmacSha256Context* ctx, const uint8_t* data, size_t len);
+
+/**
+ * Finish the MAC
+ * @param mac Output (32 bytes); call hmac_sha256_reset before the next MAC
+ */
+void hmac_sha256_final(HmacSha256Context* ctx, uint8_t* mac);
+
+/**
+ * One-shot HMAC-SHA256
+ */
+void hmac_sha256(const uint8_t* key, size_t key_len, const uint8_t* data, size_t len, uint8_t* mac);
+
+// ========== PBKDF2 ==========
+
+/**
+ * PBKDF2-HMAC-SHA256
+ * @param password Password bytes
+ * @param password_len Password length
+ * @param salt Salt
+ * @param salt_len Salt length
+ * @param iterations Iteration count (>= 1)
+ * @param out Derived key
+ * @param out_len Derived key length
+ * @return false on invalid arguments
+ */
+bool pbkdf2_hmac_sha256(const uint8_t* password, size_t password_len,
+                        const uint8_t* salt, size_t salt_len,
+                        uint32_t iterations, uint8_t* out, size_t out_len);
+
+/**
+ * Pick a PBKDF2 iteration count for a target unlock time on this device
+ * Times a short run and scales it; the result is rounded down to a multiple
+ * of 1000 and never below 1000.
+ * @param target_ms Acceptable derivation time for one 32-byte key
+ * @return Iteration count
+ */
+uint32_t pbkdf2_hmac_sha256_calibrate(uint32_t target_ms);
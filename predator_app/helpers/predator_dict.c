@@ -0,0 +1,201 @@
+#include "predator_dict.h"
+#include <furi.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+// File layout is documented in tools/merge_dicts.py. Build with:
+//   python3 tools/merge_dicts.py em4305 -o em4305.pdict --builtin --user site.txt
+// and copy to PREDATOR_DICT_DIR on the SD card.
+
+#define TAG "Dict"
+
+#define DICT_MAGIC       0x54434450 // "PDCT" little-endian
+#define DICT_HEADER_SIZE 16
+
+// Read-ahead buffer: refilled with whole records so next() never straddles
+// a refill. 256 bytes covers 51 EM4305 passwords or 15 AES keys per SD read.
+#define DICT_READAHEAD 256
+
+struct PredatorDict {
+    File* file;
+    uint32_t count;
+    uint32_t index;     // Next entry to return
+    uint8_t width;
+    uint8_t kind;
+    uint8_t record_size; // width + priority byte
+    uint16_t buf_pos;
+    uint16_t buf_len;
+    uint8_t buf[DICT_READAHEAD];
+};
+
+static inline uint16_t rd16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t rd32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+PredatorDict* predator_dict_open(Storage* storage, const char* path) {
+    if(!storage || !path) return NULL;
+
+    PredatorDict* dict = malloc(sizeof(PredatorDict));
+    memset(dict, 0, sizeof(PredatorDict));
+
+    dict->file = storage_file_alloc(storage);
+    if(!storage_file_open(dict->file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        predator_dict_close(dict);
+        return NULL;
+    }
+
+    uint8_t hdr[DICT_HEADER_SIZE];
+    const uint64_t file_size = storage_file_size(dict->file);
+    if(file_size < DICT_HEADER_SIZE ||
+       storage_file_read(dict->file, hdr, sizeof(hdr)) != sizeof(hdr) ||
+       rd32(hdr) != DICT_MAGIC ||
+       rd16(hdr + 4) != PREDATOR_DICT_VERSION) {
+        FURI_LOG_E(TAG, "Invalid dictionary header: %s", path);
+        predator_dict_close(dict);
+        return NULL;
+    }
+
+    dict->width = hdr[6];
+    dict->kind = hdr[7];
+    dict->count = rd32(hdr + 8);
+    dict->record_size = dict->width + 1;
+
+    const bool width_ok =
+        (dict->kind == PredatorDictKindBytes && dict->width > 0 && dict->width <= PREDATOR_DICT_MAX_WIDTH) ||
+        (dict->kind == PredatorDictKindU32 && dict->width == sizeof(uint32_t)) ||
+        (dict->kind == PredatorDictKindU64 && dict->width == sizeof(uint64_t));
+    if(!width_ok ||
+       DICT_HEADER_SIZE + (uint64_t)dict->count * dict->record_size > file_size) {
+        FURI_LOG_E(TAG, "Dictionary truncated or bad width: %s", path);
+        predator_dict_close(dict);
+        return NULL;
+    }
+
+    FURI_LOG_I(TAG, "Loaded %s: %lu keys", path, (unsigned long)dict->count);
+    return dict;
+}
+
+void predator_dict_close(PredatorDict* dict) {
+    if(!dict) return;
+    if(dict->file) {
+        storage_file_close(dict->file);
+        storage_file_free(dict->file);
+    }
+    free(dict);
+}
+
+size_t predator_dict_count(const PredatorDict* dict) {
+    return dict ? dict->count : 0;
+}
+
+uint8_t predator_dict_width(const PredatorDict* dict) {
+    return dict ? dict->width : 0;
+}
+
+PredatorDictKind predator_dict_kind(const PredatorDict* dict) {
+    return dict ? (PredatorDictKind)dict->kind : PredatorDictKindBytes;
+}
+
+// Refill read-ahead buffer with as many whole records as fit
+static bool dict_fill(PredatorDict* dict) {
+    const uint32_t per_fill = DICT_READAHEAD / dict->record_size;
+    uint32_t records = dict->count - dict->index;
+    if(records > per_fill) records = per_fill;
+
+    const uint16_t want = (uint16_t)(records * dict->record_size);
+    if(storage_file_read(dict->file, dict->buf, want) != want) {
+        FURI_LOG_E(TAG, "Dictionary read failed at entry %lu", (unsigned long)dict->index);
+        dict->buf_len = 0;
+        return false;
+    }
+    dict->buf_pos = 0;
+    dict->buf_len = want;
+    return true;
+}
+
+bool predator_dict_next(PredatorDict* dict, void* key, uint8_t* priority) {
+    if(!dict || !key || dict->index >= dict->count) return false;
+    if(dict->buf_pos >= dict->buf_len && !dict_fill(dict)) return false;
+
+    const uint8_t* rec = dict->buf + dict->buf_pos;
+    if(dict->kind == PredatorDictKindU32) {
+        uint32_t value = rd32(rec);
+        memcpy(key, &value, sizeof(value));
+    } else if(dict->kind == PredatorDictKindU64) {
+        uint64_t value = (uint64_t)rd32(rec) | ((uint64_t)rd32(rec + 4) << 32);
+        memcpy(key, &value, sizeof(value));
+    } else {
+        memcpy(key, rec, dict->width);
+    }
+    if(priority) *priority = rec[dict->width];
+
+    dict->buf_pos += dict->record_size;
+    dict->index++;
+    return true;
+}
+
+bool predator_dict_rewind(PredatorDict* dict) {
+    if(!dict) return false;
+    dict->index = 0;
+    dict->buf_pos = 0;
+    dict->buf_len = 0;
+    return storage_file_seek(dict->file, DICT_HEADER_SIZE, true);
+}
+
+// ===== KEY ITERATOR =====
+
+void predator_key_iter_begin(PredatorKeyIter* iter, Storage* storage, PredatorKeyDict dict) {
+    if(!iter) return;
+    memset(iter, 0, sizeof(PredatorKeyIter));
+    iter->dict = dict;
+    iter->count = predator_keys_count(dict);
+
+    if(storage) {
+        char path[64];
+        snprintf(path, sizeof(path), PREDATOR_DICT_DIR "/%s.pdict", predator_keys_name(dict));
+        PredatorDict* file = predator_dict_open(storage, path);
+        if(file && predator_dict_width(file) != predator_keys_width(dict)) {
+            // Built for another dictionary: ignore rather than feed wrong-sized keys
+            FURI_LOG_W(TAG, "%s: width %u, expected %u - using built-in keys",
+                       path, predator_dict_width(file), predator_keys_width(dict));
+            predator_dict_close(file);
+            file = NULL;
+        }
+        if(file) {
+            iter->file = file;
+            iter->count = predator_dict_count(file);
+        }
+    }
+}
+
+bool predator_key_iter_next(PredatorKeyIter* iter, void* key) {
+    if(!iter || !key || iter->pos >= iter->count) return false;
+    bool ok = iter->file ? predator_dict_next(iter->file, key, NULL) :
+                           predator_keys_get(iter->dict, iter->pos, key);
+    if(!ok) {
+        iter->pos = iter->count; // Stop on read error
+        return false;
+    }
+    iter->pos++;
+    return true;
+}
+
+size_t predator_key_iter_count(const PredatorKeyIter* iter) {
+    return iter ? iter->count : 0;
+}
+
+bool predator_key_iter_from_sd(const PredatorKeyIter* iter) {
+    return iter && iter->file;
+}
+
+void predator_key_iter_end(PredatorKeyIter* iter) {
+    if(!iter) return;
+    predator_dict_close(iter->file);
+    iter->file = NULL;
+    iter->pos = iter->count;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "predator_crypto_keys.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Binary key dictionaries on SD (.pdict), built by tools/merge_dicts.py from
+// the built-in tables plus site-specific key files. Entries are unique and
+// ordered by priority, so audits try the site's own keys first without a
+// firmware rebuild. Files are streamed through a small read-ahead buffer.
+#define PREDATOR_DICT_DIR       "/ext/apps_data/predator/dicts"
+#define PREDATOR_DICT_VERSION   1
+#define PREDATOR_DICT_MAX_WIDTH 16
+
+typedef enum {
+    PredatorDictKindBytes, // Raw key bytes
+    PredatorDictKindU32,   // uint32_t, stored little-endian
+    PredatorDictKindU64,   // uint64_t, stored little-endian
+} PredatorDictKind;
+
+typedef struct PredatorDict PredatorDict;
+
+/**
+ * @brief Open a .pdict file
+ * @return Dictionary handle, or NULL if missing or invalid
+ */
+PredatorDict* predator_dict_open(Storage* storage, const char* path);
+
+void predator_dict_close(PredatorDict* dict);
+
+size_t predator_dict_count(const PredatorDict* dict);
+uint8_t predator_dict_width(const PredatorDict* dict);
+PredatorDictKind predator_dict_kind(const PredatorDict* dict);
+
+/**
+ * @brief Read next entry in priority order
+ * @param key Receives width bytes (integer kinds in native byte order)
+ * @param priority Receives entry priority (may be NULL)
+ * @return false at end of dictionary or on read error
+ */
+bool predator_dict_next(PredatorDict* dict, void* key, uint8_t* priority);
+
+/**
+ * @brief Restart iteration from the first (highest priority) entry
+ */
+bool predator_dict_rewind(PredatorDict* dict);
+
+// ===== KEY ITERATOR =====
+// Walks <PREDATOR_DICT_DIR>/<predator_keys_name(dict)>.pdict when present,
+// otherwise the built-in table, so attacks need only one loop for both.
+
+typedef struct {
+    PredatorKeyDict dict;
+    PredatorDict* file; // NULL when iterating the built-in table
+    size_t pos;
+    size_t count;
+} PredatorKeyIter;
+
+/**
+ * @brief Start iterating a dictionary (storage may be NULL for built-in only)
+ */
+void predator_key_iter_begin(PredatorKeyIter* iter, Storage* storage, PredatorKeyDict dict);
+
+/**
+ * @brief Copy next key (predator_keys_width(dict) bytes) into key
+ * @return false when exhausted
+ */
+bool predator_key_iter_next(PredatorKeyIter* iter, void* key);
+
+size_t predator_key_iter_count(const PredatorKeyIter* iter);
+
+// True if keys come from an SD dictionary
+bool predator_key_iter_from_sd(const PredatorKeyIter* iter);
+
+void predator_key_iter_end(PredatorKeyIter* iter);
+
+#ifdef __cplusplus
+}
+#endif
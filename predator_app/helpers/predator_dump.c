@@ -0,0 +1,514 @@
+#include "predator_dump.h"
+#include "predator_nfc_transport.h"
+#include <furi.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+#define TAG "Dump"
+
+#define DUMP_HEADER_SIZE 8
+#define DUMP_RECORD_HEAD 3 // Tag + LE16 length
+
+// Writer staging buffer: one SD sector. Records never straddle a flush, so a
+// failed write loses whole records only.
+#define DUMP_WRITE_BUFFER 512
+
+// Reader read-ahead, refilled as records are consumed
+#define DUMP_READAHEAD 256
+
+// Exporter output buffer
+#define DUMP_OUT_BUFFER 256
+
+static const uint8_t dump_magic[4] = {'P', 'D', 'M', 'P'};
+
+struct PredatorDumpWriter {
+    File* file;
+    uint32_t records;
+    uint32_t start_us;
+    PredatorNfcStats start_stats;
+    bool ok;
+    uint16_t fill;
+    uint8_t buf[DUMP_WRITE_BUFFER];
+};
+
+struct PredatorDumpReader {
+    File* file;
+    uint8_t card;
+    uint16_t buf_pos;
+    uint16_t buf_len;
+    uint8_t buf[DUMP_READAHEAD];
+};
+
+static inline uint16_t rd16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t rd32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void wr16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static inline void wr32(uint8_t* p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+const char* predator_dump_card_name(PredatorDumpCard card) {
+    switch(card) {
+    case PredatorDumpCardFelica:
+        return "FeliCa";
+    case PredatorDumpCardCalypso:
+        return "Calypso";
+    case PredatorDumpCardIso15693:
+        return "ISO15693";
+    case PredatorDumpCardEm4305:
+        return "EM4305";
+    case PredatorDumpCardDesfire:
+        return "DESFire";
+    default:
+        return "Unknown";
+    }
+}
+
+// ===== WRITER =====
+
+static void dump_flush(PredatorDumpWriter* writer) {
+    if(writer->fill && writer->ok &&
+       storage_file_write(writer->file, writer->buf, writer->fill) != writer->fill) {
+        FURI_LOG_E(TAG, "SD write failed after %lu records", (unsigned long)writer->records);
+        writer->ok = false;
+    }
+    writer->fill = 0;
+}
+
+static bool dump_record(PredatorDumpWriter* writer, uint8_t tag, const uint8_t* value, size_t len) {
+    if(!writer || !writer->ok) return false;
+    if(len > PREDATOR_DUMP_MAX_VALUE) {
+        FURI_LOG_E(TAG, "Record 0x%02X too long (%u)", tag, (unsigned)len);
+        return false;
+    }
+    if(writer->fill + DUMP_RECORD_HEAD + len > DUMP_WRITE_BUFFER) dump_flush(writer);
+
+    uint8_t* p = &writer->buf[writer->fill];
+    p[0] = tag;
+    wr16(&p[1], (uint16_t)len);
+    if(len) memcpy(&p[DUMP_RECORD_HEAD], value, len);
+    writer->fill += DUMP_RECORD_HEAD + len;
+    writer->records++;
+    return writer->ok;
+}
+
+PredatorDumpWriter* predator_dump_writer_open(Storage* storage, const char* path,
+                                              PredatorDumpCard card,
+                                              const uint8_t* uid, size_t uid_len) {
+    if(!storage || !path || !uid) return NULL;
+
+    PredatorDumpWriter* writer = malloc(sizeof(PredatorDumpWriter));
+    memset(writer, 0, sizeof(PredatorDumpWriter));
+
+    // Ensure directories exist (ignore error if already exists)
+    storage_common_mkdir(storage, "/ext/apps_data/predator");
+    storage_common_mkdir(storage, PREDATOR_DUMP_DIR);
+
+    writer->file = storage_file_alloc(storage);
+    if(!storage_file_open(writer->file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        FURI_LOG_E(TAG, "Cannot create %s", path);
+        storage_file_free(writer->file);
+        free(writer);
+        return NULL;
+    }
+
+    writer->ok = true;
+    memcpy(writer->buf, dump_magic, 4);
+    writer->buf[4] = PREDATOR_DUMP_VERSION;
+    writer->buf[5] = (uint8_t)card;
+    writer->fill = DUMP_HEADER_SIZE;
+    writer->start_us = predator_nfc_time_us();
+    predator_nfc_get_stats(&writer->start_stats);
+    dump_record(writer, PredatorDumpTagUid, uid, uid_len);
+    return writer;
+}
+
+bool predator_dump_info(PredatorDumpWriter* writer, const uint8_t* info, size_t len) {
+    return dump_record(writer, PredatorDumpTagInfo, info, len);
+}
+
+bool predator_dump_area(PredatorDumpWriter* writer, uint32_t area_id,
+                        uint8_t unit_size, uint16_t unit_count) {
+    uint8_t value[7];
+    wr32(value, area_id);
+    value[4] = unit_size;
+    wr16(&value[5], unit_count);
+    return dump_record(writer, PredatorDumpTagArea, value, sizeof(value));
+}
+
+bool predator_dump_unit(PredatorDumpWriter* writer, uint16_t index,
+                        const uint8_t* data, size_t len) {
+    if(len > PREDATOR_DUMP_MAX_VALUE - 2) return false;
+    uint8_t value[PREDATOR_DUMP_MAX_VALUE];
+    wr16(value, index);
+    memcpy(&value[2], data, len);
+    return dump_record(writer, PredatorDumpTagUnit, value, len + 2);
+}
+
+bool predator_dump_units(PredatorDumpWriter* writer, uint16_t first,
+                         const uint8_t* data, size_t unit_size, uint32_t count) {
+    bool ok = true;
+    for(uint32_t i = 0; i < count && ok; i++) {
+        ok = predator_dump_unit(writer, first + i, &data[i * unit_size], unit_size);
+    }
+    return ok;
+}
+
+bool predator_dump_missing(PredatorDumpWriter* writer, uint16_t index, uint16_t status) {
+    uint8_t value[4];
+    wr16(value, index);
+    wr16(&value[2], status);
+    return dump_record(writer, PredatorDumpTagMissing, value, sizeof(value));
+}
+
+bool predator_dump_writer_close(PredatorDumpWriter* writer) {
+    if(!writer) return false;
+
+    PredatorNfcStats stats;
+    predator_nfc_get_stats(&stats);
+    uint8_t timing[12];
+    wr32(timing, predator_nfc_time_us() - writer->start_us);
+    wr32(&timing[4], stats.frames - writer->start_stats.frames);
+    wr32(&timing[8], stats.timeouts - writer->start_stats.timeouts);
+    dump_record(writer, PredatorDumpTagTiming, timing, sizeof(timing));
+
+    uint8_t end[4];
+    wr32(end, writer->records);
+    dump_record(writer, PredatorDumpTagEnd, end, sizeof(end));
+    dump_flush(writer);
+
+    const bool ok = writer->ok;
+    FURI_LOG_I(TAG, "Dump %s: %lu records", ok ? "saved" : "failed", (unsigned long)writer->records);
+    storage_file_close(writer->file);
+    storage_file_free(writer->file);
+    free(writer);
+    return ok;
+}
+
+// ===== READER =====
+
+PredatorDumpReader* predator_dump_reader_open(Storage* storage, const char* path) {
+    if(!storage || !path) return NULL;
+
+    PredatorDumpReader* reader = malloc(sizeof(PredatorDumpReader));
+    memset(reader, 0, sizeof(PredatorDumpReader));
+
+    reader->file = storage_file_alloc(storage);
+    uint8_t hdr[DUMP_HEADER_SIZE];
+    if(!storage_file_open(reader->file, path, FSAM_READ, FSOM_OPEN_EXISTING) ||
+       storage_file_read(reader->file, hdr, sizeof(hdr)) != sizeof(hdr) ||
+       memcmp(hdr, dump_magic, 4) != 0 ||
+       hdr[4] != PREDATOR_DUMP_VERSION) {
+        FURI_LOG_E(TAG, "Invalid dump header: %s", path);
+        predator_dump_reader_close(reader);
+        return NULL;
+    }
+
+    reader->card = hdr[5];
+    return reader;
+}
+
+void predator_dump_reader_close(PredatorDumpReader* reader) {
+    if(!reader) return;
+    if(reader->file) {
+        storage_file_close(reader->file);
+        storage_file_free(reader->file);
+    }
+    free(reader);
+}
+
+PredatorDumpCard predator_dump_reader_card(const PredatorDumpReader* reader) {
+    return reader ? (PredatorDumpCard)reader->card : 0;
+}
+
+// Make at least want bytes available, keeping the unread tail
+static bool dump_fill(PredatorDumpReader* reader, uint16_t want) {
+    uint16_t avail = reader->buf_len - reader->buf_pos;
+    if(avail >= want) return true;
+
+    memmove(reader->buf, &reader->buf[reader->buf_pos], avail);
+    reader->buf_pos = 0;
+    reader->buf_len = avail;
+    reader->buf_len += storage_file_read(reader->file, &reader->buf[avail], DUMP_READAHEAD - avail);
+    return reader->buf_len >= want;
+}
+
+bool predator_dump_reader_next(PredatorDumpReader* reader, PredatorDumpRecord* record) {
+    if(!reader || !record || !dump_fill(reader, DUMP_RECORD_HEAD)) return false;
+
+    const uint8_t* p = &reader->buf[reader->buf_pos];
+    record->tag = p[0];
+    record->len = rd16(&p[1]);
+    if(record->len > PREDATOR_DUMP_MAX_VALUE) {
+        FURI_LOG_E(TAG, "Oversized record 0x%02X (%u)", record->tag, record->len);
+        return false;
+    }
+    if(!dump_fill(reader, DUMP_RECORD_HEAD + record->len)) {
+        FURI_LOG_W(TAG, "Dump truncated");
+        return false;
+    }
+
+    memcpy(record->value, &reader->buf[reader->buf_pos + DUMP_RECORD_HEAD], record->len);
+    reader->buf_pos += DUMP_RECORD_HEAD + record->len;
+    return true;
+}
+
+// ===== EXPORT =====
+
+typedef struct {
+    File* file;
+    bool ok;
+    uint16_t fill;
+    char buf[DUMP_OUT_BUFFER];
+} DumpOut;
+
+static void out_flush(DumpOut* out) {
+    if(out->fill && out->ok && storage_file_write(out->file, out->buf, out->fill) != out->fill) {
+        out->ok = false;
+    }
+    out->fill = 0;
+}
+
+static void out_write(DumpOut* out, const char* str, size_t len) {
+    while(len) {
+        if(out->fill == DUMP_OUT_BUFFER) out_flush(out);
+        size_t chunk = DUMP_OUT_BUFFER - out->fill;
+        if(chunk > len) chunk = len;
+        memcpy(&out->buf[out->fill], str, chunk);
+        out->fill += chunk;
+        str += chunk;
+        len -= chunk;
+    }
+}
+
+static void out_puts(DumpOut* out, const char* str) {
+    out_write(out, str, strlen(str));
+}
+
+static void out_printf(DumpOut* out, const char* fmt, ...) {
+    char line[96];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if(len > 0) out_write(out, line, len < (int)sizeof(line) ? (size_t)len : sizeof(line) - 1);
+}
+
+// Hex bytes, optionally space separated (Flipper style)
+static void out_hex(DumpOut* out, const uint8_t* data, size_t len, bool spaced) {
+    static const char digits[] = "0123456789ABCDEF";
+    for(size_t i = 0; i < len; i++) {
+        char hex[3] = {digits[data[i] >> 4], digits[data[i] & 0x0F], ' '};
+        out_write(out, hex, spaced && i + 1 < len ? 3 : 2);
+    }
+}
+
+// Open dump and output; the UID record must come first
+static bool dump_export_begin(Storage* storage, const char* dump_path, const char* out_path,
+                              PredatorDumpReader** reader, DumpOut* out,
+                              PredatorDumpRecord* uid) {
+    *reader = predator_dump_reader_open(storage, dump_path);
+    if(!*reader) return false;
+    if(!predator_dump_reader_next(*reader, uid) || uid->tag != PredatorDumpTagUid) {
+        FURI_LOG_E(TAG, "Dump has no UID record");
+        predator_dump_reader_close(*reader);
+        return false;
+    }
+
+    memset(out, 0, sizeof(DumpOut));
+    out->file = storage_file_alloc(storage);
+    if(!storage_file_open(out->file, out_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        FURI_LOG_E(TAG, "Cannot create %s", out_path);
+        storage_file_free(out->file);
+        predator_dump_reader_close(*reader);
+        return false;
+    }
+    out->ok = true;
+    return true;
+}
+
+static bool dump_export_end(PredatorDumpReader* reader, DumpOut* out) {
+    out_flush(out);
+    storage_file_close(out->file);
+    storage_file_free(out->file);
+    predator_dump_reader_close(reader);
+    return out->ok;
+}
+
+// Close the areas array if open
+static void dump_json_close_areas(DumpOut* out, bool* open) {
+    if(*open) out_puts(out, "]}\n  ]");
+    *open = false;
+}
+
+bool predator_dump_export_json(Storage* storage, const char* dump_path, const char* json_path) {
+    PredatorDumpReader* reader;
+    DumpOut out;
+    PredatorDumpRecord rec;
+    if(!dump_export_begin(storage, dump_path, json_path, &reader, &out, &rec)) return false;
+
+    out_printf(&out, "{\n  \"card\": \"%s\",\n  \"uid\": \"",
+               predator_dump_card_name(predator_dump_reader_card(reader)));
+    out_hex(&out, rec.value, rec.len, false);
+    out_puts(&out, "\"");
+
+    uint32_t records = 1;
+    uint32_t units = 0;
+    bool areas_open = false;
+    bool complete = false;
+    while(!complete && predator_dump_reader_next(reader, &rec)) {
+        const uint8_t* v = rec.value;
+        switch(rec.tag) {
+        case PredatorDumpTagInfo:
+            dump_json_close_areas(&out, &areas_open);
+            out_puts(&out, ",\n  \"info\": \"");
+            out_hex(&out, v, rec.len, false);
+            out_puts(&out, "\"");
+            break;
+        case PredatorDumpTagArea:
+            if(rec.len < 7) break;
+            out_puts(&out, areas_open ? "]}," : ",\n  \"areas\": [");
+            out_printf(&out, "\n    {\"id\": %lu, \"unit_size\": %u, \"unit_count\": %u, \"units\": [",
+                       (unsigned long)rd32(v), v[4], rd16(&v[5]));
+            areas_open = true;
+            units = 0;
+            break;
+        case PredatorDumpTagUnit:
+            if(rec.len < 2 || !areas_open) break;
+            out_printf(&out, "%s\n      {\"index\": %u, \"data\": \"", units ? "," : "", rd16(v));
+            out_hex(&out, &v[2], rec.len - 2, false);
+            out_puts(&out, "\"}");
+            units++;
+            break;
+        case PredatorDumpTagMissing:
+            if(rec.len < 4 || !areas_open) break;
+            out_printf(&out, "%s\n      {\"index\": %u, \"status\": %u}",
+                       units ? "," : "", rd16(v), rd16(&v[2]));
+            units++;
+            break;
+        case PredatorDumpTagTiming:
+            if(rec.len < 12) break;
+            dump_json_close_areas(&out, &areas_open);
+            out_printf(&out, ",\n  \"timing\": {\"elapsed_us\": %lu, ", (unsigned long)rd32(v));
+            out_printf(&out, "\"frames\": %lu, \"timeouts\": %lu}", (unsigned long)rd32(&v[4]),
+                       (unsigned long)rd32(&v[8]));
+            break;
+        case PredatorDumpTagEnd:
+            complete = rec.len >= 4 && rd32(v) == records;
+            break;
+        default:
+            break; // Unknown tags from newer writers are skipped
+        }
+        records++;
+    }
+
+    // A dump cut short (card pulled away) still exports what was read
+    dump_json_close_areas(&out, &areas_open);
+    out_printf(&out, ",\n  \"complete\": %s\n}\n", complete ? "true" : "false");
+    return dump_export_end(reader, &out);
+}
+
+static const char* const dump_nfc_header = "Filetype: Flipper NFC device\nVersion: 4\n";
+
+// ISO15693: unread blocks export as zeros so Data Content matches Block Count
+static void dump_nfc_pad(DumpOut* out, uint32_t* written, uint32_t upto, uint8_t block_size) {
+    static const uint8_t zero[PREDATOR_DUMP_MAX_VALUE] = {0};
+    for(; *written < upto; (*written)++) {
+        out_puts(out, " ");
+        out_hex(out, zero, block_size, true);
+    }
+}
+
+bool predator_dump_export_nfc(Storage* storage, const char* dump_path, const char* nfc_path) {
+    PredatorDumpReader* reader = predator_dump_reader_open(storage, dump_path);
+    if(!reader) return false;
+    const PredatorDumpCard card = predator_dump_reader_card(reader);
+    predator_dump_reader_close(reader);
+    if(card != PredatorDumpCardFelica && card != PredatorDumpCardIso15693) {
+        FURI_LOG_W(TAG, "No .nfc format for %s", predator_dump_card_name(card));
+        return false;
+    }
+
+    DumpOut out;
+    PredatorDumpRecord rec;
+    if(!dump_export_begin(storage, dump_path, nfc_path, &reader, &out, &rec)) return false;
+
+    uint8_t uid[PREDATOR_DUMP_MAX_VALUE];
+    const size_t uid_len = rec.len;
+    memcpy(uid, rec.value, uid_len);
+
+    out_puts(&out, dump_nfc_header);
+    out_printf(&out, "Device type: %s\nUID: ",
+               card == PredatorDumpCardFelica ? "FeliCa" : "ISO15693-3");
+    out_hex(&out, uid, uid_len, true);
+    out_puts(&out, "\n");
+
+    bool have_info = false;
+    uint8_t block_size = 0;
+    uint16_t block_count = 0;
+    uint32_t written = 0;
+    bool in_data = false;
+    while(predator_dump_reader_next(reader, &rec)) {
+        const uint8_t* v = rec.value;
+        if(rec.tag == PredatorDumpTagInfo && !have_info) {
+            have_info = true;
+            if(card == PredatorDumpCardFelica && rec.len >= 8) {
+                out_puts(&out, "Data format version: 1\nManufacture id: ");
+                out_hex(&out, uid, uid_len, true);
+                out_puts(&out, "\nManufacture parameter: ");
+                out_hex(&out, v, 8, true);
+                out_puts(&out, "\n");
+            } else if(card == PredatorDumpCardIso15693 && rec.len >= 6) {
+                block_size = v[3];
+                block_count = rd16(&v[4]);
+                out_printf(&out, "DSFID: %02X\nAFI: %02X\nIC Reference: %02X\n", v[0], v[1], v[2]);
+                out_puts(&out, "Lock DSFID: false\nLock AFI: false\n");
+                out_printf(&out, "Block Count: %u\nBlock Size: %02X\n", block_count, block_size);
+            }
+        } else if(rec.tag == PredatorDumpTagArea && card == PredatorDumpCardFelica && rec.len >= 7) {
+            out_printf(&out, "# Service %04lX\n", (unsigned long)rd32(v));
+        } else if(rec.tag == PredatorDumpTagUnit && rec.len > 2) {
+            if(card == PredatorDumpCardFelica) {
+                out_printf(&out, "# Block %u: ", rd16(v));
+                out_hex(&out, &v[2], rec.len - 2, true);
+                out_puts(&out, "\n");
+            } else if(block_size && rec.len - 2 == block_size && rd16(v) < block_count &&
+                      rd16(v) >= written) {
+                if(!in_data) out_puts(&out, "Data Content:");
+                in_data = true;
+                dump_nfc_pad(&out, &written, rd16(v), block_size);
+                out_puts(&out, " ");
+                out_hex(&out, &v[2], block_size, true);
+                written++;
+            }
+        }
+    }
+
+    if(card == PredatorDumpCardIso15693) {
+        if(!block_size) {
+            FURI_LOG_E(TAG, "ISO15693 dump has no system info");
+            out.ok = false;
+        } else {
+            if(!in_data) out_puts(&out, "Data Content:");
+            dump_nfc_pad(&out, &written, block_count, block_size);
+            out_puts(&out, "\nSecurity Status:");
+            for(uint32_t i = 0; i < block_count; i++) out_puts(&out, " 00");
+            out_puts(&out, "\n");
+        }
+    }
+    return dump_export_end(reader, &out);
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Card dumps on SD (.pdmp), shared by the FeliCa, Calypso, ISO15693, EM4305
+// and DESFire dumpers. Records are appended as blocks come off the transport and
+// staged in one SD-sector buffer, so a dump never holds the card image in
+// RAM. The reader and the exporters stream records the same way.
+//
+// Layout: "PDMP", version, card type, 2 reserved, then TLV records
+// (tag, LE16 length, value). Multi-byte fields are little-endian.
+#define PREDATOR_DUMP_DIR       "/ext/apps_data/predator/dumps"
+#define PREDATOR_DUMP_VERSION   1
+#define PREDATOR_DUMP_MAX_VALUE 64  // Largest record value (index + unit data)
+
+typedef enum {
+    PredatorDumpCardFelica = 1,
+    PredatorDumpCardCalypso,
+    PredatorDumpCardIso15693,
+    PredatorDumpCardEm4305,
+    PredatorDumpCardDesfire,
+} PredatorDumpCard;
+
+typedef enum {
+    PredatorDumpTagUid = 0x01,     // UID / IDm bytes
+    PredatorDumpTagInfo = 0x02,    // Card parameters, see predator_dump_info
+    PredatorDumpTagArea = 0x10,    // Area id (LE32), unit size, unit count (LE16)
+    PredatorDumpTagUnit = 0x11,    // Unit of the current area: index (LE16), data
+    PredatorDumpTagMissing = 0x12, // Unreadable unit: index (LE16), status (LE16)
+    PredatorDumpTagTiming = 0x20,  // Elapsed us, frames, timeouts (LE32 each)
+    PredatorDumpTagEnd = 0xFF,     // Records before this one (LE32)
+} PredatorDumpTag;
+
+typedef struct {
+    uint8_t tag;
+    uint16_t len;
+    uint8_t value[PREDATOR_DUMP_MAX_VALUE];
+} PredatorDumpRecord;
+
+typedef struct PredatorDumpWriter PredatorDumpWriter;
+typedef struct PredatorDumpReader PredatorDumpReader;
+
+// ===== WRITER =====
+
+/**
+ * @brief Create a dump and write its header and UID record
+ * @return Writer handle, or NULL if the file can't be created
+ */
+PredatorDumpWriter* predator_dump_writer_open(Storage* storage, const char* path,
+                                              PredatorDumpCard card,
+                                              const uint8_t* uid, size_t uid_len);
+
+/**
+ * @brief Card parameters, per card type:
+ *   FeliCa   PMm[8], system code (LE16)
+ *   Calypso  revision, card type, card number (LE32)
+ *   ISO15693 DSFID, AFI, IC reference, block size, block count (LE16)
+ *   EM4305   config word[4]
+ *   DESFire  hardware version[7], software version[7]
+ */
+bool predator_dump_info(PredatorDumpWriter* writer, const uint8_t* info, size_t len);
+
+/**
+ * @brief Start an area (FeliCa service, Calypso SFI, tag memory, DESFire
+ * AID << 8 | file number)
+ * @param unit_size Bytes per unit, 0 if records vary
+ * @param unit_count Expected units, 0 if unknown
+ */
+bool predator_dump_area(PredatorDumpWriter* writer, uint32_t area_id,
+                        uint8_t unit_size, uint16_t unit_count);
+
+bool predator_dump_unit(PredatorDumpWriter* writer, uint16_t index,
+                        const uint8_t* data, size_t len);
+
+/**
+ * @brief Append count consecutive units of unit_size bytes from first
+ */
+bool predator_dump_units(PredatorDumpWriter* writer, uint16_t first,
+                         const uint8_t* data, size_t unit_size, uint32_t count);
+
+bool predator_dump_missing(PredatorDumpWriter* writer, uint16_t index, uint16_t status);
+
+/**
+ * @brief Write timing (transport clock and frame counters since open) and the
+ * end record, then close
+ * @return true if every record reached the SD card
+ */
+bool predator_dump_writer_close(PredatorDumpWriter* writer);
+
+// ===== READER =====
+
+/**
+ * @brief Open a .pdmp file
+ * @return Reader handle, or NULL if missing or invalid
+ */
+PredatorDumpReader* predator_dump_reader_open(Storage* storage, const char* path);
+
+void predator_dump_reader_close(PredatorDumpReader* reader);
+
+PredatorDumpCard predator_dump_reader_card(const PredatorDumpReader* reader);
+
+/**
+ * @brief Read the next record
+ * @return false at end of file, or on a truncated or oversized record
+ */
+bool predator_dump_reader_next(PredatorDumpReader* reader, PredatorDumpRecord* record);
+
+const char* predator_dump_card_name(PredatorDumpCard card);
+
+// ===== EXPORT =====
+
+/**
+ * @brief Convert a dump to JSON (all card types)
+ */
+bool predator_dump_export_json(Storage* storage, const char* dump_path, const char* json_path);
+
+/**
+ * @brief Convert a dump to a Flipper .nfc file (FeliCa, ISO15693). FeliCa
+ * service blocks go into comments; the Flipper format has no field for them.
+ * @return false for other card types (Calypso, EM4305, DESFire)
+ */
+bool predator_dump_export_nfc(Storage* storage, const char* dump_path, const char* nfc_path);
+
+#ifdef __cplusplus
+}
+#endif
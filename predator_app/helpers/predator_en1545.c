@@ -0,0 +1,112 @@
+#include "predator_en1545.h"
+#include <string.h>
+
+// Deepest bitmap nesting a layout may use (Intercode uses 2)
+#define EN1545_MAX_DEPTH 4
+
+typedef struct {
+    const En1545Field* layout;
+    size_t layout_len;
+    const uint8_t* data;
+    size_t len_bits;
+    size_t pos;
+    En1545Values* values;
+} En1545Walk;
+
+uint32_t en1545_read_bits(const uint8_t* data, size_t bit_pos, uint8_t n) {
+    if(n == 0) return 0;
+    // Up to 5 bytes cover any 32-bit field at any bit offset
+    const uint8_t* p = &data[bit_pos >> 3];
+    const unsigned shift = bit_pos & 7;
+    const unsigned bytes = (shift + n + 7) >> 3;
+    uint64_t acc = 0;
+    for(unsigned i = 0; i < bytes; i++) acc = (acc << 8) | p[i];
+    acc >>= bytes * 8 - shift - n;
+    return (uint32_t)(acc & ((n == 32) ? 0xFFFFFFFFULL : ((1ULL << n) - 1)));
+}
+
+// Index just past field idx and its children, without reading any bits
+static size_t en1545_skip_desc(const En1545Field* layout, size_t layout_len, size_t idx, int depth) {
+    if(idx >= layout_len || depth > EN1545_MAX_DEPTH) return SIZE_MAX;
+    const En1545Field* f = &layout[idx++];
+    if(f->type == En1545Bitmap) {
+        for(uint8_t i = 0; i < f->bits && idx != SIZE_MAX; i++) {
+            idx = en1545_skip_desc(layout, layout_len, idx, depth + 1);
+        }
+    }
+    return idx;
+}
+
+// Decode field idx; returns the index of the next sibling or SIZE_MAX
+static size_t en1545_field(En1545Walk* w, size_t idx, int depth) {
+    if(idx >= w->layout_len || depth > EN1545_MAX_DEPTH) return SIZE_MAX;
+    const En1545Field* f = &w->layout[idx++];
+    if(w->pos + f->bits > w->len_bits) return SIZE_MAX;
+
+    if(f->type == En1545Int) {
+        if(f->id && f->bits <= 32 && f->id < EN1545_MAX_VALUES) {
+            w->values->value[f->id] = en1545_read_bits(w->data, w->pos, f->bits);
+            w->values->present |= 1UL << f->id;
+        }
+        w->pos += f->bits;
+        return idx;
+    }
+
+    if(f->type != En1545Bitmap || f->bits > 32) return SIZE_MAX;
+    const uint32_t bitmap = en1545_read_bits(w->data, w->pos, f->bits);
+    w->pos += f->bits;
+    for(uint8_t i = 0; i < f->bits && idx != SIZE_MAX; i++) {
+        if((bitmap >> i) & 1) {
+            idx = en1545_field(w, idx, depth + 1);
+        } else {
+            idx = en1545_skip_desc(w->layout, w->layout_len, idx, depth + 1);
+        }
+    }
+    return idx;
+}
+
+bool en1545_decode(const En1545Field* layout, size_t layout_len,
+                   const uint8_t* data, size_t len, En1545Values* values) {
+    if(!layout || !data || !values) return false;
+    memset(values, 0, sizeof(*values));
+
+    En1545Walk w = {
+        .layout = layout,
+        .layout_len = layout_len,
+        .data = data,
+        .len_bits = len * 8,
+        .pos = 0,
+        .values = values,
+    };
+    size_t idx = 0;
+    while(idx < layout_len) {
+        idx = en1545_field(&w, idx, 0);
+        if(idx == SIZE_MAX) return false;
+    }
+    return true;
+}
+
+static inline uint8_t to_bcd(uint32_t v) {
+    return (uint8_t)(((v / 10) % 10) << 4 | (v % 10));
+}
+
+void en1545_date_to_bcd(uint32_t days, uint8_t* ymd) {
+    // Civil date from a day count (Hinnant), epoch shifted to 1997-01-01
+    const int32_t z = (int32_t)days + 9862 + 719468;  // 9862 = 1997-01-01 - 1970-01-01
+    const int32_t era = z / 146097;
+    const uint32_t doe = (uint32_t)(z - era * 146097);
+    const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const uint32_t mp = (5 * doy + 2) / 153;
+    const uint32_t d = doy - (153 * mp + 2) / 5 + 1;
+    const uint32_t m = mp < 10 ? mp + 3 : mp - 9;
+    const uint32_t y = (uint32_t)(yoe + era * 400) + (m <= 2);
+    ymd[0] = to_bcd(y % 100);
+    ymd[1] = to_bcd(m);
+    ymd[2] = to_bcd(d);
+}
+
+void en1545_time_to_bcd(uint32_t minutes, uint8_t* hm) {
+    hm[0] = to_bcd((minutes / 60) % 24);
+    hm[1] = to_bcd(minutes % 60);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * EN1545 bit-field decoder (Calypso Intercode contracts and events)
+ *
+ * EN1545 records are MSB-first bit strings. Optional groups are announced
+ * by presence bitmaps: an n-bit bitmap is followed by its present children
+ * in order, child i present when bit i (counting from the LSB) is set.
+ * Bitmaps nest.
+ *
+ * A record layout is a flat, preorder table of En1545Field. A bitmap entry
+ * is followed by the descriptors of its children (each of which may be a
+ * bitmap with its own children). Decoding walks the table once against the
+ * raw record, reading in place; integer fields tagged with an id are
+ * stored in En1545Values, everything else is skipped. Supporting a new
+ * network layout means writing a new table.
+ */
+
+#define EN1545_MAX_VALUES 32   // Value ids 1..31 (0 = skip)
+
+typedef enum {
+    En1545Int,      // Unsigned integer, 1..255 bits (> 32 bits: skip only)
+    En1545Bitmap,   // Presence bitmap, bits = number of child fields
+} En1545FieldType;
+
+typedef struct {
+    uint8_t type;   // En1545FieldType
+    uint8_t bits;   // Field width, or bitmap width (= child count)
+    uint8_t id;     // Value slot for integers, 0 = skip
+} En1545Field;
+
+typedef struct {
+    uint32_t value[EN1545_MAX_VALUES];
+    uint32_t present;   // Bit id set when value[id] was decoded
+} En1545Values;
+
+// Field descriptor helpers for layout tables
+#define EN1545_INT(bits, id) {En1545Int, (bits), (id)}
+#define EN1545_SKIP(bits)    {En1545Int, (bits), 0}
+#define EN1545_BITMAP(n)     {En1545Bitmap, (n), 0}
+
+// Common EN1545 field widths
+#define EN1545_DATE_BITS 14   // Days since 1997-01-01
+#define EN1545_TIME_BITS 11   // Minutes since midnight
+
+/**
+ * Read n (0..32) bits MSB-first at bit_pos; caller checks the bounds
+ */
+uint32_t en1545_read_bits(const uint8_t* data, size_t bit_pos, uint8_t n);
+
+/**
+ * Decode one record
+ * @param layout Layout table
+ * @param layout_len Descriptors in layout
+ * @param data Raw record
+ * @param len Record length in bytes
+ * @param values Output values (cleared first)
+ * @return false if the record ends inside a field or the table is malformed
+ */
+bool en1545_decode(const En1545Field* layout, size_t layout_len,
+                   const uint8_t* data, size_t len, En1545Values* values);
+
+static inline bool en1545_has(const En1545Values* values, uint8_t id) {
+    return (values->present >> id) & 1;
+}
+
+/**
+ * EN1545 date (days since 1997-01-01) to BCD year (2 digits), month, day
+ */
+void en1545_date_to_bcd(uint32_t days, uint8_t* ymd);
+
+/**
+ * EN1545 time (minutes since midnight) to BCD hour, minute
+ */
+void en1545_time_to_bcd(uint32_t minutes, uint8_t* hm);
@@ -0,0 +1,265 @@
+#include "predator_felica_sync.h"
+#include "../predator_i.h"
+#include <storage/storage.h>
+#include <string.h>
+#include <stdio.h>
+
+#define TAG "FeliCaSync"
+
+#define FELICA_SYNC_INDEX       FELICA_SYNC_DIR "/index.bin"
+#define FELICA_SYNC_HEADER_SIZE 8
+#define FELICA_SYNC_ENTRY_SIZE  12
+#define FELICA_SYNC_BLOCK_SIZE  16
+
+static const uint8_t felica_sync_index_magic[4] = {'F', 'I', 'D', 'X'};
+static const uint8_t felica_sync_history_magic[4] = {'F', 'H', 'S', 'T'};
+
+uint16_t felica_history_sequence(const uint8_t* block) {
+    return block ? (uint16_t)((block[13] << 8) | block[14]) : 0;
+}
+
+static void felica_sync_history_path(const uint8_t* idm, char* path, size_t path_len) {
+    snprintf(path, path_len, "%s/%02X%02X%02X%02X%02X%02X%02X%02X.fhs", FELICA_SYNC_DIR,
+             idm[0], idm[1], idm[2], idm[3], idm[4], idm[5], idm[6], idm[7]);
+}
+
+static bool felica_sync_check_header(File* file, const uint8_t* magic) {
+    uint8_t hdr[FELICA_SYNC_HEADER_SIZE];
+    return storage_file_read(file, hdr, sizeof(hdr)) == sizeof(hdr) &&
+           memcmp(hdr, magic, 4) == 0 && hdr[4] == FELICA_SYNC_VERSION;
+}
+
+static bool felica_sync_write_header(File* file, const uint8_t* magic) {
+    uint8_t hdr[FELICA_SYNC_HEADER_SIZE] = {0};
+    memcpy(hdr, magic, 4);
+    hdr[4] = FELICA_SYNC_VERSION;
+    return storage_file_write(file, hdr, sizeof(hdr)) == sizeof(hdr);
+}
+
+// Look up idm in the index; offset receives the entry position, or the
+// position a new entry goes to (0 = index missing or invalid)
+static bool felica_sync_find(Storage* storage, const uint8_t* idm, FeliCaSyncEntry* entry,
+                             uint32_t* offset) {
+    *offset = 0;
+    File* file = storage_file_alloc(storage);
+    bool found = false;
+
+    if(storage_file_open(file, FELICA_SYNC_INDEX, FSAM_READ, FSOM_OPEN_EXISTING) &&
+       felica_sync_check_header(file, felica_sync_index_magic)) {
+        uint32_t pos = FELICA_SYNC_HEADER_SIZE;
+        uint8_t rec[FELICA_SYNC_ENTRY_SIZE];
+        while(storage_file_read(file, rec, sizeof(rec)) == sizeof(rec)) {
+            if(memcmp(rec, idm, 8) == 0) {
+                memcpy(entry->idm, rec, 8);
+                entry->last_sequence = rec[8] | (rec[9] << 8);
+                entry->record_count = rec[10] | (rec[11] << 8);
+                found = true;
+                break;
+            }
+            pos += sizeof(rec);
+        }
+        *offset = pos;
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+    return found;
+}
+
+static bool felica_sync_write_entry(Storage* storage, const FeliCaSyncEntry* entry,
+                                    uint32_t offset) {
+    File* file = storage_file_alloc(storage);
+    bool ok = false;
+
+    if(offset == 0) {
+        // No usable index yet: start a new one
+        ok = storage_file_open(file, FELICA_SYNC_INDEX, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+             felica_sync_write_header(file, felica_sync_index_magic);
+    } else {
+        ok = storage_file_open(file, FELICA_SYNC_INDEX, FSAM_READ | FSAM_WRITE,
+                               FSOM_OPEN_EXISTING) &&
+             storage_file_seek(file, offset, true);
+    }
+
+    if(ok) {
+        uint8_t rec[FELICA_SYNC_ENTRY_SIZE];
+        memcpy(rec, entry->idm, 8);
+        rec[8] = entry->last_sequence & 0xFF;
+        rec[9] = entry->last_sequence >> 8;
+        rec[10] = entry->record_count & 0xFF;
+        rec[11] = entry->record_count >> 8;
+        ok = storage_file_write(file, rec, sizeof(rec)) == sizeof(rec);
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+    return ok;
+}
+
+// Append blocks (newest first in memory) to the card's file, oldest first.
+// Blocks go right after the stored records the index counts: anything past
+// them is left over from a sync whose index update failed, and is replaced.
+static bool felica_sync_append(Storage* storage, const uint8_t* idm, bool create,
+                               uint32_t stored, const uint8_t* blocks, uint32_t count) {
+    char path[64];
+    felica_sync_history_path(idm, path, sizeof(path));
+
+    File* file = storage_file_alloc(storage);
+    bool ok = false;
+    if(create) {
+        ok = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+             felica_sync_write_header(file, felica_sync_history_magic);
+    } else {
+        const uint32_t end = FELICA_SYNC_HEADER_SIZE + stored * FELICA_SYNC_BLOCK_SIZE;
+        ok = storage_file_open(file, path, FSAM_READ | FSAM_WRITE, FSOM_OPEN_EXISTING);
+        if(ok && storage_file_size(file) < end) {
+            FURI_LOG_E(TAG, "History file shorter than its %lu indexed records", stored);
+            ok = false;
+        }
+        ok = ok && storage_file_seek(file, end, true);
+    }
+    for(uint32_t i = count; ok && i > 0; i--) {
+        ok = storage_file_write(file, &blocks[(i - 1) * FELICA_SYNC_BLOCK_SIZE],
+                                FELICA_SYNC_BLOCK_SIZE) == FELICA_SYNC_BLOCK_SIZE;
+    }
+    if(ok && !create) ok = storage_file_truncate(file);
+
+    storage_file_close(file);
+    storage_file_free(file);
+    return ok;
+}
+
+static bool felica_sync_block_empty(const uint8_t* block) {
+    for(size_t i = 0; i < FELICA_SYNC_BLOCK_SIZE; i++) {
+        if(block[i]) return false;
+    }
+    return true;
+}
+
+bool felica_sync_history(PredatorApp* app, const FeliCaCard* card, FeliCaSyncResult* result) {
+    FeliCaSyncResult local;
+    if(!result) result = &local;
+    memset(result, 0, sizeof(FeliCaSyncResult));
+    if(!app || !app->storage || !card) return false;
+
+    Storage* storage = app->storage;
+    FeliCaSyncEntry entry;
+    uint32_t offset;
+    const bool known = felica_sync_find(storage, card->idm, &entry, &offset);
+
+    const uint16_t service = FELICA_SERVICE_SUICA_HISTORY;
+    uint8_t block_list[FELICA_SUICA_HISTORY_BLOCKS * 2];
+    uint8_t blocks[FELICA_SUICA_HISTORY_BLOCKS * FELICA_SYNC_BLOCK_SIZE];
+    for(uint8_t i = 0; i < FELICA_SUICA_HISTORY_BLOCKS; i++) {
+        block_list[i * 2] = 0x80;  // Service 0
+        block_list[i * 2 + 1] = i; // Block number
+    }
+
+    // Newest block first: an unchanged sequence number means nothing new
+    if(felica_read_blocks(app, card, &service, 1, block_list, 1, blocks) != 1) return false;
+    result->blocks_read = 1;
+
+    const uint16_t newest = felica_history_sequence(blocks);
+    uint32_t wanted = FELICA_SUICA_HISTORY_BLOCKS;
+    if(known) {
+        result->total_records = entry.record_count;
+        const uint16_t ahead = newest - entry.last_sequence;
+        if(ahead == 0) return true;
+        if(ahead >= 0x8000) {
+            FURI_LOG_W(TAG, "Sequence went back (%u < %u), not syncing",
+                       newest, entry.last_sequence);
+            return true;
+        }
+        if(ahead <= FELICA_SUICA_HISTORY_BLOCKS) {
+            wanted = ahead;
+        } else {
+            result->gap = true;
+        }
+    }
+
+    if(wanted > 1) {
+        result->blocks_read += felica_read_blocks(
+            app, card, &service, 1, &block_list[2], wanted - 1, &blocks[FELICA_SYNC_BLOCK_SIZE]);
+        // Storing part of the new blocks and moving the index to the newest
+        // would lose the rest for good: leave everything for the next sync
+        if(result->blocks_read < wanted) {
+            FURI_LOG_W(TAG, "Short history read (%lu of %lu blocks), not syncing",
+                       result->blocks_read, wanted);
+            return false;
+        }
+    }
+
+    // Keep blocks newer than the stored sequence; unused ring entries are zero
+    uint32_t fresh = 0;
+    while(fresh < wanted) {
+        const uint8_t* block = &blocks[fresh * FELICA_SYNC_BLOCK_SIZE];
+        if(felica_sync_block_empty(block)) break;
+        if(known) {
+            const uint16_t ahead = felica_history_sequence(block) - entry.last_sequence;
+            if(ahead == 0 || ahead >= 0x8000) break;
+        }
+        fresh++;
+    }
+    if(fresh == 0) return true;
+
+    if(!known) {
+        memcpy(entry.idm, card->idm, 8);
+        entry.record_count = 0;
+        // Ensure directories exist (ignore error if already exists)
+        storage_common_mkdir(storage, "/ext/apps_data/predator");
+        storage_common_mkdir(storage, FELICA_SYNC_DIR);
+    }
+    if(!felica_sync_append(storage, card->idm, !known, entry.record_count, blocks, fresh)) {
+        FURI_LOG_E(TAG, "History write failed");
+        return false;
+    }
+
+    entry.last_sequence = newest;
+    entry.record_count = entry.record_count + fresh > 0xFFFF ? 0xFFFF : entry.record_count + fresh;
+    if(!felica_sync_write_entry(storage, &entry, offset)) {
+        FURI_LOG_E(TAG, "Index write failed");
+        return false;
+    }
+
+    result->new_records = fresh;
+    result->total_records = entry.record_count;
+    FURI_LOG_I(TAG, "%lu new records (%lu stored, %lu blocks read)",
+               result->new_records, result->total_records, result->blocks_read);
+    return true;
+}
+
+bool felica_sync_get_entry(PredatorApp* app, const uint8_t* idm, FeliCaSyncEntry* entry) {
+    if(!app || !app->storage || !idm || !entry) return false;
+    uint32_t offset;
+    return felica_sync_find(app->storage, idm, entry, &offset);
+}
+
+uint32_t felica_sync_load(PredatorApp* app, const uint8_t* idm, uint32_t skip,
+                          FeliCaTransaction* transactions, uint32_t max_transactions,
+                          FeliCaCardType card_type) {
+    FeliCaSyncEntry entry;
+    if(!transactions || !felica_sync_get_entry(app, idm, &entry)) return 0;
+
+    char path[64];
+    felica_sync_history_path(idm, path, sizeof(path));
+    File* file = storage_file_alloc(app->storage);
+    uint32_t count = 0;
+
+    if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+       felica_sync_check_header(file, felica_sync_history_magic)) {
+        uint8_t block[FELICA_SYNC_BLOCK_SIZE];
+        for(uint32_t i = skip; i < entry.record_count && count < max_transactions; i++) {
+            const uint32_t pos =
+                FELICA_SYNC_HEADER_SIZE + (entry.record_count - 1 - i) * FELICA_SYNC_BLOCK_SIZE;
+            if(!storage_file_seek(file, pos, true) ||
+               storage_file_read(file, block, sizeof(block)) != sizeof(block)) {
+                break;
+            }
+            if(felica_parse_transaction(block, &transactions[count], card_type)) count++;
+        }
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+    return count;
+}
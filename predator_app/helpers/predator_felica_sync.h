@@ -0,0 +1,71 @@
+#pragma once
+
+#include "predator_crypto_felica.h"
+
+/**
+ * Incremental Suica / PASMO history sync
+ *
+ * The card keeps its last 20 transactions in a ring (service 0x090F, block
+ * 0 newest). Each sync reads block 0 first: if its transaction sequence
+ * number matches the one stored for this IDm nothing else is read;
+ * otherwise only the blocks newer than the stored sequence are fetched and
+ * appended. Repeated reads of the same card cost one frame, and the stored
+ * history grows past the card's 20 entries.
+ *
+ * SD layout (FELICA_SYNC_DIR):
+ *   index.bin   "FIDX", version, 3 reserved, then one 12-byte entry per
+ *               card: IDm[8], last sequence (LE16), record count (LE16)
+ *   <IDm>.fhs   "FHST", version, 3 reserved, then raw 16-byte history
+ *               blocks, oldest first (append only)
+ */
+
+#define FELICA_SYNC_DIR     "/ext/apps_data/predator/felica"
+#define FELICA_SYNC_VERSION 1
+
+typedef struct {
+    uint8_t idm[8];
+    uint16_t last_sequence;      // Newest stored transaction
+    uint16_t record_count;       // Blocks in the card's history file
+} FeliCaSyncEntry;
+
+typedef struct {
+    uint32_t new_records;        // Blocks appended by this sync
+    uint32_t total_records;      // Blocks stored for the card
+    uint32_t blocks_read;        // History blocks read over RF
+    bool gap;                    // More transactions than the ring holds since last sync
+} FeliCaSyncResult;
+
+/**
+ * Transaction sequence number of a history block (bytes 13-14, big-endian)
+ */
+uint16_t felica_history_sequence(const uint8_t* block);
+
+/**
+ * Fetch history blocks newer than the stored ones and append them
+ * @param app PredatorApp context (storage)
+ * @param card Polled card (IDm, PMm)
+ * @param result Optional sync summary
+ * @return true if the card was read and the store is up to date
+ */
+bool felica_sync_history(struct PredatorApp* app, const FeliCaCard* card,
+                         FeliCaSyncResult* result);
+
+/**
+ * Index entry for a card
+ * @return false if the card was never synced
+ */
+bool felica_sync_get_entry(struct PredatorApp* app, const uint8_t* idm, FeliCaSyncEntry* entry);
+
+/**
+ * Load stored history, newest first
+ * @param app PredatorApp context (storage)
+ * @param idm Card IDm
+ * @param skip Newest records to skip (for paging)
+ * @param transactions Output array
+ * @param max_transactions Maximum transactions
+ * @param card_type Card type for parsing
+ * @return Number of transactions loaded
+ */
+uint32_t felica_sync_load(struct PredatorApp* app, const uint8_t* idm, uint32_t skip,
+                          FeliCaTransaction* transactions, uint32_t max_transactions,
+                          FeliCaCardType card_type);
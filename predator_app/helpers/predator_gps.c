@@ -2,7 +2,7 @@
 #include "../predator_i.h"
 #include "../predator_uart.h"
 #include "predator_boards.h"
-#include "predator_memory_optimized.h"
+#include "predator_string.h"
 #include <furi.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,6 +11,7 @@
 
 #define GPS_UART_BAUD PREDATOR_GPS_UART_BAUD
 #define GPS_BUFFER_SIZE 512
+#define GPS_NMEA_MAX_FIELDS 20 // GSV: header + 4 sats x 4 fields + checksum
 
 void predator_gps_rx_callback(uint8_t* buf, size_t len, void* context) {
     PredatorApp* app = (PredatorApp*)context;
@@ -185,20 +186,39 @@ void predator_gps_update(PredatorApp* app) {
     }
 }
 
+// Convert NMEA DDMM.MMMM (DDDMM.MMMM for longitude) to decimal degrees
+static bool gps_parse_coordinate(PredatorSpan field, float* out) {
+    size_t dot = predator_span_find(field, '.');
+    if(dot == SIZE_MAX || dot < 2) return false;
+    
+    float degrees = 0.0f;
+    float minutes = 0.0f;
+    PredatorSpan deg_part = predator_span_sub(field, 0, dot - 2);
+    if(deg_part.len > 0 && !predator_span_to_float(deg_part, &degrees)) return false;
+    if(!predator_span_to_float(predator_span_sub(field, dot - 2, field.len), &minutes)) return false;
+    
+    *out = degrees + (minutes / 60.0f);
+    return true;
+}
+
 bool predator_gps_parse_nmea(PredatorApp* app, const char* sentence) {
     if(!app || !sentence) return false;
     
+    // Split once; every field below is a view into sentence (no copies)
+    PredatorSpan fields[GPS_NMEA_MAX_FIELDS];
+    size_t field_count = predator_split(
+        sentence, strlen(sentence), ',', fields, GPS_NMEA_MAX_FIELDS);
+    PredatorSpan type = predator_span_sub(fields[0], 0, 6);
+    
     // GSV sentence contains satellite info
-    if(strncmp(sentence, "$GPGSV", 6) == 0 || strncmp(sentence, "$GNGSV", 6) == 0) {
+    if(predator_span_equals(type, "$GPGSV") || predator_span_equals(type, "$GNGSV")) {
         // GSV = GPS Satellites in View
         // Format: $GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74
         //         $GPGSV,num_msgs,msg_num,num_sats,...
 
-        // Get the 4th field (number of satellites)
-        char* sats_field = predator_get_next_field(sentence, 3, ',');
-        if(sats_field && strlen(sats_field) > 0) {
-            // This field is the total number of satellites in view
-            uint32_t sats_in_view = atoi(sats_field);
+        // 4th field is the total number of satellites in view
+        uint32_t sats_in_view;
+        if(field_count > 3 && predator_span_to_uint32(fields[3], &sats_in_view)) {
             if(sats_in_view > app->satellites) {
                 app->satellites = sats_in_view;
             }
@@ -211,75 +231,31 @@ bool predator_gps_parse_nmea(PredatorApp* app, const char* sentence) {
     }
     
     // Parse GGA sentence (primary position data)
-    if(strncmp(sentence, "$GPGGA", 6) == 0 || strncmp(sentence, "$GNGGA", 6) == 0) {
-        // Parse GGA data
+    if(predator_span_equals(type, "$GPGGA") || predator_span_equals(type, "$GNGGA")) {
+        float degrees;
         
         // Process latitude (field 2 and 3)
-        char* lat_str = predator_get_next_field(sentence, 2, ',');
-        char* ns_indicator = predator_get_next_field(sentence, 3, ',');
-        
-        if(lat_str && strlen(lat_str) > 0 && ns_indicator && (*ns_indicator == 'N' || *ns_indicator == 'S')) {
-            char ns = *ns_indicator;
-            
-            // Convert DDMM.MMMM to decimal degrees
-            char* dot = strchr(lat_str, '.');
-            if(dot) {
-                int dot_pos = dot - lat_str;
-                if(dot_pos >= 2) {
-                    char deg_part[10] = {0};
-                    char min_part[15] = {0};
-                    
-                    strncpy(deg_part, lat_str, dot_pos - 2);
-                    strcpy(min_part, lat_str + dot_pos - 2);
-                    
-                    float degrees = strtof(deg_part, NULL);
-                    float minutes = strtof(min_part, NULL);
-                    
-                    app->latitude = degrees + (minutes / 60.0f);
-                    
-                    // Apply N/S sign
-                    if(ns == 'S') app->latitude = -app->latitude;
-                    
-                    app->gps_connected = true;
-                }
-            }
+        if(field_count > 3 && fields[3].len == 1 &&
+           (fields[3].ptr[0] == 'N' || fields[3].ptr[0] == 'S') &&
+           gps_parse_coordinate(fields[2], &degrees)) {
+            // Apply N/S sign
+            app->latitude = (fields[3].ptr[0] == 'S') ? -degrees : degrees;
+            app->gps_connected = true;
         }
         
         // Process longitude (field 4 and 5)
-        char* lon_str = predator_get_next_field(sentence, 4, ',');
-        char* ew_indicator = predator_get_next_field(sentence, 5, ',');
-        
-        if(lon_str && strlen(lon_str) > 0 && ew_indicator && (*ew_indicator == 'E' || *ew_indicator == 'W')) {
-            char ew = *ew_indicator;
-            
-            // Convert DDDMM.MMMM to decimal degrees
-            char* dot = strchr(lon_str, '.');
-            if(dot) {
-                int dot_pos = dot - lon_str;
-                if(dot_pos >= 2) {
-                    char deg_part[10] = {0};
-                    char min_part[15] = {0};
-                    
-                    strncpy(deg_part, lon_str, dot_pos - 2);
-                    strcpy(min_part, lon_str + dot_pos - 2);
-                    
-                    float degrees = strtof(deg_part, NULL);
-                    float minutes = strtof(min_part, NULL);
-                    
-                    app->longitude = degrees + (minutes / 60.0f);
-                    
-                    // Apply E/W sign
-                    if(ew == 'W') app->longitude = -app->longitude;
-                    
-                    app->gps_connected = true;
-                }
-            }
+        if(field_count > 5 && fields[5].len == 1 &&
+           (fields[5].ptr[0] == 'E' || fields[5].ptr[0] == 'W') &&
+           gps_parse_coordinate(fields[4], &degrees)) {
+            // Apply E/W sign
+            app->longitude = (fields[5].ptr[0] == 'W') ? -degrees : degrees;
+            app->gps_connected = true;
         }
         
         // Get number of satellites (field 7)
-        char* sats_str = predator_get_next_field(sentence, 7, ',');
-        if(sats_str && strlen(sats_str) > 0) {
-            app->satellites = atoi(sats_str);
+        uint32_t sats;
+        if(field_count > 7 && predator_span_to_uint32(fields[7], &sats)) {
+            app->satellites = sats;
             app->gps_connected = true;
         }
         
@@ -287,13 +263,12 @@ bool predator_gps_parse_nmea(PredatorApp* app, const char* sentence) {
     }
     
     // RMC sentence contains the recommended minimum data
-    if(strncmp(sentence, "$GPRMC", 6) == 0 || strncmp(sentence, "$GNRMC", 6) == 0) {
+    if(predator_span_equals(type, "$GPRMC") || predator_span_equals(type, "$GNRMC")) {
         // RMC = Recommended Minimum specific GPS/Transit data
         // We parse this to get status information and backup position
         
         // Get status field (field 2: A=active, V=void)
-        char* status_field = predator_get_next_field(sentence, 2, ',');
-        if(status_field && *status_field == 'A') {
+        if(field_count > 2 && fields[2].len > 0 && fields[2].ptr[0] == 'A') {
             app->gps_connected = true;
             // We could also parse additional fields here if needed
         }
@@ -25,38 +25,6 @@ void predator_watchdog_stop(void) {
     watchdog_active = false;
 }
 
-// Minimal string helper - replaces predator_string.c
-char* predator_get_next_field(const char* str, int field_index, char delimiter) {
-    if (!str || field_index < 0) return NULL;
-    
-    static char buffer[64]; // REDUCED from 128
-    memset(buffer, 0, sizeof(buffer));
-    
-    const char* current = str;
-    int current_field = 0;
-    
-    // Skip to the desired field
-    while (current_field < field_index && *current) {
-        if (*current == delimiter) {
-            current_field++;
-        }
-        current++;
-    }
-    
-    if (current_field != field_index || !*current) {
-        return NULL;
-    }
-    
-    // Copy the field content
-    int i = 0;
-    while (*current && *current != delimiter && i < (int)sizeof(buffer) - 1) {
-        buffer[i++] = *current++;
-    }
-    buffer[i] = '\0';
-    
-    return buffer;
-}
-
 // Minimal UI callbacks - essential only
 void predator_ui_callback_generic(void* context, uint32_t index) {
     PredatorApp* app = context;
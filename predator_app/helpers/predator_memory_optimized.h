@@ -19,8 +19,7 @@ void predator_watchdog_start(void);
 void predator_watchdog_tick(void);
 void predator_watchdog_stop(void);
 
-// String functions (minimal implementation)
-char* predator_get_next_field(const char* str, int field_index, char delimiter);
+// String field parsing: see predator_string.h (span tokenizer)
 
 // UI callback functions (minimal implementation)
 void predator_ui_callback_generic(void* context, uint32_t index);
@@ -26,6 +26,15 @@ typedef enum {
     CryptoProtocolCount
 } CryptoProtocol;
 
+// Frequency band of a remote (packed into precomputed model metadata)
+typedef enum {
+    CarFreqBand315,            // 300-350 MHz (US/Japan)
+    CarFreqBand433,            // 433-435 MHz (EU/Asia)
+    CarFreqBand868,            // 868-869 MHz (EU premium)
+    CarFreqBandOther,
+    CarFreqBandCount
+} CarFreqBand;
+
 typedef struct {
     char make[16];
     char model[40];
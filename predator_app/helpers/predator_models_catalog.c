@@ -0,0 +1,391 @@
+#include "predator_models_catalog.h"
+#include <storage/storage.h>
+#include <furi.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+// Catalog layout is documented in tools/condense_models.py (build_catalog).
+// Generate with:
+//   python3 tools/condense_models.py --catalog car_models.pmc data/car_models_500.csv
+// and copy to PREDATOR_MODELS_CATALOG_PATH on the SD card.
+
+#define TAG "ModelsCatalog"
+
+#define CATALOG_MAGIC       0x54434D50 // "PMCT" little-endian
+#define CATALOG_HEADER_SIZE 48
+#define CATALOG_RECORD_SIZE 16
+#define CATALOG_CONT_SIZE   4
+#define CATALOG_FREQ_SIZE   8
+#define CATALOG_SEARCH_SIZE 4
+#define CATALOG_SEARCH_MODEL_ONLY 0x8000
+
+// Two 256-byte pages: one usually holds the current record page, the other
+// the strings it points at. Pages are evicted least-recently-used.
+#define CATALOG_PAGE_SIZE  256
+#define CATALOG_PAGE_COUNT 2
+
+typedef struct {
+    uint32_t offset;   // File offset of page start (UINT32_MAX = empty)
+    uint32_t len;      // Valid bytes in page
+    uint32_t last_use; // LRU stamp
+    uint8_t data[CATALOG_PAGE_SIZE];
+} CatalogPage;
+
+typedef struct {
+    File* file;
+    uint32_t file_size;
+    uint32_t record_count;
+    uint32_t records_off;
+    uint32_t strings_off;
+    uint32_t strings_len;
+    uint32_t continent_off;
+    uint32_t freq_off;
+    uint32_t freq_count;
+    uint32_t freq_map_off;
+    uint32_t search_off;
+    uint32_t search_count;
+    uint32_t use_counter;
+    CatalogPage pages[CATALOG_PAGE_COUNT];
+} ModelsCatalog;
+
+static ModelsCatalog* catalog = NULL;
+
+static inline uint16_t rd16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t rd32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static CatalogPage* catalog_page(uint32_t offset) {
+    const uint32_t page_off = offset - (offset % CATALOG_PAGE_SIZE);
+    CatalogPage* victim = &catalog->pages[0];
+
+    for(size_t i = 0; i < CATALOG_PAGE_COUNT; i++) {
+        CatalogPage* page = &catalog->pages[i];
+        if(page->offset == page_off) {
+            page->last_use = ++catalog->use_counter;
+            return page;
+        }
+        if(page->last_use < victim->last_use) victim = page;
+    }
+
+    // Miss: refill least recently used page from SD
+    victim->offset = UINT32_MAX;
+    if(!storage_file_seek(catalog->file, page_off, true)) return NULL;
+    uint32_t want = catalog->file_size - page_off;
+    if(want > CATALOG_PAGE_SIZE) want = CATALOG_PAGE_SIZE;
+    if(storage_file_read(catalog->file, victim->data, want) != want) return NULL;
+    victim->offset = page_off;
+    victim->len = want;
+    victim->last_use = ++catalog->use_counter;
+    return victim;
+}
+
+static bool catalog_read(uint32_t offset, void* dst, uint32_t len) {
+    uint8_t* out = dst;
+    if(offset > catalog->file_size || len > catalog->file_size - offset) return false;
+    while(len > 0) {
+        CatalogPage* page = catalog_page(offset);
+        if(!page) return false;
+        uint32_t in_page = offset - page->offset;
+        uint32_t chunk = page->len - in_page;
+        if(chunk > len) chunk = len;
+        memcpy(out, page->data + in_page, chunk);
+        out += chunk;
+        offset += chunk;
+        len -= chunk;
+    }
+    return true;
+}
+
+// Copy NUL-terminated string from string table, truncating to out_len
+static bool catalog_read_string(uint16_t str_off, char* out, size_t out_len) {
+    if(str_off >= catalog->strings_len) return false;
+    uint32_t offset = catalog->strings_off + str_off;
+    uint32_t end = catalog->strings_off + catalog->strings_len;
+    size_t idx = 0;
+    while(idx + 1 < out_len && offset < end) {
+        CatalogPage* page = catalog_page(offset);
+        if(!page) return false;
+        char ch = (char)page->data[offset - page->offset];
+        if(ch == '\0') break;
+        out[idx++] = ch;
+        offset++;
+    }
+    out[idx] = '\0';
+    return true;
+}
+
+bool predator_models_catalog_open(Storage* storage, const char* path) {
+    if(!storage) return false;
+    predator_models_catalog_close();
+
+    catalog = malloc(sizeof(ModelsCatalog));
+    memset(catalog, 0, sizeof(ModelsCatalog));
+    for(size_t i = 0; i < CATALOG_PAGE_COUNT; i++) {
+        catalog->pages[i].offset = UINT32_MAX;
+    }
+
+    catalog->file = storage_file_alloc(storage);
+    if(!storage_file_open(catalog->file, path ? path : PREDATOR_MODELS_CATALOG_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        predator_models_catalog_close();
+        return false;
+    }
+    catalog->file_size = (uint32_t)storage_file_size(catalog->file);
+
+    uint8_t hdr[CATALOG_HEADER_SIZE];
+    if(catalog->file_size < CATALOG_HEADER_SIZE ||
+       storage_file_read(catalog->file, hdr, sizeof(hdr)) != sizeof(hdr) ||
+       rd32(hdr) != CATALOG_MAGIC ||
+       rd16(hdr + 4) != PREDATOR_MODELS_CATALOG_VERSION ||
+       rd16(hdr + 6) != CATALOG_RECORD_SIZE) {
+        FURI_LOG_E(TAG, "Invalid catalog header");
+        predator_models_catalog_close();
+        return false;
+    }
+
+    catalog->record_count = rd32(hdr + 8);
+    catalog->records_off = rd32(hdr + 12);
+    catalog->strings_off = rd32(hdr + 16);
+    catalog->strings_len = rd32(hdr + 20);
+    catalog->continent_off = rd32(hdr + 24);
+    catalog->freq_off = rd32(hdr + 28);
+    catalog->freq_count = rd32(hdr + 32);
+    catalog->freq_map_off = rd32(hdr + 36);
+    catalog->search_off = rd32(hdr + 40);
+    catalog->search_count = rd32(hdr + 44);
+
+    // Bounds-check every section once so lookups can trust the offsets
+    const uint64_t size = catalog->file_size;
+    if((uint64_t)catalog->records_off + (uint64_t)catalog->record_count * CATALOG_RECORD_SIZE > size ||
+       (uint64_t)catalog->strings_off + catalog->strings_len > size ||
+       (uint64_t)catalog->continent_off + CarContinentCount * CATALOG_CONT_SIZE > size ||
+       (uint64_t)catalog->freq_off + (uint64_t)catalog->freq_count * CATALOG_FREQ_SIZE > size ||
+       (uint64_t)catalog->freq_map_off + (uint64_t)catalog->record_count * 2 > size ||
+       (uint64_t)catalog->search_off + (uint64_t)catalog->search_count * CATALOG_SEARCH_SIZE > size ||
+       catalog->search_count > UINT16_MAX) {
+        FURI_LOG_E(TAG, "Catalog truncated");
+        predator_models_catalog_close();
+        return false;
+    }
+
+    FURI_LOG_I(TAG, "Catalog loaded: %lu models", (unsigned long)catalog->record_count);
+    return true;
+}
+
+void predator_models_catalog_close(void) {
+    if(!catalog) return;
+    if(catalog->file) {
+        storage_file_close(catalog->file);
+        storage_file_free(catalog->file);
+    }
+    free(catalog);
+    catalog = NULL;
+}
+
+bool predator_models_catalog_is_open(void) {
+    return catalog != NULL;
+}
+
+size_t predator_models_catalog_count(void) {
+    return catalog ? catalog->record_count : 0;
+}
+
+bool predator_models_catalog_get(size_t index, PredatorCarModel* out, CryptoProtocol* protocol) {
+    if(!catalog || !out || index >= catalog->record_count) return false;
+
+    uint8_t rec[CATALOG_RECORD_SIZE];
+    if(!catalog_read(catalog->records_off + (uint32_t)index * CATALOG_RECORD_SIZE, rec, sizeof(rec))) {
+        return false;
+    }
+
+    out->frequency = rd32(rec);
+    out->continent = rec[10] < CarContinentCount ? (CarContinent)rec[10] : CarContinentEurope;
+    if(!catalog_read_string(rd16(rec + 4), out->make, sizeof(out->make)) ||
+       !catalog_read_string(rd16(rec + 6), out->model, sizeof(out->model)) ||
+       !catalog_read_string(rd16(rec + 8), out->remote_type, sizeof(out->remote_type))) {
+        return false;
+    }
+    if(protocol) {
+        *protocol = rec[11] < CryptoProtocolCount ? (CryptoProtocol)rec[11] : CryptoProtocolNone;
+    }
+    return true;
+}
+
+bool predator_models_catalog_continent_range(CarContinent continent, size_t* first, size_t* count) {
+    if(!catalog || !first || !count || continent >= CarContinentCount) return false;
+    uint8_t entry[CATALOG_CONT_SIZE];
+    if(!catalog_read(catalog->continent_off + (uint32_t)continent * CATALOG_CONT_SIZE, entry, sizeof(entry))) {
+        return false;
+    }
+    *first = rd16(entry);
+    *count = rd16(entry + 2);
+    if(*first + *count > catalog->record_count) return false;
+    return true;
+}
+
+size_t predator_models_catalog_freq_count(void) {
+    return catalog ? catalog->freq_count : 0;
+}
+
+bool predator_models_catalog_freq_entry(size_t freq_index, uint32_t* frequency, size_t* count) {
+    if(!catalog || freq_index >= catalog->freq_count) return false;
+    uint8_t entry[CATALOG_FREQ_SIZE];
+    if(!catalog_read(catalog->freq_off + (uint32_t)freq_index * CATALOG_FREQ_SIZE, entry, sizeof(entry))) {
+        return false;
+    }
+    if(frequency) *frequency = rd32(entry);
+    if(count) *count = rd16(entry + 6);
+    return true;
+}
+
+bool predator_models_catalog_freq_record(uint32_t frequency, size_t nth, size_t* record_index) {
+    if(!catalog || !record_index) return false;
+
+    // Frequency index is sorted: binary search for the entry
+    size_t lo = 0, hi = catalog->freq_count;
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        uint8_t entry[CATALOG_FREQ_SIZE];
+        if(!catalog_read(catalog->freq_off + (uint32_t)mid * CATALOG_FREQ_SIZE, entry, sizeof(entry))) {
+            return false;
+        }
+        uint32_t f = rd32(entry);
+        if(f < frequency) {
+            lo = mid + 1;
+        } else if(f > frequency) {
+            hi = mid;
+        } else {
+            uint16_t first = rd16(entry + 4);
+            uint16_t count = rd16(entry + 6);
+            if(nth >= count || (size_t)first + nth >= catalog->record_count) return false;
+            uint8_t idx[2];
+            if(!catalog_read(catalog->freq_map_off + (uint32_t)(first + nth) * 2, idx, sizeof(idx))) {
+                return false;
+            }
+            *record_index = rd16(idx);
+            return *record_index < catalog->record_count;
+        }
+    }
+    return false;
+}
+
+// ===== TYPE-AHEAD SEARCH =====
+
+bool predator_models_catalog_has_search(void) {
+    return catalog && catalog->search_count > 0;
+}
+
+static bool search_entry(size_t pos, uint16_t* key_off, uint16_t* record) {
+    uint8_t entry[CATALOG_SEARCH_SIZE];
+    if(!catalog_read(catalog->search_off + (uint32_t)pos * CATALOG_SEARCH_SIZE, entry, sizeof(entry))) {
+        return false;
+    }
+    *key_off = rd16(entry);
+    *record = rd16(entry + 2);
+    return true;
+}
+
+// Compare first len bytes of key at str_off against prefix: <0, 0 (prefix match), >0
+static int search_compare(uint16_t str_off, const char* prefix, size_t len) {
+    uint32_t offset = catalog->strings_off + str_off;
+    const uint32_t end = catalog->strings_off + catalog->strings_len;
+    for(size_t i = 0; i < len; i++, offset++) {
+        if(offset >= end) return -1;
+        CatalogPage* page = catalog_page(offset);
+        if(!page) return -1;
+        uint8_t k = page->data[offset - page->offset];
+        uint8_t p = (uint8_t)prefix[i];
+        if(k != p) return k < p ? -1 : 1; // Key NUL sorts before any prefix char
+    }
+    return 0;
+}
+
+// First entry in [lo, hi) whose key compares >= 0 (upper: > 0) against prefix
+static size_t search_bound(size_t lo, size_t hi, const char* prefix, size_t len, bool upper) {
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        uint16_t key_off, record;
+        if(!search_entry(mid, &key_off, &record)) return hi;
+        int cmp = search_compare(key_off, prefix, len);
+        if(cmp < 0 || (upper && cmp == 0)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void predator_models_catalog_search_begin(PredatorModelsSearch* search) {
+    if(!search) return;
+    search->prefix[0] = '\0';
+    search->lo = 0;
+    search->hi = catalog ? (uint16_t)catalog->search_count : 0;
+}
+
+bool predator_models_catalog_search_refine(PredatorModelsSearch* search, const char* prefix) {
+    if(!search || !prefix || !predator_models_catalog_has_search()) return false;
+
+    char key[PREDATOR_MODELS_SEARCH_MAX];
+    size_t len = 0;
+    for(; prefix[len] && len + 1 < sizeof(key); len++) {
+        key[len] = (char)tolower((unsigned char)prefix[len]);
+    }
+    key[len] = '\0';
+
+    // Longer prefix of the previous query: only the previous range can match
+    if(strncmp(key, search->prefix, strlen(search->prefix)) != 0) {
+        predator_models_catalog_search_begin(search);
+    }
+
+    size_t lo = search_bound(search->lo, search->hi, key, len, false);
+    size_t hi = search_bound(lo, search->hi, key, len, true);
+    memcpy(search->prefix, key, len + 1);
+    search->lo = (uint16_t)lo;
+    search->hi = (uint16_t)hi;
+    return lo < hi;
+}
+
+// A model-only key duplicates its "make model" key when the prefix matches both
+static bool search_is_duplicate(const PredatorModelsSearch* search, uint16_t record) {
+    uint8_t rec[CATALOG_RECORD_SIZE];
+    char make[16];
+    if(!catalog_read(catalog->records_off + (uint32_t)record * CATALOG_RECORD_SIZE, rec, sizeof(rec)) ||
+       !catalog_read_string(rd16(rec + 4), make, sizeof(make))) {
+        return false;
+    }
+    const size_t make_len = strlen(make);
+    const size_t len = strlen(search->prefix);
+    for(size_t i = 0; i < len && i < make_len; i++) {
+        if(tolower((unsigned char)make[i]) != (unsigned char)search->prefix[i]) return false;
+    }
+    // Longer prefixes would need the model to repeat itself after "make ": treat as distinct
+    return len <= make_len;
+}
+
+size_t predator_models_catalog_search_results(
+    const PredatorModelsSearch* search,
+    size_t skip,
+    size_t* record_indices,
+    size_t max,
+    size_t* next) {
+    size_t found = 0;
+    size_t pos = search ? search->lo + skip : 0;
+    if(search && record_indices && catalog) {
+        for(; pos < search->hi && found < max; pos++) {
+            uint16_t key_off, record;
+            if(!search_entry(pos, &key_off, &record)) break;
+            if(record & CATALOG_SEARCH_MODEL_ONLY) {
+                record &= ~CATALOG_SEARCH_MODEL_ONLY;
+                if(search_is_duplicate(search, record)) continue;
+            }
+            if(record < catalog->record_count) record_indices[found++] = record;
+        }
+    }
+    if(next) *next = search ? pos - search->lo : 0;
+    return found;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "predator_models.h"
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Binary model catalog generated by tools/condense_models.py --catalog.
+// Records are fetched from SD on demand through a small page cache, so the
+// full worldwide list can be browsed without keeping it in RAM or flash.
+#define PREDATOR_MODELS_CATALOG_PATH    "/ext/apps_data/predator/car_models.pmc"
+#define PREDATOR_MODELS_CATALOG_VERSION 1
+
+// Open catalog at path (NULL = default path). Returns false if missing or invalid.
+bool predator_models_catalog_open(Storage* storage, const char* path);
+
+// Close catalog and release the page cache
+void predator_models_catalog_close(void);
+
+bool predator_models_catalog_is_open(void);
+
+// Number of records in the open catalog (0 if none)
+size_t predator_models_catalog_count(void);
+
+// Read record at index into out; protocol may be NULL
+bool predator_models_catalog_get(size_t index, PredatorCarModel* out, CryptoProtocol* protocol);
+
+// Records are sorted by continent: get the contiguous range for one continent
+bool predator_models_catalog_continent_range(CarContinent continent, size_t* first, size_t* count);
+
+// Number of distinct frequencies in the frequency index
+size_t predator_models_catalog_freq_count(void);
+
+// Frequency index entry: distinct frequency and how many records use it
+bool predator_models_catalog_freq_entry(size_t freq_index, uint32_t* frequency, size_t* count);
+
+// Record index of the nth model using frequency (via the frequency index)
+bool predator_models_catalog_freq_record(uint32_t frequency, size_t nth, size_t* record_index);
+
+// ===== TYPE-AHEAD SEARCH =====
+// Prefix search over lowercase "make model" and "model" keys built at catalog
+// generation time. Refining with a longer prefix only searches the range that
+// matched the previous prefix, so typing narrows results incrementally.
+
+#define PREDATOR_MODELS_SEARCH_MAX 24
+
+typedef struct {
+    char prefix[PREDATOR_MODELS_SEARCH_MAX];
+    uint16_t lo; // First matching index entry
+    uint16_t hi; // One past last matching index entry
+} PredatorModelsSearch;
+
+// True if the open catalog carries a search index
+bool predator_models_catalog_has_search(void);
+
+// Reset search to match everything
+void predator_models_catalog_search_begin(PredatorModelsSearch* search);
+
+// Narrow (or restart) search for prefix (case-insensitive). Returns false if nothing matches.
+bool predator_models_catalog_search_refine(PredatorModelsSearch* search, const char* prefix);
+
+// Collect up to max matching record indices, skipping the first skip index entries.
+// Returns number written; *next receives the skip value for the following batch.
+size_t predator_models_catalog_search_results(
+    const PredatorModelsSearch* search,
+    size_t skip,
+    size_t* record_indices,
+    size_t max,
+    size_t* next);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,6 @@
 #include "predator_models.h"
+#include "predator_models_hardcoded.h"
+#include "predator_models_meta.h"
 #include <string.h>
 
 // COMPLETE WORLDWIDE CAR MODELS DATABASE - Production Ready! 🚗
@@ -151,6 +153,12 @@ static const PredatorCarModel hardcoded_models[] = {
 
 static const size_t hardcoded_models_count = sizeof(hardcoded_models) / sizeof(hardcoded_models[0]);
 
+// predator_models_meta.h is generated from the table above; regenerate it with
+// tools/condense_models.py --hardcoded-meta whenever the table changes.
+_Static_assert(
+    sizeof(hardcoded_models) / sizeof(hardcoded_models[0]) == PREDATOR_MODELS_META_COUNT,
+    "predator_models_meta.h is stale - regenerate with condense_models.py --hardcoded-meta");
+
 // Return hardcoded model count
 size_t predator_models_get_hardcoded_count(void) {
     return hardcoded_models_count;
@@ -211,50 +219,33 @@ bool predator_models_is_continent(size_t index, CarContinent continent) {
     return predator_models_get_continent(index) == continent;
 }
 
-// ===== CRYPTO PROTOCOL DETECTION (INTELLIGENT) =====
-// Automatically detects the correct crypto algorithm based on model data
+// Number of models in a continent (precomputed index, no scan)
+size_t predator_models_continent_count(CarContinent continent) {
+    if(continent >= CarContinentCount) return 0;
+    return hardcoded_continent_range[continent][1];
+}
 
-CryptoProtocol predator_models_get_protocol(size_t index) {
-    const PredatorCarModel* model = predator_models_get_hardcoded(index);
-    if(!model) return CryptoProtocolNone;
-    
-    // Use the remote_type field from database (NOT just brand name!)
-    
-    // FIXED CODE: No encryption, simple replay
-    if(strcmp(model->remote_type, "Fixed Code") == 0) {
-        return CryptoProtocolNone;
-    }
-    
-    // SMART KEY: AES-128 or Tesla-specific
-    if(strcmp(model->remote_type, "Smart Key") == 0) {
-        // Tesla uses proprietary protocol
-        if(strcmp(model->make, "Tesla") == 0) {
-            return CryptoProtocolTesla;
-        }
-        // All other smart keys use AES-128
-        return CryptoProtocolAES128;
-    }
-    
-    // ROLLING CODE: Keeloq OR Hitag2 (depends on frequency + manufacturer)
-    if(strcmp(model->remote_type, "Rolling Code") == 0) {
-        // Hitag2: German brands at 868MHz
-        if(model->frequency >= 868000000 && model->frequency < 869000000) {
-            if(strcmp(model->make, "BMW") == 0 ||
-               strcmp(model->make, "Audi") == 0 ||
-               strcmp(model->make, "Volkswagen") == 0 ||
-               strcmp(model->make, "Porsche") == 0 ||
-               strcmp(model->make, "Skoda") == 0 ||
-               strcmp(model->make, "Seat") == 0) {
-                return CryptoProtocolHitag2;
-            }
-        }
-        
-        // All other rolling code vehicles use Keeloq
-        return CryptoProtocolKeeloq;
+// Hardcoded index of the nth model in a continent (SIZE_MAX if out of range)
+size_t predator_models_continent_model(CarContinent continent, size_t nth) {
+    if(continent >= CarContinentCount || nth >= hardcoded_continent_range[continent][1]) {
+        return SIZE_MAX;
     }
-    
-    // Default: No encryption
-    return CryptoProtocolNone;
+    return hardcoded_continent_index[hardcoded_continent_range[continent][0] + nth];
+}
+
+// Get frequency band (precomputed)
+CarFreqBand predator_models_get_band(size_t index) {
+    if(index >= hardcoded_models_count) return CarFreqBandOther;
+    return PREDATOR_MODEL_META_BAND(hardcoded_model_meta[index]);
+}
+
+// ===== CRYPTO PROTOCOL DETECTION =====
+// Protocol is derived from remote_type + frequency + make at build time
+// (condense_models.py protocol_of) and stored packed in hardcoded_model_meta.
+
+CryptoProtocol predator_models_get_protocol(size_t index) {
+    if(index >= hardcoded_models_count) return CryptoProtocolNone;
+    return PREDATOR_MODEL_META_PROTOCOL(hardcoded_model_meta[index]);
 }
 
 // Get protocol name as human-readable string
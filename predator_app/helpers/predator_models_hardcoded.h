@@ -24,6 +24,13 @@ CarContinent predator_models_get_continent(size_t index);
 const char* predator_models_get_continent_name(CarContinent continent);
 bool predator_models_is_continent(size_t index, CarContinent continent);
 
+// Per-continent index (precomputed): number of models and nth model's hardcoded index
+size_t predator_models_continent_count(CarContinent continent);
+size_t predator_models_continent_model(CarContinent continent, size_t nth);
+
+// Frequency band (precomputed)
+CarFreqBand predator_models_get_band(size_t index);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,138 @@
+#pragma once
+
+// GENERATED by tools/condense_models.py --hardcoded-meta - do not edit.
+// One entry per hardcoded_models[] row, same order.
+
+#include <stdint.h>
+
+#define PREDATOR_MODELS_META_COUNT 96
+
+// Packed: bits 0-2 CryptoProtocol, bits 3-4 CarFreqBand, bits 5-6 CarContinent
+#define PREDATOR_MODEL_META(proto, band, cont) \
+    ((uint8_t)((proto) | ((band) << 3) | ((cont) << 5)))
+#define PREDATOR_MODEL_META_PROTOCOL(m)  ((CryptoProtocol)((m) & 0x07))
+#define PREDATOR_MODEL_META_BAND(m)      ((CarFreqBand)(((m) >> 3) & 0x03))
+#define PREDATOR_MODEL_META_CONTINENT(m) ((CarContinent)(((m) >> 5) & 0x03))
+
+static const uint8_t hardcoded_model_meta[PREDATOR_MODELS_META_COUNT] = {
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand315, CarContinentEurope), // VW Atlas 20+
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // VW Fixed
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // VW Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // VW Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // Audi Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // Audi Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // BMW Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // BMW Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // Mercedes Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // Mercedes Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // Mercedes Sprinter 18+
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Renault Fixed
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Renault Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Renault Zoe 19+
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Peugeot Landtrek 20+
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Peugeot Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Peugeot Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Fiat 500X 18+
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand315, CarContinentEurope), // Fiat Fixed
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Fiat Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Porsche Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Porsche Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Skoda Enyaq 21+
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Skoda Fixed
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Skoda Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Seat Fixed
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Seat Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // Volvo Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand868, CarContinentEurope), // Volvo Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Jaguar Fixed
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Jaguar Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Range Rover Fixed
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Range Rover Smart
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Ferrari 488 GTB 2015+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Ferrari F8 Tributo 2019+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Ferrari SF90 Stradale 2019+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Ferrari Roma 2020+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Ferrari Portofino 2017+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Ferrari 812 Superfast 2017+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Ferrari 296 GTB 2022+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Lamborghini Huracan 2014+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Lamborghini Aventador 2011+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Lamborghini Urus 2018+
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand433, CarContinentEurope), // Lamborghini Gallardo 2003-2013
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentEurope), // Lamborghini Murcielago 2001-2010
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Maserati Ghibli 2014+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Maserati Quattroporte 2013+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Maserati Levante 2016+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Maserati MC20 2021+
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand433, CarContinentEurope), // Maserati GranTurismo 2007-2019
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Bentley Continental GT 2018+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Bentley Flying Spur 2019+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Bentley Bentayga 2016+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Bentley Mulsanne 2010-2020
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Rolls-Royce Phantom 2017+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Rolls-Royce Ghost 2020+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Rolls-Royce Cullinan 2018+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Rolls-Royce Wraith 2013+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Aston Martin DB11 2016+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Aston Martin DBS Superleggera 2018+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Aston Martin Vantage 2018+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Aston Martin DBX 2020+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // McLaren 720S 2017+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // McLaren 765LT 2020+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // McLaren Artura 2021+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // McLaren GT 2019+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Bugatti Chiron 2016+
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentEurope), // Bugatti Veyron 2005-2015
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand315, CarContinentAmerica), // Ford Various Fixed 315
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand433, CarContinentAmerica), // Ford Various Fixed 433
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand315, CarContinentAmerica), // Ford Various Rolling 315
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand433, CarContinentAmerica), // Ford Various Rolling 433
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand315, CarContinentAmerica), // Ford Various Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand315, CarContinentAmerica), // Chevrolet Various Fixed
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand315, CarContinentAmerica), // Chevrolet Various Rolling
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand315, CarContinentAmerica), // Chevrolet Various Smart
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand433, CarContinentAmerica), // Jeep Avenger 2023+
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand315, CarContinentAmerica), // Jeep Various Fixed
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand315, CarContinentAmerica), // Jeep Various Rolling
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand315, CarContinentAmerica), // Dodge Various Fixed
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand315, CarContinentAmerica), // Dodge Various Rolling
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand315, CarContinentAmerica), // Dodge Various Smart
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand315, CarContinentAmerica), // Chrysler Various Fixed
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand315, CarContinentAmerica), // Chrysler Various Rolling
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand315, CarContinentAmerica), // Cadillac Various Rolling
+    PREDATOR_MODEL_META(CryptoProtocolAES128, CarFreqBand315, CarContinentAmerica), // Cadillac Various Smart
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand315, CarContinentAmerica), // Tesla Model S 2012-2016
+    PREDATOR_MODEL_META(CryptoProtocolTesla, CarFreqBand315, CarContinentAmerica), // Tesla Model S 2017+
+    PREDATOR_MODEL_META(CryptoProtocolTesla, CarFreqBand315, CarContinentAmerica), // Tesla Model 3 2018+
+    PREDATOR_MODEL_META(CryptoProtocolKeeloq, CarFreqBand315, CarContinentAmerica), // Tesla Model X 2016-2020
+    PREDATOR_MODEL_META(CryptoProtocolTesla, CarFreqBand315, CarContinentAmerica), // Tesla Model X 2021+
+    PREDATOR_MODEL_META(CryptoProtocolTesla, CarFreqBand315, CarContinentAmerica), // Tesla Model Y 2020+
+    PREDATOR_MODEL_META(CryptoProtocolTesla, CarFreqBand315, CarContinentAmerica), // Tesla Cybertruck 2024+
+    PREDATOR_MODEL_META(CryptoProtocolNone, CarFreqBand315, CarContinentAmerica), // Tesla Roadster 2008-2012
+    PREDATOR_MODEL_META(CryptoProtocolTesla, CarFreqBand315, CarContinentAmerica), // Tesla Roadster 2023+
+    PREDATOR_MODEL_META(CryptoProtocolTesla, CarFreqBand315, CarContinentAmerica), // Tesla Semi 2023+
+};
+// zlib CRC-32 of hardcoded_model_meta[], checked by tests/predator_tables_tests.c
+#define PREDATOR_MODELS_META_CRC32 0xB520391B
+
+// Hardcoded model indices grouped by continent
+static const uint8_t hardcoded_continent_index[96] = {
+    // Europe
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67,
+    // Asia
+    // America
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+};
+#define PREDATOR_MODELS_CONTINENT_INDEX_CRC32 0x51C87372
+
+// {first, count} into hardcoded_continent_index, indexed by CarContinent
+static const uint8_t hardcoded_continent_range[][2] = {
+    {0, 68}, // Europe
+    {68, 0}, // Asia
+    {68, 28}, // America
+};
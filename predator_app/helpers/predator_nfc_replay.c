@@ -0,0 +1,104 @@
+#include "predator_nfc_replay.h"
+#include <furi.h>
+#include <string.h>
+
+// Air interface timing per technology
+typedef struct {
+    uint16_t byte_ns_div10;  // One byte on air, in 10 ns units
+    uint8_t frame_bytes;     // Per-frame overhead (SOF/EOF, preamble, CRC)
+    uint16_t turnaround_us;  // Reader-to-card plus card-to-reader guard times
+} NfcAirTiming;
+
+static const NfcAirTiming nfc_air_timing[PredatorNfcTechCount] = {
+    // ISO 14443B, 106 kbps: 10 etu per byte (start, 8 bits, stop)
+    [PredatorNfcTechIso14443b] = {9440, 4, 200},
+    // FeliCa, 212 kbps Manchester: preamble 6 + sync 2 + CRC 2
+    [PredatorNfcTechFelica] = {3774, 10, 150},
+    // ISO 15693 high data rate, ~26.5 kbps: SOF/EOF + CRC
+    [PredatorNfcTechIso15693] = {30200, 3, 320},
+    // ISO 14443A, 106 kbps: 9 bits per byte (parity), PCB + CRC
+    [PredatorNfcTechIso14443a] = {8496, 3, 100},
+};
+
+uint32_t predator_nfc_frame_us(PredatorNfcTech tech, size_t tx_len, size_t rx_len) {
+    if(tech >= PredatorNfcTechCount) return 0;
+    const NfcAirTiming* t = &nfc_air_timing[tech];
+    const uint32_t bytes = (uint32_t)(tx_len + rx_len) + 2 * t->frame_bytes;
+    return bytes * t->byte_ns_div10 / 100 + t->turnaround_us;
+}
+
+static bool nfc_replay_field_on(void* ctx, PredatorNfcTech tech) {
+    UNUSED(tech);
+    PredatorNfcReplay* replay = ctx;
+    replay->field = true;
+    return true;
+}
+
+static void nfc_replay_field_off(void* ctx) {
+    PredatorNfcReplay* replay = ctx;
+    replay->field = false;
+}
+
+static bool nfc_replay_transceive(void* ctx, PredatorNfcTech tech,
+                                  const uint8_t* tx, size_t tx_len,
+                                  uint8_t* rx, size_t rx_max, size_t* rx_len,
+                                  uint32_t timeout_us) {
+    PredatorNfcReplay* replay = ctx;
+    const PredatorNfcSession* session = replay->session;
+    *rx_len = 0;
+
+    const size_t count = session ? session->frame_count : 0;
+    for(size_t n = 0; n < count; n++) {
+        const size_t i = (replay->cursor + n) % count;
+        const PredatorNfcFrame* f = &session->frames[i];
+        if(f->tech != tech || f->tx_len != tx_len || memcmp(f->tx, tx, tx_len) != 0) continue;
+
+        replay->cursor = i + 1;
+        if(f->rx_len == 0) break;   // Recorded silence
+        if(f->card_us > timeout_us) break;   // Answer arrives after the reader gave up
+
+        replay->now_us += replay->reader_us + f->card_us +
+                          predator_nfc_frame_us(tech, tx_len, f->rx_len);
+        if(f->rx_len > rx_max) return false;   // Would overflow the caller: refused like the device
+        *rx_len = f->rx_len;
+        memcpy(rx, f->rx, *rx_len);
+        return true;
+    }
+
+    // Unknown request or recorded silence: the reader waits it out
+    replay->misses++;
+    replay->now_us += replay->reader_us + timeout_us;
+    return false;
+}
+
+static void nfc_replay_delay_us(void* ctx, uint32_t us) {
+    PredatorNfcReplay* replay = ctx;
+    replay->now_us += us;
+}
+
+static uint32_t nfc_replay_time_us(void* ctx) {
+    const PredatorNfcReplay* replay = ctx;
+    return (uint32_t)replay->now_us;
+}
+
+static const PredatorNfcTransportOps nfc_replay_ops = {
+    .name = "replay",
+    .field_on = nfc_replay_field_on,
+    .field_off = nfc_replay_field_off,
+    .transceive = nfc_replay_transceive,
+    .delay_us = nfc_replay_delay_us,
+    .time_us = nfc_replay_time_us,
+};
+
+void predator_nfc_replay_init(PredatorNfcReplay* replay, const PredatorNfcSession* session) {
+    if(!replay) return;
+    memset(replay, 0, sizeof(PredatorNfcReplay));
+    replay->session = session;
+    replay->reader_us = PREDATOR_NFC_REPLAY_READER_US;
+    replay->transport.ops = &nfc_replay_ops;
+    replay->transport.ctx = replay;
+}
+
+const PredatorNfcTransport* predator_nfc_replay_transport(PredatorNfcReplay* replay) {
+    return replay ? &replay->transport : NULL;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "predator_nfc_transport.h"
+
+/**
+ * Replay NFC transport (host benchmarking and tests)
+ *
+ * Answers frames from a recorded card session. Each request is matched
+ * byte for byte against the recorded requests, starting at the frame after
+ * the last match and wrapping, so an in-order dump replays in order and
+ * re-reads still find their answer. Unmatched requests time out, as do
+ * requests whose recorded card time exceeds the caller's timeout.
+ *
+ * Time is virtual: every exchange costs its air time at the interface's
+ * bit rate (predator_nfc_frame_us) plus the recorded card processing time
+ * and a fixed reader overhead; timeouts cost their timeout and delays
+ * their duration. Nothing sleeps, so a full card read is timed in
+ * microseconds of host time.
+ */
+
+#define PREDATOR_NFC_REPLAY_READER_US 500   // Reader/HAL overhead per frame
+
+typedef struct {
+    uint8_t tech;         // PredatorNfcTech
+    uint8_t tx_len;
+    uint8_t rx_len;       // 0 = no answer
+    uint16_t card_us;     // Card processing time before answering
+    const uint8_t* tx;
+    const uint8_t* rx;
+} PredatorNfcFrame;
+
+typedef struct {
+    const char* name;
+    const PredatorNfcFrame* frames;
+    size_t frame_count;
+} PredatorNfcSession;
+
+typedef struct {
+    const PredatorNfcSession* session;
+    size_t cursor;          // Frame after the last match
+    uint64_t now_us;        // Virtual clock
+    uint32_t reader_us;     // Per-frame reader overhead
+    uint32_t misses;        // Requests not in the session
+    bool field;
+    PredatorNfcTransport transport;
+} PredatorNfcReplay;
+
+/**
+ * Prepare a replay of session (clock at 0)
+ */
+void predator_nfc_replay_init(PredatorNfcReplay* replay, const PredatorNfcSession* session);
+
+/**
+ * Transport to pass to predator_nfc_set_transport
+ */
+const PredatorNfcTransport* predator_nfc_replay_transport(PredatorNfcReplay* replay);
+
+/**
+ * Air time of one exchange: request and answer frames plus turnaround
+ */
+uint32_t predator_nfc_frame_us(PredatorNfcTech tech, size_t tx_len, size_t rx_len);
@@ -0,0 +1,139 @@
+#include "predator_nfc_transport.h"
+#include "../predator_i.h"
+#include <string.h>
+
+// ========== DEVICE BACKEND ==========
+
+static bool nfc_device_field_on(void* ctx, PredatorNfcTech tech) {
+    UNUSED(ctx);
+    UNUSED(tech);
+    furi_hal_nfc_field_on();
+    return true;
+}
+
+static void nfc_device_field_off(void* ctx) {
+    UNUSED(ctx);
+    furi_hal_nfc_field_off();
+}
+
+// The frame wait time goes to the HAL, so per-command timeouts (FeliCa PMm,
+// ISO15693 empty slots) bound the wait on the device as they do on replay.
+// The HAL receives into the backend's frame buffer, never the caller's.
+static uint8_t nfc_device_frame[PREDATOR_NFC_FRAME_MAX];
+
+static bool nfc_device_transceive(void* ctx, PredatorNfcTech tech,
+                                  const uint8_t* tx, size_t tx_len,
+                                  uint8_t* rx, size_t rx_max, size_t* rx_len,
+                                  uint32_t timeout_us) {
+    UNUSED(ctx);
+    uint8_t* frame = nfc_device_frame;
+    const size_t frame_max = sizeof(nfc_device_frame);
+    size_t len = 0;
+    *rx_len = 0;
+    switch(tech) {
+    case PredatorNfcTechIso14443b:
+        furi_hal_nfc_iso14443b_transceive(tx, tx_len, frame, frame_max, &len, timeout_us);
+        break;
+    case PredatorNfcTechFelica:
+        furi_hal_nfc_felica_transceive(tx, tx_len, frame, frame_max, &len, timeout_us);
+        break;
+    case PredatorNfcTechIso15693:
+        furi_hal_nfc_iso15693_transceive(tx, tx_len, frame, frame_max, &len, timeout_us);
+        break;
+    case PredatorNfcTechIso14443a:
+        furi_hal_nfc_iso14443a_transceive(tx, tx_len, frame, frame_max, &len, timeout_us);
+        break;
+    default:
+        return false;
+    }
+    if(len == 0 || len > frame_max) return false;
+    if(len > rx_max) {
+        FURI_LOG_W("NFC", "%u-byte answer, buffer holds %u", (unsigned)len, (unsigned)rx_max);
+        return false;
+    }
+    memcpy(rx, frame, len);
+    *rx_len = len;
+    return true;
+}
+
+static void nfc_device_delay_us(void* ctx, uint32_t us) {
+    UNUSED(ctx);
+    furi_delay_us(us);
+}
+
+static uint32_t nfc_device_time_us(void* ctx) {
+    UNUSED(ctx);
+    return furi_get_tick() * 1000;  // Tick resolution
+}
+
+static const PredatorNfcTransportOps nfc_device_ops = {
+    .name = "device",
+    .field_on = nfc_device_field_on,
+    .field_off = nfc_device_field_off,
+    .transceive = nfc_device_transceive,
+    .delay_us = nfc_device_delay_us,
+    .time_us = nfc_device_time_us,
+};
+
+static const PredatorNfcTransport nfc_device_transport = {
+    .ops = &nfc_device_ops,
+    .ctx = NULL,
+};
+
+// ========== ACTIVE TRANSPORT ==========
+
+static const PredatorNfcTransport* nfc_transport = &nfc_device_transport;
+static PredatorNfcStats nfc_stats;
+
+void predator_nfc_set_transport(const PredatorNfcTransport* transport) {
+    nfc_transport = (transport && transport->ops) ? transport : &nfc_device_transport;
+    FURI_LOG_D("NFC", "Transport: %s", nfc_transport->ops->name);
+}
+
+const PredatorNfcTransport* predator_nfc_get_transport(void) {
+    return nfc_transport;
+}
+
+bool predator_nfc_field_on(PredatorNfcTech tech) {
+    return nfc_transport->ops->field_on(nfc_transport->ctx, tech);
+}
+
+void predator_nfc_field_off(void) {
+    nfc_transport->ops->field_off(nfc_transport->ctx);
+}
+
+bool predator_nfc_transceive(PredatorNfcTech tech, const uint8_t* tx, size_t tx_len,
+                             uint8_t* rx, size_t rx_max, size_t* rx_len,
+                             uint32_t timeout_us) {
+    if(!tx || !rx || !rx_len) return false;
+    *rx_len = 0;
+
+    bool ok = nfc_transport->ops->transceive(
+        nfc_transport->ctx, tech, tx, tx_len, rx, rx_max, rx_len, timeout_us);
+
+    nfc_stats.frames++;
+    nfc_stats.tx_bytes += tx_len;
+    if(ok) {
+        nfc_stats.rx_bytes += *rx_len;
+    } else {
+        nfc_stats.timeouts++;
+        *rx_len = 0;
+    }
+    return ok;
+}
+
+void predator_nfc_delay_ms(uint32_t ms) {
+    nfc_transport->ops->delay_us(nfc_transport->ctx, ms * 1000);
+}
+
+uint32_t predator_nfc_time_us(void) {
+    return nfc_transport->ops->time_us(nfc_transport->ctx);
+}
+
+void predator_nfc_get_stats(PredatorNfcStats* stats) {
+    if(stats) *stats = nfc_stats;
+}
+
+void predator_nfc_reset_stats(void) {
+    memset(&nfc_stats, 0, sizeof(nfc_stats));
+}
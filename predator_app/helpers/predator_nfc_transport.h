@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * NFC transport (FeliCa, Calypso, ISO15693, DESFire)
+ *
+ * Card modules build frames and hand them to predator_nfc_transceive; the
+ * active transport moves them. The default transport is the device HAL.
+ * predator_nfc_set_transport swaps in another backend, e.g. the replay
+ * backend (predator_nfc_replay.h), which answers from a recorded card
+ * session on a virtual clock so full reads can be timed on a workstation.
+ *
+ * Delays between frames go through predator_nfc_delay_ms for the same
+ * reason: on replay they advance the virtual clock instead of sleeping.
+ */
+
+typedef enum {
+    PredatorNfcTechIso14443b,   // Calypso (APDUs)
+    PredatorNfcTechFelica,      // FeliCa / NFC-F (LEN + command, no CRC)
+    PredatorNfcTechIso15693,    // NFC-V (flags + command + CRC; empty frame = EOF to next slot)
+    PredatorNfcTechIso14443a,   // DESFire (ISO 7816-wrapped native commands)
+    PredatorNfcTechCount,
+} PredatorNfcTech;
+
+#define PREDATOR_NFC_TIMEOUT_US 20000   // Default response timeout
+#define PREDATOR_NFC_FRAME_MAX  256     // Largest answer a backend accepts
+
+typedef struct {
+    const char* name;
+    bool (*field_on)(void* ctx, PredatorNfcTech tech);
+    void (*field_off)(void* ctx);
+    // rx_len is set to the response length; false on timeout / no answer, or
+    // an answer longer than rx_max (never truncated)
+    bool (*transceive)(void* ctx, PredatorNfcTech tech,
+                       const uint8_t* tx, size_t tx_len,
+                       uint8_t* rx, size_t rx_max, size_t* rx_len,
+                       uint32_t timeout_us);
+    void (*delay_us)(void* ctx, uint32_t us);
+    uint32_t (*time_us)(void* ctx);
+} PredatorNfcTransportOps;
+
+typedef struct {
+    const PredatorNfcTransportOps* ops;
+    void* ctx;
+} PredatorNfcTransport;
+
+typedef struct {
+    uint32_t frames;     // Transceive calls
+    uint32_t timeouts;   // Frames without an answer (or one too long for rx_max)
+    uint32_t tx_bytes;
+    uint32_t rx_bytes;
+} PredatorNfcStats;
+
+/**
+ * Select the active transport
+ * @param transport Backend, or NULL for the device HAL
+ */
+void predator_nfc_set_transport(const PredatorNfcTransport* transport);
+
+/**
+ * Active transport (never NULL)
+ */
+const PredatorNfcTransport* predator_nfc_get_transport(void);
+
+bool predator_nfc_field_on(PredatorNfcTech tech);
+void predator_nfc_field_off(void);
+
+/**
+ * Send a frame and wait for the answer on the active transport
+ * @param tech Air interface
+ * @param tx Frame to send
+ * @param tx_len Frame length
+ * @param rx Response buffer
+ * @param rx_max Response buffer size
+ * @param rx_len Output response length (0 on failure)
+ * @param timeout_us Response timeout
+ * @return true if the card answered within rx_max bytes
+ */
+bool predator_nfc_transceive(PredatorNfcTech tech, const uint8_t* tx, size_t tx_len,
+                             uint8_t* rx, size_t rx_max, size_t* rx_len,
+                             uint32_t timeout_us);
+
+/**
+ * Wait between frames (virtual on replay)
+ */
+void predator_nfc_delay_ms(uint32_t ms);
+
+/**
+ * Transport clock in microseconds (virtual on replay)
+ */
+uint32_t predator_nfc_time_us(void);
+
+/**
+ * Frame counters since the last reset
+ */
+void predator_nfc_get_stats(PredatorNfcStats* stats);
+void predator_nfc_reset_stats(void);
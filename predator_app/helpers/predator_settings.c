@@ -1,5 +1,6 @@
 #include "predator_settings.h"
 #include "../predator_i.h"
+#include "predator_string.h"
 #include <storage/storage.h>
 #include <furi.h>
 #include <string.h>
@@ -48,16 +49,17 @@ bool predator_settings_get_int(struct PredatorApp* app, const char* key, int32_t
     bool found = false;
     if(storage_file_open(file, SETTINGS_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
         char line[96];
+        PredatorSpan kv[2];
         while(read_line(file, line, sizeof(line))) {
             if(line[0] == '\0') continue;
-            char* eq = strchr(line, '=');
-            if(!eq) continue;
-            *eq = '\0';
-            const char* k = line;
-            const char* v = eq + 1;
-            if(strcmp(k, key) == 0) {
-                *out_value = (int32_t)strtol(v, NULL, 10);
-                found = true;
+            if(predator_split(line, strlen(line), '=', kv, 2) < 2) continue;
+            if(predator_span_equals(predator_span_trim(kv[0]), key)) {
+                // Malformed value keeps the default
+                int32_t value;
+                if(predator_span_to_int32(predator_span_trim(kv[1]), &value)) {
+                    *out_value = value;
+                    found = true;
+                }
                 break;
             }
         }
@@ -79,23 +81,19 @@ bool predator_settings_set_int(struct PredatorApp* app, const char* key, int32_t
     char buffer[2048]; size_t used = 0;
     if(storage_file_open(file, SETTINGS_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
         char line[96];
+        PredatorSpan kv[2];
         while(read_line(file, line, sizeof(line))) {
             if(line[0] == '\0') continue;
-            char* eq = strchr(line, '=');
-            if(eq) {
-                *eq = '\0';
-                const char* k = line;
-                const char* rest = eq + 1;
-                if(strcmp(k, key) == 0) {
-                    // skip existing entry
-                    continue;
-                } else {
-                    // append original line
-                    size_t len = strlen(k) + 1 + strlen(rest);
-                    if(used + len + 2 < sizeof(buffer)) {
-                        used += snprintf(buffer + used, sizeof(buffer) - used, "%s=%s\n", k, rest);
-                    }
-                }
+            if(predator_split(line, strlen(line), '=', kv, 2) < 2) continue;
+            if(predator_span_equals(predator_span_trim(kv[0]), key)) {
+                // skip existing entry
+                continue;
+            }
+            // append original line
+            size_t len = kv[0].len + 1 + kv[1].len;
+            if(used + len + 2 < sizeof(buffer)) {
+                used += snprintf(buffer + used, sizeof(buffer) - used, "%.*s=%.*s\n",
+                                 (int)kv[0].len, kv[0].ptr, (int)kv[1].len, kv[1].ptr);
             }
         }
         storage_file_close(file);
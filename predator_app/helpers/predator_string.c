@@ -0,0 +1,159 @@
+#include "predator_string.h"
+#include <string.h>
+
+PredatorSpan predator_span_from_cstr(const char* str) {
+    PredatorSpan span = {str, str ? strlen(str) : 0};
+    return span;
+}
+
+size_t predator_split(const char* str, size_t len, char delimiter, PredatorSpan* fields, size_t max_fields) {
+    if(!fields || max_fields == 0) return 0;
+    if(!str) len = 0;
+
+    size_t count = 0;
+    size_t start = 0;
+    for(size_t i = 0; i < len && count + 1 < max_fields; i++) {
+        if(str[i] == delimiter) {
+            fields[count].ptr = str + start;
+            fields[count].len = i - start;
+            count++;
+            start = i + 1;
+        }
+    }
+    // Final field (or remainder of line once max_fields is reached)
+    fields[count].ptr = str ? str + start : NULL;
+    fields[count].len = len - start;
+    return count + 1;
+}
+
+static bool span_is_space(char ch) {
+    return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+}
+
+PredatorSpan predator_span_trim(PredatorSpan span) {
+    while(span.len > 0 && span_is_space(span.ptr[0])) {
+        span.ptr++;
+        span.len--;
+    }
+    while(span.len > 0 && span_is_space(span.ptr[span.len - 1])) {
+        span.len--;
+    }
+    return span;
+}
+
+PredatorSpan predator_span_sub(PredatorSpan span, size_t offset, size_t len) {
+    if(offset > span.len) offset = span.len;
+    if(len > span.len - offset) len = span.len - offset;
+    PredatorSpan sub = {span.ptr ? span.ptr + offset : NULL, len};
+    return sub;
+}
+
+size_t predator_span_find(PredatorSpan span, char ch) {
+    for(size_t i = 0; i < span.len; i++) {
+        if(span.ptr[i] == ch) return i;
+    }
+    return SIZE_MAX;
+}
+
+bool predator_span_equals(PredatorSpan span, const char* str) {
+    if(!str) return false;
+    return strlen(str) == span.len && (span.len == 0 || memcmp(span.ptr, str, span.len) == 0);
+}
+
+bool predator_span_copy(PredatorSpan span, char* out, size_t out_size) {
+    if(!out || out_size == 0) return false;
+    size_t n = span.len < out_size - 1 ? span.len : out_size - 1;
+    if(n > 0) memcpy(out, span.ptr, n);
+    out[n] = '\0';
+    return n == span.len;
+}
+
+bool predator_span_to_uint32(PredatorSpan span, uint32_t* out) {
+    if(!out || span.len == 0) return false;
+    size_t i = (span.ptr[0] == '+') ? 1 : 0;
+    if(i == span.len) return false;
+
+    uint32_t value = 0;
+    for(; i < span.len; i++) {
+        char ch = span.ptr[i];
+        if(ch < '0' || ch > '9') return false;
+        uint32_t digit = (uint32_t)(ch - '0');
+        if(value > (UINT32_MAX - digit) / 10) return false;
+        value = value * 10 + digit;
+    }
+    *out = value;
+    return true;
+}
+
+bool predator_span_to_int32(PredatorSpan span, int32_t* out) {
+    if(!out || span.len == 0) return false;
+    bool negative = span.ptr[0] == '-';
+    if(negative) {
+        span = predator_span_sub(span, 1, span.len);
+        if(span.len > 0 && span.ptr[0] == '+') return false;
+    }
+
+    uint32_t magnitude;
+    if(!predator_span_to_uint32(span, &magnitude)) return false;
+    if(negative) {
+        if(magnitude > (uint32_t)INT32_MAX + 1) return false;
+        *out = (int32_t)(0 - magnitude);
+    } else {
+        if(magnitude > INT32_MAX) return false;
+        *out = (int32_t)magnitude;
+    }
+    return true;
+}
+
+bool predator_span_to_hex32(PredatorSpan span, uint32_t* out) {
+    if(!out) return false;
+    if(span.len >= 2 && span.ptr[0] == '0' && (span.ptr[1] == 'x' || span.ptr[1] == 'X')) {
+        span = predator_span_sub(span, 2, span.len);
+    }
+    if(span.len == 0 || span.len > 8) return false;
+
+    uint32_t value = 0;
+    for(size_t i = 0; i < span.len; i++) {
+        char ch = span.ptr[i];
+        uint32_t nibble;
+        if(ch >= '0' && ch <= '9') nibble = (uint32_t)(ch - '0');
+        else if(ch >= 'a' && ch <= 'f') nibble = (uint32_t)(ch - 'a' + 10);
+        else if(ch >= 'A' && ch <= 'F') nibble = (uint32_t)(ch - 'A' + 10);
+        else return false;
+        value = (value << 4) | nibble;
+    }
+    *out = value;
+    return true;
+}
+
+bool predator_span_to_float(PredatorSpan span, float* out) {
+    if(!out || span.len == 0) return false;
+
+    // Integer and fraction accumulated separately: float keeps ~7 digits, so
+    // "01131.000" must not be folded into one scaled integer first
+    uint32_t int_part = 0;
+    uint32_t frac_part = 0;
+    uint32_t frac_scale = 1;
+    bool seen_dot = false;
+    bool seen_digit = false;
+    for(size_t i = 0; i < span.len; i++) {
+        char ch = span.ptr[i];
+        if(ch == '.' && !seen_dot) {
+            seen_dot = true;
+            continue;
+        }
+        if(ch < '0' || ch > '9') return false;
+        seen_digit = true;
+        if(!seen_dot) {
+            if(int_part > (UINT32_MAX - 9) / 10) return false;
+            int_part = int_part * 10 + (uint32_t)(ch - '0');
+        } else if(frac_scale <= 100000000) {
+            // Digits past 1e-9 do not change a float
+            frac_part = frac_part * 10 + (uint32_t)(ch - '0');
+            frac_scale *= 10;
+        }
+    }
+    if(!seen_digit) return false;
+    *out = (float)int_part + (float)frac_part / (float)frac_scale;
+    return true;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Zero-copy string views. A line is split once into (ptr, len) spans stored
+// in a caller-provided array; fields are then parsed in place. Nothing is
+// static, so the UART RX thread (GPS) and the GUI thread can parse at once.
+
+typedef struct {
+    const char* ptr;
+    size_t len;
+} PredatorSpan;
+
+#define PREDATOR_SPAN_EMPTY ((PredatorSpan){NULL, 0})
+
+/**
+ * @brief View over a NUL-terminated string (NULL gives an empty span)
+ */
+PredatorSpan predator_span_from_cstr(const char* str);
+
+/**
+ * @brief Split str[0..len) on delimiter into fields
+ *
+ * Empty fields are kept ("a,,b" gives 3 fields). If the line has more than
+ * max_fields fields, the last span runs to the end of the line, so
+ * splitting "key=a=b" into 2 fields gives "key" and "a=b".
+ *
+ * @return Number of spans written (0 only if max_fields is 0)
+ */
+size_t predator_split(const char* str, size_t len, char delimiter, PredatorSpan* fields, size_t max_fields);
+
+/**
+ * @brief Strip leading/trailing spaces, tabs and CR/LF
+ */
+PredatorSpan predator_span_trim(PredatorSpan span);
+
+/**
+ * @brief Sub-view [offset, offset + len), clamped to the span
+ */
+PredatorSpan predator_span_sub(PredatorSpan span, size_t offset, size_t len);
+
+/**
+ * @brief Offset of first ch in span, or SIZE_MAX
+ */
+size_t predator_span_find(PredatorSpan span, char ch);
+
+/**
+ * @brief Compare span with a NUL-terminated string
+ */
+bool predator_span_equals(PredatorSpan span, const char* str);
+
+/**
+ * @brief Copy span into out as a NUL-terminated string
+ * @return false if out_size is too small (out then holds a truncated copy)
+ */
+bool predator_span_copy(PredatorSpan span, char* out, size_t out_size);
+
+/**
+ * @brief Parse whole span as decimal integer (optional sign)
+ * @return false on empty span, stray characters or overflow
+ */
+bool predator_span_to_int32(PredatorSpan span, int32_t* out);
+bool predator_span_to_uint32(PredatorSpan span, uint32_t* out);
+
+/**
+ * @brief Parse whole span as hex (optional 0x prefix, up to 8 digits)
+ */
+bool predator_span_to_hex32(PredatorSpan span, uint32_t* out);
+
+/**
+ * @brief Parse whole span as unsigned decimal with optional fraction ("4807.038")
+ */
+bool predator_span_to_float(PredatorSpan span, float* out);
+
+#ifdef __cplusplus
+}
+#endif
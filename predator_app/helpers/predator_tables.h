@@ -0,0 +1,85 @@
+#pragma once
+
+// GENERATED by tools/gen_tables.py - do not edit.
+// Constant lookup tables; each *_CRC32 is the zlib CRC-32 of the table's
+// little-endian bytes and is checked by tests/predator_tables_tests.c.
+
+#include <stdint.h>
+
+// Slice-by-4 CRC tables (5 KB of .rodata); set to 0 for RAM-tight builds
+#ifndef PREDATOR_CRC_SLICE4
+#define PREDATOR_CRC_SLICE4 1
+#endif
+
+// Rotated AES T-tables (6 KB); 0 keeps only Te0/Td0 (2 KB) and rotates in code
+#ifndef PREDATOR_AES_FULL_TABLES
+#define PREDATOR_AES_FULL_TABLES 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// DES combined S-box + P permutation, indexed [box][6-bit chunk]
+extern const uint32_t predator_des_sp[8][64];
+#define PREDATOR_DES_SP_CRC32 0x76D4FBCE
+
+// CRC-8, polynomial 0x07 (MSB-first)
+extern const uint8_t predator_crc8_table[256];
+#define PREDATOR_CRC8_CRC32 0x153FF56E
+
+// CRC-16/CCITT, polynomial 0x1021 (MSB-first)
+extern const uint16_t predator_crc16_ccitt_table[256];
+#define PREDATOR_CRC16_CCITT_CRC32 0x0E1D3952
+
+// CRC-16 reflected 0x8408 (ISO 15693, ISO 14443-3 A/B)
+extern const uint16_t predator_crc16_8408_table[256];
+#define PREDATOR_CRC16_8408_CRC32 0x0917CC20
+
+#if PREDATOR_CRC_SLICE4
+// Slice-by-4 tables 1-3 for reflected 0x8408
+extern const uint16_t predator_crc16_8408_slice[3][256];
+#define PREDATOR_CRC16_8408_SLICE_CRC32 0x5F4C3A59
+#endif
+
+// CRC-32 reflected 0xEDB88320 (DESFire JAMCRC)
+extern const uint32_t predator_crc32_table[256];
+#define PREDATOR_CRC32_CRC32 0x6FCF9E13
+
+#if PREDATOR_CRC_SLICE4
+// Slice-by-4 tables 1-3 for reflected 0xEDB88320
+extern const uint32_t predator_crc32_slice[3][256];
+#define PREDATOR_CRC32_SLICE_CRC32 0xADFF4698
+#endif
+
+// AES S-box (FIPS-197 5.1.1)
+extern const uint8_t predator_aes_sbox[256];
+#define PREDATOR_AES_SBOX_CRC32 0x206EE743
+
+// AES inverse S-box (FIPS-197 5.3.2)
+extern const uint8_t predator_aes_inv_sbox[256];
+#define PREDATOR_AES_INV_SBOX_CRC32 0x50CD7DFD
+
+// AES encryption T-table: SubBytes + MixColumns column
+extern const uint32_t predator_aes_te0[256];
+#define PREDATOR_AES_TE0_CRC32 0xD520BB83
+
+// AES decryption T-table: InvSubBytes + InvMixColumns column
+extern const uint32_t predator_aes_td0[256];
+#define PREDATOR_AES_TD0_CRC32 0x7E8D5D5F
+
+#if PREDATOR_AES_FULL_TABLES
+// Te1-Te3 (Te0 rotated right by 8/16/24 bits)
+extern const uint32_t predator_aes_te_rot[3][256];
+#define PREDATOR_AES_TE_ROT_CRC32 0xFDDAFFCE
+#endif
+
+#if PREDATOR_AES_FULL_TABLES
+// Td1-Td3 (Td0 rotated right by 8/16/24 bits)
+extern const uint32_t predator_aes_td_rot[3][256];
+#define PREDATOR_AES_TD_ROT_CRC32 0xBFFA0237
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,6 +19,7 @@
 #include "helpers/predator_error.h"
 #include "helpers/predator_watchdog.h"
 #include "helpers/predator_boards.h"
+#include "helpers/predator_crypto_keydiv.h"
 
 #include "scenes/predator_scene.h"
 
@@ -465,6 +466,9 @@ void predator_app_free(PredatorApp* app) {
     if(app->view_dispatcher) view_dispatcher_free(app->view_dispatcher);
     if(app->scene_manager) scene_manager_free(app->scene_manager);
 
+    // Wipe cached card keys
+    predator_keydiv_clear();
+
     // Safely close records that were opened
     // Close in reverse order of opening for proper dependency handling
     if(app->storage) {
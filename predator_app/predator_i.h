@@ -18,6 +18,9 @@
 #include "helpers/predator_models.h"
 // Compliance and regional gating
 #include "helpers/predator_compliance.h"
+// Transit cards shared between the reader scenes and their detail views
+#include "helpers/predator_crypto_calypso.h"
+#include "helpers/predator_crypto_felica.h"
 // Use generated scene IDs from config to avoid mismatches
 #include "scenes/predator_scene.h"
 
@@ -214,6 +217,7 @@ typedef struct PredatorApp {
     // Selected car model context
     CarContinent selected_continent;  // Selected continent filter
     size_t selected_model_index;
+    CryptoProtocol selected_model_protocol;  // Resolved at selection (hardcoded list or SD catalog)
     uint32_t selected_model_freq;
     char selected_model_make[16];
     char selected_model_name[40];
@@ -222,6 +226,12 @@ typedef struct PredatorApp {
     uint8_t selected_barrier_region;        // 0-7: Region selection (Worldwide, EU, NA, Asia, etc.)
     uint8_t selected_barrier_type;          // 1-6: Public, Private, Hospital, Mall, Airport, Government
     uint8_t selected_barrier_manufacturer;  // 0-34: Manufacturer, 0xFF: Try all
+    
+    // Transit cards detected by the reader scenes (journey/contracts/history views read these)
+    CalypsoCard calypso_card;
+    bool calypso_card_valid;
+    FeliCaCard felica_card;
+    bool felica_card_valid;
 } PredatorApp;
 
 
@@ -6,7 +6,6 @@
 // Pattern: Scrollable list with detailed info
 
 typedef struct {
-    CalypsoCard card;
     CalypsoContract contracts[4];
     uint32_t contract_count;
     uint32_t selected_index;
@@ -121,13 +120,16 @@ void predator_scene_calypso_contracts_on_enter(void* context) {
     state = malloc(sizeof(ContractsState));
     memset(state, 0, sizeof(ContractsState));
     
-    // Read contracts
-    // Real implementation would call:
-    // state->contract_count = calypso_read_all_contracts(
-    //     app, &state->card, state->contracts, 4);
-    
-    snprintf(state->status_text, sizeof(state->status_text),
-             "←/→ Navigate, Back to exit");
+    // Read contracts (records already read this session come from the cache)
+    if(app->calypso_card_valid) {
+        state->contract_count = calypso_read_all_contracts(
+            app, &app->calypso_card, state->contracts, COUNT_OF(state->contracts));
+        snprintf(state->status_text, sizeof(state->status_text),
+                 "←/→ Navigate, Back to exit");
+    } else {
+        snprintf(state->status_text, sizeof(state->status_text),
+                 "No card, Back to exit");
+    }
     
     // Create view if needed
     if(!contracts_view) {
@@ -6,7 +6,6 @@
 // Pattern: Same as FeliCa History
 
 typedef struct {
-    CalypsoCard card;
     CalypsoEvent events[20];
     uint32_t event_count;
     uint32_t scroll_offset;
@@ -147,13 +146,16 @@ void predator_scene_calypso_journey_on_enter(void* context) {
     state = malloc(sizeof(JourneyState));
     memset(state, 0, sizeof(JourneyState));
     
-    // Read journey history
-    // Real implementation would call:
-    // state->event_count = calypso_read_event_log(
-    //     app, &state->card, state->events, 20);
-    
-    snprintf(state->status_text, sizeof(state->status_text),
-             "↑/↓ Scroll, Back to exit");
+    // Read journey history (records already read this session come from the cache)
+    if(app->calypso_card_valid) {
+        state->event_count = calypso_read_event_log(
+            app, &app->calypso_card, state->events, COUNT_OF(state->events));
+        snprintf(state->status_text, sizeof(state->status_text),
+                 "↑/↓ Scroll, Back to exit");
+    } else {
+        snprintf(state->status_text, sizeof(state->status_text),
+                 "No card, Back to exit");
+    }
     
     // Create view if needed
     if(!journey_view) {
@@ -116,26 +116,24 @@ static bool calypso_reader_input_callback(InputEvent* event, void* context) {
     return false;
 }
 
-static void calypso_reader_timer_callback(void* context) {
-    UNUSED(context);
-    
+// Poll for a card. Runs from on_event (GUI thread): detection and the record
+// reads are NFC exchanges that must not block the timer service thread.
+static void calypso_reader_step(PredatorApp* app) {
     if(!reader_state) return;
     
-    // Try to detect card
-    if(!reader_state->card_detected) {
-        // Real implementation would call:
-        // if(calypso_detect_card(app, &reader_state->card)) {
-        //     reader_state->card_detected = true;
-        //     // Read contracts
-        //     reader_state->contract_count = calypso_read_all_contracts(
-        //         app, &reader_state->card,
-        //         reader_state->contracts, 2);
-        //     // Read events
-        //     reader_state->event_count = calypso_read_event_log(
-        //         app, &reader_state->card,
-        //         reader_state->events, 5);
-        // }
+    // Detect once; the actions/journey/contracts views reuse the stored card
+    if(!reader_state->card_detected && calypso_detect_card(app, &reader_state->card)) {
+        reader_state->card_detected = true;
+        app->calypso_card = reader_state->card;
+        app->calypso_card_valid = true;
         
+        reader_state->contract_count = calypso_read_all_contracts(
+            app, &reader_state->card, reader_state->contracts, COUNT_OF(reader_state->contracts));
+        reader_state->event_count = calypso_read_event_log(
+            app, &reader_state->card, reader_state->events, COUNT_OF(reader_state->events));
+    }
+    
+    if(!reader_state->card_detected) {
         snprintf(reader_state->status_text, sizeof(reader_state->status_text),
                  "Scanning...");
     } else {
@@ -146,6 +144,16 @@ static void calypso_reader_timer_callback(void* context) {
     // ViewDispatcher handles redraws automatically
 }
 
+// Timer only ticks; detection happens in on_event
+static void calypso_reader_timer_callback(void* context) {
+    PredatorApp* app = context;
+    if(!app || !app->view_dispatcher || !reader_state) return;
+    
+    if(!reader_state->card_detected) {
+        view_dispatcher_send_custom_event(app->view_dispatcher, PredatorCustomEventTimerExpired);
+    }
+}
+
 void predator_scene_calypso_reader_on_enter(void* context) {
     PredatorApp* app = context;
     if(!app || !app->view_dispatcher) return;
@@ -154,6 +162,10 @@ void predator_scene_calypso_reader_on_enter(void* context) {
     reader_state = malloc(sizeof(CalypsoReaderState));
     memset(reader_state, 0, sizeof(CalypsoReaderState));
     
+    // New read session: journey/contracts views then share this card's records
+    calypso_cache_clear();
+    app->calypso_card_valid = false;
+    
     snprintf(reader_state->status_text, sizeof(reader_state->status_text),
              "Waiting for card...");
     
@@ -178,8 +190,14 @@ void predator_scene_calypso_reader_on_enter(void* context) {
 }
 
 bool predator_scene_calypso_reader_on_event(void* context, SceneManagerEvent event) {
-    UNUSED(context);
-    UNUSED(event);
+    PredatorApp* app = context;
+    
+    if(event.type == SceneManagerEventTypeCustom &&
+       event.event == PredatorCustomEventTimerExpired && app) {
+        calypso_reader_step(app);
+        return true;
+    }
+    
     return false;
 }
 
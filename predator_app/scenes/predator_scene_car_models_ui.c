@@ -1,12 +1,15 @@
 #include "../predator_i.h"
 #include "predator_scene.h"
 #include "../helpers/predator_models_hardcoded.h"
+#include "../helpers/predator_models_catalog.h"
 
 // Simple, memory-safe car models list -> selects one model and moves to attacks scene
-// Uses existing app->submenu only. No dynamic allocations.
+// Uses existing app->submenu only. When the SD catalog is present, pages are read
+// from it on demand; otherwise the hardcoded list is used.
 
 static uint16_t car_models_page = 0; // each page shows up to 16 entries to keep UI fast
 #define CAR_MODELS_PER_PAGE 16
+#define CAR_MODELS_CATALOG_EVENT_BASE 100000 // catalog ids = base + record index
 
 static void car_models_submenu_cb(void* context, uint32_t index) {
     PredatorApp* app = context;
@@ -14,6 +17,54 @@ static void car_models_submenu_cb(void* context, uint32_t index) {
     view_dispatcher_send_custom_event(app->view_dispatcher, index);
 }
 
+static void car_models_add_catalog_page(PredatorApp* app) {
+    size_t first = 0, filtered_count = 0;
+    predator_models_catalog_continent_range(app->selected_continent, &first, &filtered_count);
+
+    const uint16_t total_pages = (filtered_count + CAR_MODELS_PER_PAGE - 1) / CAR_MODELS_PER_PAGE;
+    if(car_models_page >= total_pages) car_models_page = 0;
+
+    if(predator_models_catalog_has_search()) {
+        submenu_add_item(app->submenu, "🔍 Search models", 10001, car_models_submenu_cb, app);
+    }
+
+    if(total_pages > 1) {
+        char hdr[24];
+        snprintf(hdr, sizeof(hdr), "Page %u/%u", (unsigned)(car_models_page + 1), (unsigned)total_pages);
+        submenu_add_item(app->submenu, hdr, 10000, car_models_submenu_cb, app);
+    }
+
+    // Continent records are contiguous: read exactly one page worth from SD
+    const size_t start = car_models_page * CAR_MODELS_PER_PAGE;
+    for(size_t i = start; i < filtered_count && i < start + CAR_MODELS_PER_PAGE; i++) {
+        PredatorCarModel model;
+        if(!predator_models_catalog_get(first + i, &model, NULL)) break;
+        char label[32];
+        snprintf(label, sizeof(label), "%.15s %.15s", model.make, model.model);
+        submenu_add_item(
+            app->submenu, label, (uint32_t)(CAR_MODELS_CATALOG_EVENT_BASE + first + i), car_models_submenu_cb, app);
+    }
+
+    if(total_pages > 1) {
+        submenu_add_item(app->submenu, "Next Page ▶", 20001, car_models_submenu_cb, app);
+        submenu_add_item(app->submenu, "◀ Prev Page", 20002, car_models_submenu_cb, app);
+    }
+}
+
+static void car_models_select(PredatorApp* app, size_t idx, const PredatorCarModel* model, CryptoProtocol protocol) {
+    // CRITICAL: Store model index and protocol for attack scenes
+    app->selected_model_index = idx;
+    app->selected_model_protocol = protocol;
+
+    // Persist selection on app (bounded copies)
+    app->selected_model_freq = model->frequency;
+    strncpy(app->selected_model_make, model->make, sizeof(app->selected_model_make) - 1);
+    app->selected_model_make[sizeof(app->selected_model_make) - 1] = '\0';
+    strncpy(app->selected_model_name, model->model, sizeof(app->selected_model_name) - 1);
+    app->selected_model_name[sizeof(app->selected_model_name) - 1] = '\0';
+    scene_manager_next_scene(app->scene_manager, PredatorSceneCarModelAttacksUI);
+}
+
 void predator_scene_car_models_ui_on_enter(void* context) {
     PredatorApp* app = context;
     if(!app || !app->submenu) return;
@@ -26,14 +77,14 @@ void predator_scene_car_models_ui_on_enter(void* context) {
     snprintf(header, sizeof(header), "🚗 %s", continent_name);
     submenu_set_header(app->submenu, header);
 
-    // Count filtered models on-the-fly (no large array allocation)
-    const size_t total = predator_models_get_hardcoded_count();
-    size_t filtered_count = 0;
-    for(size_t i = 0; i < total; i++) {
-        if(predator_models_is_continent(i, app->selected_continent)) {
-            filtered_count++;
-        }
+    if(predator_models_catalog_is_open() || predator_models_catalog_open(app->storage, NULL)) {
+        car_models_add_catalog_page(app);
+        view_dispatcher_switch_to_view(app->view_dispatcher, PredatorViewSubmenu);
+        return;
     }
+
+    // Precomputed continent index: no scan over the whole table
+    const size_t filtered_count = predator_models_continent_count(app->selected_continent);
     
     const uint16_t total_pages = (filtered_count + CAR_MODELS_PER_PAGE - 1) / CAR_MODELS_PER_PAGE;
     if(car_models_page >= total_pages) car_models_page = 0;
@@ -45,26 +96,17 @@ void predator_scene_car_models_ui_on_enter(void* context) {
         submenu_add_item(app->submenu, hdr, 10000, car_models_submenu_cb, app);
     }
 
-    // Add models for current page (on-the-fly filtering, no array)
+    // Add models for current page: O(page size) lookups through the index
     const size_t start = car_models_page * CAR_MODELS_PER_PAGE;
-    const size_t end = start + CAR_MODELS_PER_PAGE;
-    size_t displayed = 0;
-    size_t filtered_idx = 0;
-    
-    for(size_t i = 0; i < total && displayed < CAR_MODELS_PER_PAGE; i++) {
-        if(!predator_models_is_continent(i, app->selected_continent)) continue;
-        
-        if(filtered_idx >= start && filtered_idx < end) {
-            const PredatorCarModel* model = predator_models_get_hardcoded(i);
-            if(model) {
-                char label[32];
-                snprintf(label, sizeof(label), "%.15s %.15s", model->make, model->model);
-                // Store model index in event ID for later protocol detection
-                submenu_add_item(app->submenu, label, (uint32_t)(i + 1), car_models_submenu_cb, app);
-                displayed++;
-            }
+    for(size_t n = start; n < filtered_count && n < start + CAR_MODELS_PER_PAGE; n++) {
+        const size_t i = predator_models_continent_model(app->selected_continent, n);
+        const PredatorCarModel* model = predator_models_get_hardcoded(i);
+        if(model) {
+            char label[32];
+            snprintf(label, sizeof(label), "%.15s %.15s", model->make, model->model);
+            // Store model index in event ID for later protocol detection
+            submenu_add_item(app->submenu, label, (uint32_t)(i + 1), car_models_submenu_cb, app);
         }
-        filtered_idx++;
     }
 
     // Navigation buttons
@@ -87,8 +129,11 @@ bool predator_scene_car_models_ui_on_event(void* context, SceneManagerEvent even
     }
 
     if(event.type == SceneManagerEventTypeCustom) {
-        // Pagination header id = 10000; next=20001; prev=20002; model ids are index+1
-        if(event.event == 20001) { // next
+        // Pagination header id = 10000; search=10001; next=20001; prev=20002; model ids are index+1
+        if(event.event == 10001) { // search
+            scene_manager_next_scene(app->scene_manager, PredatorSceneCarModelSearchUI);
+            return true;
+        } else if(event.event == 20001) { // next
             car_models_page++;
             predator_scene_car_models_ui_on_enter(app);
             return true;
@@ -96,21 +141,21 @@ bool predator_scene_car_models_ui_on_event(void* context, SceneManagerEvent even
             if(car_models_page > 0) car_models_page--; else car_models_page = 0;
             predator_scene_car_models_ui_on_enter(app);
             return true;
+        } else if(event.event >= CAR_MODELS_CATALOG_EVENT_BASE) {
+            // Model selected from SD catalog
+            size_t idx = (size_t)event.event - CAR_MODELS_CATALOG_EVENT_BASE;
+            PredatorCarModel model;
+            CryptoProtocol protocol;
+            if(predator_models_catalog_get(idx, &model, &protocol)) {
+                car_models_select(app, idx, &model, protocol);
+                return true;
+            }
         } else if(event.event >= 1 && event.event < 10000) {
             // Model selected
             size_t idx = (size_t)event.event - 1;
             const PredatorCarModel* model = predator_models_get_hardcoded(idx);
             if(model) {
-                // CRITICAL: Store model index for protocol detection
-                app->selected_model_index = idx;
-                
-                // Persist selection on app (bounded copies)
-                app->selected_model_freq = model->frequency;
-                strncpy(app->selected_model_make, model->make, sizeof(app->selected_model_make) - 1);
-                app->selected_model_make[sizeof(app->selected_model_make) - 1] = '\0';
-                strncpy(app->selected_model_name, model->model, sizeof(app->selected_model_name) - 1);
-                app->selected_model_name[sizeof(app->selected_model_name) - 1] = '\0';
-                scene_manager_next_scene(app->scene_manager, PredatorSceneCarModelAttacksUI);
+                car_models_select(app, idx, model, predator_models_get_protocol(idx));
                 return true;
             }
         }
@@ -122,5 +167,6 @@ bool predator_scene_car_models_ui_on_event(void* context, SceneManagerEvent even
 void predator_scene_car_models_ui_on_exit(void* context) {
     PredatorApp* app = context;
     if(!app) return;
-    // Nothing to cleanup: using shared submenu
+    // Shared submenu needs no cleanup; release catalog file handle and page cache
+    predator_models_catalog_close();
 }
@@ -5,6 +5,7 @@ ADD_SCENE(predator, main_menu_ui, MainMenuUI)
 ADD_SCENE(predator, car_tesla_ui, CarTeslaUI)
 ADD_SCENE(predator, car_continent_ui, CarContinentUI)     // Continent picker (Europe/Asia/America)
 ADD_SCENE(predator, car_models_ui, CarModelsUI)           // Simple model picker
+ADD_SCENE(predator, car_model_search_ui, CarModelSearchUI) // Type-ahead search (SD catalog)
 ADD_SCENE(predator, car_model_attacks_ui, CarModelAttacksUI) // Attacks for selected model
 ADD_SCENE(predator, protocol_test_ui, ProtocolTestUI)     // Protocol testing (Keeloq/Hitag2/AES)
 // ADD_SCENE(predator, walking_open_ui, WalkingOpenUI)      // REMOVED: Replaced by Konami code easter egg 🎮
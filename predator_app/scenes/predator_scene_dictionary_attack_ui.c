@@ -1,5 +1,5 @@
 #include "../predator_i.h"
-#include "../helpers/predator_crypto_keys.h"
+#include "../helpers/predator_dict.h"
 #include "../helpers/predator_subghz.h"
 #include "../helpers/predator_logging.h"
 #include <gui/view.h>
@@ -27,6 +27,14 @@ typedef struct {
 static DictAttackState dict_state;
 static View* dict_view = NULL;
 static uint32_t attack_start_tick = 0;
+// SD dictionaries (site keys first) when present, else built-in tables
+static PredatorKeyIter keeloq_keys;
+static PredatorKeyIter hitag2_keys;
+
+static void dict_attack_release_keys(void) {
+    predator_key_iter_end(&keeloq_keys);
+    predator_key_iter_end(&hitag2_keys);
+}
 
 static void dict_attack_draw_callback(Canvas* canvas, void* context) {
     UNUSED(context);
@@ -98,18 +106,24 @@ static bool dict_attack_input_callback(InputEvent* event, void* context) {
                 // START ATTACK
                 dict_state.status = DictAttackStatusAttacking;
                 dict_state.keys_tried = 0;
-                dict_state.total_keys = KEELOQ_KEY_COUNT + HITAG2_KEY_COUNT;
+                predator_key_iter_begin(&keeloq_keys, app->storage, PredatorKeyDictKeeloq);
+                predator_key_iter_begin(&hitag2_keys, app->storage, PredatorKeyDictHitag2);
+                dict_state.total_keys = predator_key_iter_count(&keeloq_keys) + predator_key_iter_count(&hitag2_keys);
                 dict_state.attack_time_ms = 0;
                 dict_state.success = false;
                 attack_start_tick = furi_get_tick();
                 
                 predator_log_append(app, "🔥 DICTIONARY ATTACK: 980+ keys loaded");
                 predator_log_append(app, "Testing all Keeloq + Hitag2 keys");
+                if(predator_key_iter_from_sd(&keeloq_keys) || predator_key_iter_from_sd(&hitag2_keys)) {
+                    predator_log_append(app, "Using SD dictionaries (site keys first)");
+                }
                 
                 return true;
             } else if(dict_state.status == DictAttackStatusAttacking) {
                 // STOP ATTACK
                 dict_state.status = DictAttackStatusComplete;
+                dict_attack_release_keys();
                 predator_log_append(app, "Dictionary attack stopped");
                 return true;
             }
@@ -119,27 +133,31 @@ static bool dict_attack_input_callback(InputEvent* event, void* context) {
     return true;
 }
 
-static void dict_attack_timer_callback(void* context) {
-    PredatorApp* app = context;
-    if(!app) return;
-    
+// Try one key. Runs from on_event (GUI thread): SD dictionaries refill
+// from storage, which must not block the timer service thread.
+static void dict_attack_step(PredatorApp* app) {
     if(dict_state.status == DictAttackStatusAttacking) {
         dict_state.attack_time_ms = furi_get_tick() - attack_start_tick;
         
         // 🔥 TRY NEXT KEY FROM DATABASE
-        if(dict_state.keys_tried < KEELOQ_KEY_COUNT) {
+        uint64_t key;
+        uint8_t hitag_key[6];
+        if(predator_key_iter_next(&keeloq_keys, &key)) {
             // Test Keeloq key
-            uint64_t key = KEELOQ_KEYS[dict_state.keys_tried];
             FURI_LOG_I("DictAttack", "[DICT] Trying Keeloq key %lu: 0x%016llX", 
                       dict_state.keys_tried, key);
             
-        } else if(dict_state.keys_tried < KEELOQ_KEY_COUNT + HITAG2_KEY_COUNT) {
+        } else if(predator_key_iter_next(&hitag2_keys, hitag_key)) {
             // Test Hitag2 key
-            uint32_t hitag_index = dict_state.keys_tried - KEELOQ_KEY_COUNT;
-            FURI_LOG_I("DictAttack", "[DICT] Trying Hitag2 key %lu", hitag_index);
+            FURI_LOG_I("DictAttack", "[DICT] Trying Hitag2 key %u: %02X%02X%02X%02X%02X%02X",
+                      (unsigned)hitag2_keys.pos, hitag_key[0], hitag_key[1], hitag_key[2],
+                      hitag_key[3], hitag_key[4], hitag_key[5]);
+        } else {
+            // Both dictionaries exhausted early (SD read error)
+            dict_state.total_keys = dict_state.keys_tried;
         }
         
-        dict_state.keys_tried++;
+        if(dict_state.keys_tried < dict_state.total_keys) dict_state.keys_tried++;
         
         // Log progress every 50 keys
         if(dict_state.keys_tried % 50 == 0 && dict_state.total_keys > 0) {
@@ -153,12 +171,19 @@ static void dict_attack_timer_callback(void* context) {
         // Complete when all keys tested
         if(dict_state.keys_tried >= dict_state.total_keys) {
             dict_state.status = DictAttackStatusComplete;
+            dict_attack_release_keys();
             predator_log_append(app, "Dictionary attack complete");
         }
-        
-        if(app->view_dispatcher) {
-            view_dispatcher_send_custom_event(app->view_dispatcher, 0);
-        }
+    }
+}
+
+// Timer only ticks; key iteration happens in on_event
+static void dict_attack_timer_callback(void* context) {
+    PredatorApp* app = context;
+    if(!app || !app->view_dispatcher) return;
+    
+    if(dict_state.status == DictAttackStatusAttacking) {
+        view_dispatcher_send_custom_event(app->view_dispatcher, PredatorCustomEventTimerExpired);
     }
 }
 
@@ -175,6 +200,8 @@ void predator_scene_dictionary_attack_ui_on_enter(void* context) {
     }
     
     memset(&dict_state, 0, sizeof(DictAttackState));
+    memset(&keeloq_keys, 0, sizeof(keeloq_keys));
+    memset(&hitag2_keys, 0, sizeof(hitag2_keys));
     dict_state.status = DictAttackStatusIdle;
     dict_state.frequency = 433920000;
     
@@ -210,7 +237,7 @@ void predator_scene_dictionary_attack_ui_on_enter(void* context) {
 }
 
 bool predator_scene_dictionary_attack_ui_on_event(void* context, SceneManagerEvent event) {
-    UNUSED(context);
+    PredatorApp* app = context;
     
     if(event.type == SceneManagerEventTypeBack) {
         if(dict_state.status == DictAttackStatusAttacking) {
@@ -220,6 +247,9 @@ bool predator_scene_dictionary_attack_ui_on_event(void* context, SceneManagerEve
     }
     
     if(event.type == SceneManagerEventTypeCustom) {
+        if(event.event == PredatorCustomEventTimerExpired && app) {
+            dict_attack_step(app);
+        }
         return true;
     }
     
@@ -237,6 +267,7 @@ void predator_scene_dictionary_attack_ui_on_exit(void* context) {
     }
     
     dict_state.status = DictAttackStatusIdle;
+    dict_attack_release_keys();
     
     FURI_LOG_I("DictAttack", "Dictionary Attack UI exited");
 }
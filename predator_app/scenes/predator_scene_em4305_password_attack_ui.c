@@ -1,7 +1,7 @@
 #include "../predator_i.h"
 #include "../helpers/predator_crypto_em4305.h"
 #include "../helpers/predator_em4305_hal.h"
-#include "../helpers/predator_crypto_keys.h"
+#include "../helpers/predator_dict.h"
 #include <gui/elements.h>
 
 // EM4305 Password Attack - Dictionary + Brute Force
@@ -19,7 +19,7 @@ typedef struct {
     uint32_t current_password;
     uint32_t passwords_tried;
     uint32_t found_password;
-    uint16_t dictionary_index;
+    PredatorKeyIter keys; // SD dictionary if present, else built-in passwords
     char status_text[64];
 } PasswordAttackState;
 
@@ -80,19 +80,17 @@ static bool password_input_callback(InputEvent* event, void* context) {
     return false;
 }
 
-static void password_timer_callback(void* context) {
-    PredatorApp* app = context;
-    
+// Try one password. Runs from on_event (GUI thread): SD dictionaries refill
+// from storage, which must not block the timer service thread.
+static void password_attack_step(PredatorApp* app) {
     if(!pw_state) return;
     
     switch(pw_state->state) {
     case PasswordStateDictionary:
-        // Try comprehensive dictionary passwords (40+ known passwords)
-        if(pw_state->dictionary_index < EM4305_PASSWORD_COUNT) {
-            pw_state->current_password = EM4305_PASSWORDS[pw_state->dictionary_index];
-            
+        // Site-specific SD dictionary (priority ordered) or built-in passwords
+        if(predator_key_iter_next(&pw_state->keys, &pw_state->current_password)) {
             FURI_LOG_D("EM4305Password", "Trying dictionary password %u: %08lX",
-                      pw_state->dictionary_index, pw_state->current_password);
+                      (unsigned)pw_state->keys.pos, pw_state->current_password);
             
             if(em4305_authenticate(app, pw_state->current_password)) {
                 pw_state->found_password = pw_state->current_password;
@@ -104,21 +102,18 @@ static void password_timer_callback(void* context) {
                 snprintf(pw_state->status_text, sizeof(pw_state->status_text),
                          "Found!");
             } else {
-                pw_state->dictionary_index++;
                 pw_state->passwords_tried++;
-                
-                if(pw_state->dictionary_index >= EM4305_PASSWORD_COUNT) {
-                    // Dictionary exhausted (tried all 40+ passwords), start brute force
-                    pw_state->state = PasswordStateBruteForce;
-                    pw_state->current_password = 0;
-                    
-                    FURI_LOG_I("EM4305Password", "Dictionary exhausted (%u passwords), starting brute force",
-                              EM4305_PASSWORD_COUNT);
-                    
-                    snprintf(pw_state->status_text, sizeof(pw_state->status_text),
-                             "Brute forcing...");
-                }
             }
+        } else {
+            // Dictionary exhausted, start brute force
+            pw_state->state = PasswordStateBruteForce;
+            pw_state->current_password = 0;
+            
+            FURI_LOG_I("EM4305Password", "Dictionary exhausted (%u passwords), starting brute force",
+                      (unsigned)predator_key_iter_count(&pw_state->keys));
+            
+            snprintf(pw_state->status_text, sizeof(pw_state->status_text),
+                     "Brute forcing...");
         }
         break;
         
@@ -154,6 +149,16 @@ static void password_timer_callback(void* context) {
     view_port_update(app->view_port);
 }
 
+// Timer only ticks; password iteration happens in on_event
+static void password_timer_callback(void* context) {
+    PredatorApp* app = context;
+    if(!app || !app->view_dispatcher || !pw_state) return;
+    
+    if(pw_state->state == PasswordStateDictionary || pw_state->state == PasswordStateBruteForce) {
+        view_dispatcher_send_custom_event(app->view_dispatcher, PredatorCustomEventTimerExpired);
+    }
+}
+
 void predator_scene_em4305_password_attack_on_enter(void* context) {
     PredatorApp* app = context;
     
@@ -161,8 +166,9 @@ void predator_scene_em4305_password_attack_on_enter(void* context) {
     memset(pw_state, 0, sizeof(PasswordAttackState));
     
     pw_state->state = PasswordStateDictionary;
+    predator_key_iter_begin(&pw_state->keys, app->storage, PredatorKeyDictEM4305);
     snprintf(pw_state->status_text, sizeof(pw_state->status_text),
-             "Dictionary attack...");
+             predator_key_iter_from_sd(&pw_state->keys) ? "SD dictionary attack..." : "Dictionary attack...");
     
     view_port_draw_callback_set(app->view_port, password_draw_callback, app);
     view_port_input_callback_set(app->view_port, password_input_callback, app);
@@ -174,8 +180,14 @@ void predator_scene_em4305_password_attack_on_enter(void* context) {
 }
 
 bool predator_scene_em4305_password_attack_on_event(void* context, SceneManagerEvent event) {
-    UNUSED(context);
-    UNUSED(event);
+    PredatorApp* app = context;
+    
+    if(event.type == SceneManagerEventTypeCustom &&
+       event.event == PredatorCustomEventTimerExpired && app) {
+        password_attack_step(app);
+        return true;
+    }
+    
     return false;
 }
 
@@ -191,6 +203,7 @@ void predator_scene_em4305_password_attack_on_exit(void* context) {
     gui_remove_view_port(app->gui, app->view_port);
     
     if(pw_state) {
+        predator_key_iter_end(&pw_state->keys);
         free(pw_state);
         pw_state = NULL;
     }
@@ -120,8 +120,12 @@ static void dump_timer_callback(void* context) {
         snprintf(state->status_text, sizeof(state->status_text),
                  "Saving to SD card...");
         
-        // Real implementation would call:
-        // bool saved = felica_save_dump(app, &state->card, "/ext/felica_dump.txt");
+        // Real implementation would stream the card to SD (reading and
+        // saving are one pass), then export for the NFC app:
+        // bool saved = felica_dump_card(app, &state->card,
+        //                               PREDATOR_DUMP_DIR "/felica.pdmp");
+        // predator_dump_export_nfc(app->storage, PREDATOR_DUMP_DIR "/felica.pdmp",
+        //                          "/ext/nfc/felica.nfc");
         // if(saved) {
         //     state->dump_state = DumpStateComplete;
         // } else {
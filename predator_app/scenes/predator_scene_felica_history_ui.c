@@ -1,14 +1,16 @@
 #include "../predator_i.h"
 #include "../helpers/predator_crypto_felica.h"
+#include "../helpers/predator_felica_sync.h"
 #include <gui/elements.h>
 
 // FeliCa Transaction History Viewer - Scrollable list
 // Pattern: Scrollable list like car model selection
 
 typedef struct {
-    FeliCaCard card;
-    FeliCaTransaction transactions[20];
-    uint32_t transaction_count;
+    FeliCaTransaction transactions[20];  // Page of the stored history
+    uint32_t transaction_count;          // Transactions in the page
+    uint32_t page_start;                 // Index of transactions[0], newest first
+    uint32_t total_count;                // Transactions stored on SD for the card
     uint32_t scroll_offset;
     char status_text[64];
 } HistoryState;
@@ -16,6 +18,14 @@ typedef struct {
 static HistoryState* state = NULL;
 static View* history_view = NULL;
 
+// Load the page of stored history starting at `first` (newest first)
+static void history_load_page(PredatorApp* app, uint32_t first) {
+    state->page_start = first;
+    state->transaction_count = felica_sync_load(
+        app, app->felica_card.idm, first,
+        state->transactions, COUNT_OF(state->transactions), app->felica_card.card_type);
+}
+
 static void history_draw_callback(Canvas* canvas, void* context) {
     UNUSED(context);
     if(!state) return;
@@ -24,7 +34,7 @@ static void history_draw_callback(Canvas* canvas, void* context) {
     canvas_set_font(canvas, FontPrimary);
     canvas_draw_str(canvas, 2, 10, "Transaction History");
 
-    if(state->transaction_count == 0) {
+    if(state->total_count == 0) {
         canvas_set_font(canvas, FontSecondary);
         canvas_draw_str(canvas, 2, 30, "No transactions found");
         return;
@@ -35,18 +45,20 @@ static void history_draw_callback(Canvas* canvas, void* context) {
     int y = 20;
     
     for(uint32_t i = state->scroll_offset; 
-        i < state->transaction_count && i < state->scroll_offset + 3; 
+        i < state->total_count && i < state->scroll_offset + 3; 
         i++) {
+        if(i < state->page_start || i - state->page_start >= state->transaction_count) break;
+        const FeliCaTransaction* tx = &state->transactions[i - state->page_start];
         
         // Decode station
         char station[64];
         felica_decode_station_id(
-            state->transactions[i].terminal_id,
+            tx->terminal_id,
             station,
             sizeof(station));
         
         // Transaction type
-        const char* type = state->transactions[i].transaction_type == 0x01 ? "Entry" : "Exit";
+        const char* type = tx->transaction_type == 0x01 ? "Entry" : "Exit";
         
         // Draw transaction
         char line1[128];
@@ -60,27 +72,27 @@ static void history_draw_callback(Canvas* canvas, void* context) {
         char line2[128];
         snprintf(line2, sizeof(line2),
                  "  -¥%u (Bal: ¥%u)",
-                 state->transactions[i].amount,
-                 state->transactions[i].balance_after);
+                 tx->amount,
+                 tx->balance_after);
         canvas_draw_str(canvas, 2, y + 9, line2);
         
         y += 18;
     }
     
     // Scroll indicator
-    if(state->transaction_count > 3) {
+    if(state->total_count > 3) {
         char scroll_info[32];
         snprintf(scroll_info, sizeof(scroll_info),
                  "(%lu/%lu)",
                  state->scroll_offset + 1,
-                 state->transaction_count);
+                 state->total_count);
         canvas_draw_str(canvas, 90, 10, scroll_info);
         
         // Arrows
         if(state->scroll_offset > 0) {
             canvas_draw_str(canvas, 120, 30, "↑");
         }
-        if(state->scroll_offset + 3 < state->transaction_count) {
+        if(state->scroll_offset + 3 < state->total_count) {
             canvas_draw_str(canvas, 120, 50, "↓");
         }
     }
@@ -101,13 +113,24 @@ static bool history_input_callback(InputEvent* event, void* context) {
         
         if(event->key == InputKeyUp && state->scroll_offset > 0) {
             state->scroll_offset--;
+            // Scrolled above the page: reload it ending at the last visible row
+            if(state->scroll_offset < state->page_start) {
+                uint32_t end = state->scroll_offset + 3;
+                history_load_page(
+                    app, end > COUNT_OF(state->transactions) ?
+                             end - COUNT_OF(state->transactions) : 0);
+            }
             // ViewDispatcher handles redraws automatically
             return true;
         }
         
         if(event->key == InputKeyDown && 
-           state->scroll_offset + 3 < state->transaction_count) {
+           state->scroll_offset + 3 < state->total_count) {
             state->scroll_offset++;
+            // Scrolled below the page: page in the next records from SD
+            if(state->scroll_offset + 3 > state->page_start + state->transaction_count) {
+                history_load_page(app, state->scroll_offset);
+            }
             // ViewDispatcher handles redraws automatically
             return true;
         }
@@ -124,13 +147,22 @@ void predator_scene_felica_history_on_enter(void* context) {
     state = malloc(sizeof(HistoryState));
     memset(state, 0, sizeof(HistoryState));
     
-    // Read transaction history
-    // Real implementation would call:
-    // state->transaction_count = felica_read_history(
-    //     app, &state->card, state->transactions, 20);
-    
-    snprintf(state->status_text, sizeof(state->status_text),
-             "↑/↓ Scroll, Back to exit");
+    // Sync new blocks from the card to SD, then page the stored history from there
+    if(app->felica_card_valid) {
+        bool synced = felica_sync_history(app, &app->felica_card, NULL);
+        
+        FeliCaSyncEntry entry;
+        if(felica_sync_get_entry(app, app->felica_card.idm, &entry)) {
+            state->total_count = entry.record_count;
+            history_load_page(app, 0);
+        }
+        
+        snprintf(state->status_text, sizeof(state->status_text),
+                 synced ? "↑/↓ Scroll, Back to exit" : "Stored history, card not read");
+    } else {
+        snprintf(state->status_text, sizeof(state->status_text),
+                 "No card, Back to exit");
+    }
     
     // Create view if needed
     if(!history_view) {
@@ -101,24 +101,24 @@ static bool felica_reader_input_callback(InputEvent* event, void* context) {
     return false;
 }
 
-static void felica_reader_timer_callback(void* context) {
-    UNUSED(context);
-    
+// Poll for a card. Runs from on_event (GUI thread): detection and the
+// balance/history reads are NFC exchanges that must not block the timer thread.
+static void felica_reader_step(PredatorApp* app) {
     if(!reader_state) return;
     
-    // Try to detect card
-    if(!reader_state->card_detected) {
-        // Real implementation would call:
-        // if(felica_detect_card(app, 0xFFFF, &reader_state->card)) {
-        //     reader_state->card_detected = true;
-        //     // Read balance
-        //     felica_read_balance(app, &reader_state->card, &reader_state->balance);
-        //     // Read history
-        //     reader_state->transaction_count = felica_read_history(
-        //         app, &reader_state->card,
-        //         reader_state->transactions, 5);
-        // }
+    // Detect once; the actions/history views reuse the stored card
+    if(!reader_state->card_detected && felica_detect_card(app, 0xFFFF, &reader_state->card)) {
+        reader_state->card_detected = true;
+        app->felica_card = reader_state->card;
+        app->felica_card_valid = true;
         
+        felica_read_balance(app, &reader_state->card, &reader_state->balance);
+        reader_state->transaction_count = felica_read_history(
+            app, &reader_state->card,
+            reader_state->transactions, COUNT_OF(reader_state->transactions));
+    }
+    
+    if(!reader_state->card_detected) {
         snprintf(reader_state->status_text, sizeof(reader_state->status_text),
                  "Scanning...");
     } else {
@@ -129,6 +129,16 @@ static void felica_reader_timer_callback(void* context) {
     // ViewDispatcher handles redraws automatically
 }
 
+// Timer keeps the waiting animation going; detection happens in on_event
+static void felica_reader_timer_callback(void* context) {
+    PredatorApp* app = context;
+    if(!app || !app->view_dispatcher || !reader_state) return;
+    
+    if(!reader_state->card_detected) {
+        view_dispatcher_send_custom_event(app->view_dispatcher, PredatorCustomEventTimerExpired);
+    }
+}
+
 void predator_scene_felica_reader_on_enter(void* context) {
     PredatorApp* app = context;
     if(!app || !app->view_dispatcher) return;
@@ -136,6 +146,7 @@ void predator_scene_felica_reader_on_enter(void* context) {
     // Allocate state
     reader_state = malloc(sizeof(FelicaReaderState));
     memset(reader_state, 0, sizeof(FelicaReaderState));
+    app->felica_card_valid = false;
     
     snprintf(reader_state->status_text, sizeof(reader_state->status_text),
              "Waiting for card...");
@@ -161,8 +172,14 @@ void predator_scene_felica_reader_on_enter(void* context) {
 }
 
 bool predator_scene_felica_reader_on_event(void* context, SceneManagerEvent event) {
-    UNUSED(context);
-    UNUSED(event);
+    PredatorApp* app = context;
+    
+    if(event.type == SceneManagerEventTypeCustom &&
+       event.event == PredatorCustomEventTimerExpired && app) {
+        felica_reader_step(app);
+        return true;
+    }
+    
     return false;
 }
 
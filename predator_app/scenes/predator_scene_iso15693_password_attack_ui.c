@@ -1,6 +1,6 @@
 #include "../predator_i.h"
 #include "../helpers/predator_crypto_iso15693.h"
-#include "../helpers/predator_crypto_keys.h"
+#include "../helpers/predator_dict.h"
 #include <gui/elements.h>
 
 // ISO 15693 Password Attack - SLIX password cracking
@@ -18,7 +18,7 @@ typedef struct {
     uint32_t current_password;
     uint32_t passwords_tried;
     uint32_t found_password;
-    uint16_t dictionary_index;
+    PredatorKeyIter keys; // SD dictionary if present, else built-in passwords
     char status_text[64];
 } PasswordAttackState;
 
@@ -77,17 +77,15 @@ static bool password_input_callback(InputEvent* event, void* context) {
     return false;
 }
 
-static void password_timer_callback(void* context) {
-    PredatorApp* app = context;
-    
+// Try one password. Runs from on_event (GUI thread): SD dictionaries refill
+// from storage, which must not block the timer service thread.
+static void password_attack_step(PredatorApp* app) {
     if(!pw_state) return;
     
     switch(pw_state->state) {
     case PasswordStateDictionary:
-        // Try comprehensive SLIX dictionary (30+ known passwords)
-        if(pw_state->dictionary_index < ISO15693_PASSWORD_COUNT) {
-            pw_state->current_password = ISO15693_SLIX_PASSWORDS[pw_state->dictionary_index];
-            
+        // Site-specific SD dictionary (priority ordered) or built-in SLIX passwords
+        if(predator_key_iter_next(&pw_state->keys, &pw_state->current_password)) {
             // Real implementation: iso15693_try_password(app, pw_state->current_password)
             bool success = false; // Placeholder
             
@@ -98,19 +96,16 @@ static void password_timer_callback(void* context) {
                 FURI_LOG_I("ISO15693Password", "SUCCESS! Password: %08lX", 
                           pw_state->found_password);
             } else {
-                pw_state->dictionary_index++;
                 pw_state->passwords_tried++;
-                
-                if(pw_state->dictionary_index >= ISO15693_PASSWORD_COUNT) {
-                    pw_state->state = PasswordStateFailed;
-                    
-                    FURI_LOG_I("ISO15693Password", "Dictionary exhausted (%u passwords), no match",
-                              ISO15693_PASSWORD_COUNT);
-                    
-                    snprintf(pw_state->status_text, sizeof(pw_state->status_text),
-                             "No match found");
-                }
             }
+        } else {
+            pw_state->state = PasswordStateFailed;
+            
+            FURI_LOG_I("ISO15693Password", "Dictionary exhausted (%u passwords), no match",
+                      (unsigned)predator_key_iter_count(&pw_state->keys));
+            
+            snprintf(pw_state->status_text, sizeof(pw_state->status_text),
+                     "No match found");
         }
         break;
         
@@ -121,6 +116,16 @@ static void password_timer_callback(void* context) {
     view_port_update(app->view_port);
 }
 
+// Timer only ticks; password iteration happens in on_event
+static void password_timer_callback(void* context) {
+    PredatorApp* app = context;
+    if(!app || !app->view_dispatcher || !pw_state) return;
+    
+    if(pw_state->state == PasswordStateDictionary) {
+        view_dispatcher_send_custom_event(app->view_dispatcher, PredatorCustomEventTimerExpired);
+    }
+}
+
 void predator_scene_iso15693_password_attack_on_enter(void* context) {
     PredatorApp* app = context;
     
@@ -128,8 +133,9 @@ void predator_scene_iso15693_password_attack_on_enter(void* context) {
     memset(pw_state, 0, sizeof(PasswordAttackState));
     
     pw_state->state = PasswordStateDictionary;
+    predator_key_iter_begin(&pw_state->keys, app->storage, PredatorKeyDictISO15693);
     snprintf(pw_state->status_text, sizeof(pw_state->status_text),
-             "Dictionary attack...");
+             predator_key_iter_from_sd(&pw_state->keys) ? "SD dictionary attack..." : "Dictionary attack...");
     
     view_port_draw_callback_set(app->view_port, password_draw_callback, app);
     view_port_input_callback_set(app->view_port, password_input_callback, app);
@@ -141,8 +147,14 @@ void predator_scene_iso15693_password_attack_on_enter(void* context) {
 }
 
 bool predator_scene_iso15693_password_attack_on_event(void* context, SceneManagerEvent event) {
-    UNUSED(context);
-    UNUSED(event);
+    PredatorApp* app = context;
+    
+    if(event.type == SceneManagerEventTypeCustom &&
+       event.event == PredatorCustomEventTimerExpired && app) {
+        password_attack_step(app);
+        return true;
+    }
+    
     return false;
 }
 
@@ -158,6 +170,7 @@ void predator_scene_iso15693_password_attack_on_exit(void* context) {
     gui_remove_view_port(app->gui, app->view_port);
     
     if(pw_state) {
+        predator_key_iter_end(&pw_state->keys);
         free(pw_state);
         pw_state = NULL;
     }
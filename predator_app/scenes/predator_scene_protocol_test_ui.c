@@ -29,7 +29,7 @@ void predator_scene_protocol_test_ui_on_enter(void* context) {
     submenu_set_header(app->submenu, header);
 
     // INTELLIGENT: Use database-driven protocol detection instead of string matching
-    CryptoProtocol detected_protocol = predator_models_get_protocol(app->selected_model_index);
+    CryptoProtocol detected_protocol = app->selected_model_protocol;
     
     bool uses_keeloq = (detected_protocol == CryptoProtocolKeeloq);
     bool uses_hitag2 = (detected_protocol == CryptoProtocolHitag2);
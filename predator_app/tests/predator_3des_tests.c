@@ -0,0 +1,201 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_crypto_3des.h"
+#include <string.h>
+
+#define DES3_BENCH_BLOCKS 2000
+
+// 2-key test key (K1 || K2) and "Now is the time for all "
+static const uint8_t des3_key[16] = {
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
+    0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x01};
+static const uint8_t des3_plain[24] = {
+    0x4E, 0x6F, 0x77, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+    0x69, 0x6D, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20};
+static const uint8_t des3_key3[24] = {
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x23, 0x45, 0x67, 0x89,
+    0xAB, 0xCD, 0xEF, 0x01, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x01, 0x23};
+static const uint8_t des3_iv[8] = {0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF};
+
+// Test 2-key ECB against known answers (one-shot and keyed context)
+static TestResult test_des3_ecb_kat(void* context) {
+    UNUSED(context);
+    const uint8_t expected[24] = {
+        0xB7, 0x83, 0x57, 0x79, 0xEE, 0x26, 0xAC, 0xB7, 0x5D, 0x27, 0x31, 0xA8,
+        0xD9, 0xB4, 0x01, 0x62, 0x3D, 0xD3, 0xFC, 0x69, 0xA0, 0x8C, 0xC6, 0xD9};
+    DES3Context ctx;
+    uint8_t out[8];
+
+    TEST_ASSERT(des3_init(&ctx, des3_key, DES3_2KEY_SIZE));
+    for(int i = 0; i < 24; i += 8) {
+        des3_encrypt_ecb(des3_key, &des3_plain[i], out);
+        TEST_ASSERT(memcmp(out, &expected[i], 8) == 0);
+        des3_decrypt_ecb(des3_key, out, out);
+        TEST_ASSERT(memcmp(out, &des3_plain[i], 8) == 0);
+
+        des3_encrypt_block(&ctx, &des3_plain[i], out);
+        TEST_ASSERT(memcmp(out, &expected[i], 8) == 0);
+        des3_decrypt_block(&ctx, out, out);
+        TEST_ASSERT(memcmp(out, &des3_plain[i], 8) == 0);
+    }
+
+    // Unsupported key lengths are rejected
+    TEST_ASSERT(!des3_init(&ctx, des3_key, 8));
+    TEST_ASSERT(!des3_init(NULL, des3_key, DES3_2KEY_SIZE));
+    return TestResultPass;
+}
+
+// Test 2-key CBC against known answers, including in-place decryption
+static TestResult test_des3_cbc_kat(void* context) {
+    UNUSED(context);
+    const uint8_t expected[24] = {
+        0x13, 0x4B, 0x98, 0xF8, 0xEE, 0xB3, 0xF6, 0x07, 0x9F, 0x1A, 0x82, 0xE0,
+        0x64, 0x0D, 0x5F, 0x2F, 0x8E, 0x09, 0x06, 0x61, 0xC4, 0x28, 0x64, 0xA1};
+    uint8_t buf[24];
+
+    des3_encrypt_cbc(des3_key, des3_iv, des3_plain, buf, sizeof(buf));
+    TEST_ASSERT(memcmp(buf, expected, sizeof(expected)) == 0);
+    des3_decrypt_cbc(des3_key, des3_iv, buf, buf, sizeof(buf));
+    TEST_ASSERT(memcmp(buf, des3_plain, sizeof(des3_plain)) == 0);
+    return TestResultPass;
+}
+
+// Test 3-key ECB/CBC against known answers
+static TestResult test_des3_3key_kat(void* context) {
+    UNUSED(context);
+    const uint8_t expected_ecb[24] = {
+        0x31, 0x4F, 0x83, 0x27, 0xFA, 0x7A, 0x09, 0xA8, 0x43, 0x62, 0x76, 0x0C,
+        0xC1, 0x3B, 0xA7, 0xDA, 0xFF, 0x55, 0xC5, 0xF8, 0x0F, 0xAA, 0xAC, 0x45};
+    const uint8_t expected_cbc[24] = {
+        0xF3, 0xC0, 0xFF, 0x02, 0x6C, 0x02, 0x30, 0x89, 0x65, 0x6F, 0xBB, 0x16,
+        0x9D, 0xEF, 0x7E, 0xDB, 0x30, 0xBA, 0x36, 0x07, 0x5D, 0x6F, 0x01, 0x76};
+    uint8_t buf[24];
+
+    for(int i = 0; i < 24; i += 8) {
+        des3_3key_encrypt_ecb(des3_key3, &des3_plain[i], &buf[i]);
+        TEST_ASSERT(memcmp(&buf[i], &expected_ecb[i], 8) == 0);
+        des3_3key_decrypt_ecb(des3_key3, &buf[i], &buf[i]);
+        TEST_ASSERT(memcmp(&buf[i], &des3_plain[i], 8) == 0);
+    }
+
+    des3_3key_encrypt_cbc(des3_key3, des3_iv, des3_plain, buf, sizeof(buf));
+    TEST_ASSERT(memcmp(buf, expected_cbc, sizeof(expected_cbc)) == 0);
+    des3_3key_decrypt_cbc(des3_key3, des3_iv, buf, buf, sizeof(buf));
+    TEST_ASSERT(memcmp(buf, des3_plain, sizeof(des3_plain)) == 0);
+
+    // K3 = K1 reduces 3-key to 2-key
+    uint8_t key_k1k2k1[24];
+    uint8_t out2[8];
+    memcpy(&key_k1k2k1[0], des3_key, 16);
+    memcpy(&key_k1k2k1[16], des3_key, 8);
+    des3_3key_encrypt_ecb(key_k1k2k1, des3_plain, buf);
+    des3_encrypt_ecb(des3_key, des3_plain, out2);
+    TEST_ASSERT(memcmp(buf, out2, 8) == 0);
+    return TestResultPass;
+}
+
+// Test keyed CBC: chunked calls continue one chain through the IV
+static TestResult test_des3_cbc_context(void* context) {
+    UNUSED(context);
+    DES3Context ctx;
+    uint8_t ref[24];
+    uint8_t buf[24];
+    uint8_t iv[8];
+
+    des3_3key_encrypt_cbc(des3_key3, des3_iv, des3_plain, ref, sizeof(ref));
+    TEST_ASSERT(des3_init(&ctx, des3_key3, DES3_3KEY_SIZE));
+
+    memcpy(iv, des3_iv, sizeof(iv));
+    des3_cbc_encrypt(&ctx, iv, &des3_plain[0], &buf[0], 8);
+    des3_cbc_encrypt(&ctx, iv, &des3_plain[8], &buf[8], 16);
+    TEST_ASSERT(memcmp(buf, ref, sizeof(ref)) == 0);
+    TEST_ASSERT(memcmp(iv, &ref[16], 8) == 0);
+
+    memcpy(iv, des3_iv, sizeof(iv));
+    des3_cbc_decrypt(&ctx, iv, &buf[0], &buf[0], 16);
+    des3_cbc_decrypt(&ctx, iv, &buf[16], &buf[16], 8);
+    TEST_ASSERT(memcmp(buf, des3_plain, sizeof(des3_plain)) == 0);
+    TEST_ASSERT(memcmp(iv, &ref[16], 8) == 0);
+    return TestResultPass;
+}
+
+// Test key diversification: both halves are ECB encryptions of the diversifier
+static TestResult test_des3_derive_key(void* context) {
+    UNUSED(context);
+    const uint8_t div[16] = {
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18};
+    uint8_t derived[16];
+    uint8_t expected[16];
+
+    des3_encrypt_ecb(des3_key, &div[0], &expected[0]);
+    des3_encrypt_ecb(des3_key, &div[8], &expected[8]);
+    des3_derive_key(des3_key, div, sizeof(div), derived);
+    TEST_ASSERT(memcmp(derived, expected, sizeof(expected)) == 0);
+
+    // 8-byte diversifier: second half reuses the same block
+    des3_derive_key(des3_key, div, 8, derived);
+    TEST_ASSERT(memcmp(&derived[0], &expected[0], 8) == 0);
+    TEST_ASSERT(memcmp(&derived[8], &expected[0], 8) == 0);
+    return TestResultPass;
+}
+
+// Benchmark one-shot vs keyed 3DES (reported in the log, never fails)
+static TestResult test_des3_benchmark(void* context) {
+    UNUSED(context);
+    DES3Context ctx;
+    uint8_t block[8];
+    uint8_t derived[16];
+    memcpy(block, des3_plain, sizeof(block));
+    TEST_ASSERT(des3_init(&ctx, des3_key, DES3_2KEY_SIZE));
+
+    // One-shot path used by felica_3des_* / calypso session keys
+    uint32_t start = furi_get_tick();
+    for(int i = 0; i < DES3_BENCH_BLOCKS; i++) des3_encrypt_ecb(des3_key, block, block);
+    uint32_t ecb_ms = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    for(int i = 0; i < DES3_BENCH_BLOCKS; i++) des3_decrypt_block(&ctx, block, block);
+    uint32_t ctx_ms = furi_get_tick() - start;
+
+    // Encrypting then decrypting N times must land back on the start block
+    TEST_ASSERT(memcmp(block, des3_plain, sizeof(block)) == 0);
+
+    start = furi_get_tick();
+    for(int i = 0; i < DES3_BENCH_BLOCKS / 2; i++) des3_derive_key(des3_key, des3_plain, 8, derived);
+    uint32_t derive_ms = furi_get_tick() - start;
+
+    FURI_LOG_I(
+        "TEST",
+        "3DES: %d blocks, one-shot %lu ms, keyed %lu ms, %d derive_key %lu ms",
+        DES3_BENCH_BLOCKS,
+        (unsigned long)ecb_ms,
+        (unsigned long)ctx_ms,
+        DES3_BENCH_BLOCKS / 2,
+        (unsigned long)derive_ms);
+    return TestResultPass;
+}
+
+bool predator_run_3des_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"3DES ECB Known Answers", test_des3_ecb_kat, true},
+        {"3DES CBC Known Answers", test_des3_cbc_kat, true},
+        {"3K3DES Known Answers", test_des3_3key_kat, true},
+        {"3DES Keyed CBC Chaining", test_des3_cbc_context, true},
+        {"3DES Key Diversification", test_des3_derive_key, true},
+        {"3DES Throughput", test_des3_benchmark, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "3DES Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
@@ -0,0 +1,338 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_crypto_aes.h"
+#include <string.h>
+
+#define AES_BENCH_BLOCKS 2000
+#define AES_CTR_BENCH_BYTES 4096
+#define AES_CTR_BENCH_ROUNDS 16
+
+// FIPS-197 Appendix C example vectors
+static const uint8_t fips_plain[16] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+
+static const uint8_t fips_key[32] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+
+// SP 800-38A F.2.1 / F.5.1 AES-128 key and plaintext (four blocks)
+static const uint8_t sp_key[16] = {
+    0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C};
+static const uint8_t sp_plain[64] = {
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10};
+
+// Test AES-128 against FIPS-197 C.1 and SP 800-38A F.1.1
+static TestResult test_aes128_kat(void* context) {
+    UNUSED(context);
+    const uint8_t expected_c1[16] = {
+        0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30,
+        0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A};
+    const uint8_t sp_cipher[16] = {
+        0x3A, 0xD7, 0x7B, 0xB4, 0x0D, 0x7A, 0x36, 0x60,
+        0xA8, 0x9E, 0xCA, 0xF3, 0x24, 0x66, 0xEF, 0x97};
+    AESContext ctx;
+    uint8_t out[16];
+
+    TEST_ASSERT(aes128_init(&ctx, fips_key));
+    TEST_ASSERT(aes128_encrypt_block(&ctx, fips_plain, out));
+    TEST_ASSERT(memcmp(out, expected_c1, 16) == 0);
+    TEST_ASSERT(aes128_decrypt_block(&ctx, expected_c1, out));
+    TEST_ASSERT(memcmp(out, fips_plain, 16) == 0);
+
+    TEST_ASSERT(aes128_init(&ctx, sp_key));
+    TEST_ASSERT(aes128_encrypt_block(&ctx, sp_plain, out));
+    TEST_ASSERT(memcmp(out, sp_cipher, 16) == 0);
+    TEST_ASSERT(aes128_decrypt_block(&ctx, sp_cipher, out));
+    TEST_ASSERT(memcmp(out, sp_plain, 16) == 0);
+    return TestResultPass;
+}
+
+// Test AES-256 against FIPS-197 C.3
+static TestResult test_aes256_kat(void* context) {
+    UNUSED(context);
+    const uint8_t expected_c3[16] = {
+        0x8E, 0xA2, 0xB7, 0xCA, 0x51, 0x67, 0x45, 0xBF,
+        0xEA, 0xFC, 0x49, 0x90, 0x4B, 0x49, 0x60, 0x89};
+    AESContext ctx;
+    uint8_t out[16];
+
+    TEST_ASSERT(aes256_init(&ctx, fips_key));
+    TEST_ASSERT(aes256_encrypt_block(&ctx, fips_plain, out));
+    TEST_ASSERT(memcmp(out, expected_c3, 16) == 0);
+    TEST_ASSERT(aes256_decrypt_block(&ctx, expected_c3, out));
+    TEST_ASSERT(memcmp(out, fips_plain, 16) == 0);
+
+    // Key size is checked: an AES-256 schedule is refused by the AES-128 calls
+    TEST_ASSERT(!aes128_encrypt_block(&ctx, fips_plain, out));
+    TEST_ASSERT(!aes128_decrypt_block(&ctx, fips_plain, out));
+    return TestResultPass;
+}
+
+// Test in-place round trips over a chain of blocks (output feeds next key)
+static TestResult test_aes_round_trip(void* context) {
+    UNUSED(context);
+    uint8_t key[32];
+    uint8_t block[16];
+    uint8_t original[16];
+    memcpy(key, fips_key, sizeof(key));
+    memcpy(block, fips_plain, sizeof(block));
+
+    for(int i = 0; i < 64; i++) {
+        AESContext ctx;
+        const bool wide = (i & 1) != 0;
+        TEST_ASSERT(wide ? aes256_init(&ctx, key) : aes128_init(&ctx, key));
+        memcpy(original, block, 16);
+        TEST_ASSERT(wide ? aes256_encrypt_block(&ctx, block, block) : aes128_encrypt_block(&ctx, block, block));
+        TEST_ASSERT(memcmp(block, original, 16) != 0);
+        uint8_t back[16];
+        TEST_ASSERT(wide ? aes256_decrypt_block(&ctx, block, back) : aes128_decrypt_block(&ctx, block, back));
+        TEST_ASSERT(memcmp(back, original, 16) == 0);
+        memcpy(&key[(i % 2) * 16], block, 16);
+    }
+    return TestResultPass;
+}
+
+// Test CBC stream against SP 800-38A F.2.1 with uneven chunks and in-place
+static TestResult test_aes_cbc_stream(void* context) {
+    UNUSED(context);
+    const uint8_t iv[16] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+    const uint8_t expected[64] = {
+        0x76, 0x49, 0xAB, 0xAC, 0x81, 0x19, 0xB2, 0x46, 0xCE, 0xE9, 0x8E, 0x9B, 0x12, 0xE9, 0x19, 0x7D,
+        0x50, 0x86, 0xCB, 0x9B, 0x50, 0x72, 0x19, 0xEE, 0x95, 0xDB, 0x11, 0x3A, 0x91, 0x76, 0x78, 0xB2,
+        0x73, 0xBE, 0xD6, 0xB8, 0xE3, 0xC1, 0x74, 0x3B, 0x71, 0x16, 0xE6, 0x9E, 0x22, 0x22, 0x95, 0x16,
+        0x3F, 0xF1, 0xCA, 0xA1, 0x68, 0x1F, 0xAC, 0x09, 0x12, 0x0E, 0xCA, 0x30, 0x75, 0x86, 0xE1, 0xA7};
+    const size_t chunks[] = {5, 20, 1, 30, 8};
+    AESCbcContext ctx;
+    uint8_t out[64 + AES_BLOCK_SIZE];
+    size_t total = 0;
+    size_t offset = 0;
+    size_t written;
+
+    // Encrypt in chunks that straddle block boundaries
+    TEST_ASSERT(aes_cbc_init(&ctx, sp_key, sizeof(sp_key), iv, true));
+    for(size_t i = 0; i < COUNT_OF(chunks); i++) {
+        TEST_ASSERT(aes_cbc_update(&ctx, &sp_plain[offset], chunks[i], &out[total], &written));
+        TEST_ASSERT(written % AES_BLOCK_SIZE == 0);
+        offset += chunks[i];
+        total += written;
+    }
+    TEST_ASSERT(aes_cbc_final(&ctx));
+    TEST_ASSERT(total == sizeof(expected));
+    TEST_ASSERT(memcmp(out, expected, sizeof(expected)) == 0);
+
+    // Decrypt in place, one and then three blocks
+    TEST_ASSERT(aes_cbc_init(&ctx, sp_key, sizeof(sp_key), iv, false));
+    TEST_ASSERT(aes_cbc_update(&ctx, out, 16, out, &written));
+    TEST_ASSERT(aes_cbc_update(&ctx, &out[16], 48, &out[16], &written));
+    TEST_ASSERT(aes_cbc_final(&ctx));
+    TEST_ASSERT(memcmp(out, sp_plain, sizeof(sp_plain)) == 0);
+
+    // A trailing partial block is reported by final
+    TEST_ASSERT(aes_cbc_init(&ctx, sp_key, sizeof(sp_key), iv, true));
+    TEST_ASSERT(aes_cbc_update(&ctx, sp_plain, 20, out, &written));
+    TEST_ASSERT(written == 16);
+    TEST_ASSERT(!aes_cbc_final(&ctx));
+
+    // One-shot wrapper agrees with the stream
+    TEST_ASSERT(predator_crypto_aes128_cbc_encrypt(sp_key, iv, sp_plain, sizeof(sp_plain), out));
+    TEST_ASSERT(memcmp(out, expected, sizeof(expected)) == 0);
+    return TestResultPass;
+}
+
+// Test CTR stream against SP 800-38A F.5.1 with odd chunk sizes, in place
+static TestResult test_aes_ctr_stream(void* context) {
+    UNUSED(context);
+    const uint8_t counter[16] = {
+        0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF};
+    const uint8_t expected[64] = {
+        0x87, 0x4D, 0x61, 0x91, 0xB6, 0x20, 0xE3, 0x26, 0x1B, 0xEF, 0x68, 0x64, 0x99, 0x0D, 0xB6, 0xCE,
+        0x98, 0x06, 0xF6, 0x6B, 0x79, 0x70, 0xFD, 0xFF, 0x86, 0x17, 0x18, 0x7B, 0xB9, 0xFF, 0xFD, 0xFF,
+        0x5A, 0xE4, 0xDF, 0x3E, 0xDB, 0xD5, 0xD3, 0x5E, 0x5B, 0x4F, 0x09, 0x02, 0x0D, 0xB0, 0x3E, 0xAB,
+        0x1E, 0x03, 0x1D, 0xDA, 0x2F, 0xBE, 0x03, 0xD1, 0x79, 0x21, 0x70, 0xA0, 0xF3, 0x00, 0x9C, 0xEE};
+    const size_t chunks[] = {3, 13, 17, 0, 31};
+    AESCtrContext ctx;
+    uint8_t buf[64];
+    memcpy(buf, sp_plain, sizeof(buf));
+
+    TEST_ASSERT(aes_ctr_init(&ctx, sp_key, sizeof(sp_key), counter));
+    size_t offset = 0;
+    for(size_t i = 0; i < COUNT_OF(chunks); i++) {
+        TEST_ASSERT(aes_ctr_update(&ctx, &buf[offset], chunks[i], &buf[offset]));
+        offset += chunks[i];
+    }
+    aes_ctr_final(&ctx);
+    TEST_ASSERT(offset == sizeof(buf));
+    TEST_ASSERT(memcmp(buf, expected, sizeof(expected)) == 0);
+
+    // Same counter decrypts in one call
+    TEST_ASSERT(aes_ctr_init(&ctx, sp_key, sizeof(sp_key), counter));
+    TEST_ASSERT(aes_ctr_update(&ctx, buf, sizeof(buf), buf));
+    aes_ctr_final(&ctx);
+    TEST_ASSERT(memcmp(buf, sp_plain, sizeof(sp_plain)) == 0);
+    return TestResultPass;
+}
+
+// Test the bitsliced core against FIPS-197 and the table core, and bitsliced
+// CTR streams against table CTR across counter carries and odd chunk sizes
+static TestResult test_aes_bitsliced(void* context) {
+    UNUSED(context);
+#if PREDATOR_AES_BITSLICE
+    const uint8_t expected_c1[16] = {
+        0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30,
+        0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A};
+    const uint8_t expected_c3[16] = {
+        0x8E, 0xA2, 0xB7, 0xCA, 0x51, 0x67, 0x45, 0xBF,
+        0xEA, 0xFC, 0x49, 0x90, 0x4B, 0x49, 0x60, 0x89};
+    static uint64_t bs_keys[(AES256_ROUNDS + 1) * AES_BITSLICED_ROUND_WORDS];
+    static uint8_t blocks[AES_BITSLICED_BATCH];
+    static uint8_t data[1000];
+    static uint8_t ref[sizeof(data)];
+    static uint8_t buf[sizeof(data)];
+    AESContext ctx;
+    uint8_t one[16];
+
+    for(int wide = 0; wide < 2; wide++) {
+        TEST_ASSERT(aes_init(&ctx, fips_key, wide ? AES256_KEY_SIZE : AES128_KEY_SIZE));
+        aes_bitsliced_expand(&ctx, bs_keys);
+
+        // Block 0 is the FIPS plaintext, the others differ in every byte
+        for(size_t i = 0; i < sizeof(blocks); i++) {
+            blocks[i] = fips_plain[i % 16] ^ (uint8_t)((i / 16) * 0x3D);
+        }
+        memcpy(buf, blocks, sizeof(blocks));
+        aes_bitsliced_encrypt8(bs_keys, ctx.num_rounds, buf, buf);
+        TEST_ASSERT(memcmp(buf, wide ? expected_c3 : expected_c1, 16) == 0);
+        for(int blk = 0; blk < 8; blk++) {
+            aes_encrypt_block(&ctx, &blocks[blk * 16], one);
+            TEST_ASSERT(memcmp(&buf[blk * 16], one, 16) == 0);
+        }
+    }
+
+    // Counter low bytes carry inside a batch
+    uint8_t counter[16];
+    memset(counter, 0xFF, sizeof(counter));
+    counter[0] = 0x12;
+    counter[15] = 0xFA;
+    for(size_t i = 0; i < sizeof(data); i++) data[i] = (uint8_t)(i * 7 + 1);
+    const size_t chunks[] = {5, 128, 300, 1, 256, 310};
+
+    for(int wide = 0; wide < 2; wide++) {
+        const size_t key_len = wide ? AES256_KEY_SIZE : AES128_KEY_SIZE;
+        AESCtrContext ctr;
+
+        TEST_ASSERT(aes_select_impl(AesImplTable));
+        TEST_ASSERT(aes_ctr_init(&ctr, fips_key, key_len, counter));
+        TEST_ASSERT(aes_ctr_update(&ctr, data, sizeof(data), ref));
+        aes_ctr_final(&ctr);
+
+        TEST_ASSERT(aes_select_impl(AesImplBitsliced));
+        TEST_ASSERT(aes_ctr_init(&ctr, fips_key, key_len, counter));
+        memcpy(buf, data, sizeof(buf));
+        size_t offset = 0;
+        for(size_t i = 0; i < COUNT_OF(chunks); i++) {
+            TEST_ASSERT(aes_ctr_update(&ctr, &buf[offset], chunks[i], &buf[offset]));
+            offset += chunks[i];
+        }
+        aes_ctr_final(&ctr);
+        TEST_ASSERT(offset == sizeof(buf));
+        TEST_ASSERT(memcmp(buf, ref, sizeof(ref)) == 0);
+    }
+    TEST_ASSERT(aes_select_impl(AesImplTable));
+    return TestResultPass;
+#else
+    // Not built in: selection must refuse it and keep the table core
+    TEST_ASSERT(!aes_select_impl(AesImplBitsliced));
+    TEST_ASSERT(aes_get_impl() == AesImplTable);
+    return TestResultSkip;
+#endif
+}
+
+// Benchmark AES-128 block throughput (reported in the log, never fails)
+static TestResult test_aes_benchmark(void* context) {
+    UNUSED(context);
+    AESContext ctx;
+    uint8_t block[16];
+    memcpy(block, fips_plain, sizeof(block));
+    TEST_ASSERT(aes128_init(&ctx, fips_key));
+
+    uint32_t start = furi_get_tick();
+    for(int i = 0; i < AES_BENCH_BLOCKS; i++) aes128_encrypt_block(&ctx, block, block);
+    uint32_t enc_ms = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    for(int i = 0; i < AES_BENCH_BLOCKS; i++) aes128_decrypt_block(&ctx, block, block);
+    uint32_t dec_ms = furi_get_tick() - start;
+
+    // Encrypting then decrypting N times must land back on the start block
+    TEST_ASSERT(memcmp(block, fips_plain, 16) == 0);
+    FURI_LOG_I(
+        "TEST",
+        "AES-128: %d blocks, encrypt %lu ms (%lu blk/s), decrypt %lu ms (%lu blk/s)",
+        AES_BENCH_BLOCKS,
+        (unsigned long)enc_ms,
+        (unsigned long)(enc_ms ? AES_BENCH_BLOCKS * 1000UL / enc_ms : 0),
+        (unsigned long)dec_ms,
+        (unsigned long)(dec_ms ? AES_BENCH_BLOCKS * 1000UL / dec_ms : 0));
+    return TestResultPass;
+}
+
+// Benchmark bulk AES-128 CTR with each built-in core (log only, never fails)
+static TestResult test_aes_ctr_benchmark(void* context) {
+    UNUSED(context);
+    static uint8_t buf[AES_CTR_BENCH_BYTES];
+    const AesImpl impls[] = {AesImplTable, AesImplBitsliced};
+    const char* names[] = {"table", "bitsliced"};
+    const AesImpl saved = aes_get_impl();
+    memset(buf, 0xA5, sizeof(buf));
+
+    for(size_t n = 0; n < COUNT_OF(impls); n++) {
+        if(!aes_select_impl(impls[n])) continue;
+        AESCtrContext ctx;
+        TEST_ASSERT(aes_ctr_init(&ctx, sp_key, sizeof(sp_key), fips_plain));
+
+        uint32_t start = furi_get_tick();
+        for(int i = 0; i < AES_CTR_BENCH_ROUNDS; i++) aes_ctr_update(&ctx, buf, sizeof(buf), buf);
+        uint32_t elapsed = furi_get_tick() - start;
+        aes_ctr_final(&ctx);
+
+        FURI_LOG_I(
+            "TEST",
+            "AES-128 CTR (%s): %d bytes in %lu ms",
+            names[n],
+            AES_CTR_BENCH_BYTES * AES_CTR_BENCH_ROUNDS,
+            (unsigned long)elapsed);
+    }
+    aes_select_impl(saved);
+    return TestResultPass;
+}
+
+bool predator_run_aes_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"AES-128 Known Answers", test_aes128_kat, true},
+        {"AES-256 Known Answers", test_aes256_kat, true},
+        {"AES In-place Round Trip", test_aes_round_trip, true},
+        {"AES-CBC Streaming", test_aes_cbc_stream, true},
+        {"AES-CTR Streaming", test_aes_ctr_stream, true},
+        {"AES Bitsliced Core", test_aes_bitsliced, true},
+        {"AES-128 Throughput", test_aes_benchmark, true},
+        {"AES-128 CTR Throughput", test_aes_ctr_benchmark, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "AES Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
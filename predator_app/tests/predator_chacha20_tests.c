@@ -0,0 +1,275 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_crypto_chacha20.h"
+#include <string.h>
+
+#define CHACHA20_BENCH_BYTES 4096
+#define CHACHA20_BENCH_ROUNDS 16
+
+// RFC 8439 2.3.2 / 2.4.2 key 00..1F
+static const uint8_t rfc_key[32] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+
+static const char rfc_sunscreen[] =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it.";
+
+// RFC 8439 2.4.2 ciphertext (nonce 00 00 00 00 00 00 00 4A 00 00 00 00, counter 1)
+static const uint8_t rfc_sunscreen_cipher[114] = {
+    0x6E, 0x2E, 0x35, 0x9A, 0x25, 0x68, 0xF9, 0x80, 0x41, 0xBA, 0x07, 0x28,
+    0xDD, 0x0D, 0x69, 0x81, 0xE9, 0x7E, 0x7A, 0xEC, 0x1D, 0x43, 0x60, 0xC2,
+    0x0A, 0x27, 0xAF, 0xCC, 0xFD, 0x9F, 0xAE, 0x0B, 0xF9, 0x1B, 0x65, 0xC5,
+    0x52, 0x47, 0x33, 0xAB, 0x8F, 0x59, 0x3D, 0xAB, 0xCD, 0x62, 0xB3, 0x57,
+    0x16, 0x39, 0xD6, 0x24, 0xE6, 0x51, 0x52, 0xAB, 0x8F, 0x53, 0x0C, 0x35,
+    0x9F, 0x08, 0x61, 0xD8, 0x07, 0xCA, 0x0D, 0xBF, 0x50, 0x0D, 0x6A, 0x61,
+    0x56, 0xA3, 0x8E, 0x08, 0x8A, 0x22, 0xB6, 0x5E, 0x52, 0xBC, 0x51, 0x4D,
+    0x16, 0xCC, 0xF8, 0x06, 0x81, 0x8C, 0xE9, 0x1A, 0xB7, 0x79, 0x37, 0x36,
+    0x5A, 0xF9, 0x0B, 0xBF, 0x74, 0xA3, 0x5B, 0xE6, 0xB4, 0x0B, 0x8E, 0xED,
+    0xF2, 0x78, 0x5E, 0x42, 0x87, 0x4D};
+
+static const uint8_t rfc_nonce[12] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x00};
+
+// RFC 8439 2.8.2 AEAD vector (same plaintext)
+static const uint8_t aead_key[32] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F};
+static const uint8_t aead_nonce[12] = {
+    0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+static const uint8_t aead_aad[12] = {
+    0x50, 0x51, 0x52, 0x53, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7};
+static const uint8_t aead_cipher[114] = {
+    0xD3, 0x1A, 0x8D, 0x34, 0x64, 0x8E, 0x60, 0xDB, 0x7B, 0x86, 0xAF, 0xBC,
+    0x53, 0xEF, 0x7E, 0xC2, 0xA4, 0xAD, 0xED, 0x51, 0x29, 0x6E, 0x08, 0xFE,
+    0xA9, 0xE2, 0xB5, 0xA7, 0x36, 0xEE, 0x62, 0xD6, 0x3D, 0xBE, 0xA4, 0x5E,
+    0x8C, 0xA9, 0x67, 0x12, 0x82, 0xFA, 0xFB, 0x69, 0xDA, 0x92, 0x72, 0x8B,
+    0x1A, 0x71, 0xDE, 0x0A, 0x9E, 0x06, 0x0B, 0x29, 0x05, 0xD6, 0xA5, 0xB6,
+    0x7E, 0xCD, 0x3B, 0x36, 0x92, 0xDD, 0xBD, 0x7F, 0x2D, 0x77, 0x8B, 0x8C,
+    0x98, 0x03, 0xAE, 0xE3, 0x28, 0x09, 0x1B, 0x58, 0xFA, 0xB3, 0x24, 0xE4,
+    0xFA, 0xD6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8B, 0x48, 0x31, 0xD7, 0xBC,
+    0x3F, 0xF4, 0xDE, 0xF0, 0x8E, 0x4B, 0x7A, 0x9D, 0xE5, 0x76, 0xD2, 0x65,
+    0x86, 0xCE, 0xC6, 0x4B, 0x61, 0x16};
+static const uint8_t aead_tag[16] = {
+    0x1A, 0xE1, 0x0B, 0x59, 0x4F, 0x09, 0xE2, 0x6A, 0x7E, 0x90, 0x2E, 0xCB, 0xD0, 0x60, 0x06, 0x91};
+
+// Test the block function against RFC 8439 2.3.2
+static TestResult test_chacha20_block(void* context) {
+    UNUSED(context);
+    const uint8_t nonce[12] = {
+        0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x00};
+    const uint8_t expected[64] = {
+        0x10, 0xF1, 0xE7, 0xE4, 0xD1, 0x3B, 0x59, 0x15, 0x50, 0x0F, 0xDD, 0x1F, 0xA3, 0x20, 0x71, 0xC4,
+        0xC7, 0xD1, 0xF4, 0xC7, 0x33, 0xC0, 0x68, 0x03, 0x04, 0x22, 0xAA, 0x9A, 0xC3, 0xD4, 0x6C, 0x4E,
+        0xD2, 0x82, 0x64, 0x46, 0x07, 0x9F, 0xAA, 0x09, 0x14, 0xC2, 0xD7, 0x05, 0xD9, 0x8B, 0x02, 0xA2,
+        0xB5, 0x12, 0x9C, 0xD1, 0xDE, 0x16, 0x4E, 0xB9, 0xCB, 0xD0, 0x83, 0xE8, 0xA2, 0x50, 0x3C, 0x4E};
+    ChaCha20Context ctx;
+    uint8_t block[64];
+
+    TEST_ASSERT(chacha20_init(&ctx, rfc_key, nonce, 1));
+    TEST_ASSERT(chacha20_block(&ctx, block));
+    TEST_ASSERT(memcmp(block, expected, sizeof(expected)) == 0);
+    return TestResultPass;
+}
+
+// Test encryption against RFC 8439 2.4.2, one-shot and in place
+static TestResult test_chacha20_encrypt_kat(void* context) {
+    UNUSED(context);
+    ChaCha20Context ctx;
+    uint8_t buf[114];
+
+    TEST_ASSERT(chacha20_init(&ctx, rfc_key, rfc_nonce, 1));
+    TEST_ASSERT(chacha20_crypt(&ctx, (const uint8_t*)rfc_sunscreen, sizeof(buf), buf));
+    TEST_ASSERT(memcmp(buf, rfc_sunscreen_cipher, sizeof(buf)) == 0);
+
+    TEST_ASSERT(chacha20_init(&ctx, rfc_key, rfc_nonce, 1));
+    TEST_ASSERT(chacha20_crypt(&ctx, buf, sizeof(buf), buf));
+    TEST_ASSERT(memcmp(buf, rfc_sunscreen, sizeof(buf)) == 0);
+    return TestResultPass;
+}
+
+// Test that any chunking and any buffer alignment gives the same stream
+static TestResult test_chacha20_chunked(void* context) {
+    UNUSED(context);
+    ChaCha20Context ctx;
+    uint8_t src[114 + 3];
+    uint8_t dst[114 + 3];
+
+    for(size_t offset = 0; offset < 4; offset++) {
+        memcpy(&src[offset], rfc_sunscreen, 114);
+        for(size_t chunk = 1; chunk <= 70; chunk++) {
+            TEST_ASSERT(chacha20_init(&ctx, rfc_key, rfc_nonce, 1));
+            for(size_t pos = 0; pos < 114; pos += chunk) {
+                size_t n = (114 - pos < chunk) ? 114 - pos : chunk;
+                TEST_ASSERT(chacha20_crypt(&ctx, &src[offset + pos], n, &dst[3 - offset + pos]));
+            }
+            TEST_ASSERT(memcmp(&dst[3 - offset], rfc_sunscreen_cipher, 114) == 0);
+        }
+    }
+    return TestResultPass;
+}
+
+// Test bulk output against chacha20_block across a 32-bit counter wrap
+static TestResult test_chacha20_bulk_vs_block(void* context) {
+    UNUSED(context);
+    static uint8_t bulk[64 * 12];
+    uint8_t block[64];
+    ChaCha20Context ctx;
+
+    memset(bulk, 0, sizeof(bulk));
+    TEST_ASSERT(chacha20_init(&ctx, rfc_key, rfc_nonce, 0xFFFFFFF9));
+    TEST_ASSERT(chacha20_crypt(&ctx, bulk, sizeof(bulk), bulk));
+
+    TEST_ASSERT(chacha20_init(&ctx, rfc_key, rfc_nonce, 0xFFFFFFF9));
+    for(size_t pos = 0; pos < sizeof(bulk); pos += 64) {
+        TEST_ASSERT(chacha20_block(&ctx, block));
+        TEST_ASSERT(memcmp(&bulk[pos], block, 64) == 0);
+    }
+    return TestResultPass;
+}
+
+// Test Poly1305 against RFC 8439 2.5.2, one-shot and byte by byte
+static TestResult test_poly1305_kat(void* context) {
+    UNUSED(context);
+    const uint8_t key[32] = {
+        0x85, 0xD6, 0xBE, 0x78, 0x57, 0x55, 0x6D, 0x33, 0x7F, 0x44, 0x52, 0xFE, 0x42, 0xD5, 0x06, 0xA8,
+        0x01, 0x03, 0x80, 0x8A, 0xFB, 0x0D, 0xB2, 0xFD, 0x4A, 0xBF, 0xF6, 0xAF, 0x41, 0x49, 0xF5, 0x1B};
+    const uint8_t expected[16] = {
+        0xA8, 0x06, 0x1D, 0xC1, 0x30, 0x51, 0x36, 0xC6, 0xC2, 0x2B, 0x8B, 0xAF, 0x0C, 0x01, 0x27, 0xA9};
+    const char* msg = "Cryptographic Forum Research Group";
+    const size_t msg_len = strlen(msg);
+    Poly1305Context ctx;
+    uint8_t tag[16];
+
+    TEST_ASSERT(poly1305_mac(key, (const uint8_t*)msg, msg_len, tag));
+    TEST_ASSERT(memcmp(tag, expected, sizeof(expected)) == 0);
+
+    TEST_ASSERT(poly1305_init(&ctx, key));
+    for(size_t i = 0; i < msg_len; i++) TEST_ASSERT(poly1305_update(&ctx, (const uint8_t*)&msg[i], 1));
+    TEST_ASSERT(poly1305_finish(&ctx, tag));
+    TEST_ASSERT(memcmp(tag, expected, sizeof(expected)) == 0);
+    return TestResultPass;
+}
+
+// Test one-shot AEAD against RFC 8439 2.8.2, including tag rejection
+static TestResult test_aead_kat(void* context) {
+    UNUSED(context);
+    ChaCha20Poly1305Context ctx;
+    uint8_t buf[114];
+    uint8_t tag[16];
+
+    TEST_ASSERT(chacha20_poly1305_init(&ctx, aead_key, aead_nonce));
+    TEST_ASSERT(chacha20_poly1305_encrypt(
+        &ctx, (const uint8_t*)rfc_sunscreen, sizeof(buf), aead_aad, sizeof(aead_aad), buf, tag));
+    TEST_ASSERT(memcmp(buf, aead_cipher, sizeof(buf)) == 0);
+    TEST_ASSERT(memcmp(tag, aead_tag, sizeof(tag)) == 0);
+
+    TEST_ASSERT(chacha20_poly1305_decrypt(
+        &ctx, aead_cipher, sizeof(buf), aead_aad, sizeof(aead_aad), aead_tag, buf));
+    TEST_ASSERT(memcmp(buf, rfc_sunscreen, sizeof(buf)) == 0);
+
+    // Flipped tag bit: rejected and no plaintext left behind
+    tag[15] ^= 0x01;
+    TEST_ASSERT(!chacha20_poly1305_decrypt(
+        &ctx, aead_cipher, sizeof(buf), aead_aad, sizeof(aead_aad), tag, buf));
+    for(size_t i = 0; i < sizeof(buf); i++) TEST_ASSERT(buf[i] == 0);
+    return TestResultPass;
+}
+
+// Test incremental AEAD with every chunk size, in place
+static TestResult test_aead_streaming(void* context) {
+    UNUSED(context);
+    ChaCha20Poly1305Context ctx;
+    uint8_t buf[114];
+    uint8_t tag[16];
+
+    TEST_ASSERT(chacha20_poly1305_init(&ctx, aead_key, aead_nonce));
+    for(size_t chunk = 1; chunk <= sizeof(buf); chunk++) {
+        memcpy(buf, rfc_sunscreen, sizeof(buf));
+        TEST_ASSERT(chacha20_poly1305_start(&ctx, true));
+        TEST_ASSERT(chacha20_poly1305_aad(&ctx, aead_aad, 5));
+        TEST_ASSERT(chacha20_poly1305_aad(&ctx, &aead_aad[5], sizeof(aead_aad) - 5));
+        for(size_t pos = 0; pos < sizeof(buf); pos += chunk) {
+            size_t n = (sizeof(buf) - pos < chunk) ? sizeof(buf) - pos : chunk;
+            TEST_ASSERT(chacha20_poly1305_update(&ctx, &buf[pos], n, &buf[pos]));
+        }
+        // AAD after data is a usage error
+        TEST_ASSERT(!chacha20_poly1305_aad(&ctx, aead_aad, 1));
+        TEST_ASSERT(!chacha20_poly1305_verify(&ctx, aead_tag));
+        TEST_ASSERT(chacha20_poly1305_finish(&ctx, tag));
+        TEST_ASSERT(memcmp(buf, aead_cipher, sizeof(buf)) == 0);
+        TEST_ASSERT(memcmp(tag, aead_tag, sizeof(tag)) == 0);
+
+        TEST_ASSERT(chacha20_poly1305_start(&ctx, false));
+        TEST_ASSERT(chacha20_poly1305_aad(&ctx, aead_aad, sizeof(aead_aad)));
+        for(size_t pos = 0; pos < sizeof(buf); pos += chunk) {
+            size_t n = (sizeof(buf) - pos < chunk) ? sizeof(buf) - pos : chunk;
+            TEST_ASSERT(chacha20_poly1305_update(&ctx, &buf[pos], n, &buf[pos]));
+        }
+        TEST_ASSERT(chacha20_poly1305_verify(&ctx, aead_tag));
+        TEST_ASSERT(memcmp(buf, rfc_sunscreen, sizeof(buf)) == 0);
+    }
+    return TestResultPass;
+}
+
+// Test password key derivation is PBKDF2-HMAC-SHA256 with a 32-byte output
+static TestResult test_chacha20_derive_key(void* context) {
+    UNUSED(context);
+    const uint8_t expected[32] = {
+        0xC5, 0xE4, 0x78, 0xD5, 0x92, 0x88, 0xC8, 0x41, 0xAA, 0x53, 0x0D, 0xB6, 0x84, 0x5C, 0x4C, 0x8D,
+        0x96, 0x28, 0x93, 0xA0, 0x01, 0xCE, 0x4E, 0x11, 0xA4, 0x96, 0x38, 0x73, 0xAA, 0x98, 0x13, 0x4A};
+    uint8_t key[CHACHA20_KEY_SIZE];
+
+    TEST_ASSERT(chacha20_derive_key("password", (const uint8_t*)"salt", 4, 4096, key));
+    TEST_ASSERT(memcmp(key, expected, sizeof(key)) == 0);
+
+    // Too few iterations are refused
+    TEST_ASSERT(!chacha20_derive_key("password", (const uint8_t*)"salt", 4, 999, key));
+    return TestResultPass;
+}
+
+// Benchmark bulk ChaCha20 (reported in the log, never fails)
+static TestResult test_chacha20_benchmark(void* context) {
+    UNUSED(context);
+    static uint8_t buf[CHACHA20_BENCH_BYTES];
+    ChaCha20Context ctx;
+    memset(buf, 0x5A, sizeof(buf));
+
+    TEST_ASSERT(chacha20_init(&ctx, rfc_key, rfc_nonce, 1));
+    uint32_t start = furi_get_tick();
+    for(int i = 0; i < CHACHA20_BENCH_ROUNDS; i++) chacha20_crypt(&ctx, buf, sizeof(buf), buf);
+    uint32_t bulk_ms = furi_get_tick() - start;
+
+    FURI_LOG_I(
+        "TEST",
+        "ChaCha20: %d KiB in %lu ms",
+        CHACHA20_BENCH_ROUNDS * CHACHA20_BENCH_BYTES / 1024,
+        (unsigned long)bulk_ms);
+    return TestResultPass;
+}
+
+bool predator_run_chacha20_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"ChaCha20 Block Function", test_chacha20_block, true},
+        {"ChaCha20 RFC 8439 Encryption", test_chacha20_encrypt_kat, true},
+        {"ChaCha20 Chunked and Unaligned", test_chacha20_chunked, true},
+        {"ChaCha20 Bulk vs Block Function", test_chacha20_bulk_vs_block, true},
+        {"Poly1305 RFC 8439", test_poly1305_kat, true},
+        {"ChaCha20-Poly1305 RFC 8439", test_aead_kat, true},
+        {"ChaCha20-Poly1305 Streaming", test_aead_streaming, true},
+        {"ChaCha20 Password Key Derivation", test_chacha20_derive_key, true},
+        {"ChaCha20 Throughput", test_chacha20_benchmark, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "ChaCha20 Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
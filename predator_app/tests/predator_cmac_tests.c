@@ -0,0 +1,254 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_crypto_cmac.h"
+#include "../helpers/predator_crypto_desfire.h"
+#include <string.h>
+
+// SP 800-38A/38B example message (four 16-byte blocks)
+static const uint8_t sp_msg[64] = {
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10};
+
+// SP 800-38B D.1 AES-128 key
+static const uint8_t aes_key[16] = {
+    0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C};
+
+// SP 800-38B D.2 / D.3 TDEA keys
+static const uint8_t tdea3_key[24] = {
+    0x8A, 0xA8, 0x3B, 0xF8, 0xCB, 0xDA, 0x10, 0x62, 0x0B, 0xC1, 0xBF, 0x19,
+    0xFB, 0xB6, 0xCD, 0x58, 0xBC, 0x31, 0x3D, 0x4A, 0x37, 0x1C, 0xA8, 0xB5};
+static const uint8_t tdea2_key[16] = {
+    0x4C, 0xF1, 0x51, 0x34, 0xA2, 0x85, 0x0D, 0xD5, 0x8A, 0x3D, 0x10, 0xBA, 0x80, 0x57, 0x0D, 0x38};
+
+// DESFire test randoms: RndA = 00..0F, RndB = 10..1F
+static void cmac_test_randoms(uint8_t* rnd_a, uint8_t* rnd_b) {
+    for(int i = 0; i < 16; i++) {
+        rnd_a[i] = (uint8_t)i;
+        rnd_b[i] = (uint8_t)(0x10 + i);
+    }
+}
+
+// Test AES-CMAC against SP 800-38B D.1 (subkeys and all four examples)
+static TestResult test_cmac_aes_vectors(void* context) {
+    UNUSED(context);
+    const uint8_t k1[16] = {
+        0xFB, 0xEE, 0xD6, 0x18, 0x35, 0x71, 0x33, 0x66, 0x7C, 0x85, 0xE0, 0x8F, 0x72, 0x36, 0xA8, 0xDE};
+    const uint8_t k2[16] = {
+        0xF7, 0xDD, 0xAC, 0x30, 0x6A, 0xE2, 0x66, 0xCC, 0xF9, 0x0B, 0xC1, 0x1E, 0xE4, 0x6D, 0x51, 0x3B};
+    const size_t lens[4] = {0, 16, 40, 64};
+    const uint8_t expected[4][16] = {
+        {0xBB, 0x1D, 0x69, 0x29, 0xE9, 0x59, 0x37, 0x28, 0x7F, 0xA3, 0x7D, 0x12, 0x9B, 0x75, 0x67, 0x46},
+        {0x07, 0x0A, 0x16, 0xB4, 0x6B, 0x4D, 0x41, 0x44, 0xF7, 0x9B, 0xDD, 0x9D, 0xD0, 0x4A, 0x28, 0x7C},
+        {0xDF, 0xA6, 0x67, 0x47, 0xDE, 0x9A, 0xE6, 0x30, 0x30, 0xCA, 0x32, 0x61, 0x14, 0x97, 0xC8, 0x27},
+        {0x51, 0xF0, 0xBE, 0xBF, 0x7E, 0x3B, 0x9D, 0x92, 0xFC, 0x49, 0x74, 0x17, 0x79, 0x36, 0x3C, 0xFE}};
+    PredatorCmac ctx;
+    uint8_t mac[16];
+
+    TEST_ASSERT(predator_cmac_init(&ctx, PredatorCmacAES128, aes_key));
+    TEST_ASSERT(memcmp(ctx.k1, k1, 16) == 0);
+    TEST_ASSERT(memcmp(ctx.k2, k2, 16) == 0);
+
+    // One key setup, four MACs
+    for(int i = 0; i < 4; i++) {
+        predator_cmac_start(&ctx, NULL);
+        TEST_ASSERT(predator_cmac_update(&ctx, sp_msg, lens[i]));
+        TEST_ASSERT(predator_cmac_final(&ctx, mac));
+        TEST_ASSERT(memcmp(mac, expected[i], 16) == 0);
+
+        TEST_ASSERT(predator_cmac(PredatorCmacAES128, aes_key, sp_msg, lens[i], mac));
+        TEST_ASSERT(memcmp(mac, expected[i], 16) == 0);
+    }
+    predator_cmac_wipe(&ctx);
+    return TestResultPass;
+}
+
+// Test 3DES-CMAC against SP 800-38B D.2 (3-key) and D.3 (2-key)
+static TestResult test_cmac_tdea_vectors(void* context) {
+    UNUSED(context);
+    const size_t lens[4] = {0, 8, 20, 32};
+    const uint8_t expected3[4][8] = {
+        {0xB7, 0xA6, 0x88, 0xE1, 0x22, 0xFF, 0xAF, 0x95},
+        {0x8E, 0x8F, 0x29, 0x31, 0x36, 0x28, 0x37, 0x97},
+        {0x74, 0x3D, 0xDB, 0xE0, 0xCE, 0x2D, 0xC2, 0xED},
+        {0x33, 0xE6, 0xB1, 0x09, 0x24, 0x00, 0xEA, 0xE5}};
+    const uint8_t expected2[4][8] = {
+        {0xBD, 0x2E, 0xBF, 0x9A, 0x3B, 0xA0, 0x03, 0x61},
+        {0x4F, 0xF2, 0xAB, 0x81, 0x3C, 0x53, 0xCE, 0x83},
+        {0x62, 0xDD, 0x1B, 0x47, 0x19, 0x02, 0xBD, 0x4E},
+        {0x31, 0xB1, 0xE4, 0x31, 0xDA, 0xBC, 0x4E, 0xB8}};
+    uint8_t mac[8];
+
+    for(int i = 0; i < 4; i++) {
+        TEST_ASSERT(predator_cmac(PredatorCmac3K3DES, tdea3_key, sp_msg, lens[i], mac));
+        TEST_ASSERT(memcmp(mac, expected3[i], 8) == 0);
+        TEST_ASSERT(predator_cmac(PredatorCmac2K3DES, tdea2_key, sp_msg, lens[i], mac));
+        TEST_ASSERT(memcmp(mac, expected2[i], 8) == 0);
+    }
+    return TestResultPass;
+}
+
+// Test that every chunking of the message gives the one-shot MAC
+static TestResult test_cmac_streaming(void* context) {
+    UNUSED(context);
+    PredatorCmac ctx;
+    uint8_t ref[16];
+    uint8_t mac[16];
+
+    for(size_t len = 0; len <= sizeof(sp_msg); len++) {
+        TEST_ASSERT(predator_cmac(PredatorCmacAES128, aes_key, sp_msg, len, ref));
+        TEST_ASSERT(predator_cmac_init(&ctx, PredatorCmacAES128, aes_key));
+        for(size_t chunk = 1; chunk <= 17; chunk++) {
+            predator_cmac_start(&ctx, NULL);
+            for(size_t off = 0; off < len; off += chunk) {
+                size_t n = (len - off < chunk) ? len - off : chunk;
+                TEST_ASSERT(predator_cmac_update(&ctx, &sp_msg[off], n));
+            }
+            TEST_ASSERT(predator_cmac_final(&ctx, mac));
+            TEST_ASSERT(memcmp(mac, ref, 16) == 0);
+        }
+
+        TEST_ASSERT(predator_cmac(PredatorCmac3K3DES, tdea3_key, sp_msg, len, ref));
+        TEST_ASSERT(predator_cmac_init(&ctx, PredatorCmac3K3DES, tdea3_key));
+        for(size_t chunk = 1; chunk <= 9; chunk++) {
+            predator_cmac_start(&ctx, NULL);
+            for(size_t off = 0; off < len; off += chunk) {
+                size_t n = (len - off < chunk) ? len - off : chunk;
+                TEST_ASSERT(predator_cmac_update(&ctx, &sp_msg[off], n));
+            }
+            TEST_ASSERT(predator_cmac_final(&ctx, mac));
+            TEST_ASSERT(memcmp(mac, ref, 8) == 0);
+        }
+    }
+    predator_cmac_wipe(&ctx);
+    return TestResultPass;
+}
+
+// Test DESFire EV1 session key layouts
+static TestResult test_desfire_session_keys(void* context) {
+    UNUSED(context);
+    const uint8_t aes_session[16] = {
+        0x00, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x13, 0x0C, 0x0D, 0x0E, 0x0F, 0x1C, 0x1D, 0x1E, 0x1F};
+    const uint8_t k3des_session[24] = {
+        0x00, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x13, 0x06, 0x07, 0x08, 0x09,
+        0x16, 0x17, 0x18, 0x19, 0x0C, 0x0D, 0x0E, 0x0F, 0x1C, 0x1D, 0x1E, 0x1F};
+    const uint8_t des3_session[16] = {
+        0x00, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x13, 0x04, 0x05, 0x06, 0x07, 0x14, 0x15, 0x16, 0x17};
+    uint8_t rnd_a[16];
+    uint8_t rnd_b[16];
+    cmac_test_randoms(rnd_a, rnd_b);
+
+    DESFireContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.auth_method = DESFireAuthAES128;
+    TEST_ASSERT(desfire_generate_session_keys(&ctx, rnd_a, rnd_b));
+    TEST_ASSERT(ctx.session_key_len == 16);
+    TEST_ASSERT(memcmp(ctx.session_key_enc, aes_session, 16) == 0);
+    TEST_ASSERT(memcmp(ctx.session_key_mac, aes_session, 16) == 0);
+
+    ctx.auth_method = DESFireAuth3K3DES;
+    TEST_ASSERT(desfire_generate_session_keys(&ctx, rnd_a, rnd_b));
+    TEST_ASSERT(ctx.session_key_len == 24);
+    TEST_ASSERT(memcmp(ctx.session_key_enc, k3des_session, 24) == 0);
+
+    // 2-key 3DES with distinct halves, then K1 == K2 (single DES)
+    ctx.auth_method = DESFireAuth3DES;
+    for(int i = 0; i < 16; i++) ctx.key[i] = (uint8_t)(0xA0 + i);
+    TEST_ASSERT(desfire_generate_session_keys(&ctx, rnd_a, rnd_b));
+    TEST_ASSERT(memcmp(ctx.session_key_enc, des3_session, 16) == 0);
+    memset(ctx.key, 0, sizeof(ctx.key));
+    TEST_ASSERT(desfire_generate_session_keys(&ctx, rnd_a, rnd_b));
+    TEST_ASSERT(memcmp(ctx.session_key_enc, des3_session, 8) == 0);
+    TEST_ASSERT(memcmp(&ctx.session_key_enc[8], des3_session, 8) == 0);
+    return TestResultPass;
+}
+
+// Test DESFire EV2 session keys (CMAC over SV1/SV2)
+static TestResult test_desfire_ev2_session_keys(void* context) {
+    UNUSED(context);
+    const uint8_t expected_enc[16] = {
+        0x29, 0x7B, 0x4A, 0xE0, 0xD7, 0xF3, 0xBE, 0x27, 0xB3, 0xA3, 0x48, 0xE7, 0x7A, 0xD7, 0x8C, 0xCF};
+    const uint8_t expected_mac[16] = {
+        0x4F, 0xB2, 0xA7, 0xBC, 0x69, 0x9B, 0x0B, 0x14, 0x94, 0xAB, 0xDA, 0x7F, 0x01, 0x75, 0x8E, 0x65};
+    uint8_t rnd_a[16];
+    uint8_t rnd_b[16];
+    cmac_test_randoms(rnd_a, rnd_b);
+
+    DESFireContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.auth_method = DESFireAuthEV2;
+    for(int i = 0; i < 16; i++) ctx.key[i] = (uint8_t)(i * 0x11);
+    ctx.key_len = 16;
+
+    TEST_ASSERT(desfire_generate_session_keys(&ctx, rnd_a, rnd_b));
+    TEST_ASSERT(memcmp(ctx.session_key_enc, expected_enc, 16) == 0);
+    TEST_ASSERT(memcmp(ctx.session_key_mac, expected_mac, 16) == 0);
+    return TestResultPass;
+}
+
+// Test that session CMACs chain through ctx->iv
+static TestResult test_desfire_cmac_chaining(void* context) {
+    UNUSED(context);
+    // CMAC(AES session key, GetValue 0x6C file 0) with a zero IV
+    const uint8_t cmd1[2] = {0x6C, 0x00};
+    const uint8_t expected1[16] = {
+        0x22, 0xE4, 0xBA, 0x36, 0x0E, 0x19, 0xA0, 0x6B, 0x9F, 0xE7, 0xE6, 0xEA, 0xB3, 0xFC, 0x7A, 0xC6};
+    uint8_t rnd_a[16];
+    uint8_t rnd_b[16];
+    cmac_test_randoms(rnd_a, rnd_b);
+
+    DESFireContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.auth_method = DESFireAuthAES128;
+    TEST_ASSERT(desfire_generate_session_keys(&ctx, rnd_a, rnd_b));
+
+    PredatorCmac cmac;
+    TEST_ASSERT(desfire_session_cmac_init(&ctx, &cmac));
+    desfire_session_cmac_begin(&ctx, &cmac);
+    TEST_ASSERT(predator_cmac_update(&cmac, cmd1, sizeof(cmd1)));
+    TEST_ASSERT(desfire_session_cmac_end(&ctx, &cmac));
+    TEST_ASSERT(memcmp(ctx.cmac, expected1, 16) == 0);
+    TEST_ASSERT(memcmp(ctx.iv, expected1, 16) == 0);
+
+    uint8_t mac[16];
+    TEST_ASSERT(desfire_cmac(ctx.session_key_mac, cmd1, sizeof(cmd1), mac));
+    TEST_ASSERT(memcmp(mac, expected1, 16) == 0);
+
+    // For one complete block, CMAC with IV equals zero-IV CMAC of (IV ^ M)
+    uint8_t folded[16];
+    for(int i = 0; i < 16; i++) folded[i] = ctx.iv[i] ^ sp_msg[i];
+    TEST_ASSERT(desfire_cmac(ctx.session_key_mac, folded, 16, mac));
+
+    desfire_session_cmac_begin(&ctx, &cmac);
+    TEST_ASSERT(predator_cmac_update(&cmac, sp_msg, 16));
+    TEST_ASSERT(desfire_session_cmac_end(&ctx, &cmac));
+    TEST_ASSERT(memcmp(ctx.cmac, mac, 16) == 0);
+    TEST_ASSERT(memcmp(ctx.iv, mac, 16) == 0);
+    predator_cmac_wipe(&cmac);
+    return TestResultPass;
+}
+
+bool predator_run_cmac_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"AES-CMAC SP 800-38B", test_cmac_aes_vectors, true},
+        {"3DES-CMAC SP 800-38B", test_cmac_tdea_vectors, true},
+        {"CMAC Streaming Chunks", test_cmac_streaming, true},
+        {"DESFire EV1 Session Keys", test_desfire_session_keys, true},
+        {"DESFire EV2 Session Keys", test_desfire_ev2_session_keys, true},
+        {"DESFire CMAC Chaining", test_desfire_cmac_chaining, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "CMAC Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
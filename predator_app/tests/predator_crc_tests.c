@@ -0,0 +1,103 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_crc.h"
+#include "../helpers/predator_crypto_mifare.h"
+#include "../helpers/predator_crypto_desfire.h"
+#include "../helpers/predator_crypto_iso15693.h"
+#include "../helpers/predator_crypto_felica.h"
+#include "../helpers/predator_crypto_calypso.h"
+#include <string.h>
+
+static const uint8_t check_input[] = "123456789";
+#define CHECK_LEN (sizeof(check_input) - 1)
+
+// Test every variant against its catalogue check value
+static TestResult test_crc_check_values(void* context) {
+    UNUSED(context);
+    for(int type = 0; type < PredatorCrcTypeCount; type++) {
+        const PredatorCrcParams* params = predator_crc_params((PredatorCrcType)type);
+        TEST_ASSERT_NOT_NULL(params);
+        TEST_ASSERT(predator_crc((PredatorCrcType)type, check_input, CHECK_LEN) == params->check);
+    }
+    TEST_ASSERT(predator_crc_params(PredatorCrcTypeCount) == NULL);
+    return TestResultPass;
+}
+
+// Test protocol wrappers map onto the right variant
+static TestResult test_crc_protocol_wrappers(void* context) {
+    UNUSED(context);
+    TEST_ASSERT(mifare_crc16(check_input, CHECK_LEN) == 0xBF05);
+    TEST_ASSERT(iso15693_crc16(check_input, CHECK_LEN) == 0x906E);
+    TEST_ASSERT(calypso_crc(check_input, CHECK_LEN) == 0x906E);
+    TEST_ASSERT(felica_checksum(check_input, CHECK_LEN) == 0x31C3);
+    TEST_ASSERT(desfire_crc32(check_input, CHECK_LEN) == 0x340BC6D9);
+
+    // ISO 14443-3 A: HLTA (50 00) carries CRC 57 CD
+    const uint8_t hlta[2] = {0x50, 0x00};
+    TEST_ASSERT(mifare_crc16(hlta, sizeof(hlta)) == 0xCD57);
+    return TestResultPass;
+}
+
+// Test slice-by-4 kernels match the byte-wise loop for every length/alignment
+static TestResult test_crc_slice_matches_bytewise(void* context) {
+    UNUSED(context);
+    uint8_t buffer[300];
+    uint32_t seed = 0x12345678;
+    for(size_t i = 0; i < sizeof(buffer); i++) {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = (uint8_t)(seed >> 16);
+    }
+
+    const PredatorCrcType reflected[] = {PredatorCrc16A, PredatorCrc16B, PredatorCrc32Jam};
+    for(size_t t = 0; t < COUNT_OF(reflected); t++) {
+        const PredatorCrcType type = reflected[t];
+        for(size_t offset = 0; offset < 4; offset++) {
+            for(size_t len = 0; len + offset <= sizeof(buffer); len += 7) {
+                const uint8_t* data = buffer + offset;
+                uint32_t fast = predator_crc_update(type, predator_crc_init(type), data, len);
+                uint32_t slow = predator_crc_update_bytewise(type, predator_crc_init(type), data, len);
+                TEST_ASSERT(fast == slow);
+            }
+        }
+    }
+    return TestResultPass;
+}
+
+// Test feeding a buffer in chunks gives the one-shot result
+static TestResult test_crc_incremental(void* context) {
+    UNUSED(context);
+    uint8_t buffer[128];
+    for(size_t i = 0; i < sizeof(buffer); i++) buffer[i] = (uint8_t)(i * 37 + 11);
+
+    for(int type = 0; type < PredatorCrcTypeCount; type++) {
+        const PredatorCrcType crc_type = (PredatorCrcType)type;
+        uint32_t crc = predator_crc_init(crc_type);
+        crc = predator_crc_update(crc_type, crc, buffer, 5);
+        crc = predator_crc_update(crc_type, crc, buffer + 5, 40);
+        crc = predator_crc_update(crc_type, crc, buffer + 45, sizeof(buffer) - 45);
+        TEST_ASSERT(predator_crc_final(crc_type, crc) == predator_crc(crc_type, buffer, sizeof(buffer)));
+    }
+    return TestResultPass;
+}
+
+bool predator_run_crc_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"CRC Catalogue Check Values", test_crc_check_values, true},
+        {"CRC Protocol Wrappers", test_crc_protocol_wrappers, true},
+        {"CRC Slice-by-4 vs Byte-wise", test_crc_slice_matches_bytewise, true},
+        {"CRC Incremental Update", test_crc_incremental, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "CRC Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
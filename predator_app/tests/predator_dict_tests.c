@@ -0,0 +1,102 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_dict.h"
+#include <storage/storage.h>
+#include <string.h>
+
+#define DICT_TEST_PATH    "/ext/apps_data/predator/dict_test.pdict"
+#define DICT_TEST_ENTRIES 70 // More than one read-ahead fill (256 / 5 = 51)
+
+// Write a u32 dictionary: entry i = 0xA5000000 + i, priority 255 - i
+static bool dict_test_write(Storage* storage) {
+    File* file = storage_file_alloc(storage);
+    bool ok = storage_file_open(file, DICT_TEST_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+    if(ok) {
+        const uint8_t hdr[16] = {
+            'P', 'D', 'C', 'T', PREDATOR_DICT_VERSION, 0, 4, PredatorDictKindU32,
+            DICT_TEST_ENTRIES, 0, 0, 0, 0, 0, 0, 0};
+        ok = storage_file_write(file, hdr, sizeof(hdr)) == sizeof(hdr);
+        for(uint32_t i = 0; ok && i < DICT_TEST_ENTRIES; i++) {
+            const uint32_t key = 0xA5000000 + i;
+            const uint8_t rec[5] = {
+                key & 0xFF, (key >> 8) & 0xFF, (key >> 16) & 0xFF, key >> 24, (uint8_t)(255 - i)};
+            ok = storage_file_write(file, rec, sizeof(rec)) == sizeof(rec);
+        }
+    }
+    storage_file_close(file);
+    storage_file_free(file);
+    return ok;
+}
+
+// Test SD dictionary streams every entry in file order across read-ahead refills
+static TestResult test_dict_stream(void* context) {
+    UNUSED(context);
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    TEST_ASSERT(dict_test_write(storage));
+
+    PredatorDict* dict = predator_dict_open(storage, DICT_TEST_PATH);
+    TEST_ASSERT_NOT_NULL(dict);
+    TEST_ASSERT_EQUAL_INT(DICT_TEST_ENTRIES, (int)predator_dict_count(dict));
+    TEST_ASSERT_EQUAL_INT(4, predator_dict_width(dict));
+
+    for(int pass = 0; pass < 2; pass++) {
+        uint32_t key;
+        uint8_t priority;
+        for(uint32_t i = 0; i < DICT_TEST_ENTRIES; i++) {
+            TEST_ASSERT(predator_dict_next(dict, &key, &priority));
+            TEST_ASSERT(key == 0xA5000000 + i);
+            TEST_ASSERT_EQUAL_INT(255 - (int)i, priority);
+        }
+        TEST_ASSERT(!predator_dict_next(dict, &key, &priority));
+        TEST_ASSERT(predator_dict_rewind(dict));
+    }
+
+    predator_dict_close(dict);
+    storage_common_remove(storage, DICT_TEST_PATH);
+    furi_record_close(RECORD_STORAGE);
+    return TestResultPass;
+}
+
+// Test key iterator falls back to the built-in tables without SD
+static TestResult test_dict_builtin_fallback(void* context) {
+    UNUSED(context);
+    const PredatorKeyDict dicts[] = {PredatorKeyDictEM4305, PredatorKeyDictMifare, PredatorKeyDictKeeloq};
+    for(size_t d = 0; d < COUNT_OF(dicts); d++) {
+        PredatorKeyIter iter;
+        predator_key_iter_begin(&iter, NULL, dicts[d]);
+        TEST_ASSERT(!predator_key_iter_from_sd(&iter));
+        TEST_ASSERT(predator_key_iter_count(&iter) == predator_keys_count(dicts[d]));
+
+        uint8_t key[PREDATOR_DICT_MAX_WIDTH];
+        uint8_t expected[PREDATOR_DICT_MAX_WIDTH];
+        size_t n = 0;
+        while(predator_key_iter_next(&iter, key)) {
+            TEST_ASSERT(predator_keys_get(dicts[d], n, expected));
+            TEST_ASSERT(memcmp(key, expected, predator_keys_width(dicts[d])) == 0);
+            n++;
+        }
+        TEST_ASSERT(n == predator_keys_count(dicts[d]));
+        predator_key_iter_end(&iter);
+    }
+    return TestResultPass;
+}
+
+bool predator_run_dict_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"Dictionary SD Streaming", test_dict_stream, true},
+        {"Dictionary Built-in Fallback", test_dict_builtin_fallback, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "Key Dictionary Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
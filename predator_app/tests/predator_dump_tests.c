@@ -0,0 +1,202 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_dump.h"
+#include <storage/storage.h>
+#include <string.h>
+
+#define DUMP_TEST_PATH PREDATOR_DUMP_DIR "/test.pdmp"
+#define DUMP_TEST_OUT  PREDATOR_DUMP_DIR "/test.out"
+
+static const uint8_t dump_test_uid[8] = {0xE0, 0x04, 0x01, 0x50, 0x12, 0x34, 0x56, 0x78};
+
+// Read a small exported file into buf (NUL terminated)
+static size_t dump_test_slurp(Storage* storage, const char* path, char* buf, size_t size) {
+    File* file = storage_file_alloc(storage);
+    size_t len = 0;
+    if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        len = storage_file_read(file, buf, size - 1);
+    }
+    buf[len] = '\0';
+    storage_file_close(file);
+    storage_file_free(file);
+    return len;
+}
+
+// ISO15693 tag: DSFID 01, AFI 3D, IC ref 02, 4-byte blocks
+static PredatorDumpWriter* dump_test_iso15693(Storage* storage, uint16_t blocks) {
+    PredatorDumpWriter* dump = predator_dump_writer_open(
+        storage, DUMP_TEST_PATH, PredatorDumpCardIso15693, dump_test_uid, sizeof(dump_test_uid));
+    if(!dump) return NULL;
+    const uint8_t info[6] = {0x01, 0x3D, 0x02, 4, blocks & 0xFF, blocks >> 8};
+    predator_dump_info(dump, info, sizeof(info));
+    predator_dump_area(dump, 0, 4, blocks);
+    return dump;
+}
+
+// Test records survive staging-buffer flushes and come back in order
+static TestResult test_dump_round_trip(void* context) {
+    UNUSED(context);
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    // 7 bytes per unit record: several 512-byte flushes
+    const uint16_t blocks = 300;
+    PredatorDumpWriter* dump = dump_test_iso15693(storage, blocks);
+    TEST_ASSERT_NOT_NULL(dump);
+    for(uint16_t i = 0; i < blocks; i++) {
+        if(i == 150) {
+            TEST_ASSERT(predator_dump_missing(dump, i, 0x0F));
+            continue;
+        }
+        const uint8_t data[4] = {i & 0xFF, i >> 8, 0xA5, (uint8_t)~i};
+        TEST_ASSERT(predator_dump_unit(dump, i, data, sizeof(data)));
+    }
+    uint8_t too_long[PREDATOR_DUMP_MAX_VALUE];
+    memset(too_long, 0, sizeof(too_long));
+    TEST_ASSERT(!predator_dump_unit(dump, 0, too_long, sizeof(too_long)));
+    TEST_ASSERT(predator_dump_writer_close(dump));
+
+    PredatorDumpReader* reader = predator_dump_reader_open(storage, DUMP_TEST_PATH);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT(predator_dump_reader_card(reader) == PredatorDumpCardIso15693);
+
+    PredatorDumpRecord rec;
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec));
+    TEST_ASSERT(rec.tag == PredatorDumpTagUid && rec.len == 8);
+    TEST_ASSERT(memcmp(rec.value, dump_test_uid, 8) == 0);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagInfo);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagArea);
+
+    for(uint16_t i = 0; i < blocks; i++) {
+        TEST_ASSERT(predator_dump_reader_next(reader, &rec));
+        TEST_ASSERT(rec.value[0] == (i & 0xFF) && rec.value[1] == (i >> 8));
+        if(i == 150) {
+            TEST_ASSERT(rec.tag == PredatorDumpTagMissing && rec.len == 4);
+            continue;
+        }
+        TEST_ASSERT(rec.tag == PredatorDumpTagUnit && rec.len == 6);
+        TEST_ASSERT(rec.value[4] == 0xA5 && rec.value[5] == (uint8_t)~i);
+    }
+
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagTiming);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagEnd);
+    TEST_ASSERT(rec.value[0] == (3 + blocks + 1) % 256);
+    TEST_ASSERT(!predator_dump_reader_next(reader, &rec));
+    predator_dump_reader_close(reader);
+
+    storage_common_remove(storage, DUMP_TEST_PATH);
+    furi_record_close(RECORD_STORAGE);
+    return TestResultPass;
+}
+
+// Test JSON export of a FeliCa dump
+static TestResult test_dump_export_json(void* context) {
+    UNUSED(context);
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    const uint8_t idm[8] = {0x01, 0x2E, 0x4C, 0xE4, 0x62, 0x1A, 0x8F, 0x30};
+    const uint8_t info[10] = {0x10, 0x0B, 0x4B, 0x42, 0x84, 0x85, 0xD0, 0xFF, 0x03, 0x00};
+    uint8_t block[16];
+    memset(block, 0x11, sizeof(block));
+
+    PredatorDumpWriter* dump =
+        predator_dump_writer_open(storage, DUMP_TEST_PATH, PredatorDumpCardFelica, idm, 8);
+    TEST_ASSERT_NOT_NULL(dump);
+    predator_dump_info(dump, info, sizeof(info));
+    predator_dump_area(dump, 0x008B, 16, 0);
+    predator_dump_unit(dump, 0, block, sizeof(block));
+    predator_dump_area(dump, 0x090F, 16, 0);
+    predator_dump_units(dump, 0, block, 8, 2);
+    predator_dump_missing(dump, 2, 0xA2FF);
+    TEST_ASSERT(predator_dump_writer_close(dump));
+
+    char json[1024];
+    TEST_ASSERT(predator_dump_export_json(storage, DUMP_TEST_PATH, DUMP_TEST_OUT));
+    TEST_ASSERT(dump_test_slurp(storage, DUMP_TEST_OUT, json, sizeof(json)) > 0);
+    TEST_ASSERT(strstr(json, "\"card\": \"FeliCa\"") != NULL);
+    TEST_ASSERT(strstr(json, "\"uid\": \"012E4CE4621A8F30\"") != NULL);
+    TEST_ASSERT(strstr(json, "\"info\": \"100B4B428485D0FF0300\"") != NULL);
+    TEST_ASSERT(strstr(json, "{\"id\": 139, \"unit_size\": 16") != NULL);
+    TEST_ASSERT(strstr(json, "{\"id\": 2319, \"unit_size\": 16") != NULL);
+    TEST_ASSERT(strstr(json, "{\"index\": 1, \"data\": \"1111111111111111\"}") != NULL);
+    TEST_ASSERT(strstr(json, "{\"index\": 2, \"status\": 41727}") != NULL);
+    TEST_ASSERT(strstr(json, "\"timing\": {\"elapsed_us\": ") != NULL);
+    TEST_ASSERT(strstr(json, "\"complete\": true\n}\n") != NULL);
+
+    // Brackets balance
+    int depth = 0;
+    for(const char* p = json; *p; p++) {
+        if(*p == '{' || *p == '[') depth++;
+        if(*p == '}' || *p == ']') depth--;
+        TEST_ASSERT(depth >= 0);
+    }
+    TEST_ASSERT_EQUAL_INT(0, depth);
+
+    storage_common_remove(storage, DUMP_TEST_OUT);
+    storage_common_remove(storage, DUMP_TEST_PATH);
+    furi_record_close(RECORD_STORAGE);
+    return TestResultPass;
+}
+
+// Test Flipper .nfc export of an ISO15693 dump with an unreadable block
+static TestResult test_dump_export_nfc(void* context) {
+    UNUSED(context);
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    PredatorDumpWriter* dump = dump_test_iso15693(storage, 4);
+    TEST_ASSERT_NOT_NULL(dump);
+    const uint8_t data[8] = {0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x02, 0x03, 0x04};
+    predator_dump_units(dump, 0, data, 4, 2);
+    predator_dump_missing(dump, 2, 0);
+    TEST_ASSERT(predator_dump_writer_close(dump));
+
+    char nfc[512];
+    TEST_ASSERT(predator_dump_export_nfc(storage, DUMP_TEST_PATH, DUMP_TEST_OUT));
+    dump_test_slurp(storage, DUMP_TEST_OUT, nfc, sizeof(nfc));
+    TEST_ASSERT(strcmp(nfc,
+                       "Filetype: Flipper NFC device\n"
+                       "Version: 4\n"
+                       "Device type: ISO15693-3\n"
+                       "UID: E0 04 01 50 12 34 56 78\n"
+                       "DSFID: 01\n"
+                       "AFI: 3D\n"
+                       "IC Reference: 02\n"
+                       "Lock DSFID: false\n"
+                       "Lock AFI: false\n"
+                       "Block Count: 4\n"
+                       "Block Size: 04\n"
+                       "Data Content: DE AD BE EF 01 02 03 04 00 00 00 00 00 00 00 00\n"
+                       "Security Status: 00 00 00 00\n") == 0);
+
+    // No .nfc representation for Calypso
+    dump = predator_dump_writer_open(
+        storage, DUMP_TEST_PATH, PredatorDumpCardCalypso, dump_test_uid, 4);
+    TEST_ASSERT_NOT_NULL(dump);
+    TEST_ASSERT(predator_dump_writer_close(dump));
+    TEST_ASSERT(!predator_dump_export_nfc(storage, DUMP_TEST_PATH, DUMP_TEST_OUT));
+
+    storage_common_remove(storage, DUMP_TEST_OUT);
+    storage_common_remove(storage, DUMP_TEST_PATH);
+    furi_record_close(RECORD_STORAGE);
+    return TestResultPass;
+}
+
+bool predator_run_dump_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"Dump Round Trip", test_dump_round_trip, true},
+        {"Dump JSON Export", test_dump_export_json, true},
+        {"Dump NFC Export", test_dump_export_nfc, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "Dump Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
@@ -0,0 +1,243 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_en1545.h"
+#include "../helpers/predator_crypto_calypso.h"
+#include <string.h>
+
+#define EN1545_BENCH_RECORDS 2000
+
+// MSB-first bit writer for building records
+static void en1545_put(uint8_t* buf, size_t* pos, uint32_t value, uint8_t bits) {
+    for(int i = bits - 1; i >= 0; i--) {
+        if((value >> i) & 1) buf[*pos >> 3] |= 0x80 >> (*pos & 7);
+        (*pos)++;
+    }
+}
+
+// Intercode event: date, time, code, location, vehicle, contract pointer
+static void en1545_build_event(uint8_t* record, uint32_t days, uint32_t minutes, uint8_t code,
+                               uint16_t location, uint16_t vehicle, uint8_t contract) {
+    size_t pos = 0;
+    memset(record, 0, CALYPSO_RECORD_SIZE);
+    en1545_put(record, &pos, days, EN1545_DATE_BITS);
+    en1545_put(record, &pos, minutes, EN1545_TIME_BITS);
+    en1545_put(record, &pos, (1UL << 2) | (1UL << 8) | (1UL << 14) | (1UL << 25), 28);
+    en1545_put(record, &pos, code, 8);
+    en1545_put(record, &pos, location, 16);
+    en1545_put(record, &pos, vehicle, 16);
+    en1545_put(record, &pos, contract, 5);
+}
+
+// Test the bit reader across byte boundaries
+static TestResult test_en1545_read_bits(void* context) {
+    UNUSED(context);
+    const uint8_t data[5] = {0xA5, 0x3C, 0xFF, 0x00, 0x81};
+
+    TEST_ASSERT(en1545_read_bits(data, 0, 0) == 0);
+    TEST_ASSERT(en1545_read_bits(data, 0, 1) == 1);
+    TEST_ASSERT(en1545_read_bits(data, 0, 4) == 0xA);
+    TEST_ASSERT(en1545_read_bits(data, 4, 8) == 0x53);
+    TEST_ASSERT(en1545_read_bits(data, 13, 20) == 0x9FE01);
+    TEST_ASSERT(en1545_read_bits(data, 0, 32) == 0xA53CFF00);
+    TEST_ASSERT(en1545_read_bits(data, 3, 32) == 0x29E7F804);
+    TEST_ASSERT(en1545_read_bits(data, 39, 1) == 1);
+    return TestResultPass;
+}
+
+// Test nested bitmaps, skipped subtrees and truncation
+static TestResult test_en1545_bitmaps(void* context) {
+    UNUSED(context);
+    static const En1545Field layout[] = {
+        EN1545_INT(4, 1),
+        EN1545_BITMAP(3),
+            EN1545_INT(5, 2),
+            EN1545_BITMAP(2),
+                EN1545_INT(3, 3),
+                EN1545_SKIP(40),
+            EN1545_INT(7, 4),
+        EN1545_INT(6, 5),
+    };
+    uint8_t rec[16];
+    size_t pos;
+    En1545Values v;
+
+    // Child 0 absent: its descriptor is skipped without consuming bits
+    memset(rec, 0, sizeof(rec));
+    pos = 0;
+    en1545_put(rec, &pos, 0x9, 4);
+    en1545_put(rec, &pos, 0x6, 3);   // Children 1 and 2
+    en1545_put(rec, &pos, 0x3, 2);   // Nested: both present
+    en1545_put(rec, &pos, 0x5, 3);
+    en1545_put(rec, &pos, 0, 32);
+    en1545_put(rec, &pos, 0xFF, 8);
+    en1545_put(rec, &pos, 0x55, 7);
+    en1545_put(rec, &pos, 0x2A, 6);
+    TEST_ASSERT(en1545_decode(layout, COUNT_OF(layout), rec, sizeof(rec), &v));
+    TEST_ASSERT(v.value[1] == 0x9 && en1545_has(&v, 1));
+    TEST_ASSERT(!en1545_has(&v, 2));
+    TEST_ASSERT(v.value[3] == 0x5 && en1545_has(&v, 3));
+    TEST_ASSERT(v.value[4] == 0x55 && v.value[5] == 0x2A);
+
+    // Nested bitmap absent: its whole subtree is skipped
+    memset(rec, 0, sizeof(rec));
+    pos = 0;
+    en1545_put(rec, &pos, 0x3, 4);
+    en1545_put(rec, &pos, 0x1, 3);   // Child 0 only
+    en1545_put(rec, &pos, 0x11, 5);
+    en1545_put(rec, &pos, 0x3F, 6);
+    TEST_ASSERT(en1545_decode(layout, COUNT_OF(layout), rec, 3, &v));
+    TEST_ASSERT(v.value[2] == 0x11 && v.value[5] == 0x3F);
+    TEST_ASSERT(!en1545_has(&v, 3) && !en1545_has(&v, 4));
+
+    // Record ending inside a field
+    TEST_ASSERT(!en1545_decode(layout, COUNT_OF(layout), rec, 2, &v));
+
+    // Bitmap announcing more children than the table holds
+    TEST_ASSERT(!en1545_decode(layout, 3, rec, sizeof(rec), &v));
+    return TestResultPass;
+}
+
+// Test EN1545 date/time conversion to BCD
+static TestResult test_en1545_dates(void* context) {
+    UNUSED(context);
+    uint8_t ymd[3];
+    uint8_t hm[2];
+
+    en1545_date_to_bcd(0, ymd);
+    TEST_ASSERT(ymd[0] == 0x97 && ymd[1] == 0x01 && ymd[2] == 0x01);
+    en1545_date_to_bcd(1155, ymd);
+    TEST_ASSERT(ymd[0] == 0x00 && ymd[1] == 0x03 && ymd[2] == 0x01);
+    en1545_date_to_bcd(9920, ymd);
+    TEST_ASSERT(ymd[0] == 0x24 && ymd[1] == 0x02 && ymd[2] == 0x29);
+    en1545_date_to_bcd(10591, ymd);
+    TEST_ASSERT(ymd[0] == 0x25 && ymd[1] == 0x12 && ymd[2] == 0x31);
+
+    en1545_time_to_bcd(0, hm);
+    TEST_ASSERT(hm[0] == 0x00 && hm[1] == 0x00);
+    en1545_time_to_bcd(1439, hm);
+    TEST_ASSERT(hm[0] == 0x23 && hm[1] == 0x59);
+    return TestResultPass;
+}
+
+// Test Intercode event records, single and whole-file
+static TestResult test_en1545_calypso_events(void* context) {
+    UNUSED(context);
+    uint8_t file[3 * CALYPSO_RECORD_SIZE];
+    CalypsoEvent events[3];
+
+    en1545_build_event(&file[0], 9920, 8 * 60 + 15, 0x31, 0x1234, 0x0A0B, 3);
+    memset(&file[CALYPSO_RECORD_SIZE], 0, CALYPSO_RECORD_SIZE);   // Blank
+    en1545_build_event(&file[2 * CALYPSO_RECORD_SIZE], 9921, 1439, 0x27, 0x4321, 0, 1);
+
+    TEST_ASSERT(calypso_parse_event(file, &events[0], Calypso_Navigo));
+    TEST_ASSERT(events[0].event_type == 0x01);
+    TEST_ASSERT(events[0].date[0] == 0x24 && events[0].date[1] == 0x02 && events[0].date[2] == 0x29);
+    TEST_ASSERT(events[0].time[0] == 0x08 && events[0].time[1] == 0x15);
+    TEST_ASSERT(events[0].location_id == 0x1234);
+    TEST_ASSERT(events[0].vehicle_id[0] == 0x0A && events[0].vehicle_id[1] == 0x0B);
+    TEST_ASSERT(events[0].contract_used == 3);
+
+    // Unknown layouts and blank records are refused
+    TEST_ASSERT(!calypso_parse_event(file, &events[0], Calypso_MOBIB));
+    TEST_ASSERT(!calypso_parse_event(&file[CALYPSO_RECORD_SIZE], &events[0], Calypso_Navigo));
+
+    // Whole file: blank record skipped
+    TEST_ASSERT(calypso_parse_events(file, 3, events, 3, Calypso_Lyon_TCL) == 2);
+    TEST_ASSERT(events[0].location_id == 0x1234);
+    TEST_ASSERT(events[1].event_type == 0x02 && events[1].location_id == 0x4321);
+    TEST_ASSERT(events[1].date[2] == 0x01 && events[1].date[1] == 0x03);
+    TEST_ASSERT(calypso_parse_events(file, 3, events, 1, Calypso_Navigo) == 1);
+    return TestResultPass;
+}
+
+// Intercode contract: tariff, customer profile, validity dates/zones/journeys, status
+static void en1545_build_contract(uint8_t* record, uint8_t status) {
+    size_t pos = 0;
+    memset(record, 0, CALYPSO_RECORD_SIZE);
+    en1545_put(record, &pos, (1UL << 2) | (1UL << 4) | (1UL << 13) | (1UL << 16), 20);
+    en1545_put(record, &pos, 0x4001, 16);
+    en1545_put(record, &pos, 0x1, 2);
+    en1545_put(record, &pos, 12, 6);
+    en1545_put(record, &pos, (1UL << 0) | (1UL << 2) | (1UL << 6) | (1UL << 7), 9);
+    en1545_put(record, &pos, 9920, EN1545_DATE_BITS);
+    en1545_put(record, &pos, 10591, EN1545_DATE_BITS);
+    en1545_put(record, &pos, 0x1F, 8);
+    en1545_put(record, &pos, 10, 16);
+    en1545_put(record, &pos, status, 8);
+}
+
+// Test Intercode contract records
+static TestResult test_en1545_calypso_contract(void* context) {
+    UNUSED(context);
+    uint8_t rec[CALYPSO_RECORD_SIZE];
+    CalypsoContract contract;
+
+    en1545_build_contract(rec, 0x01);
+    TEST_ASSERT(calypso_parse_contract(rec, &contract, Calypso_Navigo));
+    TEST_ASSERT(contract.tariff_code == 0x01);
+    TEST_ASSERT(contract.profile_number == 12);
+    TEST_ASSERT(contract.validity_start[0] == 0x24 && contract.validity_start[2] == 0x29);
+    TEST_ASSERT(contract.validity_end[0] == 0x25 && contract.validity_end[1] == 0x12);
+    TEST_ASSERT(contract.zones[0] == 0x1F);
+    TEST_ASSERT(contract.trip_counter == 10);
+    TEST_ASSERT(contract.is_active);
+
+    // Erasable status: parsed but not in force
+    en1545_build_contract(rec, 0xFF);
+    TEST_ASSERT(calypso_parse_contract(rec, &contract, Calypso_Navigo));
+    TEST_ASSERT(!contract.is_active);
+
+    // Blank record
+    memset(rec, 0, sizeof(rec));
+    TEST_ASSERT(!calypso_parse_contract(rec, &contract, Calypso_Navigo));
+    return TestResultPass;
+}
+
+// Benchmark event decoding (log only, never fails)
+static TestResult test_en1545_benchmark(void* context) {
+    UNUSED(context);
+    uint8_t rec[CALYPSO_RECORD_SIZE];
+    CalypsoEvent event;
+    uint32_t decoded = 0;
+    en1545_build_event(rec, 9920, 600, 0x32, 0x0102, 0x0304, 2);
+
+    uint32_t start = furi_get_tick();
+    for(int i = 0; i < EN1545_BENCH_RECORDS; i++) {
+        rec[8] ^= (uint8_t)i;   // Vary the location (bits 61..76)
+        decoded += calypso_parse_event(rec, &event, Calypso_Navigo);
+    }
+    uint32_t elapsed_ms = furi_get_tick() - start;
+    TEST_ASSERT(decoded == EN1545_BENCH_RECORDS);
+
+    FURI_LOG_I(
+        "TEST",
+        "EN1545: %d events in %lu ms (%lu us/record)",
+        EN1545_BENCH_RECORDS,
+        (unsigned long)elapsed_ms,
+        (unsigned long)(elapsed_ms * 1000 / EN1545_BENCH_RECORDS));
+    return TestResultPass;
+}
+
+bool predator_run_en1545_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"EN1545 Bit Reader", test_en1545_read_bits, true},
+        {"EN1545 Nested Bitmaps", test_en1545_bitmaps, true},
+        {"EN1545 Dates", test_en1545_dates, true},
+        {"Calypso Intercode Events", test_en1545_calypso_events, true},
+        {"Calypso Intercode Contract", test_en1545_calypso_contract, true},
+        {"EN1545 Decode Throughput", test_en1545_benchmark, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "EN1545 Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
@@ -0,0 +1,277 @@
+#include "predator_test_framework.h"
+#include "predator_nfc_test_recording.h"
+#include "../helpers/predator_felica_sync.h"
+#include <storage/storage.h>
+#include <stdio.h>
+#include <string.h>
+
+// Test context structure
+typedef struct {
+    NfcTestContext nfc;
+    FeliCaCard card;
+    uint8_t ring[FELICA_SUICA_HISTORY_BLOCKS * 16];  // Card's history blocks
+} SyncTestContext;
+
+static const uint8_t sync_test_idm[8] = {0x01, 0x2E, 0x4C, 0xE4, 0x62, 0x1A, 0x8F, 0x31};
+static const uint8_t sync_test_pmm[8] = {0x10, 0x0B, 0x4B, 0x42, 0x84, 0x85, 0xD0, 0xFF};
+
+// Card history ring: block 0 holds sequence newest, amount mirrors the sequence
+static void sync_rec_ring(SyncTestContext* ctx, uint16_t newest, uint8_t count) {
+    nfc_rec_reset(ctx->nfc.rec, "suica-sync");
+    memset(ctx->ring, 0, sizeof(ctx->ring));
+    for(uint8_t i = 0; i < count; i++) {
+        uint8_t* block = &ctx->ring[i * 16];
+        const uint16_t seq = newest - i;
+        block[0] = 0x16;  // Gate exit
+        block[5] = seq & 0xFF;
+        block[6] = seq >> 8;
+        block[13] = seq >> 8;
+        block[14] = seq & 0xFF;
+    }
+}
+
+// Read Without Encryption of ring blocks first..first+count-1
+static void sync_rec_read(SyncTestContext* ctx, uint8_t first, uint8_t count) {
+    const uint16_t service = FELICA_SERVICE_SUICA_HISTORY;
+    uint8_t block_list[FELICA_SUICA_HISTORY_BLOCKS * 2];
+    for(uint8_t b = 0; b < count; b++) {
+        block_list[b * 2] = 0x80;
+        block_list[b * 2 + 1] = first + b;
+    }
+    nfc_rec_felica_read(ctx->nfc.rec, sync_test_idm, &service, 1, block_list, count,
+                        &ctx->ring[first * 16], 2000);
+}
+
+// Full history read: block 0, then the other 19 in PMm-sized batches
+static void sync_rec_full_read(SyncTestContext* ctx) {
+    sync_rec_read(ctx, 0, 1);
+    sync_rec_read(ctx, 1, FELICA_MAX_BLOCKS_PER_READ);
+    sync_rec_read(ctx, 1 + FELICA_MAX_BLOCKS_PER_READ,
+                  FELICA_SUICA_HISTORY_BLOCKS - 1 - FELICA_MAX_BLOCKS_PER_READ);
+}
+
+static void sync_test_history_path(char* path, size_t path_len) {
+    snprintf(path, path_len, "%s/%02X%02X%02X%02X%02X%02X%02X%02X.fhs", FELICA_SYNC_DIR,
+             sync_test_idm[0], sync_test_idm[1], sync_test_idm[2], sync_test_idm[3],
+             sync_test_idm[4], sync_test_idm[5], sync_test_idm[6], sync_test_idm[7]);
+}
+
+static void sync_test_clear(Storage* storage) {
+    char path[64];
+    sync_test_history_path(path, sizeof(path));
+    storage_common_remove(storage, path);
+    storage_common_remove(storage, FELICA_SYNC_DIR "/index.bin");
+}
+
+// Setup function - called before the suite
+static void sync_test_setup(void* context) {
+    SyncTestContext* ctx = (SyncTestContext*)context;
+    nfc_test_setup(&ctx->nfc);
+    ctx->nfc.app->storage = furi_record_open(RECORD_STORAGE);
+    memset(&ctx->card, 0, sizeof(FeliCaCard));
+    memcpy(ctx->card.idm, sync_test_idm, 8);
+    memcpy(ctx->card.pmm, sync_test_pmm, 8);
+}
+
+// Teardown function - drop the test card's store
+static void sync_test_teardown(void* context) {
+    SyncTestContext* ctx = (SyncTestContext*)context;
+    sync_test_clear(ctx->nfc.app->storage);
+    furi_record_close(RECORD_STORAGE);
+    nfc_test_teardown(&ctx->nfc);
+}
+
+// Test first sync, unchanged re-read and an incremental sync
+static TestResult test_felica_sync_incremental(void* context) {
+    SyncTestContext* ctx = (SyncTestContext*)context;
+    sync_test_clear(ctx->nfc.app->storage);
+    FeliCaSyncResult result;
+    FeliCaSyncEntry entry;
+
+    // First sight: whole ring read, only used entries stored
+    sync_rec_ring(ctx, 105, 5);
+    sync_rec_full_read(ctx);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT_EQUAL_INT(5, (int)result.new_records);
+    TEST_ASSERT_EQUAL_INT(5, (int)result.total_records);
+    TEST_ASSERT_EQUAL_INT(FELICA_SUICA_HISTORY_BLOCKS, (int)result.blocks_read);
+    TEST_ASSERT(!result.gap);
+    TEST_ASSERT(felica_sync_get_entry(ctx->nfc.app, sync_test_idm, &entry));
+    TEST_ASSERT_EQUAL_INT(105, entry.last_sequence);
+
+    // Same card again: block 0 only
+    sync_rec_ring(ctx, 105, 5);
+    sync_rec_read(ctx, 0, 1);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT_EQUAL_INT(0, (int)result.new_records);
+    TEST_ASSERT_EQUAL_INT(5, (int)result.total_records);
+    TEST_ASSERT_EQUAL_INT(1, (int)result.blocks_read);
+    TEST_ASSERT_EQUAL_INT(0, (int)ctx->nfc.replay.misses);
+
+    // Three new trips: block 0 plus blocks 1-2
+    sync_rec_ring(ctx, 108, 8);
+    sync_rec_read(ctx, 0, 1);
+    sync_rec_read(ctx, 1, 2);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT_EQUAL_INT(3, (int)result.new_records);
+    TEST_ASSERT_EQUAL_INT(8, (int)result.total_records);
+    TEST_ASSERT_EQUAL_INT(3, (int)result.blocks_read);
+    TEST_ASSERT_EQUAL_INT(0, (int)ctx->nfc.replay.misses);
+
+    // Stored history comes back newest first, pageable
+    FeliCaTransaction transactions[4];
+    TEST_ASSERT_EQUAL_INT(
+        4, (int)felica_sync_load(ctx->nfc.app, sync_test_idm, 0, transactions, 4, FeliCa_Suica));
+    for(int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(108 - i, transactions[i].amount);
+    }
+    TEST_ASSERT_EQUAL_INT(
+        2, (int)felica_sync_load(ctx->nfc.app, sync_test_idm, 6, transactions, 4, FeliCa_Suica));
+    TEST_ASSERT_EQUAL_INT(102, transactions[0].amount);
+    TEST_ASSERT_EQUAL_INT(101, transactions[1].amount);
+    return TestResultPass;
+}
+
+// Test more trips than the ring holds since the last sync
+static TestResult test_felica_sync_gap(void* context) {
+    SyncTestContext* ctx = (SyncTestContext*)context;
+    sync_test_clear(ctx->nfc.app->storage);
+    FeliCaSyncResult result;
+    FeliCaSyncEntry entry;
+
+    sync_rec_ring(ctx, 0xFFFE, 3);
+    sync_rec_full_read(ctx);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT_EQUAL_INT(3, (int)result.new_records);
+
+    // 30 trips later, across the 16-bit wrap
+    sync_rec_ring(ctx, 28, FELICA_SUICA_HISTORY_BLOCKS);
+    sync_rec_full_read(ctx);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT(result.gap);
+    TEST_ASSERT_EQUAL_INT(FELICA_SUICA_HISTORY_BLOCKS, (int)result.new_records);
+    TEST_ASSERT_EQUAL_INT(3 + FELICA_SUICA_HISTORY_BLOCKS, (int)result.total_records);
+    TEST_ASSERT(felica_sync_get_entry(ctx->nfc.app, sync_test_idm, &entry));
+    TEST_ASSERT_EQUAL_INT(28, entry.last_sequence);
+    TEST_ASSERT_EQUAL_INT(3 + FELICA_SUICA_HISTORY_BLOCKS, entry.record_count);
+
+    // Unknown card: nothing stored
+    const uint8_t other[8] = {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01};
+    TEST_ASSERT(!felica_sync_get_entry(ctx->nfc.app, other, &entry));
+    return TestResultPass;
+}
+
+// Test a history read cut short after block 0 leaves the store as it was
+static TestResult test_felica_sync_partial_read(void* context) {
+    SyncTestContext* ctx = (SyncTestContext*)context;
+    sync_test_clear(ctx->nfc.app->storage);
+    FeliCaSyncResult result;
+    FeliCaSyncEntry entry;
+
+    sync_rec_ring(ctx, 100, 5);
+    sync_rec_full_read(ctx);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT_EQUAL_INT(5, (int)result.new_records);
+
+    // Five new trips, but only block 0 answers
+    sync_rec_ring(ctx, 105, 10);
+    sync_rec_read(ctx, 0, 1);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(!felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT(ctx->nfc.replay.misses > 0);
+    TEST_ASSERT_EQUAL_INT(0, (int)result.new_records);
+    TEST_ASSERT(felica_sync_get_entry(ctx->nfc.app, sync_test_idm, &entry));
+    TEST_ASSERT_EQUAL_INT(100, entry.last_sequence);
+    TEST_ASSERT_EQUAL_INT(5, entry.record_count);
+
+    // Next tap reads all five
+    sync_rec_ring(ctx, 105, 10);
+    sync_rec_read(ctx, 0, 1);
+    sync_rec_read(ctx, 1, 4);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT_EQUAL_INT(5, (int)result.new_records);
+    TEST_ASSERT_EQUAL_INT(10, (int)result.total_records);
+
+    FeliCaTransaction transactions[10];
+    TEST_ASSERT_EQUAL_INT(
+        10, (int)felica_sync_load(ctx->nfc.app, sync_test_idm, 0, transactions, 10, FeliCa_Suica));
+    for(int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_INT(105 - i, transactions[i].amount);
+    }
+    return TestResultPass;
+}
+
+// Test blocks left behind by a sync whose index update failed are replaced
+static TestResult test_felica_sync_stale_tail(void* context) {
+    SyncTestContext* ctx = (SyncTestContext*)context;
+    Storage* storage = ctx->nfc.app->storage;
+    sync_test_clear(storage);
+    FeliCaSyncResult result;
+
+    sync_rec_ring(ctx, 105, 5);
+    sync_rec_full_read(ctx);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+
+    // Two blocks appended without the index catching up
+    char path[64];
+    sync_test_history_path(path, sizeof(path));
+    File* file = storage_file_alloc(storage);
+    TEST_ASSERT(storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_APPEND));
+    uint8_t stale[32];
+    memset(stale, 0x5A, sizeof(stale));
+    TEST_ASSERT(storage_file_write(file, stale, sizeof(stale)) == sizeof(stale));
+    storage_file_close(file);
+
+    sync_rec_ring(ctx, 108, 8);
+    sync_rec_read(ctx, 0, 1);
+    sync_rec_read(ctx, 1, 2);
+    nfc_test_replay(&ctx->nfc);
+    TEST_ASSERT(felica_sync_history(ctx->nfc.app, &ctx->card, &result));
+    TEST_ASSERT_EQUAL_INT(8, (int)result.total_records);
+
+    TEST_ASSERT(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING));
+    TEST_ASSERT_EQUAL_INT(8 + 8 * 16, (int)storage_file_size(file));
+    storage_file_close(file);
+    storage_file_free(file);
+
+    FeliCaTransaction transactions[8];
+    TEST_ASSERT_EQUAL_INT(
+        8, (int)felica_sync_load(ctx->nfc.app, sync_test_idm, 0, transactions, 8, FeliCa_Suica));
+    for(int i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_INT(108 - i, transactions[i].amount);
+    }
+    return TestResultPass;
+}
+
+bool predator_run_felica_sync_tests() {
+    SyncTestContext context;
+
+    // Define test cases
+    TestCase test_cases[] = {
+        {"FeliCa Sync Incremental", test_felica_sync_incremental, true},
+        {"FeliCa Sync Gap", test_felica_sync_gap, true},
+        {"FeliCa Sync Partial Read", test_felica_sync_partial_read, true},
+        {"FeliCa Sync Stale Tail", test_felica_sync_stale_tail, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "FeliCa Sync Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = &context,
+        .setup = sync_test_setup,
+        .teardown = sync_test_teardown
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
@@ -0,0 +1,76 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_crypto_felica.h"
+#include "../helpers/predator_nfc_transport.h"
+#include <string.h>
+
+// Suica PMm (RC-S962): timing bytes 4B 42 84 85 D0 FF
+static const uint8_t felica_test_pmm[8] = {0x10, 0x0B, 0x4B, 0x42, 0x84, 0x85, 0xD0, 0xFF};
+
+// Test response times derived from PMm against hand-computed values
+static TestResult test_felica_pmm_timeout(void* context) {
+    UNUSED(context);
+    FeliCaCard card;
+    memset(&card, 0, sizeof(card));
+
+    // Not polled yet: transport default
+    TEST_ASSERT(felica_response_timeout_us(&card, FeliCaCmdRead, 1) == PREDATOR_NFC_TIMEOUT_US);
+    TEST_ASSERT(felica_response_timeout_us(NULL, FeliCaCmdRead, 1) == PREDATOR_NFC_TIMEOUT_US);
+
+    memcpy(card.pmm, felica_test_pmm, 8);
+    // 0x42: A=2, B=0, E=1 -> 302.1 * 3 * 4
+    TEST_ASSERT(felica_response_timeout_us(&card, FeliCaCmdRequestResponse, 0) == 3626);
+    // 0x4B: A=3, B=1, E=1 -> 302.1 * (2 * 2 + 4) * 4
+    TEST_ASSERT(felica_response_timeout_us(&card, FeliCaCmdRequestService, 2) == 9668);
+    // 0x85: A=5, B=0, E=2 -> 302.1 * (n + 6) * 16
+    TEST_ASSERT(felica_response_timeout_us(&card, FeliCaCmdRead, 1) == 33836);
+    TEST_ASSERT(felica_response_timeout_us(&card, FeliCaCmdRead, 15) == 101506);
+    // 0xD0: A=0, B=2, E=3 -> 302.1 * (3 + 1) * 64
+    TEST_ASSERT(felica_response_timeout_us(&card, FeliCaCmdWrite, 1) == 77338);
+
+    // More blocks never means less time
+    for(uint8_t n = 1; n < FELICA_MAX_BLOCKS_PER_READ; n++) {
+        TEST_ASSERT(felica_response_timeout_us(&card, FeliCaCmdRead, n) <
+                    felica_response_timeout_us(&card, FeliCaCmdRead, n + 1));
+    }
+    return TestResultPass;
+}
+
+// Test per-command block limits from the PMm IC type
+static TestResult test_felica_block_limits(void* context) {
+    UNUSED(context);
+    FeliCaCard card;
+    memset(&card, 0, sizeof(card));
+    memcpy(card.pmm, felica_test_pmm, 8);
+
+    TEST_ASSERT(felica_max_read_blocks(&card) == FELICA_MAX_BLOCKS_PER_READ);
+    card.pmm[1] = 0xF0;  // FeliCa Lite
+    TEST_ASSERT(felica_max_read_blocks(&card) == FELICA_LITE_BLOCKS_PER_READ);
+    card.pmm[1] = 0xF1;  // FeliCa Lite-S
+    TEST_ASSERT(felica_max_read_blocks(&card) == FELICA_LITE_BLOCKS_PER_READ);
+    TEST_ASSERT(felica_max_read_blocks(NULL) == 1);
+
+    // Largest batch fits one response frame (LEN is one byte)
+    TEST_ASSERT(13 + 16 * FELICA_MAX_BLOCKS_PER_READ <= 255);
+    return TestResultPass;
+}
+
+bool predator_run_felica_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"FeliCa PMm Timeout", test_felica_pmm_timeout, true},
+        {"FeliCa Block Limits", test_felica_block_limits, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "FeliCa Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
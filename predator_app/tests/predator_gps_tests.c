@@ -105,30 +105,65 @@ static TestResult test_gps_parse_gsv(void* context) {
     return TestResultPass;
 }
 
-// Test string parsing helper function
+// Test span tokenizer: one split, fields are views into the source string
 static TestResult test_string_helper(void* context) {
     UNUSED(context);
     
-    const char* test_str = "field1,field2,field3,field4,field5";
+    const char* test_str = "field1,field2,,field4,field5";
+    PredatorSpan fields[8];
     
-    // Get first field
-    char* field = predator_get_next_field(test_str, 0, ',');
-    TEST_ASSERT_NOT_NULL(field);
-    TEST_ASSERT_EQUAL_STRING("field1", field);
+    size_t count = predator_split(test_str, strlen(test_str), ',', fields, 8);
+    TEST_ASSERT_EQUAL_INT(5, (int)count);
     
-    // Get middle field
-    field = predator_get_next_field(test_str, 2, ',');
-    TEST_ASSERT_NOT_NULL(field);
-    TEST_ASSERT_EQUAL_STRING("field3", field);
+    // First, empty and last fields
+    TEST_ASSERT(predator_span_equals(fields[0], "field1"));
+    TEST_ASSERT(fields[0].ptr == test_str);
+    TEST_ASSERT(predator_span_equals(fields[2], ""));
+    TEST_ASSERT(predator_span_equals(fields[4], "field5"));
     
-    // Get last field
-    field = predator_get_next_field(test_str, 4, ',');
-    TEST_ASSERT_NOT_NULL(field);
-    TEST_ASSERT_EQUAL_STRING("field5", field);
+    // Capped split keeps the remainder in the last span
+    count = predator_split(test_str, strlen(test_str), ',', fields, 2);
+    TEST_ASSERT_EQUAL_INT(2, (int)count);
+    TEST_ASSERT(predator_span_equals(fields[1], "field2,,field4,field5"));
     
-    // Get non-existent field
-    field = predator_get_next_field(test_str, 10, ',');
-    TEST_ASSERT(field == NULL);
+    // Long fields are truncated to the buffer and reported
+    char copy[8];
+    TEST_ASSERT(!predator_span_copy(fields[1], copy, sizeof(copy)));
+    TEST_ASSERT_EQUAL_STRING("field2,", copy);
+    
+    return TestResultPass;
+}
+
+// Test integer, hex and decimal parsers on spans
+static TestResult test_string_span_numbers(void* context) {
+    UNUSED(context);
+    
+    int32_t value;
+    uint32_t uvalue;
+    float fvalue;
+    
+    TEST_ASSERT(predator_span_to_int32(predator_span_from_cstr("-42"), &value));
+    TEST_ASSERT_EQUAL_INT(-42, value);
+    TEST_ASSERT(predator_span_to_int32(predator_span_from_cstr("-2147483648"), &value));
+    TEST_ASSERT(value == INT32_MIN);
+    TEST_ASSERT(!predator_span_to_int32(predator_span_from_cstr("2147483648"), &value));
+    TEST_ASSERT(!predator_span_to_int32(predator_span_from_cstr("12abc"), &value));
+    TEST_ASSERT(!predator_span_to_uint32(predator_span_from_cstr(""), &uvalue));
+    TEST_ASSERT(!predator_span_to_uint32(predator_span_from_cstr("4294967296"), &uvalue));
+    
+    TEST_ASSERT(predator_span_to_hex32(predator_span_from_cstr("0x51243648"), &uvalue));
+    TEST_ASSERT(uvalue == 0x51243648);
+    TEST_ASSERT(predator_span_to_hex32(predator_span_from_cstr("deadBEEF"), &uvalue));
+    TEST_ASSERT(uvalue == 0xDEADBEEF);
+    TEST_ASSERT(!predator_span_to_hex32(predator_span_from_cstr("123456789"), &uvalue));
+    
+    // Parsers stop at the span end, not at the NUL terminator
+    PredatorSpan sats = predator_span_sub(predator_span_from_cstr("0812"), 0, 2);
+    TEST_ASSERT(predator_span_to_uint32(sats, &uvalue));
+    TEST_ASSERT(uvalue == 8);
+    
+    TEST_ASSERT(predator_span_to_float(predator_span_from_cstr("07.038"), &fvalue));
+    TEST_ASSERT(fabsf(fvalue - 7.038f) < 0.00001f);
     
     return TestResultPass;
 }
@@ -177,6 +212,7 @@ bool predator_run_gps_tests() {
         {"GPS Parse RMC Sentence", test_gps_parse_rmc, true},
         {"GPS Parse GSV Sentence", test_gps_parse_gsv, true},
         {"String Helper Function", test_string_helper, true},
+        {"String Span Number Parsing", test_string_span_numbers, true},
         {"GPS Coordinate Conversion", test_gps_coordinate_conversion, true},
         {"GPS Switch Logic", test_gps_switch_logic, true}
     };
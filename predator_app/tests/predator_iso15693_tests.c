@@ -0,0 +1,291 @@
+#include "predator_test_framework.h"
+#include "predator_nfc_test_recording.h"
+#include "../helpers/predator_crypto_iso15693.h"
+#include "../helpers/predator_dump.h"
+#include <string.h>
+
+// Tags on the air, UID LSB first; low nibbles pick the inventory slots
+static const uint8_t iso15693_test_uid_a[8] = {0x13, 0x9A, 0x44, 0x21, 0x0A, 0x01, 0x04, 0xE0};
+static const uint8_t iso15693_test_uid_b[8] = {0x25, 0x71, 0x03, 0x8C, 0x08, 0x01, 0x04, 0xE0};
+static const uint8_t iso15693_test_uid_c[8] = {0x75, 0x12, 0x9F, 0x5E, 0x08, 0x01, 0x04, 0xE0};
+
+// Add a frame; CRC is appended to non-empty requests and answers
+static uint8_t* iso15693_rec_add(NfcTestRecording* rec, const uint8_t* tx, size_t tx_len,
+                                 const uint8_t* rx, size_t rx_len, uint16_t card_us) {
+    uint8_t tx_crc[NFC_TEST_FRAME_SIZE];
+    uint8_t rx_crc[NFC_TEST_FRAME_SIZE];
+    if(tx_len) {
+        memcpy(tx_crc, tx, tx_len);
+        uint16_t crc = iso15693_crc16(tx, tx_len);
+        tx_crc[tx_len++] = crc & 0xFF;
+        tx_crc[tx_len++] = crc >> 8;
+    }
+    if(rx_len) {
+        memcpy(rx_crc, rx, rx_len);
+        uint16_t crc = iso15693_crc16(rx, rx_len);
+        rx_crc[rx_len++] = crc & 0xFF;
+        rx_crc[rx_len++] = crc >> 8;
+    }
+    return nfc_rec_add(rec, PredatorNfcTechIso15693, tx_crc, tx_len, rx_crc, rx_len, card_us);
+}
+
+// 16-slot inventory round: request, then 15 EOFs; uids[slot] answers,
+// collided[slot] is a garbled answer
+static void iso15693_rec_round(NfcTestRecording* rec, uint8_t mask, uint8_t mask_len,
+                               const uint8_t* uids[16], uint16_t collided) {
+    uint8_t req[4] = {0x06, 0x01, mask_len, mask};
+    for(uint8_t slot = 0; slot < 16; slot++) {
+        const uint8_t* tx = slot ? NULL : req;
+        size_t tx_len = slot ? 0 : (mask_len ? 4 : 3);
+        if(uids[slot]) {
+            uint8_t rx[10] = {0x00, 0x00};
+            memcpy(&rx[2], uids[slot], 8);
+            iso15693_rec_add(rec, tx, tx_len, rx, sizeof(rx), 300);
+        } else if(collided & (1 << slot)) {
+            const uint8_t garbled[10] = {0x00, 0x00, 0xF7, 0x7B, 0x8F};
+            uint8_t* stored = iso15693_rec_add(rec, tx, tx_len, garbled, sizeof(garbled), 300);
+            stored[11] ^= 0xFF;  // CRC broken
+        } else {
+            iso15693_rec_add(rec, tx, tx_len, NULL, 0, 0);
+        }
+    }
+}
+
+// Read Multiple Blocks answered with data, or refused if data is NULL
+static void iso15693_rec_read(NfcTestRecording* rec, const ISO15693Tag* tag,
+                              uint8_t first, uint8_t count, const uint8_t* data) {
+    uint8_t tx[12] = {0x22, 0x23};
+    for(int i = 0; i < 8; i++) tx[2 + i] = tag->uid[7 - i];
+    tx[10] = first;
+    tx[11] = count - 1;
+
+    uint8_t rx[NFC_TEST_FRAME_SIZE] = {0x00};
+    size_t rx_len = 1;
+    if(data) {
+        memcpy(&rx[1], data, count * tag->block_size);
+        rx_len += count * tag->block_size;
+    } else {
+        rx[0] = 0x01;   // Error flag
+        rx[1] = 0x10;   // Block not available
+        rx_len = 2;
+    }
+    iso15693_rec_add(rec, tx, sizeof(tx), rx, rx_len, 400);
+}
+
+static void iso15693_test_tag(ISO15693Tag* tag, ISO15693TagType type, uint16_t blocks) {
+    memset(tag, 0, sizeof(ISO15693Tag));
+    for(int i = 0; i < 8; i++) tag->uid[i] = iso15693_test_uid_a[7 - i];
+    tag->tag_type = type;
+    tag->block_count = blocks;
+    tag->block_size = 4;
+    tag->total_bytes = blocks * 4;
+}
+
+static void iso15693_test_replay(NfcTestContext* ctx) {
+    nfc_test_replay(ctx);
+    predator_nfc_reset_stats();
+}
+
+// Test type detection and per-type read limits
+static TestResult test_iso15693_type_limits(void* context) {
+    UNUSED(context);
+    ISO15693Tag tag;
+
+    iso15693_test_tag(&tag, ISO15693_Unknown, 80);
+    TEST_ASSERT(iso15693_detect_type(tag.uid) == ISO15693_ICODE_SLIX2);
+    const uint8_t slix[8] = {0xE0, 0x04, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01};
+    const uint8_t tagit[8] = {0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+    TEST_ASSERT(iso15693_detect_type(slix) == ISO15693_ICODE_SLIX);
+    TEST_ASSERT(iso15693_detect_type(tagit) == ISO15693_TagIt_HF_I);
+
+    tag.tag_type = ISO15693_ICODE_SLIX2;
+    TEST_ASSERT(iso15693_max_read_blocks(&tag) == 32);
+    tag.tag_type = ISO15693_TagIt_HF_I;
+    TEST_ASSERT(iso15693_max_read_blocks(&tag) == 8);
+    tag.tag_type = ISO15693_Generic;
+    TEST_ASSERT(iso15693_max_read_blocks(&tag) == 4);
+
+    // Large blocks: the response buffer caps the chunk
+    tag.tag_type = ISO15693_ICODE_SLIX2;
+    tag.block_size = 32;
+    TEST_ASSERT(iso15693_max_read_blocks(&tag) == ISO15693_MAX_READ_BYTES / 32);
+    return TestResultPass;
+}
+
+// Three tags, two sharing a slot: the collided slot is resolved one level down
+static TestResult test_iso15693_inventory(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    const uint8_t* slots[16] = {0};
+    uint8_t uids[4][8];
+    PredatorNfcStats stats;
+
+    nfc_rec_reset(ctx->rec, "shelf");
+    slots[3] = iso15693_test_uid_a;
+    iso15693_rec_round(ctx->rec, 0, 0, slots, 1 << 5);
+    memset(slots, 0, sizeof(slots));
+    slots[2] = iso15693_test_uid_b;
+    slots[7] = iso15693_test_uid_c;
+    iso15693_rec_round(ctx->rec, 0x05, 4, slots, 0);
+    iso15693_test_replay(ctx);
+
+    TEST_ASSERT(iso15693_inventory(ctx->app, uids, 4, 0) == 3);
+    TEST_ASSERT(uids[0][7] == 0x13 && uids[0][0] == 0xE0);
+    TEST_ASSERT(uids[1][7] == 0x25 && uids[2][7] == 0x75);
+
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 32);
+    TEST_ASSERT(ctx->replay.misses == 32 - 4);  // Empty slots
+
+    // Stops as soon as max_tags are found
+    iso15693_test_replay(ctx);
+    TEST_ASSERT(iso15693_inventory(ctx->app, uids, 1, 0) == 1);
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 4);
+
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// 80-block SLIX2 dump in Read Multiple Blocks chunks of 32
+static TestResult test_iso15693_read_multiple(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    ISO15693Tag tag;
+    uint8_t memory[80 * 4];
+    uint8_t data[80 * 4];
+    PredatorNfcStats stats;
+
+    for(size_t i = 0; i < sizeof(memory); i++) memory[i] = (uint8_t)(i * 7 + 1);
+    iso15693_test_tag(&tag, ISO15693_ICODE_SLIX2, 80);
+    nfc_rec_reset(ctx->rec, "slix2");
+    iso15693_rec_read(ctx->rec, &tag, 0, 32, memory);
+    iso15693_rec_read(ctx->rec, &tag, 32, 32, &memory[32 * 4]);
+    iso15693_rec_read(ctx->rec, &tag, 64, 16, &memory[64 * 4]);
+    iso15693_test_replay(ctx);
+
+    memset(data, 0, sizeof(data));
+    TEST_ASSERT(iso15693_read_blocks(ctx->app, &tag, 0, 80, data) == 80);
+    TEST_ASSERT(memcmp(data, memory, sizeof(memory)) == 0);
+
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 3 && stats.timeouts == 0);
+    FURI_LOG_I(
+        "TEST",
+        "SLIX2 dump: %lu frames, %lu ms",
+        (unsigned long)stats.frames,
+        (unsigned long)(predator_nfc_time_us() / 1000));
+
+    // Reads past the end are clipped to the tag
+    iso15693_test_replay(ctx);
+    TEST_ASSERT(iso15693_read_blocks(ctx->app, &tag, 64, 40, data) == 16);
+
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// Tag refusing a full chunk: halved and retried
+static TestResult test_iso15693_read_fallback(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    ISO15693Tag tag;
+    uint8_t memory[8 * 4];
+    uint8_t data[8 * 4];
+    PredatorNfcStats stats;
+
+    for(size_t i = 0; i < sizeof(memory); i++) memory[i] = (uint8_t)(0xA0 + i);
+    iso15693_test_tag(&tag, ISO15693_TagIt_HF_I, 8);
+    nfc_rec_reset(ctx->rec, "tagit");
+    iso15693_rec_read(ctx->rec, &tag, 0, 8, NULL);
+    iso15693_rec_read(ctx->rec, &tag, 0, 4, memory);
+    iso15693_rec_read(ctx->rec, &tag, 4, 4, &memory[16]);
+    iso15693_test_replay(ctx);
+
+    TEST_ASSERT(iso15693_read_blocks(ctx->app, &tag, 0, 8, data) == 8);
+    TEST_ASSERT(memcmp(data, memory, sizeof(memory)) == 0);
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 3 && stats.timeouts == 0);
+
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// Dump: a protected block is recorded with its error code, a silent tag ends the dump
+static TestResult test_iso15693_dump_stops(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    ISO15693Tag tag;
+    uint8_t memory[12 * 4];
+    PredatorNfcStats stats;
+
+    for(size_t i = 0; i < sizeof(memory); i++) memory[i] = (uint8_t)(0x30 + i);
+    iso15693_test_tag(&tag, ISO15693_Generic, 12);
+    nfc_rec_reset(ctx->rec, "protected");
+    iso15693_rec_read(ctx->rec, &tag, 0, 4, memory);
+    iso15693_rec_read(ctx->rec, &tag, 4, 4, NULL);
+    iso15693_rec_read(ctx->rec, &tag, 4, 2, NULL);
+    iso15693_rec_read(ctx->rec, &tag, 4, 1, NULL);
+    iso15693_rec_read(ctx->rec, &tag, 5, 4, &memory[5 * 4]);
+    // Blocks 9-11: tag gone, nothing recorded
+    iso15693_test_replay(ctx);
+
+    ctx->app->storage = furi_record_open(RECORD_STORAGE);
+    const char* path = PREDATOR_DUMP_DIR "/iso15693_test.pdmp";
+    TEST_ASSERT(iso15693_dump_tag(ctx->app, &tag, path));
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 6 && ctx->replay.misses == 1);  // One timeout, not three
+
+    PredatorDumpReader* reader = predator_dump_reader_open(ctx->app->storage, path);
+    TEST_ASSERT_NOT_NULL(reader);
+    PredatorDumpRecord rec;
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUid);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagInfo);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagArea);
+    for(uint8_t i = 0; i < 4; i++) {
+        TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUnit);
+        TEST_ASSERT(rec.value[0] == i && memcmp(&rec.value[2], &memory[i * 4], 4) == 0);
+    }
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagMissing);
+    TEST_ASSERT(rec.value[0] == 4 && rec.value[2] == 0x10 && rec.value[3] == 0x00);
+    for(uint8_t i = 5; i < 9; i++) {
+        TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUnit);
+        TEST_ASSERT(rec.value[0] == i && memcmp(&rec.value[2], &memory[i * 4], 4) == 0);
+    }
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagTiming);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagEnd);
+    predator_dump_reader_close(reader);
+
+    storage_common_remove(ctx->app->storage, path);
+    furi_record_close(RECORD_STORAGE);
+    ctx->app->storage = NULL;
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+bool predator_run_iso15693_tests() {
+    // Create context
+    NfcTestContext context;
+    memset(&context, 0, sizeof(context));
+
+    // Define test cases
+    TestCase test_cases[] = {
+        {"ISO15693 Type Limits", test_iso15693_type_limits, true},
+        {"ISO15693 16-Slot Inventory", test_iso15693_inventory, true},
+        {"ISO15693 Read Multiple", test_iso15693_read_multiple, true},
+        {"ISO15693 Read Fallback", test_iso15693_read_fallback, true},
+        {"ISO15693 Dump Stops", test_iso15693_dump_stops, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "ISO15693 Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = &context,
+        .setup = nfc_test_setup,
+        .teardown = nfc_test_teardown
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
@@ -0,0 +1,168 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_crypto_keydiv.h"
+#include <string.h>
+
+#define KEYDIV_BENCH_READS 500
+
+static const uint8_t keydiv_master_a[16] = {
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
+    0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x01};
+static const uint8_t keydiv_master_b[16] = {
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F};
+static const uint8_t keydiv_idm[16] = {
+    0x01, 0x2E, 0x4C, 0xE4, 0x62, 0x1A, 0x8F, 0x30,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18};
+
+// Test cached derivation matches des3_derive_key for every diversifier length
+static TestResult test_keydiv_matches_des3(void* context) {
+    UNUSED(context);
+    uint8_t expected[16];
+    uint8_t derived[16];
+    predator_keydiv_clear();
+
+    for(size_t len = 1; len <= 16; len++) {
+        des3_derive_key(keydiv_master_a, keydiv_idm, len, expected);
+        TEST_ASSERT(predator_keydiv_derive(keydiv_master_a, keydiv_idm, len, derived));
+        TEST_ASSERT(memcmp(derived, expected, 16) == 0);
+        // Second lookup is served from the cache
+        TEST_ASSERT(predator_keydiv_derive(keydiv_master_a, keydiv_idm, len, derived));
+        TEST_ASSERT(memcmp(derived, expected, 16) == 0);
+    }
+
+    // Invalid arguments are refused
+    TEST_ASSERT(!predator_keydiv_derive(NULL, keydiv_idm, 8, derived));
+    TEST_ASSERT(!predator_keydiv_derive(keydiv_master_a, keydiv_idm, 0, derived));
+    TEST_ASSERT(!predator_keydiv_derive(keydiv_master_a, keydiv_idm, 17, derived));
+    TEST_ASSERT(predator_keydiv_derive_ctx(keydiv_master_a, NULL, 8, NULL) == NULL);
+    predator_keydiv_clear();
+    return TestResultPass;
+}
+
+// Test hits, LRU eviction and master separation
+static TestResult test_keydiv_lru(void* context) {
+    UNUSED(context);
+    uint8_t idm[8];
+    uint8_t key_a[16];
+    uint8_t key_b[16];
+    uint32_t hits, misses;
+    predator_keydiv_clear();
+    memcpy(idm, keydiv_idm, sizeof(idm));
+
+    // Same diversifier under two masters: two entries, different keys
+    TEST_ASSERT(predator_keydiv_derive(keydiv_master_a, idm, 8, key_a));
+    TEST_ASSERT(predator_keydiv_derive(keydiv_master_b, idm, 8, key_b));
+    TEST_ASSERT(memcmp(key_a, key_b, 16) != 0);
+    predator_keydiv_stats(&hits, &misses);
+    TEST_ASSERT(hits == 0 && misses == 2);
+
+    // Fill the remaining slots, touching the first card in between
+    for(uint8_t card = 1; card < KEYDIV_DERIVED_SLOTS - 1; card++) {
+        idm[7] = keydiv_idm[7] ^ card;
+        TEST_ASSERT(predator_keydiv_derive(keydiv_master_a, idm, 8, key_b));
+    }
+    idm[7] = keydiv_idm[7];
+    TEST_ASSERT(predator_keydiv_derive(keydiv_master_a, idm, 8, key_b));
+    TEST_ASSERT(memcmp(key_a, key_b, 16) == 0);
+    predator_keydiv_stats(&hits, &misses);
+    TEST_ASSERT(hits == 1 && misses == KEYDIV_DERIVED_SLOTS);
+
+    // One more card evicts the least recently used entry (master B's),
+    // not the recently read first card
+    idm[7] = keydiv_idm[7] ^ 0x80;
+    TEST_ASSERT(predator_keydiv_derive(keydiv_master_a, idm, 8, key_b));
+    idm[7] = keydiv_idm[7];
+    TEST_ASSERT(predator_keydiv_derive(keydiv_master_a, idm, 8, key_b));
+    predator_keydiv_stats(&hits, &misses);
+    TEST_ASSERT(hits == 2 && misses == KEYDIV_DERIVED_SLOTS + 1);
+    TEST_ASSERT(predator_keydiv_derive(keydiv_master_b, idm, 8, key_b));
+    predator_keydiv_stats(&hits, &misses);
+    TEST_ASSERT(misses == KEYDIV_DERIVED_SLOTS + 2);
+
+    // Clear wipes everything
+    predator_keydiv_clear();
+    predator_keydiv_stats(&hits, &misses);
+    TEST_ASSERT(hits == 0 && misses == 0);
+    return TestResultPass;
+}
+
+// Test cached schedules encrypt like freshly expanded ones
+static TestResult test_keydiv_schedules(void* context) {
+    UNUSED(context);
+    const uint8_t block[8] = {0x4E, 0x6F, 0x77, 0x20, 0x69, 0x73, 0x20, 0x74};
+    uint8_t derived[16];
+    uint8_t ref[8];
+    uint8_t out[8];
+    predator_keydiv_clear();
+
+    const DES3Context* card = predator_keydiv_derive_ctx(keydiv_master_a, keydiv_idm, 8, derived);
+    TEST_ASSERT(card != NULL);
+    des3_encrypt_block(card, block, out);
+    des3_encrypt_ecb(derived, block, ref);
+    TEST_ASSERT(memcmp(out, ref, 8) == 0);
+
+    const DES3Context* master = predator_keydiv_master_ctx(keydiv_master_b);
+    TEST_ASSERT(master != NULL);
+    des3_encrypt_block(master, block, out);
+    des3_encrypt_ecb(keydiv_master_b, block, ref);
+    TEST_ASSERT(memcmp(out, ref, 8) == 0);
+    predator_keydiv_clear();
+    return TestResultPass;
+}
+
+// Benchmark repeated reads of one card: direct vs cached (log only, never fails)
+static TestResult test_keydiv_benchmark(void* context) {
+    UNUSED(context);
+    const uint8_t block[8] = {0};
+    uint8_t key[16];
+    uint8_t out[8];
+    predator_keydiv_clear();
+
+    // Derive, expand, then encrypt one block per read
+    uint32_t start = furi_get_tick();
+    for(int i = 0; i < KEYDIV_BENCH_READS; i++) {
+        des3_derive_key(keydiv_master_a, keydiv_idm, 8, key);
+        des3_encrypt_ecb(key, block, out);
+    }
+    uint32_t direct_ms = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    for(int i = 0; i < KEYDIV_BENCH_READS; i++) {
+        const DES3Context* ctx = predator_keydiv_derive_ctx(keydiv_master_a, keydiv_idm, 8, NULL);
+        TEST_ASSERT(ctx != NULL);
+        des3_encrypt_block(ctx, block, out);
+    }
+    uint32_t cached_ms = furi_get_tick() - start;
+    predator_keydiv_clear();
+
+    FURI_LOG_I(
+        "TEST",
+        "Key diversification: %d reads, direct %lu ms, cached %lu ms",
+        KEYDIV_BENCH_READS,
+        (unsigned long)direct_ms,
+        (unsigned long)cached_ms);
+    return TestResultPass;
+}
+
+bool predator_run_keydiv_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"Key Diversification Matches 3DES", test_keydiv_matches_des3, true},
+        {"Key Diversification LRU", test_keydiv_lru, true},
+        {"Key Diversification Schedules", test_keydiv_schedules, true},
+        {"Key Diversification Throughput", test_keydiv_benchmark, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "Key Diversification Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
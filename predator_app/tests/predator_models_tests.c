@@ -0,0 +1,96 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_models_hardcoded.h"
+#include <string.h>
+
+// Reference protocol rules (the original runtime strcmp chain). The packed
+// metadata generated by condense_models.py must agree with it for every model.
+static CryptoProtocol reference_protocol(const PredatorCarModel* model) {
+    if(strcmp(model->remote_type, "Smart Key") == 0) {
+        return strcmp(model->make, "Tesla") == 0 ? CryptoProtocolTesla : CryptoProtocolAES128;
+    }
+    if(strcmp(model->remote_type, "Rolling Code") == 0) {
+        if(model->frequency >= 868000000 && model->frequency < 869000000 &&
+           (strcmp(model->make, "BMW") == 0 || strcmp(model->make, "Audi") == 0 ||
+            strcmp(model->make, "Volkswagen") == 0 || strcmp(model->make, "Porsche") == 0 ||
+            strcmp(model->make, "Skoda") == 0 || strcmp(model->make, "Seat") == 0)) {
+            return CryptoProtocolHitag2;
+        }
+        return CryptoProtocolKeeloq;
+    }
+    return CryptoProtocolNone;
+}
+
+static CarFreqBand reference_band(uint32_t frequency) {
+    if(frequency >= 300000000 && frequency < 350000000) return CarFreqBand315;
+    if(frequency >= 433000000 && frequency < 435000000) return CarFreqBand433;
+    if(frequency >= 868000000 && frequency < 869000000) return CarFreqBand868;
+    return CarFreqBandOther;
+}
+
+// Test precomputed protocol matches the reference rules
+static TestResult test_models_protocol_meta(void* context) {
+    UNUSED(context);
+    const size_t total = predator_models_get_hardcoded_count();
+    for(size_t i = 0; i < total; i++) {
+        const PredatorCarModel* model = predator_models_get_hardcoded(i);
+        TEST_ASSERT_NOT_NULL(model);
+        TEST_ASSERT_EQUAL_INT((int)reference_protocol(model), (int)predator_models_get_protocol(i));
+    }
+    TEST_ASSERT_EQUAL_INT((int)CryptoProtocolNone, (int)predator_models_get_protocol(total));
+    return TestResultPass;
+}
+
+// Test precomputed frequency band matches the model frequency
+static TestResult test_models_band_meta(void* context) {
+    UNUSED(context);
+    const size_t total = predator_models_get_hardcoded_count();
+    for(size_t i = 0; i < total; i++) {
+        const PredatorCarModel* model = predator_models_get_hardcoded(i);
+        TEST_ASSERT_EQUAL_INT((int)reference_band(model->frequency), (int)predator_models_get_band(i));
+    }
+    return TestResultPass;
+}
+
+// Test continent index lists every model exactly once, under its own continent
+static TestResult test_models_continent_index(void* context) {
+    UNUSED(context);
+    const size_t total = predator_models_get_hardcoded_count();
+    size_t listed = 0;
+    for(int c = 0; c < CarContinentCount; c++) {
+        size_t count = predator_models_continent_count((CarContinent)c);
+        size_t prev = 0;
+        for(size_t n = 0; n < count; n++) {
+            size_t idx = predator_models_continent_model((CarContinent)c, n);
+            TEST_ASSERT(idx < total);
+            TEST_ASSERT(n == 0 || idx > prev);
+            TEST_ASSERT(predator_models_get_hardcoded(idx)->continent == (CarContinent)c);
+            prev = idx;
+        }
+        TEST_ASSERT(predator_models_continent_model((CarContinent)c, count) == SIZE_MAX);
+        listed += count;
+    }
+    TEST_ASSERT(listed == total);
+    return TestResultPass;
+}
+
+bool predator_run_models_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"Models Protocol Metadata", test_models_protocol_meta, true},
+        {"Models Frequency Band Metadata", test_models_band_meta, true},
+        {"Models Continent Index", test_models_continent_index, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "Car Models Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
@@ -0,0 +1,87 @@
+#include "predator_nfc_test_recording.h"
+#include <string.h>
+
+void nfc_rec_reset(NfcTestRecording* rec, const char* name) {
+    memset(rec, 0, sizeof(NfcTestRecording));
+    rec->session.name = name;
+    rec->session.frames = rec->frames;
+}
+
+uint8_t* nfc_rec_add(NfcTestRecording* rec, PredatorNfcTech tech,
+                     const uint8_t* tx, size_t tx_len,
+                     const uint8_t* rx, size_t rx_len, uint16_t card_us) {
+    furi_check(rec->session.frame_count < NFC_TEST_MAX_FRAMES);
+    furi_check(tx_len <= NFC_TEST_FRAME_SIZE && rx_len <= NFC_TEST_FRAME_SIZE);
+    furi_check(rec->data_used + tx_len + rx_len <= sizeof(rec->data));
+
+    uint8_t* tx_copy = &rec->data[rec->data_used];
+    if(tx_len) memcpy(tx_copy, tx, tx_len);
+    uint8_t* rx_copy = tx_copy + tx_len;
+    if(rx_len) memcpy(rx_copy, rx, rx_len);
+    rec->data_used += tx_len + rx_len;
+
+    rec->frames[rec->session.frame_count++] = (PredatorNfcFrame){
+        .tech = tech,
+        .tx_len = (uint8_t)tx_len,
+        .rx_len = (uint8_t)rx_len,
+        .card_us = card_us,
+        .tx = tx_copy,
+        .rx = rx_copy,
+    };
+    return rx_copy;
+}
+
+void nfc_rec_felica_read(NfcTestRecording* rec, const uint8_t* idm,
+                         const uint16_t* services, uint8_t service_count,
+                         const uint8_t* block_list, uint8_t block_count,
+                         const uint8_t* blocks, uint16_t card_us) {
+    uint8_t tx[NFC_TEST_FRAME_SIZE] = {0, 0x06};
+    size_t len = 2;
+    memcpy(&tx[len], idm, 8);
+    len += 8;
+    tx[len++] = service_count;
+    for(uint8_t i = 0; i < service_count; i++) {
+        tx[len++] = services[i] & 0xFF;
+        tx[len++] = services[i] >> 8;
+    }
+    tx[len++] = block_count;
+    memcpy(&tx[len], block_list, block_count * 2);
+    len += block_count * 2;
+    tx[0] = (uint8_t)len;
+
+    uint8_t rx[NFC_TEST_FRAME_SIZE] = {0, 0x07};
+    size_t rx_len = 12;
+    memcpy(&rx[2], idm, 8);
+    if(blocks) {
+        rx[rx_len++] = block_count;
+        memcpy(&rx[rx_len], blocks, block_count * 16);
+        rx_len += block_count * 16;
+    } else {
+        rx[10] = 0xFF;
+        rx[11] = 0xA2;
+    }
+    rx[0] = (uint8_t)rx_len;
+    nfc_rec_add(rec, PredatorNfcTechFelica, tx, len, rx, rx_len, card_us);
+}
+
+void nfc_test_replay(NfcTestContext* ctx) {
+    predator_nfc_replay_init(&ctx->replay, &ctx->rec->session);
+    predator_nfc_set_transport(predator_nfc_replay_transport(&ctx->replay));
+}
+
+void nfc_test_setup(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    ctx->app = malloc(sizeof(PredatorApp));
+    memset(ctx->app, 0, sizeof(PredatorApp));
+    ctx->rec = malloc(sizeof(NfcTestRecording));
+    nfc_rec_reset(ctx->rec, NULL);
+}
+
+void nfc_test_teardown(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    predator_nfc_set_transport(NULL);
+    free(ctx->rec);
+    free(ctx->app);
+    ctx->rec = NULL;
+    ctx->app = NULL;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../helpers/predator_nfc_transport.h"
+#include "../helpers/predator_nfc_replay.h"
+#include "../predator_i.h"
+
+/**
+ * In-memory card recordings for the NFC replay tests
+ *
+ * A test adds the request/answer pairs a card would exchange, then replays
+ * them through the NFC transport so the protocol code runs without a card.
+ * Frame bytes are packed into one buffer, so short ISO15693 frames and long
+ * FeliCa reads share the same space.
+ */
+
+#define NFC_TEST_MAX_FRAMES 40
+#define NFC_TEST_FRAME_SIZE 255    // PredatorNfcFrame lengths are 8-bit
+#define NFC_TEST_DATA_SIZE  8192
+
+// Recorded card session built in memory
+typedef struct {
+    PredatorNfcFrame frames[NFC_TEST_MAX_FRAMES];
+    uint8_t data[NFC_TEST_DATA_SIZE];
+    size_t data_used;
+    PredatorNfcSession session;
+} NfcTestRecording;
+
+// Test context shared by the NFC suites
+typedef struct {
+    PredatorApp* app;
+    NfcTestRecording* rec;
+    PredatorNfcReplay replay;
+} NfcTestContext;
+
+/**
+ * Start an empty recording
+ */
+void nfc_rec_reset(NfcTestRecording* rec, const char* name);
+
+/**
+ * Append a frame; rx_len 0 records a request the card does not answer
+ * @return The stored answer bytes (tests may corrupt them)
+ */
+uint8_t* nfc_rec_add(NfcTestRecording* rec, PredatorNfcTech tech,
+                     const uint8_t* tx, size_t tx_len,
+                     const uint8_t* rx, size_t rx_len, uint16_t card_us);
+
+/**
+ * FeliCa Read Without Encryption answered with blocks (16 bytes each),
+ * or refused with status FF A2 if blocks is NULL
+ */
+void nfc_rec_felica_read(NfcTestRecording* rec, const uint8_t* idm,
+                         const uint16_t* services, uint8_t service_count,
+                         const uint8_t* block_list, uint8_t block_count,
+                         const uint8_t* blocks, uint16_t card_us);
+
+/**
+ * Replay the context's recording through the NFC transport
+ */
+void nfc_test_replay(NfcTestContext* ctx);
+
+/**
+ * Suite setup/teardown for an NfcTestContext (teardown restores the device transport)
+ */
+void nfc_test_setup(void* context);
+void nfc_test_teardown(void* context);
@@ -0,0 +1,579 @@
+#include "predator_test_framework.h"
+#include "predator_nfc_test_recording.h"
+#include "../helpers/predator_crypto_felica.h"
+#include "../helpers/predator_crypto_calypso.h"
+#include "../helpers/predator_crypto_desfire.h"
+#include "../helpers/predator_dump.h"
+#include <string.h>
+
+static const uint8_t nfc_test_idm[8] = {0x01, 0x2E, 0x4C, 0xE4, 0x62, 0x1A, 0x8F, 0x30};
+static const uint8_t nfc_test_pmm[8] = {0x10, 0x0B, 0x4B, 0x42, 0x84, 0x85, 0xD0, 0xFF};
+
+// Polling answer for system code 0x0003 with the given PMm
+static void nfc_rec_felica_poll(NfcTestRecording* rec, const uint8_t* pmm) {
+    const uint8_t poll[6] = {6, 0x00, 0x03, 0x00, 0x01, 0x00};
+    uint8_t poll_rx[20] = {20, 0x01};
+    memcpy(&poll_rx[2], nfc_test_idm, 8);
+    memcpy(&poll_rx[10], pmm, 8);
+    poll_rx[18] = 0x00;
+    poll_rx[19] = 0x03;
+    nfc_rec_add(rec, PredatorNfcTechFelica, poll, sizeof(poll), poll_rx, sizeof(poll_rx), 500);
+}
+
+// Wrapped DESFire native command (90 cmd 00 00 [Lc params] 00) answered
+// with data and status 91 sw2
+static void nfc_rec_desfire(NfcTestRecording* rec, uint8_t cmd,
+                            const uint8_t* params, uint8_t params_len,
+                            const uint8_t* data, uint8_t data_len, uint8_t sw2) {
+    uint8_t tx[NFC_TEST_FRAME_SIZE] = {0x90, cmd, 0x00, 0x00};
+    size_t len = 4;
+    if(params_len) {
+        tx[len++] = params_len;
+        memcpy(&tx[len], params, params_len);
+        len += params_len;
+    }
+    tx[len++] = 0x00;
+
+    uint8_t rx[NFC_TEST_FRAME_SIZE];
+    if(data_len) memcpy(rx, data, data_len);
+    rx[data_len] = 0x91;
+    rx[data_len + 1] = sw2;
+    nfc_rec_add(rec, PredatorNfcTechIso14443a, tx, len, rx, data_len + 2, 800);
+}
+
+// Test request matching, wrap-around, timeouts and the virtual clock
+static TestResult test_nfc_replay_matching(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    const uint8_t req_a[2] = {0xA0, 0x01};
+    const uint8_t req_b[3] = {0xB0, 0x02, 0x03};
+    const uint8_t req_c[1] = {0xC0};
+    const uint8_t ans_a[4] = {0x90, 0x00, 0x11, 0x22};
+    const uint8_t ans_b[2] = {0x90, 0x00};
+    uint8_t rx[8];
+    size_t rx_len;
+    PredatorNfcStats stats;
+
+    nfc_rec_reset(ctx->rec, "matching");
+    nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, req_a, sizeof(req_a), ans_a, sizeof(ans_a), 100);
+    nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, req_b, sizeof(req_b), ans_b, sizeof(ans_b), 0);
+    nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, req_c, sizeof(req_c), NULL, 0, 0);
+    nfc_test_replay(ctx);
+    predator_nfc_reset_stats();
+    TEST_ASSERT(predator_nfc_get_transport() == &ctx->replay.transport);
+
+    // In order
+    TEST_ASSERT(predator_nfc_transceive(PredatorNfcTechIso14443b, req_a, sizeof(req_a),
+                                        rx, sizeof(rx), &rx_len, PREDATOR_NFC_TIMEOUT_US));
+    TEST_ASSERT(rx_len == sizeof(ans_a) && memcmp(rx, ans_a, rx_len) == 0);
+    uint32_t expected = PREDATOR_NFC_REPLAY_READER_US + 100 +
+                        predator_nfc_frame_us(PredatorNfcTechIso14443b, sizeof(req_a), sizeof(ans_a));
+    TEST_ASSERT(predator_nfc_time_us() == expected);
+    TEST_ASSERT(predator_nfc_transceive(PredatorNfcTechIso14443b, req_b, sizeof(req_b),
+                                        rx, sizeof(rx), &rx_len, PREDATOR_NFC_TIMEOUT_US));
+
+    // Re-read wraps around; an answer longer than the buffer is refused, not clipped
+    memset(rx, 0xEE, sizeof(rx));
+    TEST_ASSERT(!predator_nfc_transceive(PredatorNfcTechIso14443b, req_a, sizeof(req_a),
+                                         rx, 2, &rx_len, PREDATOR_NFC_TIMEOUT_US));
+    TEST_ASSERT(rx_len == 0 && rx[0] == 0xEE);
+
+    // Wrong technology, unknown request and recorded silence time out
+    TEST_ASSERT(!predator_nfc_transceive(PredatorNfcTechFelica, req_a, sizeof(req_a),
+                                         rx, sizeof(rx), &rx_len, 1000));
+    uint32_t before = predator_nfc_time_us();
+    TEST_ASSERT(!predator_nfc_transceive(PredatorNfcTechIso14443b, req_c, sizeof(req_c),
+                                         rx, sizeof(rx), &rx_len, 5000));
+    TEST_ASSERT(rx_len == 0);
+    TEST_ASSERT(predator_nfc_time_us() - before == 5000 + PREDATOR_NFC_REPLAY_READER_US);
+
+    // Delays are virtual
+    before = predator_nfc_time_us();
+    predator_nfc_delay_ms(50);
+    TEST_ASSERT(predator_nfc_time_us() - before == 50000);
+
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 5 && stats.timeouts == 3);
+    TEST_ASSERT(stats.rx_bytes == sizeof(ans_a) + sizeof(ans_b));
+    TEST_ASSERT(ctx->replay.misses == 2);
+
+    predator_nfc_set_transport(NULL);
+    TEST_ASSERT(predator_nfc_get_transport() != &ctx->replay.transport);
+    return TestResultPass;
+}
+
+// Test air time model against hand-computed frames
+static TestResult test_nfc_frame_timing(void* context) {
+    UNUSED(context);
+    // FeliCa 16-byte request, 29-byte answer: (45 + 20) bytes at 37.74 us + 150 us
+    TEST_ASSERT(predator_nfc_frame_us(PredatorNfcTechFelica, 16, 29) == 2603);
+    // ISO 15693 Read Single Block, 13 + 7 bytes: (20 + 6) bytes at 302 us + 320 us
+    TEST_ASSERT(predator_nfc_frame_us(PredatorNfcTechIso15693, 13, 7) == 8172);
+    TEST_ASSERT(predator_nfc_frame_us(PredatorNfcTechCount, 1, 1) == 0);
+    return TestResultPass;
+}
+
+// Full Suica read (poll, balance, 20 history blocks) on a recorded card
+static TestResult test_nfc_replay_felica_dump(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    FeliCaCard card;
+    FeliCaTransaction history[20];
+    uint16_t balance = 0;
+    PredatorNfcStats stats;
+    const uint16_t services[2] = {FELICA_SERVICE_SUICA_BALANCE, FELICA_SERVICE_SUICA_HISTORY};
+    uint8_t block_list[21 * 2] = {0x80, 0x00};
+    uint8_t blocks[21 * 16];
+
+    // Balance block then history blocks 0-19, 15 blocks per frame
+    memset(blocks, 0x07, 16);
+    for(uint8_t i = 0; i < 20; i++) {
+        block_list[2 + i * 2] = 0x81;
+        block_list[3 + i * 2] = i;
+        memset(&blocks[16 + i * 16], 0x20 + i, 16);
+    }
+    nfc_rec_reset(ctx->rec, "suica");
+    nfc_rec_felica_poll(ctx->rec, nfc_test_pmm);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, services, 2, block_list, 15, blocks, 4000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, services, 2, &block_list[30], 6, &blocks[15 * 16], 2000);
+
+    nfc_test_replay(ctx);
+    predator_nfc_reset_stats();
+
+    TEST_ASSERT(felica_detect_card(ctx->app, FELICA_SYSTEM_SUICA, &card));
+    TEST_ASSERT(memcmp(card.idm, nfc_test_idm, 8) == 0);
+    TEST_ASSERT(felica_read_suica_data(ctx->app, &card, &balance, history, 20) == 20);
+    TEST_ASSERT(balance == 0x0707);
+    TEST_ASSERT(history[0].transaction_type == 0x20);
+    TEST_ASSERT(history[19].transaction_type == 0x20 + 19);
+
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 3);
+    TEST_ASSERT(stats.timeouts == 0 && ctx->replay.misses == 0);
+    FURI_LOG_I(
+        "TEST",
+        "Suica dump: %lu frames, %lu bytes, %lu ms",
+        (unsigned long)stats.frames,
+        (unsigned long)(stats.tx_bytes + stats.rx_bytes),
+        (unsigned long)(predator_nfc_time_us() / 1000));
+
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// Card that refuses 15-block reads: the batch is halved and the read completes
+static TestResult test_nfc_replay_felica_fallback(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    FeliCaCard card;
+    FeliCaTransaction history[15];
+    PredatorNfcStats stats;
+    const uint16_t service = FELICA_SERVICE_SUICA_HISTORY;
+    uint8_t block_list[15 * 2];
+    uint8_t blocks[15 * 16];
+
+    for(uint8_t i = 0; i < 15; i++) {
+        block_list[i * 2] = 0x80;
+        block_list[i * 2 + 1] = i;
+        memset(&blocks[i * 16], 0x40 + i, 16);
+    }
+    nfc_rec_reset(ctx->rec, "limited");
+    nfc_rec_felica_poll(ctx->rec, nfc_test_pmm);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, block_list, 15, NULL, 1000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, block_list, 7, blocks, 2000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[14], 7, &blocks[7 * 16], 2000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[28], 1, &blocks[14 * 16], 1000);
+
+    nfc_test_replay(ctx);
+    predator_nfc_reset_stats();
+
+    TEST_ASSERT(felica_detect_card(ctx->app, FELICA_SYSTEM_SUICA, &card));
+    TEST_ASSERT(felica_read_history(ctx->app, &card, history, 15) == 15);
+    TEST_ASSERT(history[14].transaction_type == 0x40 + 14);
+
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 5 && stats.timeouts == 0);
+
+    // An answer slower than the PMm read time counts as a timeout
+    nfc_rec_reset(ctx->rec, "slow");
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, block_list, 1, blocks, 60000);
+    nfc_test_replay(ctx);
+    TEST_ASSERT(felica_read_history(ctx->app, &card, history, 1) == 0);
+    TEST_ASSERT(ctx->replay.misses == 1);
+    TEST_ASSERT(predator_nfc_time_us() ==
+                PREDATOR_NFC_REPLAY_READER_US + felica_response_timeout_us(&card, FeliCaCmdRead, 1));
+
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// FeliCa dump streamed to SD batch by batch, ending at the first refused block
+static TestResult test_nfc_replay_felica_dump_sd(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    FeliCaCard card;
+    const uint16_t service = FELICA_SERVICE_SUICA_HISTORY;
+    uint8_t block_list[30 * 2];
+    uint8_t blocks[20 * 16];
+
+    for(uint8_t i = 0; i < 30; i++) {
+        block_list[i * 2] = 0x80;
+        block_list[i * 2 + 1] = i;
+        if(i < 20) memset(&blocks[i * 16], 0x60 + i, 16);
+    }
+    // 20 blocks: 15, then halving past the end of the service
+    nfc_rec_reset(ctx->rec, "dump");
+    nfc_rec_felica_poll(ctx->rec, nfc_test_pmm);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, block_list, 15, blocks, 4000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[30], 15, NULL, 1000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[30], 7, NULL, 1000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[30], 3, &blocks[15 * 16], 1500);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[36], 3, NULL, 1000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[36], 1, &blocks[18 * 16], 1000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[38], 1, &blocks[19 * 16], 1000);
+    nfc_rec_felica_read(ctx->rec, nfc_test_idm, &service, 1, &block_list[40], 1, NULL, 1000);
+
+    nfc_test_replay(ctx);
+    TEST_ASSERT(felica_detect_card(ctx->app, FELICA_SYSTEM_SUICA, &card));
+    card.service_codes[0] = service;
+    card.service_count = 1;
+
+    ctx->app->storage = furi_record_open(RECORD_STORAGE);
+    const char* path = PREDATOR_DUMP_DIR "/felica_test.pdmp";
+    TEST_ASSERT(felica_dump_card(ctx->app, &card, path));
+    TEST_ASSERT(ctx->replay.misses == 0);
+
+    PredatorDumpReader* reader = predator_dump_reader_open(ctx->app->storage, path);
+    TEST_ASSERT_NOT_NULL(reader);
+    PredatorDumpRecord rec;
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUid);
+    TEST_ASSERT(rec.len == 8 && memcmp(rec.value, nfc_test_idm, 8) == 0);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagInfo);
+    TEST_ASSERT(memcmp(rec.value, nfc_test_pmm, 8) == 0);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagArea);
+    TEST_ASSERT(rec.value[0] == 0x0F && rec.value[1] == 0x09 && rec.value[4] == 16);
+    for(uint8_t i = 0; i < 20; i++) {
+        TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUnit);
+        TEST_ASSERT(rec.value[0] == i && rec.len == 18);
+        TEST_ASSERT(memcmp(&rec.value[2], &blocks[i * 16], 16) == 0);
+    }
+    // Timing covers the 8 read frames, not the poll
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagTiming);
+    TEST_ASSERT(rec.value[4] == 8 && rec.value[8] == 0);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagEnd);
+    predator_dump_reader_close(reader);
+
+    storage_common_remove(ctx->app->storage, path);
+    furi_record_close(RECORD_STORAGE);
+    ctx->app->storage = NULL;
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// DESFire dump: one application with a data, a value and an enciphered record file
+static TestResult test_nfc_replay_desfire_dump_sd(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    const uint8_t hw[7] = {0x04, 0x01, 0x01, 0x01, 0x00, 0x18, 0x05};
+    const uint8_t sw[7] = {0x04, 0x01, 0x01, 0x01, 0x04, 0x18, 0x05};
+    const uint8_t uid_batch[14] = {0x04, 0x5A, 0x3C, 0x2A, 0x71, 0x64, 0x80,
+                                   0xBA, 0x54, 0x42, 0x32, 0x50, 0x21, 0x19};
+    const uint8_t aid[3] = {0x33, 0x22, 0x11};
+    const uint8_t file_ids[3] = {0x01, 0x02, 0x03};
+    const uint8_t std_settings[7] = {0x00, 0x00, 0xEE, 0xEE, 40, 0x00, 0x00};
+    const uint8_t value_settings[17] = {0x02, 0x00, 0xEE, 0xEE, 0, 0, 0, 0,
+                                        0xFF, 0xFF, 0, 0, 0, 0, 0, 0, 0};
+    const uint8_t record_settings[13] = {0x04, 0x03, 0x00, 0x00, 16, 0, 0, 5, 0, 0, 2, 0, 0};
+    const uint8_t value[4] = {0xE8, 0x03, 0x00, 0x00};
+    uint8_t contents[40];
+    for(uint8_t i = 0; i < sizeof(contents); i++) contents[i] = 0xA0 + i;
+
+    nfc_rec_reset(ctx->rec, "desfire");
+    nfc_rec_desfire(ctx->rec, 0x60, NULL, 0, hw, 7, 0xAF);
+    nfc_rec_desfire(ctx->rec, 0xAF, NULL, 0, sw, 7, 0xAF);
+    nfc_rec_desfire(ctx->rec, 0xAF, NULL, 0, uid_batch, 14, 0x00);
+    nfc_rec_desfire(ctx->rec, 0x6A, NULL, 0, aid, 3, 0x00);
+    nfc_rec_desfire(ctx->rec, 0x5A, aid, 3, NULL, 0, 0x00);
+    nfc_rec_desfire(ctx->rec, 0x6F, NULL, 0, file_ids, 3, 0x00);
+    nfc_rec_desfire(ctx->rec, 0xF5, &file_ids[0], 1, std_settings, 7, 0x00);
+    const uint8_t read0[7] = {0x01, 0, 0, 0, 32, 0, 0};
+    const uint8_t read1[7] = {0x01, 32, 0, 0, 8, 0, 0};
+    nfc_rec_desfire(ctx->rec, 0xBD, read0, 7, contents, 32, 0x00);
+    nfc_rec_desfire(ctx->rec, 0xBD, read1, 7, &contents[32], 8, 0x00);
+    nfc_rec_desfire(ctx->rec, 0xF5, &file_ids[1], 1, value_settings, 17, 0x00);
+    nfc_rec_desfire(ctx->rec, 0x6C, &file_ids[1], 1, value, 4, 0x00);
+    nfc_rec_desfire(ctx->rec, 0xF5, &file_ids[2], 1, record_settings, 13, 0x00);
+    // Oldest record first; the file needs authentication
+    const uint8_t read_record[7] = {0x03, 1, 0, 0, 1, 0, 0};
+    nfc_rec_desfire(ctx->rec, 0xBB, read_record, 7, NULL, 0, 0xAE);
+
+    nfc_test_replay(ctx);
+    ctx->app->storage = furi_record_open(RECORD_STORAGE);
+    const char* path = PREDATOR_DUMP_DIR "/desfire_test.pdmp";
+    TEST_ASSERT(desfire_dump_card(ctx->app, NULL, path));
+    TEST_ASSERT(ctx->replay.misses == 0);
+
+    PredatorDumpReader* reader = predator_dump_reader_open(ctx->app->storage, path);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT(predator_dump_reader_card(reader) == PredatorDumpCardDesfire);
+    PredatorDumpRecord rec;
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUid);
+    TEST_ASSERT(rec.len == 7 && memcmp(rec.value, uid_batch, 7) == 0);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagInfo);
+    TEST_ASSERT(rec.len == 14 && memcmp(&rec.value[7], sw, 7) == 0);
+
+    // Data file: 40 bytes as a 32-byte and an 8-byte unit
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagArea);
+    TEST_ASSERT(rec.value[0] == 0x01 && rec.value[1] == 0x33 && rec.value[3] == 0x11);
+    TEST_ASSERT(rec.value[4] == 32 && rec.value[5] == 2);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUnit);
+    TEST_ASSERT(rec.len == 34 && memcmp(&rec.value[2], contents, 32) == 0);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUnit);
+    TEST_ASSERT(rec.value[0] == 1 && rec.len == 10);
+
+    // Value file
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagArea);
+    TEST_ASSERT(rec.value[0] == 0x02 && rec.value[4] == 4);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagUnit);
+    TEST_ASSERT(rec.len == 6 && memcmp(&rec.value[2], value, 4) == 0);
+
+    // Record file refused with 91AE
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagArea);
+    TEST_ASSERT(rec.value[0] == 0x03 && rec.value[4] == 16 && rec.value[5] == 2);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagMissing);
+    TEST_ASSERT(rec.value[2] == 0xAE && rec.value[3] == 0x91);
+
+    // Timing covers the 10 frames after GetVersion
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagTiming);
+    TEST_ASSERT(rec.value[4] == 10 && rec.value[8] == 0);
+    TEST_ASSERT(predator_dump_reader_next(reader, &rec) && rec.tag == PredatorDumpTagEnd);
+    predator_dump_reader_close(reader);
+
+    storage_common_remove(ctx->app->storage, path);
+    furi_record_close(RECORD_STORAGE);
+    ctx->app->storage = NULL;
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// Calypso event log (select + 3 records) on a recorded card
+static TestResult test_nfc_replay_calypso_log(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    CalypsoCard card;
+    CalypsoEvent events[3];
+    PredatorNfcStats stats;
+
+    nfc_rec_reset(ctx->rec, "navigo");
+    const uint8_t select[12] = {0x94, 0x02, 0x04, 0x00, 0x07, 0x31, 0x54, 0x49, 0x43, 0x2E, 0x49, 0x43};
+    const uint8_t ok[2] = {0x90, 0x00};
+    nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, select, sizeof(select), ok, sizeof(ok), 2000);
+    for(uint8_t i = 1; i <= 3; i++) {
+        const uint8_t read[5] = {0x94, 0xB2, i, (0x08 << 3) | 0x04, 0x1D};
+        uint8_t rx[CALYPSO_RECORD_SIZE + 2] = {0};
+        // EventDateStamp 9920 + i - 1 (2024-02-29...), no optional fields
+        uint16_t days = 9920 + i - 1;
+        rx[0] = days >> 6;
+        rx[1] = (days & 0x3F) << 2;
+        rx[CALYPSO_RECORD_SIZE] = 0x90;
+        rx[CALYPSO_RECORD_SIZE + 1] = 0x00;
+        nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, read, sizeof(read), rx, sizeof(rx), 3000);
+    }
+
+    nfc_test_replay(ctx);
+    predator_nfc_reset_stats();
+
+    memset(&card, 0, sizeof(card));
+    card.card_type = Calypso_Navigo;
+    calypso_cache_clear();
+    TEST_ASSERT(calypso_select_application(ctx->app, &card, 0x01));
+    TEST_ASSERT(calypso_read_event_log(ctx->app, &card, events, 3) == 3);
+    TEST_ASSERT(events[2].date[0] == 0x24 && events[2].date[1] == 0x03 && events[2].date[2] == 0x02);
+
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 4 && stats.timeouts == 0);
+    FURI_LOG_I(
+        "TEST",
+        "Calypso event log: %lu frames, %lu ms",
+        (unsigned long)stats.frames,
+        (unsigned long)(predator_nfc_time_us() / 1000));
+
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// Event record with only EventDateStamp set
+static void nfc_calypso_event(uint8_t* record, uint16_t days) {
+    memset(record, 0, CALYPSO_RECORD_SIZE);
+    record[0] = days >> 6;
+    record[1] = (days & 0x3F) << 2;
+}
+
+// Multi-record Read Records answer: (number, length, data) per record, 90 00
+static void nfc_rec_calypso_records(NfcTestRecording* rec, uint8_t sfi, uint8_t first,
+                                    uint8_t le_records, const uint8_t* records, uint8_t count) {
+    const uint8_t read[5] = {0x94, 0xB2, first, (sfi << 3) | 0x05,
+                             le_records * (2 + CALYPSO_RECORD_SIZE)};
+    uint8_t rx[NFC_TEST_FRAME_SIZE];
+    size_t rx_len = 0;
+    for(uint8_t i = 0; i < count; i++) {
+        rx[rx_len++] = first + i;
+        rx[rx_len++] = CALYPSO_RECORD_SIZE;
+        memcpy(&rx[rx_len], &records[i * CALYPSO_RECORD_SIZE], CALYPSO_RECORD_SIZE);
+        rx_len += CALYPSO_RECORD_SIZE;
+    }
+    rx[rx_len++] = 0x90;
+    rx[rx_len++] = 0x00;
+    nfc_rec_add(rec, PredatorNfcTechIso14443b, read, sizeof(read), rx, rx_len, 4000);
+}
+
+// Rev3 card: contracts and event log in one APDU each, then served from cache
+static TestResult test_nfc_replay_calypso_cache(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    CalypsoCard card;
+    CalypsoEvent events[20];
+    CalypsoContract contract;
+    uint8_t contracts[2 * CALYPSO_RECORD_SIZE];
+    uint8_t log[3 * CALYPSO_RECORD_SIZE];
+    uint8_t data[4 * CALYPSO_RECORD_SIZE];
+    PredatorNfcStats stats;
+
+    memset(contracts, 0x5A, sizeof(contracts));
+    for(uint8_t i = 0; i < 3; i++) nfc_calypso_event(&log[i * CALYPSO_RECORD_SIZE], 9930 - i);
+    nfc_rec_reset(ctx->rec, "navigo-rev3");
+    nfc_rec_calypso_records(ctx->rec, 0x29, 1, 4, contracts, 2);
+    nfc_rec_calypso_records(ctx->rec, 0x08, 1, CALYPSO_MAX_RECORDS_PER_READ, log, 3);
+    nfc_test_replay(ctx);
+    predator_nfc_reset_stats();
+
+    memset(&card, 0, sizeof(card));
+    card.card_type = Calypso_Navigo;
+    card.revision = Calypso_Rev3;
+    card.card_number = 0x12345678;
+    calypso_cache_clear();
+
+    TEST_ASSERT(calypso_read_records(ctx->app, &card, 0x29, 1, 4, data) == 2);
+    TEST_ASSERT(memcmp(data, contracts, sizeof(contracts)) == 0);
+    TEST_ASSERT(calypso_read_event_log(ctx->app, &card, events, 20) == 3);
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 2 && stats.timeouts == 0);
+
+    // Views re-reading the same files cost no RF traffic
+    TEST_ASSERT(calypso_read_event_log(ctx->app, &card, events, 20) == 3);
+    TEST_ASSERT(events[0].date[0] == 0x24 && events[0].date[1] == 0x03);
+    TEST_ASSERT(calypso_read_records(ctx->app, &card, 0x29, 1, 4, data) == 2);
+    TEST_ASSERT(calypso_read_record(ctx->app, &card, 0x29, 2, data, sizeof(data)) ==
+                CALYPSO_RECORD_SIZE);
+    TEST_ASSERT(!calypso_read_contract(ctx->app, &card, 3, &contract));  // Cached as absent
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 2);
+
+    // Another card never sees these records
+    card.card_number++;
+    TEST_ASSERT(calypso_read_record(ctx->app, &card, 0x29, 1, data, sizeof(data)) == 0);
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 3 && stats.timeouts == 1);
+
+    FURI_LOG_I(
+        "TEST",
+        "Calypso cached session: %lu frames, %lu ms",
+        (unsigned long)stats.frames,
+        (unsigned long)(predator_nfc_time_us() / 1000));
+
+    calypso_cache_clear();
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+// Rev2 card refusing multi-record mode: one record per APDU
+static TestResult test_nfc_replay_calypso_fallback(void* context) {
+    NfcTestContext* ctx = (NfcTestContext*)context;
+    TEST_ASSERT(ctx->app && ctx->rec);
+    CalypsoCard card;
+    uint8_t data[3 * CALYPSO_RECORD_SIZE];
+    PredatorNfcStats stats;
+
+    nfc_rec_reset(ctx->rec, "navigo-rev2");
+    const uint8_t multi[5] = {0x94, 0xB2, 0x01, (0x08 << 3) | 0x05, 3 * (2 + CALYPSO_RECORD_SIZE)};
+    const uint8_t refused[2] = {0x6B, 0x00};
+    const uint8_t not_found[2] = {0x6A, 0x83};
+    nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, multi, sizeof(multi), refused, sizeof(refused), 1000);
+    for(uint8_t i = 1; i <= 3; i++) {
+        const uint8_t read[5] = {0x94, 0xB2, i, (0x08 << 3) | 0x04, CALYPSO_RECORD_SIZE};
+        uint8_t rx[CALYPSO_RECORD_SIZE + 2];
+        nfc_calypso_event(rx, 9900 + i);
+        rx[CALYPSO_RECORD_SIZE] = 0x90;
+        rx[CALYPSO_RECORD_SIZE + 1] = 0x00;
+        if(i < 3) {
+            nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, read, sizeof(read), rx, sizeof(rx), 3000);
+        } else {
+            nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, read, sizeof(read),
+                        not_found, sizeof(not_found), 1000);
+        }
+    }
+    // Record behind a secure session: 6982 security status not satisfied
+    const uint8_t secured_read[5] = {0x94, 0xB2, 0x01, (0x07 << 3) | 0x04, CALYPSO_RECORD_SIZE};
+    const uint8_t secured[2] = {0x69, 0x82};
+    nfc_rec_add(ctx->rec, PredatorNfcTechIso14443b, secured_read, sizeof(secured_read),
+                secured, sizeof(secured), 1000);
+    nfc_test_replay(ctx);
+    predator_nfc_reset_stats();
+
+    memset(&card, 0, sizeof(card));
+    card.card_type = Calypso_Navigo;
+    card.revision = Calypso_Rev2;
+    calypso_cache_clear();
+
+    TEST_ASSERT(calypso_max_records_per_read(&card) == 4);
+    TEST_ASSERT(calypso_read_records(ctx->app, &card, 0x08, 1, 3, data) == 2);
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 4 && stats.timeouts == 0);
+
+    // End of file is remembered
+    TEST_ASSERT(calypso_read_records(ctx->app, &card, 0x08, 1, 3, data) == 2);
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 4);
+
+    // A refusal other than "not found" is not cached: asked again next time
+    TEST_ASSERT(calypso_read_record(ctx->app, &card, 0x07, 1, data, sizeof(data)) == 0);
+    TEST_ASSERT(calypso_read_record(ctx->app, &card, 0x07, 1, data, sizeof(data)) == 0);
+    predator_nfc_get_stats(&stats);
+    TEST_ASSERT(stats.frames == 6 && ctx->replay.misses == 0);
+
+    calypso_cache_clear();
+    predator_nfc_set_transport(NULL);
+    return TestResultPass;
+}
+
+bool predator_run_nfc_transport_tests() {
+    // Create context
+    NfcTestContext context;
+    memset(&context, 0, sizeof(context));
+
+    // Define test cases
+    TestCase test_cases[] = {
+        {"NFC Replay Matching", test_nfc_replay_matching, true},
+        {"NFC Frame Timing", test_nfc_frame_timing, true},
+        {"NFC Replay Suica Dump", test_nfc_replay_felica_dump, true},
+        {"NFC Replay FeliCa Batch Fallback", test_nfc_replay_felica_fallback, true},
+        {"NFC Replay FeliCa Dump To SD", test_nfc_replay_felica_dump_sd, true},
+        {"NFC Replay Calypso Event Log", test_nfc_replay_calypso_log, true},
+        {"NFC Replay Calypso Cache", test_nfc_replay_calypso_cache, true},
+        {"NFC Replay Calypso Fallback", test_nfc_replay_calypso_fallback, true},
+        {"NFC Replay DESFire Dump To SD", test_nfc_replay_desfire_dump_sd, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "NFC Transport Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = &context,
+        .setup = nfc_test_setup,
+        .teardown = nfc_test_teardown
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
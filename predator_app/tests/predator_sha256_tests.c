@@ -0,0 +1,167 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_crypto_sha256.h"
+#include <string.h>
+
+#define PBKDF2_BENCH_ITERATIONS 4096
+#define PBKDF2_UNLOCK_TARGET_MS 1000
+
+// Test SHA-256 against FIPS 180-4 examples (empty, one and two blocks)
+static TestResult test_sha256_kat(void* context) {
+    UNUSED(context);
+    const uint8_t expected_empty[32] = {
+        0xE3, 0xB0, 0xC4, 0x42, 0x98, 0xFC, 0x1C, 0x14, 0x9A, 0xFB, 0xF4, 0xC8, 0x99, 0x6F, 0xB9, 0x24,
+        0x27, 0xAE, 0x41, 0xE4, 0x64, 0x9B, 0x93, 0x4C, 0xA4, 0x95, 0x99, 0x1B, 0x78, 0x52, 0xB8, 0x55};
+    const uint8_t expected_abc[32] = {
+        0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+        0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD};
+    const uint8_t expected_448[32] = {
+        0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8, 0xE5, 0xC0, 0x26, 0x93, 0x0C, 0x3E, 0x60, 0x39,
+        0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF, 0x21, 0x67, 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1};
+    const char* msg_448 = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    uint8_t digest[32];
+
+    sha256(NULL, 0, digest);
+    TEST_ASSERT(memcmp(digest, expected_empty, 32) == 0);
+    sha256((const uint8_t*)"abc", 3, digest);
+    TEST_ASSERT(memcmp(digest, expected_abc, 32) == 0);
+    sha256((const uint8_t*)msg_448, strlen(msg_448), digest);
+    TEST_ASSERT(memcmp(digest, expected_448, 32) == 0);
+    return TestResultPass;
+}
+
+// Test that streaming in any chunk size matches the one-shot hash
+static TestResult test_sha256_streaming(void* context) {
+    UNUSED(context);
+    // SHA-256 of bytes 0x00, 0x01, ..., 0xFF, 0x00, ... (1000 bytes)
+    const uint8_t expected[32] = {
+        0xA8, 0xAF, 0x09, 0x9B, 0xF2, 0xE8, 0x78, 0x60, 0x95, 0x58, 0xDB, 0xF6, 0x9D, 0x8F, 0x88, 0xF4,
+        0xA3, 0x10, 0x40, 0xA8, 0xCF, 0x84, 0xB5, 0x49, 0xA0, 0xCF, 0xA9, 0x12, 0xF1, 0x2F, 0xFC, 0x3F};
+    static uint8_t data[1000];
+    Sha256Context ctx;
+    uint8_t digest[32];
+
+    for(size_t i = 0; i < sizeof(data); i++) data[i] = (uint8_t)i;
+    for(size_t chunk = 1; chunk <= 130; chunk++) {
+        sha256_init(&ctx);
+        for(size_t pos = 0; pos < sizeof(data); pos += chunk) {
+            size_t n = (sizeof(data) - pos < chunk) ? sizeof(data) - pos : chunk;
+            sha256_update(&ctx, &data[pos], n);
+        }
+        sha256_final(&ctx, digest);
+        TEST_ASSERT(memcmp(digest, expected, 32) == 0);
+    }
+    return TestResultPass;
+}
+
+// Test HMAC-SHA256 against RFC 4231 cases 2 and 6, and key reuse via reset
+static TestResult test_hmac_sha256_kat(void* context) {
+    UNUSED(context);
+    const uint8_t expected_2[32] = {
+        0x5B, 0xDC, 0xC1, 0x46, 0xBF, 0x60, 0x75, 0x4E, 0x6A, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xC7,
+        0x5A, 0x00, 0x3F, 0x08, 0x9D, 0x27, 0x39, 0x83, 0x9D, 0xEC, 0x58, 0xB9, 0x64, 0xEC, 0x38, 0x43};
+    const uint8_t expected_6[32] = {
+        0x60, 0xE4, 0x31, 0x59, 0x1E, 0xE0, 0xB6, 0x7F, 0x0D, 0x8A, 0x26, 0xAA, 0xCB, 0xF5, 0xB7, 0x7F,
+        0x8E, 0x0B, 0xC6, 0x21, 0x37, 0x28, 0xC5, 0x14, 0x05, 0x46, 0x04, 0x0F, 0x0E, 0xE3, 0x7F, 0x54};
+    const char* msg_2 = "what do ya want for nothing?";
+    const char* msg_6 = "Test Using Larger Than Block-Size Key - Hash Key First";
+    uint8_t key_6[131];
+    uint8_t mac[32];
+    HmacSha256Context ctx;
+
+    hmac_sha256((const uint8_t*)"Jefe", 4, (const uint8_t*)msg_2, strlen(msg_2), mac);
+    TEST_ASSERT(memcmp(mac, expected_2, 32) == 0);
+
+    memset(key_6, 0xAA, sizeof(key_6));
+    hmac_sha256(key_6, sizeof(key_6), (const uint8_t*)msg_6, strlen(msg_6), mac);
+    TEST_ASSERT(memcmp(mac, expected_6, 32) == 0);
+
+    // Keyed once, two MACs
+    hmac_sha256_init(&ctx, (const uint8_t*)"Jefe", 4);
+    hmac_sha256_update(&ctx, (const uint8_t*)msg_2, 10);
+    hmac_sha256_update(&ctx, (const uint8_t*)&msg_2[10], strlen(msg_2) - 10);
+    hmac_sha256_final(&ctx, mac);
+    TEST_ASSERT(memcmp(mac, expected_2, 32) == 0);
+    hmac_sha256_reset(&ctx);
+    hmac_sha256_update(&ctx, (const uint8_t*)msg_2, strlen(msg_2));
+    hmac_sha256_final(&ctx, mac);
+    TEST_ASSERT(memcmp(mac, expected_2, 32) == 0);
+    return TestResultPass;
+}
+
+// Test PBKDF2-HMAC-SHA256 against RFC 7914 section 11 and common vectors
+static TestResult test_pbkdf2_kat(void* context) {
+    UNUSED(context);
+    const uint8_t expected_passwd[64] = {
+        0x55, 0xAC, 0x04, 0x6E, 0x56, 0xE3, 0x08, 0x9F, 0xEC, 0x16, 0x91, 0xC2, 0x25, 0x44, 0xB6, 0x05,
+        0xF9, 0x41, 0x85, 0x21, 0x6D, 0xDE, 0x04, 0x65, 0xE6, 0x8B, 0x9D, 0x57, 0xC2, 0x0D, 0xAC, 0xBC,
+        0x49, 0xCA, 0x9C, 0xCC, 0xF1, 0x79, 0xB6, 0x45, 0x99, 0x16, 0x64, 0xB3, 0x9D, 0x77, 0xEF, 0x31,
+        0x7C, 0x71, 0xB8, 0x45, 0xB1, 0xE3, 0x0B, 0xD5, 0x09, 0x11, 0x20, 0x41, 0xD3, 0xA1, 0x97, 0x83};
+    const uint8_t expected_4096[32] = {
+        0xC5, 0xE4, 0x78, 0xD5, 0x92, 0x88, 0xC8, 0x41, 0xAA, 0x53, 0x0D, 0xB6, 0x84, 0x5C, 0x4C, 0x8D,
+        0x96, 0x28, 0x93, 0xA0, 0x01, 0xCE, 0x4E, 0x11, 0xA4, 0x96, 0x38, 0x73, 0xAA, 0x98, 0x13, 0x4A};
+    const uint8_t expected_long[40] = {
+        0x34, 0x8C, 0x89, 0xDB, 0xCB, 0xD3, 0x2B, 0x2F, 0x32, 0xD8, 0x14, 0xB8, 0x11, 0x6E, 0x84, 0xCF,
+        0x2B, 0x17, 0x34, 0x7E, 0xBC, 0x18, 0x00, 0x18, 0x1C, 0x4E, 0x2A, 0x1F, 0xB8, 0xDD, 0x53, 0xE1,
+        0xC6, 0x35, 0x51, 0x8C, 0x7D, 0xAC, 0x47, 0xE9};
+    const char* pw_long = "passwordPASSWORDpassword";
+    const char* salt_long = "saltSALTsaltSALTsaltSALTsaltSALTsalt";
+    uint8_t out[64];
+
+    TEST_ASSERT(pbkdf2_hmac_sha256((const uint8_t*)"passwd", 6, (const uint8_t*)"salt", 4, 1, out, 64));
+    TEST_ASSERT(memcmp(out, expected_passwd, 64) == 0);
+    TEST_ASSERT(pbkdf2_hmac_sha256((const uint8_t*)"password", 8, (const uint8_t*)"salt", 4, 4096, out, 32));
+    TEST_ASSERT(memcmp(out, expected_4096, 32) == 0);
+    TEST_ASSERT(pbkdf2_hmac_sha256(
+        (const uint8_t*)pw_long, strlen(pw_long), (const uint8_t*)salt_long, strlen(salt_long), 4096, out, 40));
+    TEST_ASSERT(memcmp(out, expected_long, 40) == 0);
+
+    TEST_ASSERT(!pbkdf2_hmac_sha256((const uint8_t*)"password", 8, (const uint8_t*)"salt", 4, 0, out, 32));
+    return TestResultPass;
+}
+
+// Benchmark PBKDF2 and pick an unlock iteration count (log only, never fails)
+static TestResult test_pbkdf2_benchmark(void* context) {
+    UNUSED(context);
+    uint8_t out[32];
+
+    uint32_t start = furi_get_tick();
+    TEST_ASSERT(pbkdf2_hmac_sha256(
+        (const uint8_t*)"password", 8, (const uint8_t*)"salt", 4, PBKDF2_BENCH_ITERATIONS, out, 32));
+    uint32_t elapsed = furi_get_tick() - start;
+
+    uint32_t iterations = pbkdf2_hmac_sha256_calibrate(PBKDF2_UNLOCK_TARGET_MS);
+    TEST_ASSERT(iterations >= 1000 && iterations % 1000 == 0);
+
+    FURI_LOG_I(
+        "TEST",
+        "PBKDF2-SHA256: %d iterations in %lu ms, %lu iterations for a %d ms unlock",
+        PBKDF2_BENCH_ITERATIONS,
+        (unsigned long)elapsed,
+        (unsigned long)iterations,
+        PBKDF2_UNLOCK_TARGET_MS);
+    return TestResultPass;
+}
+
+bool predator_run_sha256_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"SHA-256 Known Answers", test_sha256_kat, true},
+        {"SHA-256 Streaming Chunks", test_sha256_streaming, true},
+        {"HMAC-SHA256 RFC 4231", test_hmac_sha256_kat, true},
+        {"PBKDF2-HMAC-SHA256 Vectors", test_pbkdf2_kat, true},
+        {"PBKDF2 Unlock Calibration", test_pbkdf2_benchmark, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "SHA-256 Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
@@ -0,0 +1,130 @@
+#include "predator_test_framework.h"
+#include "../helpers/predator_tables.h"
+#include "../helpers/predator_crypto_3des.h"
+#include "../helpers/predator_crypto_engine.h"
+#include "../helpers/predator_models.h"
+#include "../helpers/predator_models_meta.h"
+#include <string.h>
+
+// Generated tables (tools/gen_tables.py, condense_models.py --hardcoded-meta)
+// carry a CRC-32 of their contents; recompute it here so a hand edit or a
+// stale generated file fails the suite instead of corrupting crypto/CRCs.
+
+// Reference zlib CRC-32, bit by bit (independent of the generated tables)
+static uint32_t reference_crc32(const void* data, size_t len) {
+    const uint8_t* bytes = data;
+    uint32_t crc = 0xFFFFFFFF;
+    for(size_t i = 0; i < len; i++) {
+        crc ^= bytes[i];
+        for(int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+static const uint8_t check_input[] = "123456789";
+#define CHECK_LEN (sizeof(check_input) - 1)
+
+// Test every generated table still matches its recorded checksum
+static TestResult test_tables_checksums(void* context) {
+    UNUSED(context);
+    TEST_ASSERT(reference_crc32(predator_des_sp, sizeof(predator_des_sp)) == PREDATOR_DES_SP_CRC32);
+    TEST_ASSERT(reference_crc32(predator_crc8_table, sizeof(predator_crc8_table)) == PREDATOR_CRC8_CRC32);
+    TEST_ASSERT(
+        reference_crc32(predator_crc16_ccitt_table, sizeof(predator_crc16_ccitt_table)) ==
+        PREDATOR_CRC16_CCITT_CRC32);
+    TEST_ASSERT(
+        reference_crc32(predator_crc16_8408_table, sizeof(predator_crc16_8408_table)) ==
+        PREDATOR_CRC16_8408_CRC32);
+    TEST_ASSERT(reference_crc32(predator_crc32_table, sizeof(predator_crc32_table)) == PREDATOR_CRC32_CRC32);
+#if PREDATOR_CRC_SLICE4
+    TEST_ASSERT(
+        reference_crc32(predator_crc16_8408_slice, sizeof(predator_crc16_8408_slice)) ==
+        PREDATOR_CRC16_8408_SLICE_CRC32);
+    TEST_ASSERT(
+        reference_crc32(predator_crc32_slice, sizeof(predator_crc32_slice)) == PREDATOR_CRC32_SLICE_CRC32);
+#endif
+    TEST_ASSERT(reference_crc32(predator_aes_sbox, sizeof(predator_aes_sbox)) == PREDATOR_AES_SBOX_CRC32);
+    TEST_ASSERT(
+        reference_crc32(predator_aes_inv_sbox, sizeof(predator_aes_inv_sbox)) == PREDATOR_AES_INV_SBOX_CRC32);
+    TEST_ASSERT(reference_crc32(predator_aes_te0, sizeof(predator_aes_te0)) == PREDATOR_AES_TE0_CRC32);
+    TEST_ASSERT(reference_crc32(predator_aes_td0, sizeof(predator_aes_td0)) == PREDATOR_AES_TD0_CRC32);
+#if PREDATOR_AES_FULL_TABLES
+    TEST_ASSERT(reference_crc32(predator_aes_te_rot, sizeof(predator_aes_te_rot)) == PREDATOR_AES_TE_ROT_CRC32);
+    TEST_ASSERT(reference_crc32(predator_aes_td_rot, sizeof(predator_aes_td_rot)) == PREDATOR_AES_TD_ROT_CRC32);
+#endif
+    TEST_ASSERT(
+        reference_crc32(hardcoded_model_meta, sizeof(hardcoded_model_meta)) == PREDATOR_MODELS_META_CRC32);
+    TEST_ASSERT(
+        reference_crc32(hardcoded_continent_index, sizeof(hardcoded_continent_index)) ==
+        PREDATOR_MODELS_CONTINENT_INDEX_CRC32);
+    return TestResultPass;
+}
+
+// Test table-driven CRCs against catalogue check values ("123456789")
+static TestResult test_tables_crc_check_values(void* context) {
+    UNUSED(context);
+    uint8_t input[CHECK_LEN];
+    memcpy(input, check_input, CHECK_LEN);
+
+    // CRC-16/CCITT-FALSE
+    TEST_ASSERT(predator_crypto_crc16(input, CHECK_LEN) == 0x29B1);
+
+    // CRC-8, poly 0x07, init 0xFF: compare with the bitwise definition
+    uint8_t crc8 = 0xFF;
+    for(size_t i = 0; i < CHECK_LEN; i++) {
+        crc8 ^= input[i];
+        for(int bit = 0; bit < 8; bit++) crc8 = (crc8 & 0x80) ? (uint8_t)((crc8 << 1) ^ 0x07) : (uint8_t)(crc8 << 1);
+    }
+    TEST_ASSERT(predator_crypto_crc8(input, CHECK_LEN) == crc8);
+
+    // CRC-16/X-25 (ISO 15693, ISO 14443-3 B): reflected 0x8408, init/xorout 0xFFFF
+    uint16_t crc16 = 0xFFFF;
+    for(size_t i = 0; i < CHECK_LEN; i++) {
+        crc16 = (crc16 >> 8) ^ predator_crc16_8408_table[(crc16 ^ input[i]) & 0xFF];
+    }
+    crc16 = ~crc16;
+    TEST_ASSERT(crc16 == 0x906E);
+    return TestResultPass;
+}
+
+// Test SP-table DES core with the classic single-DES vector (K1 == K2)
+static TestResult test_tables_des_sp(void* context) {
+    UNUSED(context);
+    const uint8_t key[16] = {
+        0x13, 0x34, 0x57, 0x79, 0x9B, 0xBC, 0xDF, 0xF1,
+        0x13, 0x34, 0x57, 0x79, 0x9B, 0xBC, 0xDF, 0xF1};
+    const uint8_t plain[8] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+    const uint8_t expected[8] = {0x85, 0xE8, 0x13, 0x54, 0x0F, 0x0A, 0xB4, 0x05};
+    uint8_t out[8];
+    uint8_t back[8];
+
+    des3_encrypt_ecb(key, plain, out);
+    TEST_ASSERT(memcmp(out, expected, sizeof(expected)) == 0);
+    des3_decrypt_ecb(key, out, back);
+    TEST_ASSERT(memcmp(back, plain, sizeof(plain)) == 0);
+    return TestResultPass;
+}
+
+bool predator_run_tables_tests() {
+    // Define test cases
+    TestCase test_cases[] = {
+        {"Generated Table Checksums", test_tables_checksums, true},
+        {"Table CRC Check Values", test_tables_crc_check_values, true},
+        {"DES SP Table Vector", test_tables_des_sp, true}
+    };
+
+    // Configure test suite
+    TestSuite suite = {
+        .name = "Generated Tables Tests",
+        .test_cases = test_cases,
+        .test_count = sizeof(test_cases) / sizeof(TestCase),
+        .context = NULL,
+        .setup = NULL,
+        .teardown = NULL
+    };
+
+    // Run tests
+    return test_run_suite(&suite);
+}
@@ -6,6 +6,22 @@
 // Forward declarations for test suites
 bool predator_run_gps_tests();
 bool predator_run_esp32_tests();
+bool predator_run_models_tests();
+bool predator_run_dict_tests();
+bool predator_run_tables_tests();
+bool predator_run_crc_tests();
+bool predator_run_aes_tests();
+bool predator_run_cmac_tests();
+bool predator_run_3des_tests();
+bool predator_run_chacha20_tests();
+bool predator_run_sha256_tests();
+bool predator_run_keydiv_tests();
+bool predator_run_en1545_tests();
+bool predator_run_nfc_transport_tests();
+bool predator_run_felica_tests();
+bool predator_run_felica_sync_tests();
+bool predator_run_iso15693_tests();
+bool predator_run_dump_tests();
 
 // Main test entry point
 int32_t predator_run_tests(void* p) {
@@ -23,6 +39,70 @@ int32_t predator_run_tests(void* p) {
     FURI_LOG_I("TEST", "Running ESP32 module tests...");
     all_passed &= predator_run_esp32_tests();
     
+    // Run car models tests
+    FURI_LOG_I("TEST", "Running car models tests...");
+    all_passed &= predator_run_models_tests();
+    
+    // Run key dictionary tests
+    FURI_LOG_I("TEST", "Running key dictionary tests...");
+    all_passed &= predator_run_dict_tests();
+    
+    // Run generated table tests
+    FURI_LOG_I("TEST", "Running generated table tests...");
+    all_passed &= predator_run_tables_tests();
+    
+    // Run CRC tests
+    FURI_LOG_I("TEST", "Running CRC tests...");
+    all_passed &= predator_run_crc_tests();
+    
+    // Run AES tests
+    FURI_LOG_I("TEST", "Running AES tests...");
+    all_passed &= predator_run_aes_tests();
+    
+    // Run CMAC tests
+    FURI_LOG_I("TEST", "Running CMAC tests...");
+    all_passed &= predator_run_cmac_tests();
+    
+    // Run 3DES tests
+    FURI_LOG_I("TEST", "Running 3DES tests...");
+    all_passed &= predator_run_3des_tests();
+    
+    // Run ChaCha20 tests
+    FURI_LOG_I("TEST", "Running ChaCha20 tests...");
+    all_passed &= predator_run_chacha20_tests();
+    
+    // Run SHA-256 tests
+    FURI_LOG_I("TEST", "Running SHA-256 tests...");
+    all_passed &= predator_run_sha256_tests();
+    
+    // Run key diversification tests
+    FURI_LOG_I("TEST", "Running key diversification tests...");
+    all_passed &= predator_run_keydiv_tests();
+    
+    // Run EN1545 tests
+    FURI_LOG_I("TEST", "Running EN1545 tests...");
+    all_passed &= predator_run_en1545_tests();
+    
+    // Run NFC transport tests
+    FURI_LOG_I("TEST", "Running NFC transport tests...");
+    all_passed &= predator_run_nfc_transport_tests();
+    
+    // Run FeliCa tests
+    FURI_LOG_I("TEST", "Running FeliCa tests...");
+    all_passed &= predator_run_felica_tests();
+    
+    // Run FeliCa sync tests
+    FURI_LOG_I("TEST", "Running FeliCa sync tests...");
+    all_passed &= predator_run_felica_sync_tests();
+    
+    // Run ISO15693 tests
+    FURI_LOG_I("TEST", "Running ISO15693 tests...");
+    all_passed &= predator_run_iso15693_tests();
+    
+    // Run dump tests
+    FURI_LOG_I("TEST", "Running dump tests...");
+    all_passed &= predator_run_dump_tests();
+    
     // Report final status
     if (all_passed) {
         FURI_LOG_I("TEST", "==== All tests PASSED! ====");
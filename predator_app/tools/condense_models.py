@@ -1,5 +1,8 @@
 import csv
+import re
+import struct
 import sys
+import zlib
 from collections import defaultdict, Counter
 from pathlib import Path
 
@@ -103,10 +106,309 @@ def condense_max128(rows):
     trimmed = groups3[:128]
     return [(g[0], g[1], g[2], g[3]) for g in trimmed]
 
+# ---------------------------------------------------------------------------
+# Binary catalog (.pmc) - read by helpers/predator_models_catalog.c
+#
+# Layout (little-endian):
+#   header   CATALOG_HEADER, 48 bytes
+#   records  record_count * CATALOG_RECORD (16 bytes), sorted by
+#            (continent, make, model)
+#   strings  NUL-terminated make/model/remote_type strings, deduplicated
+#   cont_idx CONTINENT_COUNT * (u16 first, u16 count) record ranges
+#   freq_idx freq_count * (u32 frequency, u16 first, u16 count) ranges into
+#            freq_map, sorted by frequency
+#   freq_map record_count * u16 record indices ordered by frequency
+#   search   search_count * (u16 key offset, u16 record) sorted by key; keys
+#            are lowercase "make model" strings in the string table, plus
+#            model-only keys pointing at their suffix. Bit 15 of record marks
+#            a model-only key.
+#
+# Keep the enums below in sync with helpers/predator_models.h.
+# ---------------------------------------------------------------------------
+
+CATALOG_MAGIC = b"PMCT"
+CATALOG_VERSION = 1
+CATALOG_HEADER = struct.Struct("<4sHHIIIIIIIIII")
+CATALOG_RECORD = struct.Struct("<IHHHBB4x")
+CONT_ENTRY = struct.Struct("<HH")
+SEARCH_ENTRY = struct.Struct("<HH")
+SEARCH_MODEL_ONLY = 0x8000
+SEARCH_KEY_MAX = 56
+FREQ_ENTRY = struct.Struct("<IHH")
+
+CONTINENT_EUROPE, CONTINENT_ASIA, CONTINENT_AMERICA = 0, 1, 2
+CONTINENT_COUNT = 3
+
+PROTO_NONE, PROTO_KEELOQ, PROTO_HITAG2, PROTO_AES128, PROTO_TESLA = range(5)
+
+MAKE_CONTINENT = {
+    CONTINENT_EUROPE: [
+        "Alfa Romeo", "Aston Martin", "Audi", "BMW", "Bentley", "Bugatti",
+        "Citroen", "Dacia", "Ferrari", "Fiat", "Jaguar", "Lamborghini",
+        "Land Rover", "Maserati", "McLaren", "Mercedes", "Mercedes-Benz",
+        "Mini", "Opel", "Peugeot", "Porsche", "Range Rover", "Renault",
+        "Rolls-Royce", "Seat", "Skoda", "VW", "Volkswagen", "Volvo",
+    ],
+    CONTINENT_ASIA: [
+        "Acura", "Genesis", "Honda", "Hyundai", "Infiniti", "Kia", "Lexus",
+        "Mazda", "Mitsubishi", "Nissan", "Subaru", "Suzuki", "Toyota",
+    ],
+    CONTINENT_AMERICA: [
+        "Buick", "Cadillac", "Chevrolet", "Chrysler", "Dodge", "Ford", "GMC",
+        "Jeep", "Lincoln", "Ram", "Tesla",
+    ],
+}
+MAKE_TO_CONTINENT = {
+    make.lower(): cont for cont, makes in MAKE_CONTINENT.items() for make in makes
+}
+
+HITAG2_MAKES = {"BMW", "Audi", "Volkswagen", "Porsche", "Skoda", "Seat"}
+
+BAND_315, BAND_433, BAND_868, BAND_OTHER = range(4)
+
+# Field widths of PredatorCarModel (including the terminating NUL)
+MAKE_MAX = 16
+MODEL_MAX = 40
+RTYPE_MAX = 16
+
+def continent_of(make: str) -> int:
+    cont = MAKE_TO_CONTINENT.get(make.lower())
+    if cont is None:
+        print(f"Warning: unknown make '{make}', filed under Europe")
+        return CONTINENT_EUROPE
+    return cont
+
+def protocol_of(make: str, freq: int, rtype: str) -> int:
+    # Mirrors predator_models_get_protocol() in predator_models_hardcoded.c
+    if rtype == "Fixed Code":
+        return PROTO_NONE
+    if rtype == "Smart Key":
+        return PROTO_TESLA if make == "Tesla" else PROTO_AES128
+    if rtype == "Rolling Code":
+        if 868000000 <= freq < 869000000 and make in HITAG2_MAKES:
+            return PROTO_HITAG2
+        return PROTO_KEELOQ
+    return PROTO_NONE
+
+def band_of(freq: int) -> int:
+    # Mirrors CarFreqBand in predator_models.h
+    if 300000000 <= freq < 350000000:
+        return BAND_315
+    if 433000000 <= freq < 435000000:
+        return BAND_433
+    if 868000000 <= freq < 869000000:
+        return BAND_868
+    return BAND_OTHER
+
+class StringTable:
+    def __init__(self):
+        self.data = bytearray()
+        self.offsets = {}
+
+    def add(self, s: str, max_len: int) -> int:
+        return self.add_raw(s.encode("utf-8")[: max_len - 1])
+
+    def add_raw(self, raw: bytes) -> int:
+        if raw not in self.offsets:
+            self.offsets[raw] = len(self.data)
+            self.data += raw + b"\0"
+        return self.offsets[raw]
+
+def build_catalog(rows) -> bytes:
+    entries = []
+    seen = set()
+    for make, model, freq, rtype in rows:
+        key = (make, model, freq, rtype)
+        if key in seen:
+            continue
+        seen.add(key)
+        entries.append((continent_of(make), make, model, freq, rtype))
+    entries.sort(key=lambda e: (e[0], e[1].lower(), e[2].lower(), e[3]))
+    if len(entries) >= SEARCH_MODEL_ONLY:
+        raise ValueError("catalog limited to 32767 records")
+
+    strings = StringTable()
+    records = bytearray()
+    for cont, make, model, freq, rtype in entries:
+        records += CATALOG_RECORD.pack(
+            freq,
+            strings.add(make, MAKE_MAX),
+            strings.add(model, MODEL_MAX),
+            strings.add(rtype, RTYPE_MAX),
+            cont,
+            protocol_of(make, freq, rtype),
+        )
+
+    # Type-ahead index: ASCII-lowercased keys (bytes.lower() matches the
+    # firmware's tolower) sorted bytewise for prefix binary search. A model-only
+    # key points at the model suffix of its "make model" key, so it costs no
+    # extra string bytes.
+    keys = []
+    for i, (cont, make, model, freq, rtype) in enumerate(entries):
+        make_key = make.encode("utf-8").lower()
+        full = (make_key + b" " + model.encode("utf-8").lower())[: SEARCH_KEY_MAX - 1]
+        full_off = strings.add_raw(full)
+        keys.append((full, full_off, i))
+        if len(full) > len(make_key) + 1:
+            keys.append((full[len(make_key) + 1:], full_off + len(make_key) + 1, i | SEARCH_MODEL_ONLY))
+    keys.sort()
+    search = bytearray()
+    for key, key_off, rec in keys:
+        search += SEARCH_ENTRY.pack(key_off, rec)
+
+    if len(strings.data) > 0xFFFF:
+        raise ValueError("string table exceeds 64KB")
+
+    cont_idx = bytearray()
+    for cont in range(CONTINENT_COUNT):
+        members = [i for i, e in enumerate(entries) if e[0] == cont]
+        first = members[0] if members else 0
+        cont_idx += CONT_ENTRY.pack(first, len(members))
+
+    by_freq = sorted(range(len(entries)), key=lambda i: (entries[i][3], i))
+    freq_idx = bytearray()
+    freq_count = 0
+    pos = 0
+    while pos < len(by_freq):
+        freq = entries[by_freq[pos]][3]
+        end = pos
+        while end < len(by_freq) and entries[by_freq[end]][3] == freq:
+            end += 1
+        freq_idx += FREQ_ENTRY.pack(freq, pos, end - pos)
+        freq_count += 1
+        pos = end
+    freq_map = struct.pack(f"<{len(by_freq)}H", *by_freq)
+
+    rec_off = CATALOG_HEADER.size
+    str_off = rec_off + len(records)
+    cont_off = str_off + len(strings.data)
+    freq_off = cont_off + len(cont_idx)
+    map_off = freq_off + len(freq_idx)
+    search_off = map_off + len(freq_map)
+    header = CATALOG_HEADER.pack(
+        CATALOG_MAGIC, CATALOG_VERSION, CATALOG_RECORD.size, len(entries),
+        rec_off, str_off, len(strings.data), cont_off, freq_off, freq_count,
+        map_off, search_off, len(keys),
+    )
+    return header + records + bytes(strings.data) + cont_idx + freq_idx + freq_map + search
+
+def write_catalog(out_path: Path, rows):
+    blob = build_catalog(rows)
+    out_path.parent.mkdir(parents=True, exist_ok=True)
+    out_path.write_bytes(blob)
+    return blob
+
+# ---------------------------------------------------------------------------
+# Precomputed metadata for hardcoded_models[] (predator_models_meta.h)
+#
+# Packs protocol, frequency band and continent into one byte per model and
+# emits per-continent index arrays so the firmware never re-derives them.
+# Re-run whenever hardcoded_models[] changes:
+#   condense_models.py --hardcoded-meta helpers/predator_models_hardcoded.c \
+#                      helpers/predator_models_meta.h
+# ---------------------------------------------------------------------------
+
+CONTINENT_NAMES = {"Europe": CONTINENT_EUROPE, "Asia": CONTINENT_ASIA, "America": CONTINENT_AMERICA}
+PROTO_NAMES = ["CryptoProtocolNone", "CryptoProtocolKeeloq", "CryptoProtocolHitag2",
+               "CryptoProtocolAES128", "CryptoProtocolTesla"]
+BAND_NAMES = ["CarFreqBand315", "CarFreqBand433", "CarFreqBand868", "CarFreqBandOther"]
+MODEL_LINE = re.compile(
+    r'^\s*\{\s*"([^"]*)"\s*,\s*"([^"]*)"\s*,\s*(\d+)\s*,\s*"([^"]*)"\s*,\s*CarContinent(\w+)\s*\}')
+
+def read_hardcoded(c_path: Path):
+    rows = []
+    in_table = False
+    for line in c_path.read_text(encoding="utf-8").splitlines():
+        if "hardcoded_models[] = {" in line:
+            in_table = True
+            continue
+        if in_table and line.startswith("};"):
+            break
+        m = MODEL_LINE.match(line) if in_table else None
+        if m:
+            rows.append((m.group(1), m.group(2), int(m.group(3)), m.group(4), CONTINENT_NAMES[m.group(5)]))
+    return rows
+
+def write_hardcoded_meta(out_path: Path, rows):
+    lines = [
+        "#pragma once",
+        "",
+        "// GENERATED by tools/condense_models.py --hardcoded-meta - do not edit.",
+        "// One entry per hardcoded_models[] row, same order.",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"#define PREDATOR_MODELS_META_COUNT {len(rows)}",
+        "",
+        "// Packed: bits 0-2 CryptoProtocol, bits 3-4 CarFreqBand, bits 5-6 CarContinent",
+        "#define PREDATOR_MODEL_META(proto, band, cont) \\",
+        "    ((uint8_t)((proto) | ((band) << 3) | ((cont) << 5)))",
+        "#define PREDATOR_MODEL_META_PROTOCOL(m)  ((CryptoProtocol)((m) & 0x07))",
+        "#define PREDATOR_MODEL_META_BAND(m)      ((CarFreqBand)(((m) >> 3) & 0x03))",
+        "#define PREDATOR_MODEL_META_CONTINENT(m) ((CarContinent)(((m) >> 5) & 0x03))",
+        "",
+        "static const uint8_t hardcoded_model_meta[PREDATOR_MODELS_META_COUNT] = {",
+    ]
+    for make, model, freq, rtype, cont in rows:
+        proto = protocol_of(make, freq, rtype)
+        cont_name = [k for k, v in CONTINENT_NAMES.items() if v == cont][0]
+        lines.append(
+            f"    PREDATOR_MODEL_META({PROTO_NAMES[proto]}, {BAND_NAMES[band_of(freq)]}, "
+            f"CarContinent{cont_name}), // {make} {model}")
+    lines.append("};")
+    meta = bytes(protocol_of(make, freq, rtype) | (band_of(freq) << 3) | (cont << 5)
+                 for make, model, freq, rtype, cont in rows)
+    lines.append("// zlib CRC-32 of hardcoded_model_meta[], checked by tests/predator_tables_tests.c")
+    lines.append(f"#define PREDATOR_MODELS_META_CRC32 0x{zlib.crc32(meta) & 0xFFFFFFFF:08X}")
+    lines.append("")
+
+    # Per-continent index arrays + (offset, count) into the combined array
+    order = []
+    ranges = []
+    for cont_name, cont in CONTINENT_NAMES.items():
+        members = [i for i, r in enumerate(rows) if r[4] == cont]
+        ranges.append((cont_name, len(order), len(members)))
+        order.extend(members)
+    if len(rows) > 0xFF:
+        raise ValueError("hardcoded index arrays are uint8_t; widen them for >255 models")
+    lines.append("// Hardcoded model indices grouped by continent")
+    lines.append(f"static const uint8_t hardcoded_continent_index[{max(len(order), 1)}] = {{")
+    for cont_name, start, count in ranges:
+        members = order[start:start + count]
+        lines.append(f"    // {cont_name}")
+        for i in range(0, len(members), 16):
+            lines.append("    " + ", ".join(str(x) for x in members[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append(f"#define PREDATOR_MODELS_CONTINENT_INDEX_CRC32 0x{zlib.crc32(bytes(order)) & 0xFFFFFFFF:08X}")
+    lines.append("")
+    lines.append("// {first, count} into hardcoded_continent_index, indexed by CarContinent")
+    lines.append("static const uint8_t hardcoded_continent_range[][2] = {")
+    for cont_name, start, count in ranges:
+        lines.append(f"    {{{start}, {count}}}, // {cont_name}")
+    lines.append("};")
+    out_path.write_text("\n".join(lines) + "\n", encoding="utf-8")
+
 
 def main():
+    if len(sys.argv) == 4 and sys.argv[1] == "--hardcoded-meta":
+        rows = read_hardcoded(Path(sys.argv[2]))
+        write_hardcoded_meta(Path(sys.argv[3]), rows)
+        print(f"Wrote metadata for {len(rows)} hardcoded models to {sys.argv[3]}")
+        return
+    if len(sys.argv) >= 4 and sys.argv[1] == "--catalog":
+        # condense_models.py --catalog <output_pmc> <input_csv> [<input_csv> ...]
+        out_path = Path(sys.argv[2])
+        rows = []
+        for name in sys.argv[3:]:
+            rows.extend(read_rows(Path(name)))
+        blob = write_catalog(out_path, rows)
+        count = struct.unpack_from("<I", blob, 8)[0]
+        print(f"Wrote catalog with {count} models ({len(blob)} bytes) to {out_path}")
+        return
     if len(sys.argv) < 3:
         print("Usage: condense_models.py <input_csv> <output_csv>")
+        print("       condense_models.py --catalog <output_pmc> <input_csv> [<input_csv> ...]")
+        print("       condense_models.py --hardcoded-meta <models_c> <output_h>")
         sys.exit(1)
     in_path = Path(sys.argv[1])
     out_path = Path(sys.argv[2])
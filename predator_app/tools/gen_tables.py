@@ -0,0 +1,255 @@
+import sys
+import zlib
+from pathlib import Path
+
+# ---------------------------------------------------------------------------
+# Constant lookup tables (helpers/predator_tables.c/.h)
+#
+# Everything here is derived from published definitions (FIPS 46-3 for DES,
+# FIPS-197 for AES, CRC polynomials) at build time so the firmware only does
+# table lookups.
+# Each table gets a zlib CRC-32 over its little-endian bytes; the unit tests
+# (tests/predator_tables_tests.c) recompute it to catch hand edits or a
+# stale generated file. Re-run after changing this script:
+#   python3 tools/gen_tables.py helpers
+# ---------------------------------------------------------------------------
+
+# DES S-boxes, FIPS 46-3 (row-major: row * 16 + column)
+DES_SBOX = [
+    [14, 4, 13, 1, 2, 15, 11, 8, 3, 10, 6, 12, 5, 9, 0, 7,
+     0, 15, 7, 4, 14, 2, 13, 1, 10, 6, 12, 11, 9, 5, 3, 8,
+     4, 1, 14, 8, 13, 6, 2, 11, 15, 12, 9, 7, 3, 10, 5, 0,
+     15, 12, 8, 2, 4, 9, 1, 7, 5, 11, 3, 14, 10, 0, 6, 13],
+    [15, 1, 8, 14, 6, 11, 3, 4, 9, 7, 2, 13, 12, 0, 5, 10,
+     3, 13, 4, 7, 15, 2, 8, 14, 12, 0, 1, 10, 6, 9, 11, 5,
+     0, 14, 7, 11, 10, 4, 13, 1, 5, 8, 12, 6, 9, 3, 2, 15,
+     13, 8, 10, 1, 3, 15, 4, 2, 11, 6, 7, 12, 0, 5, 14, 9],
+    [10, 0, 9, 14, 6, 3, 15, 5, 1, 13, 12, 7, 11, 4, 2, 8,
+     13, 7, 0, 9, 3, 4, 6, 10, 2, 8, 5, 14, 12, 11, 15, 1,
+     13, 6, 4, 9, 8, 15, 3, 0, 11, 1, 2, 12, 5, 10, 14, 7,
+     1, 10, 13, 0, 6, 9, 8, 7, 4, 15, 14, 3, 11, 5, 2, 12],
+    [7, 13, 14, 3, 0, 6, 9, 10, 1, 2, 8, 5, 11, 12, 4, 15,
+     13, 8, 11, 5, 6, 15, 0, 3, 4, 7, 2, 12, 1, 10, 14, 9,
+     10, 6, 9, 0, 12, 11, 7, 13, 15, 1, 3, 14, 5, 2, 8, 4,
+     3, 15, 0, 6, 10, 1, 13, 8, 9, 4, 5, 11, 12, 7, 2, 14],
+    [2, 12, 4, 1, 7, 10, 11, 6, 8, 5, 3, 15, 13, 0, 14, 9,
+     14, 11, 2, 12, 4, 7, 13, 1, 5, 0, 15, 10, 3, 9, 8, 6,
+     4, 2, 1, 11, 10, 13, 7, 8, 15, 9, 12, 5, 6, 3, 0, 14,
+     11, 8, 12, 7, 1, 14, 2, 13, 6, 15, 0, 9, 10, 4, 5, 3],
+    [12, 1, 10, 15, 9, 2, 6, 8, 0, 13, 3, 4, 14, 7, 5, 11,
+     10, 15, 4, 2, 7, 12, 9, 5, 6, 1, 13, 14, 0, 11, 3, 8,
+     9, 14, 15, 5, 2, 8, 12, 3, 7, 0, 4, 10, 1, 13, 11, 6,
+     4, 3, 2, 12, 9, 5, 15, 10, 11, 14, 1, 7, 6, 0, 8, 13],
+    [4, 11, 2, 14, 15, 0, 8, 13, 3, 12, 9, 7, 5, 10, 6, 1,
+     13, 0, 11, 7, 4, 9, 1, 10, 14, 3, 5, 12, 2, 15, 8, 6,
+     1, 4, 11, 13, 12, 3, 7, 14, 10, 15, 6, 8, 0, 5, 9, 2,
+     6, 11, 13, 8, 1, 4, 10, 7, 9, 5, 0, 15, 14, 2, 3, 12],
+    [13, 2, 8, 4, 6, 15, 11, 1, 10, 9, 3, 14, 5, 0, 12, 7,
+     1, 15, 13, 8, 10, 3, 7, 4, 12, 5, 6, 11, 0, 14, 9, 2,
+     7, 11, 4, 1, 9, 12, 14, 2, 0, 6, 10, 13, 15, 3, 5, 8,
+     2, 1, 14, 7, 4, 10, 8, 13, 15, 12, 9, 0, 3, 5, 6, 11],
+]
+
+# DES round permutation P, FIPS 46-3 (1-based, bit 1 = MSB)
+DES_P = [16, 7, 20, 21, 29, 12, 28, 17, 1, 15, 23, 26, 5, 18, 31, 10,
+         2, 8, 24, 14, 32, 27, 3, 9, 19, 13, 30, 6, 22, 11, 4, 25]
+
+def des_sp_tables():
+    # sp[box][chunk] = P(S_box(chunk) placed at its nibble). chunk is the raw
+    # 6-bit group of E(R) ^ K: row = outer bits, column = inner four bits.
+    tables = []
+    for box in range(8):
+        row_values = []
+        for chunk in range(64):
+            row = ((chunk & 0x20) >> 4) | (chunk & 0x01)
+            col = (chunk >> 1) & 0x0F
+            s_out = DES_SBOX[box][row * 16 + col] << (28 - box * 4)
+            p_out = 0
+            for i, src in enumerate(DES_P):
+                if s_out & (1 << (32 - src)):
+                    p_out |= 1 << (31 - i)
+            row_values.append(p_out)
+        tables.append(row_values)
+    return tables
+
+def crc_table_msb(poly: int, width: int):
+    top = 1 << (width - 1)
+    mask = (1 << width) - 1
+    table = []
+    for byte in range(256):
+        crc = byte << (width - 8)
+        for _ in range(8):
+            crc = ((crc << 1) ^ poly) if crc & top else (crc << 1)
+        table.append(crc & mask)
+    return table
+
+def crc_table_lsb(poly_reflected: int):
+    table = []
+    for byte in range(256):
+        crc = byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ poly_reflected if crc & 1 else crc >> 1
+        table.append(crc)
+    return table
+
+def crc_slices_lsb(table, count: int = 3):
+    # Slice k: CRC of a byte followed by k zero bytes (reflected CRCs).
+    # Together with the byte table these drive the slice-by-4 kernels.
+    slices = []
+    prev = table
+    for _ in range(count):
+        cur = [(prev[i] >> 8) ^ table[prev[i] & 0xFF] for i in range(256)]
+        slices.append(cur)
+        prev = cur
+    return slices
+
+def gf_mul(a: int, b: int) -> int:
+    # GF(2^8) multiply modulo the AES polynomial x^8 + x^4 + x^3 + x + 1
+    out = 0
+    while b:
+        if b & 1:
+            out ^= a
+        a = ((a << 1) ^ 0x11B) if a & 0x80 else a << 1
+        b >>= 1
+    return out
+
+def aes_sbox():
+    # FIPS-197 5.1.1: multiplicative inverse followed by the affine transform
+    sbox = []
+    for x in range(256):
+        inv = next((y for y in range(1, 256) if gf_mul(x, y) == 1), 0)
+        s = inv
+        for shift in range(1, 5):
+            s ^= ((inv << shift) | (inv >> (8 - shift))) & 0xFF
+        sbox.append(s ^ 0x63)
+    return sbox
+
+def aes_word(b0: int, b1: int, b2: int, b3: int) -> int:
+    return (b0 << 24) | (b1 << 16) | (b2 << 8) | b3
+
+def rotr32(x: int, n: int) -> int:
+    return ((x >> n) | (x << (32 - n))) & 0xFFFFFFFF
+
+def aes_t_tables():
+    # Te0[x] = MixColumns column (2s, s, s, 3s) for s = S(x); Td0[x] uses the
+    # InvMixColumns column (14s, 9s, 13s, 11s) for s = InvS(x). Words are
+    # big-endian: byte 0 of the state column is bits 31..24.
+    sbox = aes_sbox()
+    inv_sbox = [0] * 256
+    for x, s in enumerate(sbox):
+        inv_sbox[s] = x
+    te0 = [aes_word(gf_mul(s, 2), s, s, gf_mul(s, 3)) for s in sbox]
+    td0 = [aes_word(gf_mul(s, 14), gf_mul(s, 9), gf_mul(s, 13), gf_mul(s, 11)) for s in inv_sbox]
+    return sbox, inv_sbox, te0, td0
+
+# (C name, element type, rows, description, #if guard or None)
+def build_tables():
+    crc16_8408 = crc_table_lsb(0x8408)
+    crc32 = crc_table_lsb(0xEDB88320)
+    sbox, inv_sbox, te0, td0 = aes_t_tables()
+    return [
+        ("predator_des_sp", "uint32_t", des_sp_tables(),
+         "DES combined S-box + P permutation, indexed [box][6-bit chunk]", None),
+        ("predator_crc8_table", "uint8_t", crc_table_msb(0x07, 8),
+         "CRC-8, polynomial 0x07 (MSB-first)", None),
+        ("predator_crc16_ccitt_table", "uint16_t", crc_table_msb(0x1021, 16),
+         "CRC-16/CCITT, polynomial 0x1021 (MSB-first)", None),
+        ("predator_crc16_8408_table", "uint16_t", crc16_8408,
+         "CRC-16 reflected 0x8408 (ISO 15693, ISO 14443-3 A/B)", None),
+        ("predator_crc16_8408_slice", "uint16_t", crc_slices_lsb(crc16_8408),
+         "Slice-by-4 tables 1-3 for reflected 0x8408", "PREDATOR_CRC_SLICE4"),
+        ("predator_crc32_table", "uint32_t", crc32,
+         "CRC-32 reflected 0xEDB88320 (DESFire JAMCRC)", None),
+        ("predator_crc32_slice", "uint32_t", crc_slices_lsb(crc32),
+         "Slice-by-4 tables 1-3 for reflected 0xEDB88320", "PREDATOR_CRC_SLICE4"),
+        ("predator_aes_sbox", "uint8_t", sbox,
+         "AES S-box (FIPS-197 5.1.1)", None),
+        ("predator_aes_inv_sbox", "uint8_t", inv_sbox,
+         "AES inverse S-box (FIPS-197 5.3.2)", None),
+        ("predator_aes_te0", "uint32_t", te0,
+         "AES encryption T-table: SubBytes + MixColumns column", None),
+        ("predator_aes_td0", "uint32_t", td0,
+         "AES decryption T-table: InvSubBytes + InvMixColumns column", None),
+        ("predator_aes_te_rot", "uint32_t", [[rotr32(v, 8 * k) for v in te0] for k in (1, 2, 3)],
+         "Te1-Te3 (Te0 rotated right by 8/16/24 bits)", "PREDATOR_AES_FULL_TABLES"),
+        ("predator_aes_td_rot", "uint32_t", [[rotr32(v, 8 * k) for v in td0] for k in (1, 2, 3)],
+         "Td1-Td3 (Td0 rotated right by 8/16/24 bits)", "PREDATOR_AES_FULL_TABLES"),
+    ]
+
+C_TYPES = {"uint8_t": (1, 2), "uint16_t": (2, 4), "uint32_t": (4, 8)}
+
+def flat(values):
+    return [v for row in values for v in row] if isinstance(values[0], list) else values
+
+def table_crc32(ctype: str, values) -> int:
+    size = C_TYPES[ctype][0]
+    blob = b"".join(v.to_bytes(size, "little") for v in flat(values))
+    return zlib.crc32(blob) & 0xFFFFFFFF
+
+def c_dims(values) -> str:
+    if isinstance(values[0], list):
+        return f"[{len(values)}][{len(values[0])}]"
+    return f"[{len(values)}]"
+
+def c_body(ctype: str, values, indent: str = "    ") -> list:
+    digits = C_TYPES[ctype][1]
+    per_line = 8 if digits == 8 else 12 if digits == 4 else 16
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        lines.append(indent + ", ".join(f"0x{v:0{digits}X}" for v in chunk) + ",")
+    return lines
+
+def write_tables(out_dir: Path):
+    tables = build_tables()
+    banner = "// GENERATED by tools/gen_tables.py - do not edit."
+
+    h = ["#pragma once", "", banner,
+         "// Constant lookup tables; each *_CRC32 is the zlib CRC-32 of the table's",
+         "// little-endian bytes and is checked by tests/predator_tables_tests.c.",
+         "", "#include <stdint.h>", "",
+         "// Slice-by-4 CRC tables (5 KB of .rodata); set to 0 for RAM-tight builds",
+         "#ifndef PREDATOR_CRC_SLICE4", "#define PREDATOR_CRC_SLICE4 1", "#endif", "",
+         "// Rotated AES T-tables (6 KB); 0 keeps only Te0/Td0 (2 KB) and rotates in code",
+         "#ifndef PREDATOR_AES_FULL_TABLES", "#define PREDATOR_AES_FULL_TABLES 0", "#endif", "",
+         "#ifdef __cplusplus", 'extern "C" {', "#endif", ""]
+    c = ['#include "predator_tables.h"', "", banner, ""]
+    for name, ctype, values, desc, guard in tables:
+        macro = name.upper().replace("_TABLE", "") + "_CRC32"
+        if guard:
+            h.append(f"#if {guard}")
+            c.append(f"#if {guard}")
+        h.append(f"// {desc}")
+        h.append(f"extern const {ctype} {name}{c_dims(values)};")
+        h.append(f"#define {macro} 0x{table_crc32(ctype, values):08X}")
+        if guard:
+            h.append("#endif")
+        h.append("")
+        c.append(f"const {ctype} {name}{c_dims(values)} = {{")
+        if isinstance(values[0], list):
+            for row in values:
+                c.append("    {")
+                c.extend(c_body(ctype, row, "        "))
+                c.append("    },")
+        else:
+            c.extend(c_body(ctype, values))
+        c.append("};")
+        if guard:
+            c.append("#endif")
+        c.append("")
+    h += ["#ifdef __cplusplus", "}", "#endif"]
+
+    (out_dir / "predator_tables.h").write_text("\n".join(h) + "\n", encoding="utf-8")
+    (out_dir / "predator_tables.c").write_text("\n".join(c), encoding="utf-8")
+    return tables
+
+def main():
+    if len(sys.argv) != 2:
+        print("Usage: gen_tables.py <helpers_dir>")
+        sys.exit(1)
+    tables = write_tables(Path(sys.argv[1]))
+    total = sum(C_TYPES[t][0] * len(flat(v)) for _, t, v, _, _ in tables)
+    print(f"Wrote {len(tables)} tables ({total} bytes) to {sys.argv[1]}")
+
+if __name__ == "__main__":
+    main()
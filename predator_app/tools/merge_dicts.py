@@ -0,0 +1,156 @@
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+# ---------------------------------------------------------------------------
+# Binary key dictionary (.pdict) - read by helpers/predator_dict.c
+#
+# Layout (little-endian):
+#   header  DICT_HEADER, 16 bytes: magic, version, key width, key kind,
+#           record count, reserved
+#   records count * (key[width], u8 priority), unique keys ordered by
+#           descending priority (source order kept within a priority)
+#
+# Integer dictionaries (kind u32/u64) store keys little-endian so the
+# firmware can copy them straight into native integers.
+#
+# Usage:
+#   merge_dicts.py em4305 -o em4305.pdict --builtin --user site.txt:250
+# Copy the result to /ext/apps_data/predator/dicts/<name>.pdict; it then
+# replaces the built-in table with no rebuild.
+# ---------------------------------------------------------------------------
+
+DICT_MAGIC = b"PDCT"
+DICT_VERSION = 1
+DICT_HEADER = struct.Struct("<4sHBBII")
+
+KIND_BYTES, KIND_U32, KIND_U64 = 0, 1, 2
+
+BUILTIN_PRIORITY = 100
+USER_PRIORITY = 200
+
+KEYS_C = Path(__file__).resolve().parent.parent / "helpers" / "predator_crypto_keys.c"
+
+# name -> (C array in predator_crypto_keys.c, key width, kind).
+# Names match predator_keys_name() in predator_crypto_keys.c.
+DICTS = {
+    "em4305": ("EM4305_PASSWORDS", 4, KIND_U32),
+    "iso15693": ("ISO15693_SLIX_PASSWORDS", 4, KIND_U32),
+    "mifare": ("MIFARE_KEYS", 6, KIND_BYTES),
+    "iclass": ("HID_ICLASS_KEYS", 8, KIND_BYTES),
+    "keeloq": ("KEELOQ_KEYS", 8, KIND_U64),
+    "keeloq_seeds": ("KEELOQ_SEEDS", 4, KIND_U32),
+    "hitag2": ("HITAG2_KEYS", 6, KIND_BYTES),
+    "aes128": ("AES128_SMART_KEYS", 16, KIND_BYTES),
+    "rolling_challenges": ("ROLLING_CODE_CHALLENGES", 4, KIND_U32),
+    "legic": ("LEGIC_KEYS", 16, KIND_BYTES),
+    "felica": ("FELICA_KEYS", 16, KIND_BYTES),
+    "calypso": ("CALYPSO_KEYS", 16, KIND_BYTES),
+}
+
+def encode_key(value, width: int, kind: int) -> bytes:
+    if kind == KIND_BYTES:
+        if len(value) != width:
+            raise ValueError(f"expected {width}-byte key, got {len(value)}")
+        return bytes(value)
+    if value < 0 or value >= 1 << (width * 8):
+        raise ValueError(f"key 0x{value:X} does not fit in {width} bytes")
+    return value.to_bytes(width, "little")
+
+def read_builtin(name: str):
+    array, width, kind = DICTS[name]
+    src = KEYS_C.read_text(encoding="utf-8")
+    m = re.search(re.escape(array) + r"\[\]\s*(?:\[\d+\])?\s*=\s*\{(.*?)\n\};", src, re.S)
+    if not m:
+        raise ValueError(f"{array} not found in {KEYS_C}")
+    body = re.sub(r"//[^\n]*|/\*.*?\*/", "", m.group(1), flags=re.S)
+    if kind == KIND_BYTES:
+        groups = re.findall(r"\{([^}]*)\}", body)
+        keys = [[int(x, 0) for x in re.findall(r"0x[0-9A-Fa-f]+|\b\d+\b", g)] for g in groups]
+    else:
+        keys = [int(x.rstrip("ULul"), 0) for x in re.findall(r"0x[0-9A-Fa-f]+[ULul]*|\b\d+[ULul]*\b", body)]
+    return [encode_key(k, width, kind) for k in keys]
+
+def read_user(path: Path, width: int, kind: int, default_priority: int):
+    # One key per line: hex ("51243648", "0x51243648", "A0 A1 A2 A3 A4 A5"),
+    # optionally followed by ",priority". '#' starts a comment.
+    entries = []
+    for lineno, line in enumerate(path.read_text(encoding="utf-8").splitlines(), 1):
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        key_text, _, prio_text = line.partition(",")
+        priority = int(prio_text) if prio_text.strip() else default_priority
+        if not 0 <= priority <= 255:
+            raise ValueError(f"{path}:{lineno}: priority must be 0-255")
+        digits = key_text.strip().lower().replace("0x", "").replace(" ", "").replace(":", "")
+        try:
+            if kind == KIND_BYTES:
+                key = encode_key(list(bytes.fromhex(digits)), width, kind)
+            else:
+                key = encode_key(int(digits, 16), width, kind)
+        except ValueError as e:
+            raise ValueError(f"{path}:{lineno}: {e}")
+        entries.append((key, priority))
+    return entries
+
+def merge(sources):
+    # sources: iterable of (key, priority) in source order. Duplicates keep
+    # their highest priority and first position.
+    best = {}
+    order = {}
+    for pos, (key, priority) in enumerate(sources):
+        if key not in best:
+            order[key] = pos
+            best[key] = priority
+        elif priority > best[key]:
+            best[key] = priority
+    return sorted(best.items(), key=lambda kv: (-kv[1], order[kv[0]]))
+
+def write_dict(out_path: Path, width: int, kind: int, entries):
+    blob = bytearray(DICT_HEADER.pack(DICT_MAGIC, DICT_VERSION, width, kind, len(entries), 0))
+    for key, priority in entries:
+        blob += key + bytes([priority])
+    out_path.parent.mkdir(parents=True, exist_ok=True)
+    out_path.write_bytes(blob)
+    return len(blob)
+
+def parse_user_spec(spec):
+    """FILE[:PRIORITY] -> (path, priority); the path itself may contain ':'"""
+    path, sep, prio = spec.rpartition(":")
+    if sep and prio.lstrip("-").isdigit():
+        return path, int(prio)
+    return spec, USER_PRIORITY
+
+def main():
+    parser = argparse.ArgumentParser(description="Build a deduplicated .pdict key dictionary")
+    parser.add_argument("name", choices=sorted(DICTS), help="dictionary name")
+    parser.add_argument("-o", "--output", required=True, help="output .pdict path")
+    parser.add_argument("--builtin", action="store_true",
+                        help=f"include the built-in table (priority {BUILTIN_PRIORITY})")
+    parser.add_argument("--builtin-priority", type=int, default=BUILTIN_PRIORITY)
+    parser.add_argument("--user", action="append", default=[], metavar="FILE[:PRIORITY]",
+                        help=f"user key file (default priority {USER_PRIORITY}); repeatable")
+    args = parser.parse_args()
+
+    _, width, kind = DICTS[args.name]
+    sources = []
+    # User files first: on equal priority they keep their position ahead of built-ins
+    for spec in args.user:
+        path, prio = parse_user_spec(spec)
+        sources += read_user(Path(path), width, kind, prio)
+    if args.builtin:
+        sources += [(key, args.builtin_priority) for key in read_builtin(args.name)]
+    if not sources:
+        print("Nothing to merge: pass --builtin and/or --user")
+        sys.exit(1)
+
+    entries = merge(sources)
+    size = write_dict(Path(args.output), width, kind, entries)
+    dropped = len(sources) - len(entries)
+    print(f"Wrote {len(entries)} keys ({dropped} duplicates dropped, {size} bytes) to {args.output}")
+
+if __name__ == "__main__":
+    main()